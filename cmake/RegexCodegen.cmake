@@ -0,0 +1,26 @@
+# regex_generate_matcher(<name> IMAGE <image> [NAMESPACE <namespace>] [OUTPUT_DIR <dir>])
+#
+# Generate <dir>/<name>.hpp from a DFA matrix image saved by DFAMatrix::Save, regenerating it whenever
+# the image or the generator changes. The path of the header is stored in <name>_HEADER; add it to
+# the sources of a target and put <dir> on its include path.
+function(regex_generate_matcher NAME)
+    cmake_parse_arguments(ARG "" "IMAGE;NAMESPACE;OUTPUT_DIR" "" ${ARGN})
+    if(NOT ARG_IMAGE)
+        message(FATAL_ERROR "regex_generate_matcher: IMAGE is required")
+    endif()
+    if(NOT ARG_NAMESPACE)
+        set(ARG_NAMESPACE generated)
+    endif()
+    if(NOT ARG_OUTPUT_DIR)
+        set(ARG_OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/generated)
+    endif()
+    set(HEADER ${ARG_OUTPUT_DIR}/${NAME}.hpp)
+    add_custom_command(
+        OUTPUT ${HEADER}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${ARG_OUTPUT_DIR}
+        COMMAND RegexCodegen ${ARG_IMAGE} ${NAME} ${HEADER} ${ARG_NAMESPACE}
+        DEPENDS RegexCodegen ${ARG_IMAGE}
+        COMMENT "Generating matcher ${NAME}"
+        VERBATIM)
+    set(${NAME}_HEADER ${HEADER} PARENT_SCOPE)
+endfunction()
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef CAPTURE_MATCHER_HPP
+#define CAPTURE_MATCHER_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CaptureProgram.hpp"
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    /**
+     * CaptureMatcher
+     *
+     * Reports capture groups in two phases. The compiled DFA finds the span of the match, then a Pike VM
+     * runs the capture program over that span only, keeping one thread per vertex in priority order, so
+     * the cost of the groups grows with the length of the match instead of the length of the input. The
+     * groups are the same as the ones of TaggedDFA, and the matches the same as the ones of the DFA.
+     */
+    class CaptureMatcher
+    {
+    public:
+        /* the threads and tags of Fill, which a caller filling many spans keeps across the calls so that
+           they are only allocated once */
+        struct FillBuffers
+        {
+            /* an entry either visits a vertex, or restores a tag once the vertices after it are visited */
+            struct Entry
+            {
+                StateID vertex;
+                int tag;
+                int32_t value;
+            };
+            vector<Entry> stack;
+            vector<StateID> current, next;
+            vector<int32_t> currentSlots, nextSlots;
+            vector<int32_t> slots;
+            /* the last position at which each vertex got a thread */
+            vector<size_t> marks;
+        };
+
+        explicit CaptureMatcher(const RegularExpression::Ptr &exp);
+
+        size_t GroupCount() const
+        {
+            return program.groupCount;
+        }
+
+        bool Match(const u32string &str, vector<Submatch> &groups) const;
+        bool FullMatch(const u32string &str, vector<Submatch> &groups) const;
+        bool Search(const u32string &str, vector<Submatch> &groups) const;
+        bool Fill(const u32string &str, size_t begin, size_t end, vector<Submatch> &groups) const;
+        bool Fill(const u32string &str, size_t begin, size_t end, vector<Submatch> &groups,
+                  FillBuffers &buffers) const;
+
+        /* the DFA finding the spans, which can be iterated with FindIter */
+        const DFAMatrix &Matrix() const
+        {
+            return matrix;
+        }
+
+    private:
+        DFAMatrix matrix;
+        CaptureProgram program;
+    };
+} // namespace regex
+
+#endif // CAPTURE_MATCHER_HPP
\ No newline at end of file
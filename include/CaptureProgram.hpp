@@ -0,0 +1,85 @@
+#ifndef CAPTURE_PROGRAM_HPP
+#define CAPTURE_PROGRAM_HPP
+#include <cstdint>
+#include <vector>
+
+#include "CharClass.hpp"
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::vector;
+
+    /**
+     * Submatch
+     *
+     * The span [begin, end) of a capture group as offsets into the searched string,
+     * both -1 if the group did not take part in the match.
+     */
+    struct Submatch
+    {
+        int begin;
+        int end;
+    };
+
+    enum class CaptureVertexKind
+    {
+        Epsilon,
+        Range,
+        Tag
+    };
+
+    /**
+     * CaptureVertex
+     *
+     * A vertex of a capture program. "Range" vertices consume one character in "charClass" and move to
+     * next[0], "Tag" vertices record the position in "tag" and move to next[0]. The successors of an
+     * "Epsilon" vertex are ordered by priority, the first one being preferred.
+     */
+    struct CaptureVertex
+    {
+        CaptureVertexKind kind;
+        CharClass charClass;
+        int tag;
+        vector<StateID> next;
+    };
+
+    /* a range of characters which no range of a program separates, and its column */
+    struct CaptureColumn
+    {
+        char32_t lower;
+        char32_t upper;
+        int32_t column;
+    };
+
+    /**
+     * CaptureProgram
+     *
+     * The prioritized Thompson NFA of an expression with capture groups, shared by the matchers which
+     * report submatches. Group g opens with tag 2g - 2 and closes with tag 2g - 1. Following the first
+     * successors first gives the leftmost-greedy order of the paths: alternatives are tried from the left
+     * and repetitions take as many iterations as they can. Expressions cannot use assertions.
+     */
+    class CaptureProgram
+    {
+    public:
+        vector<CaptureVertex> vertices;
+        StateID startVertex;
+        /* the final vertex, an epsilon vertex without successors */
+        StateID endVertex;
+        /* the number of groups, group 0 being the whole match */
+        size_t groupCount;
+
+        explicit CaptureProgram(const RegularExpression::Ptr &exp);
+
+        vector<CaptureColumn> SplitColumns(vector<vector<int32_t>> &vertexColumns) const;
+
+        size_t TagCount() const
+        {
+            return 2 * (groupCount - 1);
+        }
+    };
+} // namespace regex
+
+#endif // CAPTURE_PROGRAM_HPP
\ No newline at end of file
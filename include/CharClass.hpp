@@ -0,0 +1,79 @@
+#ifndef CHAR_CLASS_HPP
+#define CHAR_CLASS_HPP
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "DFA.hpp"
+
+namespace regex
+{
+    using std::vector;
+
+    /**
+     * CharClass
+     *
+     * A set of code points stored as sorted, disjoint and non-adjacent character ranges.
+     * The set operations keep this normal form, so two classes holding the same code
+     * points always have the same ranges.
+     */
+    class CharClass
+    {
+    public:
+        static constexpr char32_t MAX_CODE_POINT = 0x10FFFF;
+
+        CharClass() = default;
+        CharClass(char32_t lower, char32_t upper);
+        CharClass(std::initializer_list<std::pair<char32_t, char32_t>> ranges);
+        explicit CharClass(vector<UnicodeRange> ranges);
+
+        static CharClass Any();
+
+        void AddRange(char32_t lower, char32_t upper);
+
+        CharClass Union(const CharClass &other) const;
+        CharClass Intersect(const CharClass &other) const;
+        CharClass Difference(const CharClass &other) const;
+        CharClass Negate() const;
+        CharClass FoldCase() const;
+
+        bool Contains(char32_t c) const;
+        bool IsEmpty() const
+        {
+            return ranges.empty();
+        }
+        const vector<UnicodeRange> &Ranges() const
+        {
+            return ranges;
+        }
+
+    private:
+        vector<UnicodeRange> ranges;
+
+        void Normalize();
+    };
+
+    inline bool operator==(const CharClass &x, const CharClass &y)
+    {
+        return x.Ranges() == y.Ranges();
+    }
+    inline bool operator!=(const CharClass &x, const CharClass &y)
+    {
+        return !(x == y);
+    }
+
+    struct CharClassHash
+    {
+        size_t operator()(const CharClass &charClass) const noexcept
+        {
+            size_t hash = 1;
+            for (const auto &range : charClass.Ranges())
+            {
+                hash = hash * 31 + UnicodeRangeHash()(range);
+            }
+            return hash;
+        }
+    };
+} // namespace regex
+
+#endif // CHAR_CLASS_HPP
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef CODE_GENERATOR_HPP
+#define CODE_GENERATOR_HPP
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DFA.hpp"
+#include "DFAImage.hpp"
+
+namespace regex
+{
+    using std::string;
+    using std::vector;
+
+    /**
+     * CppCodeGenerator
+     *
+     * Emits a self-contained C++ header matching the same language as a compiled DFA matrix.
+     * Every state becomes a case of a switch and the class of a character is found by a balanced
+     * tree of comparisons, so the generated matcher has no tables and no dependency on this library.
+     * The generated struct has the same FullMatch, Search and Match functions as DFAMatrix, over
+     * [begin, end) ranges of char32_t. The assertions of the matrix come with a Context function and
+     * the start state of each context. Search runs the search states to the end of the match and a
+     * second struct, generated from the reversed matrix, back to its start; a matrix without search
+     * states tries an anchored match at every start instead, in quadratic time.
+     */
+    class CppCodeGenerator
+    {
+    public:
+        CppCodeGenerator(const DFAMatrix &matrix, string name, string nameSpace = "generated");
+
+        string Generate() const;
+
+    private:
+        /* a maximal run of code points [lower, next lower) in the same column, -1 for no column */
+        struct Segment
+        {
+            char32_t lower;
+            int column;
+        };
+
+        DFAMatrix matrix;
+        string name;
+        string nameSpace;
+        const DFAImageHeader *header;
+        vector<Segment> segments;
+
+        int Next(size_t state, int column) const;
+        uint8_t Accepting(size_t state) const;
+        bool AcceptsAtEnd(size_t state) const;
+        bool HasSearchStates() const;
+        void GenerateStruct(std::ostringstream &out, bool backward) const;
+        void GenerateSearch(std::ostringstream &out, bool contexts) const;
+        void GenerateColumnTree(std::ostringstream &out, size_t first, size_t last, int indent) const;
+        void GenerateState(std::ostringstream &out, size_t state, bool backward) const;
+    };
+} // namespace regex
+
+#endif // CODE_GENERATOR_HPP
\ No newline at end of file
@@ -0,0 +1,136 @@
+#ifndef COUNTING_MATCHER_HPP
+#define COUNTING_MATCHER_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CharClass.hpp"
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    enum class CountingStateKind
+    {
+        Epsilon,
+        Range,
+        LineBegin,
+        LineEnd,
+        WordBoundary,
+        NotWordBoundary,
+        Counter
+    };
+
+    /**
+     * CountingState
+     *
+     * A state of a Thompson NFA. "Range" states consume one character in "charClass" and move to next[0].
+     * "Counter" states stand for a whole bounded repetition of a single character class.
+     */
+    struct CountingState
+    {
+        CountingStateKind kind;
+        CharClass charClass;
+        vector<StateID> next;
+        int counter;
+    };
+
+    /**
+     * Counter
+     *
+     * x{atLeast,atMost} where x is a single character class. The active repetition counts are kept
+     * in a bit vector window instead of being unrolled into states: bit i is set if a thread has
+     * consumed i + 1 characters of the repetition. Without an upper bound, the window saturates at
+     * max(atLeast, 1) characters.
+     */
+    struct Counter
+    {
+        CharClass charClass;
+        int atLeast;
+        int atMost;
+        StateID exit;
+        size_t windowOffset;
+        size_t windowWords;
+        int windowBits;
+    };
+
+    /**
+     * CountingMatcher
+     *
+     * Matches a regular expression by simulating its NFA, with bounded repetitions of a single
+     * character class executed as counters. Expressions like x{1000} or .{0,4096} need a constant
+     * number of states instead of thousands of unrolled states and a potentially huge DFA.
+     */
+    class CountingMatcher
+    {
+    public:
+        static constexpr int DEFAULT_THRESHOLD = 32;
+
+        explicit CountingMatcher(const RegularExpression::Ptr &exp, int threshold = DEFAULT_THRESHOLD);
+
+        bool FullMatch(const u32string &str) const;
+        u32string::const_iterator Search(u32string::const_iterator strBegin, u32string::const_iterator strEnd) const;
+        int Match(u32string::const_iterator strBegin, u32string::const_iterator strEnd, bool greedyMode) const;
+
+        size_t StateCount() const
+        {
+            return states.size();
+        }
+        size_t CounterCount() const
+        {
+            return counters.size();
+        }
+
+        static bool HasCountedRepetition(const RegularExpression::Ptr &exp, int threshold = DEFAULT_THRESHOLD);
+
+    private:
+        vector<CountingState> states;
+        vector<Counter> counters;
+        size_t windowSize;
+        StateID startState;
+        StateID acceptState;
+
+        friend class CountingProgramBuilder;
+
+        class Threads
+        {
+        public:
+            vector<StateID> list;
+            vector<uint32_t> marks;
+            uint32_t generation;
+            vector<uint64_t> windows;
+            vector<bool> entered;
+
+            Threads(size_t stateCount, size_t windowSize, size_t counterCount);
+            void Clear();
+            bool IsEmpty() const;
+        };
+
+        /* the thread sets of a simulation, allocated once per call of Search or Match */
+        struct RunBuffers
+        {
+            Threads current;
+            Threads next;
+            vector<StateID> stack;
+
+            RunBuffers(size_t stateCount, size_t windowSize, size_t counterCount);
+        };
+
+        int MatchFrom(u32string::const_iterator textBegin, u32string::const_iterator strBegin,
+                      u32string::const_iterator strEnd, bool greedyMode, RunBuffers &buffers) const;
+        int FirstMatchEnd(u32string::const_iterator strBegin, u32string::const_iterator strEnd,
+                          RunBuffers &buffers) const;
+        void AddThread(Threads &threads, StateID state, u32string::const_iterator i,
+                       u32string::const_iterator textBegin, u32string::const_iterator strEnd,
+                       vector<StateID> &stack) const;
+        void Step(const Threads &current, Threads &next, char32_t c, u32string::const_iterator i,
+                  u32string::const_iterator textBegin, u32string::const_iterator strEnd,
+                  vector<StateID> &stack) const;
+        bool IsAccepting(const Threads &threads) const;
+    };
+} // namespace regex
+
+#endif // COUNTING_MATCHER_HPP
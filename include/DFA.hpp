@@ -1,11 +1,15 @@
 #ifndef DFA_HPP
 #define DFA_HPP
+#include <cstdint>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "DFAImage.hpp"
+
 namespace regex
 {
     using std::u32string;
@@ -19,9 +23,76 @@ namespace regex
         Epsilon,
         LineBegin,
         LineEnd,
-        CharacterRange
+        CharacterRange,
+        WordBoundary,
+        NotWordBoundary
+    };
+
+    /**
+     * CharacterContext
+     *
+     * What lies on one side of a position, which is all the assertions need to know: the edge of the
+     * text, a newline, a word character ([0-9A-Za-z_]) or any other character. The compiled DFA keeps
+     * the context behind the current position in its states, and decides its matches by the context
+     * ahead.
+     */
+    enum class CharacterContext
+    {
+        TextEdge,
+        Newline,
+        Word,
+        Other
     };
 
+    inline CharacterContext ContextOf(char32_t c)
+    {
+        if (c == U'\n')
+        {
+            return CharacterContext::Newline;
+        }
+        else if ((c >= U'0' && c <= U'9') || (c >= U'A' && c <= U'Z') || (c >= U'a' && c <= U'z') || c == U'_')
+        {
+            return CharacterContext::Word;
+        }
+        else
+        {
+            return CharacterContext::Other;
+        }
+    }
+
+    /**
+     * AssertionHolds
+     *
+     * "^" holds after the start of the text or a newline, "$" before the end of the text or a newline,
+     * and "\b" between a word character and anything else.
+     *
+     * @param  {RangeType} type               : the assertion
+     * @param  {CharacterContext} behind      : the context before the position
+     * @param  {CharacterContext} ahead       : the context after the position
+     * @return {bool}                         : whether the assertion holds at the position
+     */
+    inline bool AssertionHolds(RangeType type, CharacterContext behind, CharacterContext ahead)
+    {
+        switch (type)
+        {
+        case RangeType::LineBegin:
+            return behind == CharacterContext::TextEdge || behind == CharacterContext::Newline;
+        case RangeType::LineEnd:
+            return ahead == CharacterContext::TextEdge || ahead == CharacterContext::Newline;
+        case RangeType::WordBoundary:
+            return (behind == CharacterContext::Word) != (ahead == CharacterContext::Word);
+        case RangeType::NotWordBoundary:
+            return (behind == CharacterContext::Word) == (ahead == CharacterContext::Word);
+        default:
+            return false;
+        }
+    }
+
+    inline bool IsAssertion(RangeType type)
+    {
+        return type != RangeType::Epsilon && type != RangeType::CharacterRange;
+    }
+
     struct UnicodeRange
     {
         RangeType rangeType;
@@ -69,21 +140,27 @@ namespace regex
     {
         return x.rangeType == y.rangeType && x.lower == y.lower && x.upper == y.upper;
     }
+    /**
+     * UnicodePatterns
+     *
+     * Numbers the patterns of an automaton. Several disjoint ranges may share a number, when they
+     * form one class of characters which always lead to the same states.
+     */
     class UnicodePatterns
     {
     public:
         unordered_map<UnicodeRange, int, UnicodeRangeHash> patternToID;
-        unordered_map<int, UnicodeRange> IDToPattern;
+        unordered_map<int, vector<UnicodeRange>> IDToPatterns;
 
         void Add(UnicodeRange pattern, int id)
         {
             patternToID[pattern] = id;
-            IDToPattern[id] = pattern;
+            IDToPatterns[id].push_back(pattern);
         }
 
         size_t Size() const
         {
-            return patternToID.size();
+            return IDToPatterns.size();
         }
 
         int GetIDByPattern(const UnicodeRange &pattern) const
@@ -98,7 +175,12 @@ namespace regex
 
         const UnicodeRange &GetPatternByID(int id) const
         {
-            return IDToPattern.at(id);
+            return IDToPatterns.at(id).front();
+        }
+
+        const vector<UnicodeRange> &GetPatternsByID(int id) const
+        {
+            return IDToPatterns.at(id);
         }
     };
 
@@ -192,25 +274,138 @@ namespace regex
             : index{index}, nextStates{nextStates} {}
     };
 
+    /**
+     * DFAMatrix
+     *
+     * A compiled DFA. All of its data lives in one position-independent binary image (see
+     * DFAImage.hpp), which is either owned by the matrix, or mapped from a file and used in
+     * place. Copies of a matrix share the image.
+     *
+     * Assertions are compiled into the states and cost nothing per character: a state knows the
+     * context behind the current position, the context before the start of a match picks one of the
+     * start states, and a state accepts depending on the context ahead. Match takes the start of the
+     * range as the start of the text, while Search and the other scans look at the character before
+     * each start.
+     */
     class DFAMatrix
     {
-    private:
-        vector<vector<int>> matrix;
-        UnicodePatterns patterns;
-        unordered_set<StateID> endStates;
-
     public:
         DFAMatrix() = default;
         explicit DFAMatrix(const DFA &dfaGraph);
 
+        static DFAMatrix FromContents(DFAImageContents contents);
+        static DFAMatrix FromImage(const void *data, size_t size);
+        static DFAMatrix FromImage(vector<uint8_t> image);
+        static DFAMatrix Load(const std::string &path);
+        void Save(const std::string &path, const std::string &metadata = "") const;
+
         bool FullMatch(const u32string &str) const;
         u32string::const_iterator Search(u32string::const_iterator strBegin, u32string::const_iterator strEnd) const;
         int Match(u32string::const_iterator strBegin, u32string::const_iterator strEnd, bool greedyMode) const;
+        bool IsMatch(const u32string &str) const;
+        size_t Count(const u32string &str) const;
+
+        size_t StateCount() const
+        {
+            return stateCount;
+        }
+        /* the states reached from the start states, which come first; the search states follow */
+        size_t AnchoredStateCount() const
+        {
+            return anchoredStateCount;
+        }
+        size_t ColumnCount() const
+        {
+            return columnCount;
+        }
+        /* true if the expression uses assertions, so that matches depend on the characters around them */
+        bool HasAssertions() const
+        {
+            return assertionTypes != 0;
+        }
+        const uint8_t *ImageData() const
+        {
+            return image;
+        }
+        size_t ImageSize() const;
+        std::string Metadata() const;
+
+        /* stepping through the DFA one character at a time, for the scanners built on top of it: a scan
+           starts in the start state of the context behind its first position, moves along the column of
+           each character (-1 once the DFA is dead), and has a match wherever the state accepts the
+           context ahead */
+        int StartState(CharacterContext behind) const
+        {
+            return startStates[static_cast<int>(behind)];
+        }
+        int StartState(u32string::const_iterator textBegin, u32string::const_iterator position) const
+        {
+            return StartState(position == textBegin ? CharacterContext::TextEdge : ContextOf(position[-1]));
+        }
+        /* the start of a scan for a match anywhere ahead, or -1 if the matrix has no search states: the
+           scan accepts at the ends of the leftmost matches, so that MatchFrom gives the end of the
+           leftmost-longest match in greedy mode, and the end of the first match otherwise */
+        int SearchStartState(CharacterContext behind) const
+        {
+            return searchStartStates == nullptr ? -1 : searchStartStates[static_cast<int>(behind)];
+        }
+        int Next(int state, int column) const
+        {
+            return transitions[static_cast<size_t>(state) * columnCount + column];
+        }
+        bool Accepts(int state, CharacterContext ahead) const
+        {
+            return (accepting[state] >> static_cast<int>(ahead)) & 1;
+        }
+        int CharacterColumn(char32_t c) const;
+        int MatchFrom(int state, u32string::const_iterator strBegin, u32string::const_iterator strEnd,
+                      bool greedyMode) const;
+        /* the matrix of the reversed expression, with the same columns, or null if the image has none */
+        const DFAMatrix *Reversed() const
+        {
+            return reversed.get();
+        }
+        int MatchBackward(u32string::const_iterator textBegin, u32string::const_iterator strBegin,
+                          u32string::const_iterator strEnd, u32string::const_iterator textEnd) const;
+        bool StartsWithoutCharacter() const;
+        bool CanStartWith(char32_t c) const;
 
     private:
-        bool MatchPattern(int &state, const UnicodeRange &pattern, char32_t c, u32string::const_iterator &i, size_t j,
-                          u32string::const_iterator strBegin, u32string::const_iterator strEnd) const;
+        static constexpr uint16_t NO_COLUMN = UINT16_MAX;
+        static constexpr unsigned BLOCK_BITS = 8;
+        static constexpr char32_t BLOCK_MASK = 0xFF;
+        static constexpr char32_t MAX_CHARACTER = 0x10FFFF;
+
+        /* keeps the image alive: an owned buffer or a file mapping, empty for a borrowed image */
+        std::shared_ptr<const void> owner;
+        const uint8_t *image = nullptr;
+        size_t stateCount = 0;
+        size_t anchoredStateCount = 0;
+        size_t columnCount = 0;
+        const int32_t *transitions = nullptr;
+        /* the contexts ahead in which each state accepts, as bits */
+        const uint8_t *accepting = nullptr;
+        /* the start state of each context behind, and the same for searching */
+        const int32_t *startStates = nullptr;
+        const int32_t *searchStartStates = nullptr;
+        uint32_t assertionTypes = 0;
+        /* the character ranges sorted by their lower bounds, with their columns */
+        const DFAImageRange *ranges = nullptr;
+        size_t rangeCount = 0;
+        /* two-stage map from a character c to the column of its class: blockIndices[c >> 8] is the
+           block of 256 columns holding it. Null if there are too many columns for 16 bits. */
+        const uint16_t *blockIndices = nullptr;
+        const uint16_t *blockColumns = nullptr;
+        /* the matrix stored in the reverse section of the image, sharing its owner */
+        std::shared_ptr<const DFAMatrix> reversed;
+
+        void Attach(std::shared_ptr<const void> owner, const void *data, size_t size);
         bool IsEndState(int state) const;
+        static void MarkUniversalStates(DFAImageContents &contents);
+        bool IsUniversal(int state) const
+        {
+            return (accepting[state] & DFA_IMAGE_UNIVERSAL) != 0;
+        }
     };
 
     DFA DFATableRowsToDFAGraph(
@@ -0,0 +1,144 @@
+#ifndef DFA_IMAGE_HPP
+#define DFA_IMAGE_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace regex
+{
+    using std::string;
+    using std::vector;
+
+    static constexpr uint32_t DFA_IMAGE_MAGIC = 0x41464452; // "RDFA"
+    static constexpr uint32_t DFA_IMAGE_VERSION = 5;
+    static constexpr uint32_t DFA_IMAGE_BYTE_ORDER = 0x01020304;
+    static constexpr size_t DFA_IMAGE_ALIGNMENT = 8;
+    static constexpr size_t DFA_IMAGE_BLOCK_SIZE = 256;
+    static constexpr size_t DFA_IMAGE_BLOCK_INDEX_COUNT = 0x110000 / DFA_IMAGE_BLOCK_SIZE;
+    /* the number of contexts around a position: the edge of the text, a newline, a word character, another */
+    static constexpr size_t DFA_IMAGE_CONTEXT_COUNT = 4;
+    /* the accepting bits of a state which accepts whatever comes next */
+    static constexpr uint8_t DFA_IMAGE_ALWAYS_ACCEPTING = (1 << DFA_IMAGE_CONTEXT_COUNT) - 1;
+    /* the accepting bit of a state from which every continuation of the string is accepted */
+    static constexpr uint8_t DFA_IMAGE_UNIVERSAL = 1 << 7;
+
+    /**
+     * DFAImageHeader
+     *
+     * The header of the binary image of a compiled DFA matrix. The sections follow the header in
+     * the order of the fields below. All the offsets are relative to the start of the image and
+     * aligned to DFA_IMAGE_ALIGNMENT bytes, so an image can be mapped at any address and used in
+     * place. Integers are stored in the byte order of the machine which wrote the image.
+     *
+     * "startStates" holds the start state after each context, and "assertionTypes" has the bit
+     * 1 << t set for every RangeType t of the assertions compiled into the states; both are 0 for
+     * expressions without assertions.
+     *
+     * The states reached from the start states come first, "anchoredStateCount" of them. The search
+     * states follow: they find the leftmost-longest match starting at or after a position in one pass,
+     * from the state of "searchStartStates" picked by the context behind that position. An image
+     * without search states has -1 there, when they were not built or grew too many. "reserved" is 0.
+     *
+     * An image may hold the image of the reversed expression, with the same columns, which reads a match
+     * backwards from its end to find its start.
+     *
+     * transitions  : int32_t[stateCount * columnCount], the next state, or -1 if there is no transition
+     * accepting    : uint8_t[stateCount], the bit 1 << c is set if the state accepts before the context c,
+     *                and DFA_IMAGE_UNIVERSAL if it accepts whatever follows
+     * ranges       : DFAImageRange[rangeCount], the character ranges sorted by their lower bounds
+     * blockIndices : uint16_t[DFA_IMAGE_BLOCK_INDEX_COUNT], the block of each 256 code points, if blockCount > 0
+     * blockColumns : uint16_t[blockCount * DFA_IMAGE_BLOCK_SIZE], the column of every code point of a block,
+     *                or UINT16_MAX
+     * reverse      : reverseSize bytes, the image of the reversed expression, if reverseSize > 0
+     * metadata     : metadataSize bytes left to the user, always the last section
+     */
+    struct DFAImageHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t stateCount;
+        uint32_t columnCount;
+        uint32_t rangeCount;
+        uint32_t assertionTypes;
+        uint32_t blockCount;
+        uint32_t anchoredStateCount;
+        uint32_t reserved;
+        int32_t startStates[DFA_IMAGE_CONTEXT_COUNT];
+        int32_t searchStartStates[DFA_IMAGE_CONTEXT_COUNT];
+        uint64_t transitionsOffset;
+        uint64_t acceptingOffset;
+        uint64_t rangesOffset;
+        uint64_t blockIndicesOffset;
+        uint64_t blockColumnsOffset;
+        uint64_t reverseOffset;
+        uint64_t reverseSize;
+        uint64_t metadataOffset;
+        uint64_t metadataSize;
+        uint64_t imageSize;
+    };
+
+    struct DFAImageRange
+    {
+        uint32_t lower;
+        uint32_t upper;
+        int32_t column;
+    };
+
+    /**
+     * FindRangeColumn
+     *
+     * The binary search for the range holding a character, shared by the matchers keeping their classes as
+     * ranges with a "lower", an "upper" and a "column".
+     *
+     * @param  {Range*} ranges  : the ranges, sorted by their lower bounds
+     * @param  {size_t} count   : the number of ranges
+     * @param  {char32_t} c     : a character
+     * @return {int32_t}        : the column of the range holding c, or -1 if none does
+     */
+    template <typename Range>
+    int32_t FindRangeColumn(const Range *ranges, size_t count, char32_t c)
+    {
+        const Range *end = ranges + count;
+        const Range *it =
+            std::upper_bound(ranges, end, c, [](char32_t c, const Range &range) { return c < range.lower; });
+        if (it != ranges && (it - 1)->upper >= c)
+        {
+            return (it - 1)->column;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+
+    /**
+     * DFAImageContents
+     *
+     * The sections of an image before they are laid out.
+     */
+    struct DFAImageContents
+    {
+        uint32_t stateCount = 0;
+        uint32_t columnCount = 0;
+        uint32_t assertionTypes = 0;
+        uint32_t anchoredStateCount = 0;
+        int32_t startStates[DFA_IMAGE_CONTEXT_COUNT] = {};
+        int32_t searchStartStates[DFA_IMAGE_CONTEXT_COUNT] = {-1, -1, -1, -1};
+        vector<int32_t> transitions;
+        vector<uint8_t> accepting;
+        vector<DFAImageRange> ranges;
+        vector<uint16_t> blockIndices;
+        vector<uint16_t> blockColumns;
+        vector<uint8_t> reverse;
+        string metadata;
+    };
+
+    vector<uint8_t> BuildDFAImage(const DFAImageContents &contents);
+
+    const DFAImageHeader &ValidateDFAImage(const void *data, size_t size);
+} // namespace regex
+
+#endif // DFA_IMAGE_HPP
\ No newline at end of file
@@ -0,0 +1,205 @@
+#ifndef EXPRESSION_ARENA_HPP
+#define EXPRESSION_ARENA_HPP
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+    using NodeIndex = uint32_t;
+
+    /**
+     * ArenaNode
+     *
+     * A node of an arena-allocated expression. The children of the node are
+     * stored contiguously in the arena as [firstChild, firstChild + childCount).
+     * "range" is only used by symbols, "atLeast" and "atMost" only by repetitions,
+     * "charClass" only by character classes, as an index into the classes of the arena.
+     * A capture keeps its group number in "atLeast".
+     */
+    struct ArenaNode
+    {
+        RegularExpressionKind kind;
+        UnicodeRange range;
+        uint32_t firstChild;
+        uint32_t childCount;
+        int32_t atLeast;
+        int32_t atMost;
+        uint32_t charClass;
+    };
+
+    /**
+     * ExpressionArena
+     *
+     * Stores regular expressions as compact, hash-consed nodes in flat arrays.
+     * Building the same subtree twice returns the same node index, so repeated
+     * parts of an expression (and of many expressions sharing the arena) are
+     * stored only once. Compile builds the NFA straight from the nodes and skips
+     * Simplify, unless the compilation is case-insensitive.
+     */
+    class ExpressionArena
+    {
+    public:
+        static constexpr NodeIndex NONE = UINT32_MAX;
+
+        ExpressionArena() = default;
+
+        NodeIndex Symbol(char32_t c);
+        NodeIndex Range(char32_t lower, char32_t upper);
+        NodeIndex LineBegin();
+        NodeIndex LineEnd();
+        NodeIndex WordBoundary();
+        NodeIndex NotWordBoundary();
+        NodeIndex Class(const CharClass &charClass);
+        NodeIndex Alternation(NodeIndex x, NodeIndex y);
+        NodeIndex Alternation(const vector<NodeIndex> &items);
+        NodeIndex Concatenation(NodeIndex x, NodeIndex y);
+        NodeIndex Concatenation(const vector<NodeIndex> &items);
+        NodeIndex KleeneStar(NodeIndex x);
+        NodeIndex Literal(const u32string &text);
+        NodeIndex RepeatExactly(NodeIndex x, int times);
+        NodeIndex RepeatAtLeast(NodeIndex x, int times);
+        NodeIndex Repeat(NodeIndex x, int atLeast, int atMost);
+        NodeIndex Optional(NodeIndex x);
+        NodeIndex OneOrMore(NodeIndex x);
+        NodeIndex Capture(NodeIndex x, int group);
+
+        NodeIndex Intern(const RegularExpression::Ptr &exp);
+        RegularExpression::Ptr ToExpression(NodeIndex node) const;
+        DFAMatrix Compile(NodeIndex node, CompileFlags flags = CompileFlags::None) const;
+
+        const ArenaNode &Node(NodeIndex node) const
+        {
+            return nodes.at(node);
+        }
+        const CharClass &NodeClass(NodeIndex node) const
+        {
+            return classes.at(nodes.at(node).charClass);
+        }
+        NodeIndex Child(NodeIndex node, size_t i) const
+        {
+            return children.at(nodes.at(node).firstChild + i);
+        }
+        size_t NodeCount() const
+        {
+            return nodes.size();
+        }
+        void Reserve(size_t nodeCount);
+
+    private:
+        vector<ArenaNode> nodes;
+        vector<NodeIndex> children;
+        vector<size_t> hashes;
+        vector<NodeIndex> buckets;
+        vector<CharClass> classes;
+        std::unordered_map<CharClass, uint32_t, CharClassHash> classIndices;
+
+        NodeIndex MakeNode(ArenaNode node, const NodeIndex *items);
+        bool SameNode(NodeIndex index, const ArenaNode &node, const NodeIndex *items) const;
+        void Rehash(size_t bucketCount);
+    };
+
+    /**
+     * ArenaFolder
+     *
+     * Visits the nodes reachable from a root in post-order with an explicit stack.
+     * A node shared by several parents is visited once per occurrence.
+     */
+    template <typename ResultType>
+    class ArenaFolder
+    {
+    public:
+        const ExpressionArena &arena;
+
+        explicit ArenaFolder(const ExpressionArena &arena) : arena{arena} {}
+
+        ResultType Fold(NodeIndex root)
+        {
+            vector<std::pair<NodeIndex, uint32_t>> stack;
+            vector<ResultType> results;
+            stack.emplace_back(root, 0);
+            while (!stack.empty())
+            {
+                auto [node, next] = stack.back();
+                if (next < arena.Node(node).childCount)
+                {
+                    /* visit the next child before the node itself */
+                    stack.back().second++;
+                    stack.emplace_back(arena.Child(node, next), 0);
+                }
+                else
+                {
+                    stack.pop_back();
+                    items.clear();
+                    for (size_t i = results.size() - next; i < results.size(); i++)
+                    {
+                        items.push_back(std::move(results[i]));
+                    }
+                    results.resize(results.size() - next);
+                    results.push_back(FoldNode(node));
+                }
+            }
+            return std::move(results.back());
+        }
+        virtual ResultType FoldAlternation(NodeIndex node, vector<ResultType> &items) = 0;
+        virtual ResultType FoldConcatenation(NodeIndex node, vector<ResultType> &items) = 0;
+        virtual ResultType FoldKleeneStar(NodeIndex node, ResultType &inner) = 0;
+        virtual ResultType FoldRepeat(NodeIndex node, ResultType &inner) = 0;
+        virtual ResultType FoldSymbol(NodeIndex node) = 0;
+        virtual ResultType FoldCharClass(NodeIndex node) = 0;
+        virtual ResultType FoldCapture(NodeIndex node, ResultType &inner) = 0;
+
+    private:
+        vector<ResultType> items;
+
+        ResultType FoldNode(NodeIndex node)
+        {
+            switch (arena.Node(node).kind)
+            {
+            case RegularExpressionKind::Alternation:
+            {
+                return FoldAlternation(node, items);
+            }
+            case RegularExpressionKind::Concatenation:
+            {
+                return FoldConcatenation(node, items);
+            }
+            case RegularExpressionKind::KleeneStar:
+            {
+                return FoldKleeneStar(node, items.at(0));
+            }
+            case RegularExpressionKind::Repeat:
+            {
+                return FoldRepeat(node, items.at(0));
+            }
+            case RegularExpressionKind::Symbol:
+            {
+                return FoldSymbol(node);
+            }
+            case RegularExpressionKind::CharClass:
+            {
+                return FoldCharClass(node);
+            }
+            case RegularExpressionKind::Capture:
+            {
+                return FoldCapture(node, items.at(0));
+            }
+            default:
+            {
+                // make the compiler happy
+                throw std::runtime_error("unreachable case branch");
+            }
+            }
+        }
+    };
+} // namespace regex
+
+#endif // EXPRESSION_ARENA_HPP
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef FIND_ITER_HPP
+#define FIND_ITER_HPP
+#include <cstdint>
+#include <string>
+
+#include "DFA.hpp"
+
+namespace regex
+{
+    using std::u32string;
+
+    struct MatchSpan
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    /**
+     * FindIter
+     *
+     * Iterates over the successive non-overlapping matches of a DFA matrix in a string, each one the
+     * longest match at the leftmost position after the previous match. Scanning resumes at the end of the
+     * previous match. An empty match is followed by a search from the next character, and an empty match
+     * right at the end of the previous match is skipped. Each match is found with two scans: the search
+     * states of the matrix read forward to the end of the leftmost-longest match, and its reversed matrix
+     * reads back from there to the start. A matrix without them tries every position in turn, skipping
+     * those which cannot start a match with one column lookup. The iterator never allocates; the matrix
+     * and the string must outlive it.
+     */
+    class FindIter
+    {
+    public:
+        FindIter(const DFAMatrix &matrix, const u32string &str);
+
+        bool Next(MatchSpan &span);
+
+    private:
+        const DFAMatrix &matrix;
+        const u32string &str;
+        size_t position = 0;
+        /* the end of the previous match, SIZE_MAX before the first one */
+        size_t lastEnd = SIZE_MAX;
+        /* true if a match can start before any character: then every position is tried */
+        bool everyPosition = false;
+        /* the reversed matrix, null if the matches are found by trying every position */
+        const DFAMatrix *reversed = nullptr;
+    };
+} // namespace regex
+
+#endif // FIND_ITER_HPP
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef JIT_MATCHER_HPP
+#define JIT_MATCHER_HPP
+#include <cstdint>
+#include <memory>
+
+#include "DFA.hpp"
+
+namespace regex
+{
+    /**
+     * JitMatcher
+     *
+     * Lowers a DFA matrix to native x86-64 code. Every state becomes a basic block which dispatches
+     * on the character by a balanced tree of comparisons over the ranges of its own transitions, and
+     * a state looping on one range checks that range before anything else. The search states get an
+     * entry point of their own, so that Search reads the input once. Matrices with assertions,
+     * other platforms, and matchers which would not pay back the compilation keep using the table
+     * interpreter, with the same results.
+     */
+    class JitMatcher
+    {
+    public:
+        /* below this many characters of expected input the table interpreter is used */
+        static constexpr size_t MIN_INPUT_SIZE = 1 << 16;
+        static constexpr size_t MAX_STATE_COUNT = 1 << 16;
+        static constexpr size_t MAX_CODE_SIZE = 1 << 24;
+
+        /**
+         * @param {DFAMatrix} matrix          : the matcher to compile
+         * @param {size_t} expectedInputSize  : the number of characters the matcher is expected to scan in its lifetime
+         */
+        explicit JitMatcher(DFAMatrix matrix, size_t expectedInputSize = SIZE_MAX);
+
+        static bool IsSupported();
+        static bool ShouldCompile(const DFAMatrix &matrix, size_t expectedInputSize);
+
+        bool IsCompiled() const
+        {
+            return function != nullptr;
+        }
+        size_t CodeSize() const
+        {
+            return codeSize;
+        }
+
+        bool FullMatch(const u32string &str) const;
+        u32string::const_iterator Search(u32string::const_iterator strBegin, u32string::const_iterator strEnd) const;
+        int Match(u32string::const_iterator strBegin, u32string::const_iterator strEnd, bool greedyMode) const;
+
+    private:
+        using Function = int64_t (*)(const char32_t *begin, const char32_t *end, int64_t greedyMode);
+
+        DFAMatrix matrix;
+        /* the executable mapping holding the code, shared by the copies */
+        std::shared_ptr<void> code;
+        size_t codeSize = 0;
+        Function function = nullptr;
+        /* the entry point of the search states, null if they are not compiled */
+        Function searchFunction = nullptr;
+
+        void Compile();
+    };
+} // namespace regex
+
+#endif // JIT_MATCHER_HPP
\ No newline at end of file
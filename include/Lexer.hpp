@@ -0,0 +1,56 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    struct TokenSpan
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    /**
+     * Lexer
+     *
+     * A tokenizer over the DFA matrix of the union of its rules, whose class map finds the column of a
+     * character in two lookups. From each position the longest match wins, and a tie goes to the rule
+     * which comes first: every accepting state remembers the smallest rule ID among the rules ending in
+     * it. Rules cannot use assertions, and empty matches are never tokens.
+     */
+    class Lexer
+    {
+    public:
+        static constexpr size_t MAX_STATE_COUNT = 1 << 16;
+
+        explicit Lexer(const vector<RegularExpression::Ptr> &rules);
+
+        size_t RuleCount() const
+        {
+            return ruleCount;
+        }
+        size_t StateCount() const
+        {
+            return accepting.size();
+        }
+
+        size_t Tokenize(const u32string &input, vector<int> &ids, vector<TokenSpan> &spans) const;
+        size_t Tokenize(const char32_t *begin, const char32_t *end, vector<int> &ids, vector<TokenSpan> &spans) const;
+
+    private:
+        size_t ruleCount;
+        DFAMatrix matrix;
+        /* the rule accepted in each state of the matrix, or -1 */
+        vector<int32_t> accepting;
+    };
+} // namespace regex
+
+#endif // LEXER_HPP
\ No newline at end of file
@@ -1,5 +1,6 @@
 #ifndef NFA_HPP
 #define NFA_HPP
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
@@ -7,6 +8,7 @@
 #include <vector>
 
 #include "DFA.hpp"
+#include "ExpressionArena.hpp"
 #include "RegularExpression.hpp"
 
 namespace regex
@@ -16,17 +18,25 @@ namespace regex
     using std::unordered_set;
     using std::vector;
 
+    /**
+     * NFASubgraph
+     *
+     * The NFA fragment of a subexpression. The fragment owns the contiguous
+     * vertices [first, first + the number of vertices added while building it).
+     */
     class NFASubgraph
     {
     public:
         StateID start;
         StateID end;
+        StateID first;
 
         NFASubgraph() = default;
-        NFASubgraph(StateID start, StateID end) : start{start}, end{end} {}
+        NFASubgraph(StateID start, StateID end) : start{start}, end{end}, first{std::min(start, end)} {}
+        NFASubgraph(StateID start, StateID end, StateID first) : start{start}, end{end}, first{first} {}
     };
 
-    class NFA : public RegularExpressionVisitor<NFASubgraph>
+    class NFA : public RegularExpressionFolder<NFASubgraph>
     {
     public:
         typedef unordered_map<UnicodeRange, unordered_set<StateID>, UnicodeRangeHash> Row;
@@ -36,14 +46,28 @@ namespace regex
         UnicodePatterns patterns;
         size_t startVertex;
         size_t endVertex;
-        static const int EPSILON = -1;
+        /* the end vertex of every expression of a union, in order, each joined to endVertex */
+        vector<StateID> endVertices;
+        static constexpr int EPSILON = -1;
 
         explicit NFA(const RegularExpression::Ptr &exp);
+        explicit NFA(const vector<RegularExpression::Ptr> &exps);
+        NFA(const ExpressionArena &arena, NodeIndex root);
 
-        NFASubgraph VisitAlternation(const AlternationExpression::Ptr &exp) override;
-        NFASubgraph VisitConcatenation(const ConcatenationExpression::Ptr &exp) override;
-        NFASubgraph VisitKleeneStar(const KleeneStarExpression::Ptr &exp) override;
-        NFASubgraph VisitSymbol(const SymbolExpression::Ptr &exp) override;
+        NFASubgraph FoldAlternation(const AlternationExpression::Ptr &exp, vector<NFASubgraph> &items) override;
+        NFASubgraph FoldConcatenation(const ConcatenationExpression::Ptr &exp, vector<NFASubgraph> &items) override;
+        NFASubgraph FoldKleeneStar(const KleeneStarExpression::Ptr &exp, NFASubgraph &inner) override;
+        NFASubgraph FoldRepeat(const RepeatExpression::Ptr &exp, NFASubgraph &inner) override;
+        NFASubgraph FoldSymbol(const SymbolExpression::Ptr &exp) override;
+        NFASubgraph FoldCharClass(const CharClassExpression::Ptr &exp) override;
+        NFASubgraph FoldCapture(const CaptureExpression::Ptr &exp, NFASubgraph &inner) override;
+
+        NFASubgraph AddAlternation(const vector<NFASubgraph> &graphs);
+        NFASubgraph AddConcatenation(const vector<NFASubgraph> &graphs);
+        NFASubgraph AddKleeneStar(const NFASubgraph &graph);
+        NFASubgraph AddRepeat(const NFASubgraph &graph, int atLeast, int atMost);
+        NFASubgraph AddSymbol(const UnicodeRange &pattern);
+        NFASubgraph AddCharClass(const CharClass &charClass);
 
         void FindNextStates(int start, int vertex, UnicodeRange pattern, Table &table, vector<bool> &visited);
 
@@ -51,8 +75,31 @@ namespace regex
         Row ComputeVerticesNextRow(std::set<StateID> vertices, Table &table);
         vector<DFATableRow> EpsilonClosure();
 
+        /**
+         * NFA::RangeClasses
+         *
+         * @param  {UnicodeRange} range : the pattern of an edge
+         * @return {vector<int>}        : the IDs of the classes of characters the range covers
+         */
+        const vector<int> &RangeClasses(const UnicodeRange &range) const
+        {
+            return rangeClasses.at(range);
+        }
+
     private:
+        unordered_map<UnicodeRange, vector<int>, UnicodeRangeHash> rangeClasses;
+
         void NumberPatterns();
+        NFASubgraph CloneSubgraph(const NFASubgraph &graph, StateID last);
     };
+
+    /* the most search states BuildDFAMatrix adds to the anchored ones before giving them up */
+    static constexpr size_t MAX_SEARCH_STATES = 4096;
+
+    DFAMatrix BuildDFAMatrix(const RegularExpression::Ptr &exp, CompileFlags flags = CompileFlags::None);
+    DFAMatrix BuildDFAMatrix(NFA &nfa);
+    DFAMatrix BuildAnchoredDFAMatrix(const NFA &nfa, vector<vector<StateID>> &states,
+                                     size_t maxStateCount = SIZE_MAX);
+    DFAMatrix BuildAnchoredDFAMatrix(const RegularExpression::Ptr &exp, CompileFlags flags = CompileFlags::None);
 } // namespace regex
 #endif // NFA_HPP
@@ -0,0 +1,80 @@
+#ifndef ONE_PASS_DFA_HPP
+#define ONE_PASS_DFA_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CaptureProgram.hpp"
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    /**
+     * OnePassDFA
+     *
+     * A DFA reporting capture groups for one-pass expressions: from every point of the capture program,
+     * each character can be consumed by at most one path, and the end of the match reached by at most one.
+     * A state is then a single vertex of the program, and each transition carries the tags of the only
+     * path it follows, so matching runs one thread with no register copies and no backtracking.
+     * Search finds the span with the DFA matrix of the expression first, then runs that thread over it.
+     * IsOnePass tells whether an expression qualifies, otherwise TaggedDFA or CaptureMatcher apply.
+     */
+    class OnePassDFA
+    {
+    public:
+        explicit OnePassDFA(const RegularExpression::Ptr &exp);
+
+        static bool IsOnePass(const RegularExpression::Ptr &exp);
+
+        /* the number of groups, group 0 being the whole match */
+        size_t GroupCount() const
+        {
+            return groupCount;
+        }
+        size_t StateCount() const
+        {
+            return stateCount;
+        }
+
+        bool Match(const u32string &str, vector<Submatch> &groups) const;
+        bool FullMatch(const u32string &str, vector<Submatch> &groups) const;
+        bool Search(const u32string &str, vector<Submatch> &groups) const;
+
+    private:
+        /* the tags set so far, and the ones of the last match */
+        struct RunBuffers
+        {
+            vector<int32_t> slots;
+            vector<int32_t> snapshot;
+        };
+
+        /* finds the spans searched for */
+        DFAMatrix matrix;
+        size_t groupCount = 0;
+        size_t tagCount = 0;
+        size_t stateCount = 0;
+        size_t columnCount = 0;
+        vector<CaptureColumn> classRanges;
+        /* the next state of each state and column, or -1 */
+        vector<int32_t> transitions;
+        /* the tags set by transition i are tags[tagOffsets[i], tagOffsets[i + 1]) */
+        vector<uint32_t> tagOffsets;
+        vector<int32_t> tags;
+        /* the tags set when the match ends in state s are endTags[finalOffsets[s], finalOffsets[s + 1]) */
+        vector<uint32_t> finalOffsets;
+        vector<int32_t> endTags;
+        vector<bool> accepting;
+
+        OnePassDFA() = default;
+
+        bool Build(const CaptureProgram &program);
+        int32_t ColumnOf(char32_t c) const;
+        int Run(const u32string &str, size_t start, size_t end, vector<Submatch> &groups, RunBuffers &buffers) const;
+    };
+} // namespace regex
+
+#endif // ONE_PASS_DFA_HPP
\ No newline at end of file
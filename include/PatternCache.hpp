@@ -0,0 +1,72 @@
+#ifndef PATTERN_CACHE_HPP
+#define PATTERN_CACHE_HPP
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::shared_ptr;
+    using std::unordered_map;
+
+    /**
+     * PatternCache
+     *
+     * A bounded LRU cache of compiled DFA matrices keyed by the structure of
+     * the regular expression tree and the compile flags. All the member functions
+     * are thread-safe.
+     */
+    class PatternCache
+    {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 256;
+
+        explicit PatternCache(size_t capacity = DEFAULT_CAPACITY);
+
+        shared_ptr<const DFAMatrix> Compile(const RegularExpression::Ptr &exp, CompileFlags flags = CompileFlags::None);
+
+        size_t Hits() const;
+        size_t Misses() const;
+        size_t Size() const;
+        size_t Capacity() const;
+        void SetCapacity(size_t capacity);
+        void Clear();
+
+        static PatternCache &Global();
+
+    private:
+        typedef std::pair<RegularExpression::Ptr, CompileFlags> Key;
+        typedef std::pair<Key, shared_ptr<const DFAMatrix>> Entry;
+
+        struct KeyHash
+        {
+            size_t operator()(const Key &key) const
+            {
+                return RegularExpressionHash()(key.first) * 31 + static_cast<size_t>(key.second);
+            }
+        };
+        struct KeyEqual
+        {
+            bool operator()(const Key &x, const Key &y) const
+            {
+                return x.second == y.second && RegularExpressionEqual()(x.first, y.first);
+            }
+        };
+
+        mutable std::mutex mutex;
+        size_t capacity;
+        size_t hits;
+        size_t misses;
+        std::list<Entry> entries;
+        unordered_map<Key, std::list<Entry>::iterator, KeyHash, KeyEqual> index;
+
+        void Evict();
+    };
+} // namespace regex
+
+#endif // PATTERN_CACHE_HPP
\ No newline at end of file
@@ -0,0 +1,128 @@
+#ifndef REGEX_SET_HPP
+#define REGEX_SET_HPP
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "NFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    /**
+     * SetMatch
+     *
+     * A match of the expression "id" of a set ending at offset "end". "begin" is the leftmost offset a
+     * match of the expression ending there can start at, or SIZE_MAX if starts are not recovered.
+     */
+    struct SetMatch
+    {
+        size_t id;
+        size_t begin;
+        size_t end;
+    };
+
+    /**
+     * RegexSet
+     *
+     * Many expressions compiled into one automaton, which finds all the expressions occurring
+     * anywhere in a string in a single pass. The DFA is built lazily: a state is a set of vertices
+     * of the union NFA, created the first time the input reaches it and cached with the IDs of the
+     * expressions it accepts. Every state contains the closure of the start vertex, so that matches
+     * can begin at any position; a state only stores the other, "live" vertices, and the moves of
+     * the start closure are computed once per class. The cache is flushed when it grows over
+     * MAX_CACHED_STATES, so the memory stays bounded even if the full DFA would be exponential.
+     *
+     * ForEachMatch reports every end of every match as the scan goes, overlapping ones included, in the
+     * manner of Aho-Corasick. Starts are recovered on request by running the NFA of the expression
+     * backwards from the end, which costs time in the length of the match.
+     *
+     * "^" and "$" hold at the edges of the string and of its lines, as in DFAMatrix, and word boundaries
+     * are not supported. Matching updates the cache, so a set must not be shared between threads.
+     */
+    class RegexSet
+    {
+    public:
+        static constexpr size_t MAX_CACHED_STATES = 4096;
+
+        explicit RegexSet(const vector<RegularExpression::Ptr> &exps);
+
+        size_t Size() const
+        {
+            return patternCount;
+        }
+        size_t CachedStateCount() const
+        {
+            return states.size();
+        }
+
+        vector<size_t> Matches(const u32string &str);
+        bool IsMatch(const u32string &str);
+        void ForEachMatch(const u32string &str, const std::function<void(const SetMatch &)> &callback,
+                          bool recoverStarts = false);
+
+    private:
+        static constexpr int UNKNOWN = -1;
+
+        struct State
+        {
+            /* the sorted vertices of the state out of the start closure */
+            vector<StateID> vertices;
+            /* the IDs of the expressions ending in the state, sorted */
+            vector<size_t> matches;
+            /* the next state of every class, of the characters out of all the classes and of "\n", or UNKNOWN */
+            vector<int> next;
+            /* the IDs of the expressions accepted if a line ends in the state, once computed */
+            vector<size_t> endMatches;
+            bool hasEndMatches = false;
+            /* true at the start of the string and after a newline */
+            bool afterLineBegin = false;
+        };
+
+        std::unique_ptr<NFA> nfa;
+        size_t patternCount;
+        size_t classCount;
+        /* the character ranges of the classes sorted by their lower bounds, with the class as the column */
+        vector<DFAImageRange> classRanges;
+        /* the expression ending at each vertex, or SIZE_MAX */
+        vector<size_t> endPatterns;
+        /* the character transitions of each vertex, as (classes, next vertex) */
+        vector<vector<std::pair<const vector<int> *, StateID>>> transitions;
+        /* the same transitions entering each vertex, as (classes, previous vertex) */
+        vector<vector<std::pair<const vector<int> *, StateID>>> reverseTransitions;
+        /* the edges without a character entering each vertex, as (type, previous vertex) */
+        vector<vector<std::pair<RangeType, StateID>>> reverseEpsilons;
+        /* the closure of the start vertex, in every state, and what it adds to the first state */
+        vector<StateID> restart;
+        vector<bool> inRestart;
+        vector<size_t> restartMatches;
+        vector<StateID> initial;
+        /* the live vertices reached from the start closure by each class, once computed */
+        vector<vector<StateID>> restartMoves;
+        vector<bool> hasRestartMove;
+        vector<State> states;
+        std::map<std::pair<vector<StateID>, bool>, int> stateIndices;
+        /* marks of the vertices visited by the current closure */
+        vector<uint32_t> marks;
+        uint32_t generation = 0;
+
+        int ClassOf(char32_t c) const;
+        vector<StateID> Closure(vector<StateID> vertices, bool atBegin, bool atEnd, bool live);
+        vector<StateID> Move(const vector<StateID> &vertices, int classID) const;
+        int AddState(vector<StateID> vertices, bool afterLineBegin);
+        int Next(int state, char32_t c);
+        const vector<size_t> &LineEndMatches(int state);
+        vector<size_t> Scan(const u32string &str, bool firstOnly);
+        vector<StateID> ReverseClosure(vector<StateID> vertices, bool atBegin, bool atEnd);
+        size_t MatchStart(const u32string &str, size_t id, size_t end);
+    };
+} // namespace regex
+
+#endif // REGEX_SET_HPP
\ No newline at end of file
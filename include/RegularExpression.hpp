@@ -4,9 +4,12 @@
 #include <cstdint>
 #include <exception>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "CharClass.hpp"
 #include "DFA.hpp"
 
 namespace regex
@@ -20,16 +23,44 @@ namespace regex
     class AlternationExpression;
     class ConcatenationExpression;
     class KleeneStarExpression;
+    class RepeatExpression;
     class SymbolExpression;
+    class CharClassExpression;
+    class CaptureExpression;
 
     enum class RegularExpressionKind
     {
         Alternation,
         Concatenation,
         KleeneStar,
-        Symbol
+        Repeat,
+        Symbol,
+        CharClass,
+        Capture
     };
 
+    /**
+     * CompileFlags
+     *
+     * Options of the compilation, combined with "|". CaseInsensitive lets every character match all
+     * of its cases, by Unicode simple case folding of the character classes (see FoldCase).
+     */
+    enum class CompileFlags : uint32_t
+    {
+        None = 0,
+        CaseInsensitive = 1 << 0
+    };
+
+    inline CompileFlags operator|(CompileFlags x, CompileFlags y)
+    {
+        return static_cast<CompileFlags>(static_cast<uint32_t>(x) | static_cast<uint32_t>(y));
+    }
+
+    inline bool HasFlag(CompileFlags flags, CompileFlags flag)
+    {
+        return (static_cast<uint32_t>(flags) & static_cast<uint32_t>(flag)) != 0;
+    }
+
     class RegularExpression : public std::enable_shared_from_this<RegularExpression>
     {
     public:
@@ -37,7 +68,7 @@ namespace regex
 
         virtual RegularExpressionKind Kind() const = 0;
 
-        DFAMatrix Compile();
+        DFAMatrix Compile(CompileFlags flags = CompileFlags::None);
 
         RegularExpression::Ptr Many();
     };
@@ -47,9 +78,9 @@ namespace regex
     public:
         typedef shared_ptr<AlternationExpression> Ptr;
 
-        RegularExpression::Ptr left;
-        RegularExpression::Ptr right;
+        vector<RegularExpression::Ptr> items;
         AlternationExpression(const RegularExpression::Ptr &left, const RegularExpression::Ptr &right);
+        explicit AlternationExpression(vector<RegularExpression::Ptr> items);
         RegularExpressionKind Kind() const override;
     };
 
@@ -58,9 +89,9 @@ namespace regex
     public:
         typedef shared_ptr<ConcatenationExpression> Ptr;
 
-        RegularExpression::Ptr left;
-        RegularExpression::Ptr right;
+        vector<RegularExpression::Ptr> items;
         ConcatenationExpression(const RegularExpression::Ptr &left, const RegularExpression::Ptr &right);
+        explicit ConcatenationExpression(vector<RegularExpression::Ptr> items);
         RegularExpressionKind Kind() const override;
     };
 
@@ -74,6 +105,29 @@ namespace regex
         RegularExpressionKind Kind() const override;
     };
 
+    /**
+     * RepeatExpression
+     *
+     * Matches the inner expression at least "atLeast" times and at most "atMost" times.
+     * "atMost" is RepeatExpression::UNBOUNDED if there is no upper bound.
+     */
+    class RepeatExpression : public RegularExpression
+    {
+    public:
+        typedef shared_ptr<RepeatExpression> Ptr;
+        static constexpr int UNBOUNDED = -1;
+
+        RegularExpression::Ptr innerExp;
+        int atLeast;
+        int atMost;
+        RepeatExpression(const RegularExpression::Ptr &innerExp, int atLeast, int atMost);
+        RegularExpressionKind Kind() const override;
+        bool IsBounded() const
+        {
+            return atMost != UNBOUNDED;
+        }
+    };
+
     class SymbolExpression : public RegularExpression
     {
     public:
@@ -84,6 +138,56 @@ namespace regex
         RegularExpressionKind Kind() const override;
     };
 
+    /**
+     * CharClassExpression
+     *
+     * Matches one character of a set of code points. The whole set becomes a single
+     * transition of the automaton instead of an alternation of ranges.
+     */
+    class CharClassExpression : public RegularExpression
+    {
+    public:
+        typedef shared_ptr<CharClassExpression> Ptr;
+
+        CharClass charClass;
+        explicit CharClassExpression(CharClass charClass);
+        RegularExpressionKind Kind() const override;
+    };
+
+    /**
+     * CaptureExpression
+     *
+     * Matches the inner expression and records the span it matched as the numbered group.
+     * Groups are numbered from 1, group 0 being the whole match. Matchers which do not
+     * report submatches treat the node as its inner expression.
+     */
+    class CaptureExpression : public RegularExpression
+    {
+    public:
+        typedef shared_ptr<CaptureExpression> Ptr;
+
+        RegularExpression::Ptr innerExp;
+        int group;
+        CaptureExpression(const RegularExpression::Ptr &innerExp, int group);
+        RegularExpressionKind Kind() const override;
+    };
+
+    /**
+     * Structural hash and equality over regular expression trees.
+     *
+     * Two trees built independently from the same notations compare equal,
+     * which lets compiled programs be shared between them.
+     */
+    struct RegularExpressionHash
+    {
+        size_t operator()(const RegularExpression::Ptr &exp) const;
+    };
+
+    struct RegularExpressionEqual
+    {
+        bool operator()(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y) const;
+    };
+
     template <typename ReturnType, typename... ArgTypes>
     class RegularExpressionVisitor
     {
@@ -104,10 +208,22 @@ namespace regex
             {
                 return VisitKleeneStar(static_pointer_cast<KleeneStarExpression>(exp), args...);
             }
+            case RegularExpressionKind::Repeat:
+            {
+                return VisitRepeat(static_pointer_cast<RepeatExpression>(exp), args...);
+            }
             case RegularExpressionKind::Symbol:
             {
                 return VisitSymbol(static_pointer_cast<SymbolExpression>(exp), args...);
             }
+            case RegularExpressionKind::CharClass:
+            {
+                return VisitCharClass(static_pointer_cast<CharClassExpression>(exp), args...);
+            }
+            case RegularExpressionKind::Capture:
+            {
+                return VisitCapture(static_pointer_cast<CaptureExpression>(exp), args...);
+            }
             default:
             {
                 // make the compiler happy
@@ -118,22 +234,160 @@ namespace regex
         virtual ReturnType VisitAlternation(const AlternationExpression::Ptr &exp, ArgTypes... args) = 0;
         virtual ReturnType VisitConcatenation(const ConcatenationExpression::Ptr &exp, ArgTypes... args) = 0;
         virtual ReturnType VisitKleeneStar(const KleeneStarExpression::Ptr &exp, ArgTypes... args) = 0;
+        virtual ReturnType VisitRepeat(const RepeatExpression::Ptr &exp, ArgTypes... args) = 0;
         virtual ReturnType VisitSymbol(const SymbolExpression::Ptr &exp, ArgTypes... args) = 0;
+        virtual ReturnType VisitCharClass(const CharClassExpression::Ptr &exp, ArgTypes... args) = 0;
+        virtual ReturnType VisitCapture(const CaptureExpression::Ptr &exp, ArgTypes... args) = 0;
+    };
+
+    /**
+     * RegularExpressionFolder
+     *
+     * Visits an expression tree in post-order with an explicit stack instead of recursion,
+     * so that arbitrarily deep trees can be processed in bounded call stack space.
+     * The results of the children of a node are handed to the callback of the node.
+     */
+    template <typename ResultType>
+    class RegularExpressionFolder
+    {
+    public:
+        ResultType Fold(const RegularExpression::Ptr &exp)
+        {
+            vector<std::pair<RegularExpression::Ptr, size_t>> stack;
+            vector<ResultType> results;
+            stack.emplace_back(exp, 0);
+            while (!stack.empty())
+            {
+                size_t next = stack.back().second;
+                if (next < ChildCount(stack.back().first))
+                {
+                    /* visit the next child before the node itself */
+                    stack.back().second++;
+                    RegularExpression::Ptr child = Child(stack.back().first, next);
+                    stack.emplace_back(std::move(child), 0);
+                }
+                else
+                {
+                    RegularExpression::Ptr current = std::move(stack.back().first);
+                    stack.pop_back();
+                    items.clear();
+                    for (size_t i = results.size() - next; i < results.size(); i++)
+                    {
+                        items.push_back(std::move(results[i]));
+                    }
+                    results.resize(results.size() - next);
+                    results.push_back(FoldNode(current));
+                }
+            }
+            return std::move(results.back());
+        }
+        virtual ResultType FoldAlternation(const AlternationExpression::Ptr &exp, vector<ResultType> &items) = 0;
+        virtual ResultType FoldConcatenation(const ConcatenationExpression::Ptr &exp, vector<ResultType> &items) = 0;
+        virtual ResultType FoldKleeneStar(const KleeneStarExpression::Ptr &exp, ResultType &inner) = 0;
+        virtual ResultType FoldRepeat(const RepeatExpression::Ptr &exp, ResultType &inner) = 0;
+        virtual ResultType FoldSymbol(const SymbolExpression::Ptr &exp) = 0;
+        virtual ResultType FoldCharClass(const CharClassExpression::Ptr &exp) = 0;
+        virtual ResultType FoldCapture(const CaptureExpression::Ptr &exp, ResultType &inner) = 0;
+
+    private:
+        vector<ResultType> items;
+
+        static size_t ChildCount(const RegularExpression::Ptr &exp)
+        {
+            switch (exp->Kind())
+            {
+            case RegularExpressionKind::Alternation:
+                return static_cast<const AlternationExpression &>(*exp).items.size();
+            case RegularExpressionKind::Concatenation:
+                return static_cast<const ConcatenationExpression &>(*exp).items.size();
+            case RegularExpressionKind::KleeneStar:
+            case RegularExpressionKind::Repeat:
+            case RegularExpressionKind::Capture:
+                return 1;
+            default:
+                return 0;
+            }
+        }
+        static RegularExpression::Ptr Child(const RegularExpression::Ptr &exp, size_t i)
+        {
+            switch (exp->Kind())
+            {
+            case RegularExpressionKind::Alternation:
+                return static_cast<const AlternationExpression &>(*exp).items.at(i);
+            case RegularExpressionKind::Concatenation:
+                return static_cast<const ConcatenationExpression &>(*exp).items.at(i);
+            case RegularExpressionKind::KleeneStar:
+                return static_cast<const KleeneStarExpression &>(*exp).innerExp;
+            case RegularExpressionKind::Repeat:
+                return static_cast<const RepeatExpression &>(*exp).innerExp;
+            case RegularExpressionKind::Capture:
+                return static_cast<const CaptureExpression &>(*exp).innerExp;
+            default:
+                throw std::runtime_error("unreachable case branch");
+            }
+        }
+        ResultType FoldNode(const RegularExpression::Ptr &exp)
+        {
+            switch (exp->Kind())
+            {
+            case RegularExpressionKind::Alternation:
+            {
+                return FoldAlternation(static_pointer_cast<AlternationExpression>(exp), items);
+            }
+            case RegularExpressionKind::Concatenation:
+            {
+                return FoldConcatenation(static_pointer_cast<ConcatenationExpression>(exp), items);
+            }
+            case RegularExpressionKind::KleeneStar:
+            {
+                return FoldKleeneStar(static_pointer_cast<KleeneStarExpression>(exp), items.at(0));
+            }
+            case RegularExpressionKind::Repeat:
+            {
+                return FoldRepeat(static_pointer_cast<RepeatExpression>(exp), items.at(0));
+            }
+            case RegularExpressionKind::Symbol:
+            {
+                return FoldSymbol(static_pointer_cast<SymbolExpression>(exp));
+            }
+            case RegularExpressionKind::CharClass:
+            {
+                return FoldCharClass(static_pointer_cast<CharClassExpression>(exp));
+            }
+            case RegularExpressionKind::Capture:
+            {
+                return FoldCapture(static_pointer_cast<CaptureExpression>(exp), items.at(0));
+            }
+            default:
+            {
+                // make the compiler happy
+                throw std::runtime_error("unreachable case branch");
+            }
+            }
+        }
     };
 
     namespace notations
     {
         RegularExpression::Ptr operator|(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y);
+        RegularExpression::Ptr operator|(RegularExpression::Ptr &&x, const RegularExpression::Ptr &y);
         RegularExpression::Ptr operator+(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y);
+        RegularExpression::Ptr operator+(RegularExpression::Ptr &&x, const RegularExpression::Ptr &y);
 
         RegularExpression::Ptr Symbol(char32_t c);
         RegularExpression::Ptr Literal(const u32string &text);
         RegularExpression::Ptr Range(char32_t lower, char32_t upper);
+        RegularExpression::Ptr Class(const CharClass &charClass);
         RegularExpression::Ptr LineBegin();
         RegularExpression::Ptr LineEnd();
+        RegularExpression::Ptr WordBoundary();
+        RegularExpression::Ptr NotWordBoundary();
         RegularExpression::Ptr RepeatExactly(const RegularExpression::Ptr &x, int times);
         RegularExpression::Ptr RepeatAtLeast(const RegularExpression::Ptr &x, int times);
         RegularExpression::Ptr Repeat(const RegularExpression::Ptr &x, int atLeast, int atMost);
+        RegularExpression::Ptr Optional(const RegularExpression::Ptr &x);
+        RegularExpression::Ptr OneOrMore(const RegularExpression::Ptr &x);
+        RegularExpression::Ptr Capture(const RegularExpression::Ptr &x, int group);
     } // namespace notations
 
 } // namespace regex
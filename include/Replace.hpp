@@ -0,0 +1,72 @@
+#ifndef REPLACE_HPP
+#define REPLACE_HPP
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CaptureMatcher.hpp"
+#include "DFA.hpp"
+#include "FindIter.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::u32string_view;
+    using std::vector;
+
+    /**
+     * ReplaceTemplate
+     *
+     * A replacement string parsed once into literal pieces and group references. "$n" and "${n}" insert
+     * group n, "$0" being the whole match, and "$$" inserts a "$". A group which did not take part in
+     * the match inserts nothing.
+     */
+    class ReplaceTemplate
+    {
+    public:
+        explicit ReplaceTemplate(const u32string &text);
+
+        /* the largest group referenced, 0 if only the whole match is */
+        size_t MaxGroup() const
+        {
+            return maxGroup;
+        }
+
+        void Expand(const u32string &str, const vector<Submatch> &groups, u32string &out) const;
+        void Expand(const u32string &str, const MatchSpan &span, u32string &out) const;
+
+    private:
+        /* the group of a piece copied from the template text */
+        static constexpr size_t LITERAL = SIZE_MAX;
+
+        struct Piece
+        {
+            size_t group;
+            /* the span of a literal piece in the text */
+            size_t begin;
+            size_t end;
+        };
+
+        u32string text;
+        vector<Piece> pieces;
+        size_t maxGroup = 0;
+    };
+
+    /*
+     * Replacing appends the string with the matches replaced to "out", which the caller can reuse
+     * between calls; the matches are the ones of FindIter. The functions taking a DFA matrix only
+     * accept templates referencing the whole match. Split fills "pieces" with views of the string
+     * between the matches, so the string must outlive them.
+     */
+    bool Replace(const DFAMatrix &matrix, const u32string &str, const ReplaceTemplate &replacement, u32string &out);
+    size_t ReplaceAll(const DFAMatrix &matrix, const u32string &str, const ReplaceTemplate &replacement,
+                      u32string &out);
+    bool Replace(const CaptureMatcher &matcher, const u32string &str, const ReplaceTemplate &replacement,
+                 u32string &out);
+    size_t ReplaceAll(const CaptureMatcher &matcher, const u32string &str, const ReplaceTemplate &replacement,
+                      u32string &out);
+    size_t Split(const DFAMatrix &matrix, const u32string &str, vector<u32string_view> &pieces);
+} // namespace regex
+
+#endif // REPLACE_HPP
\ No newline at end of file
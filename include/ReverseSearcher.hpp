@@ -0,0 +1,85 @@
+#ifndef REVERSE_SEARCHER_HPP
+#define REVERSE_SEARCHER_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DFA.hpp"
+#include "FindIter.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    /**
+     * Reverser
+     *
+     * Rewrites an expression into one matching the reversed strings: the items of every concatenation
+     * are flipped, and "^" and "$" trade places. Capture groups are dropped.
+     */
+    class Reverser : public RegularExpressionFolder<RegularExpression::Ptr>
+    {
+    public:
+        RegularExpression::Ptr FoldAlternation(const AlternationExpression::Ptr &exp,
+                                               vector<RegularExpression::Ptr> &items) override;
+        RegularExpression::Ptr FoldConcatenation(const ConcatenationExpression::Ptr &exp,
+                                                 vector<RegularExpression::Ptr> &items) override;
+        RegularExpression::Ptr FoldKleeneStar(const KleeneStarExpression::Ptr &exp,
+                                              RegularExpression::Ptr &inner) override;
+        RegularExpression::Ptr FoldRepeat(const RepeatExpression::Ptr &exp, RegularExpression::Ptr &inner) override;
+        RegularExpression::Ptr FoldSymbol(const SymbolExpression::Ptr &exp) override;
+        RegularExpression::Ptr FoldCharClass(const CharClassExpression::Ptr &exp) override;
+        RegularExpression::Ptr FoldCapture(const CaptureExpression::Ptr &exp, RegularExpression::Ptr &inner) override;
+    };
+
+    RegularExpression::Ptr Reverse(const RegularExpression::Ptr &exp);
+
+    /**
+     * ReverseSearcher
+     *
+     * Searches with the DFA of the reversed expression, read from right to left, where the end of a match
+     * is easier to find than its start:
+     *
+     * - an expression ending with "$" on every path only matches at the end of a line;
+     * - an expression ending with a literal, such as "[a-z]+@example.com", only matches where the literal
+     *   occurs, so nothing past its last occurrence is read, and a string without it is rejected with a
+     *   substring search;
+     * - any other expression is searched forward with FindIter.
+     *
+     * In the first two cases a single backward scan from the last possible end finds the leftmost start
+     * of a match, and the longest match is read forward from there.
+     *
+     * The assertions hold at the same positions as in the forward scans. MatchStart recovers the start
+     * of a match whose end is known, e.g. from RegexSet::ForEachMatch.
+     */
+    class ReverseSearcher
+    {
+    public:
+        explicit ReverseSearcher(const RegularExpression::Ptr &exp);
+
+        bool IsEndAnchored() const
+        {
+            return endAnchored;
+        }
+        /* the literal every match ends with, empty if there is none */
+        const u32string &Suffix() const
+        {
+            return suffix;
+        }
+
+        bool Search(const u32string &str, MatchSpan &span) const;
+        size_t MatchStart(const u32string &str, size_t end) const;
+
+    private:
+        DFAMatrix forward;
+        /* the reversed expression after ".*", which accepts at the start of every match read backwards; it is
+           only run from its start, so it has no search states and no reversed matrix */
+        DFAMatrix backward;
+        bool endAnchored;
+        u32string suffix;
+    };
+} // namespace regex
+
+#endif // REVERSE_SEARCHER_HPP
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef SIMPLIFIER_HPP
+#define SIMPLIFIER_HPP
+#include <vector>
+
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::vector;
+
+    /**
+     * Simplifier
+     *
+     * Rewrites an expression tree into an equivalent one with fewer nodes before it is turned into
+     * an NFA. Nested alternations and concatenations are flattened, duplicate alternatives removed,
+     * common prefixes of alternatives factored out into a trie, single-character alternatives merged
+     * into one class, and redundant stars collapsed ((x*)*, x*x*, (x?)*, (x*){m,n}).
+     * Unchanged subtrees are shared with the input tree.
+     */
+    class Simplifier : public RegularExpressionFolder<RegularExpression::Ptr>
+    {
+    public:
+        RegularExpression::Ptr FoldAlternation(const AlternationExpression::Ptr &exp,
+                                               vector<RegularExpression::Ptr> &items) override;
+        RegularExpression::Ptr FoldConcatenation(const ConcatenationExpression::Ptr &exp,
+                                                 vector<RegularExpression::Ptr> &items) override;
+        RegularExpression::Ptr FoldKleeneStar(const KleeneStarExpression::Ptr &exp,
+                                              RegularExpression::Ptr &inner) override;
+        RegularExpression::Ptr FoldRepeat(const RepeatExpression::Ptr &exp, RegularExpression::Ptr &inner) override;
+        RegularExpression::Ptr FoldSymbol(const SymbolExpression::Ptr &exp) override;
+        RegularExpression::Ptr FoldCharClass(const CharClassExpression::Ptr &exp) override;
+        RegularExpression::Ptr FoldCapture(const CaptureExpression::Ptr &exp, RegularExpression::Ptr &inner) override;
+
+        RegularExpression::Ptr SimplifyAlternation(vector<RegularExpression::Ptr> items);
+        RegularExpression::Ptr SimplifyConcatenation(vector<RegularExpression::Ptr> items);
+
+    private:
+        vector<RegularExpression::Ptr> FactorPrefixes(const vector<RegularExpression::Ptr> &items);
+        vector<RegularExpression::Ptr> MergeCharacters(const vector<RegularExpression::Ptr> &items);
+    };
+
+    /**
+     * CaseFolder
+     *
+     * Rewrites an expression so that every character also matches its other cases: each symbol and
+     * class becomes the class closed under Unicode simple case folding. The shape of the tree is kept,
+     * so the automaton has as many states as the one of the input. Unchanged subtrees are shared with
+     * the input tree.
+     */
+    class CaseFolder : public RegularExpressionFolder<RegularExpression::Ptr>
+    {
+    public:
+        RegularExpression::Ptr FoldAlternation(const AlternationExpression::Ptr &exp,
+                                               vector<RegularExpression::Ptr> &items) override;
+        RegularExpression::Ptr FoldConcatenation(const ConcatenationExpression::Ptr &exp,
+                                                 vector<RegularExpression::Ptr> &items) override;
+        RegularExpression::Ptr FoldKleeneStar(const KleeneStarExpression::Ptr &exp,
+                                              RegularExpression::Ptr &inner) override;
+        RegularExpression::Ptr FoldRepeat(const RepeatExpression::Ptr &exp, RegularExpression::Ptr &inner) override;
+        RegularExpression::Ptr FoldSymbol(const SymbolExpression::Ptr &exp) override;
+        RegularExpression::Ptr FoldCharClass(const CharClassExpression::Ptr &exp) override;
+        RegularExpression::Ptr FoldCapture(const CaptureExpression::Ptr &exp, RegularExpression::Ptr &inner) override;
+    };
+
+    RegularExpression::Ptr Simplify(const RegularExpression::Ptr &exp);
+    RegularExpression::Ptr FoldCase(const RegularExpression::Ptr &exp);
+} // namespace regex
+
+#endif // SIMPLIFIER_HPP
\ No newline at end of file
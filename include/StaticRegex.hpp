@@ -0,0 +1,593 @@
+#ifndef STATIC_REGEX_HPP
+#define STATIC_REGEX_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace regex
+{
+    enum class StaticNodeKind : uint8_t
+    {
+        Epsilon,
+        Range,
+        Alternation,
+        Concatenation,
+        KleeneStar
+    };
+
+    /**
+     * StaticNode
+     *
+     * A node of a static expression. "left" and "right" are the indices of the operands, which
+     * always come before the node itself; a KleeneStar only uses "left".
+     */
+    struct StaticNode
+    {
+        StaticNodeKind kind = StaticNodeKind::Epsilon;
+        char32_t lower = 0;
+        char32_t upper = 0;
+        size_t left = 0;
+        size_t right = 0;
+    };
+
+    /**
+     * StaticExpression
+     *
+     * A regular expression whose N nodes are stored by value, so that it can be built in a constant
+     * expression by the static notations. The root is the last node.
+     */
+    template <size_t N>
+    struct StaticExpression
+    {
+        static constexpr size_t Size = N;
+        std::array<StaticNode, N> nodes{};
+
+        constexpr StaticExpression<N + 1> Many() const
+        {
+            StaticExpression<N + 1> result;
+            for (size_t i = 0; i < N; i++)
+            {
+                result.nodes[i] = nodes[i];
+            }
+            result.nodes[N] = StaticNode{StaticNodeKind::KleeneStar, 0, 0, N - 1, N - 1};
+            return result;
+        }
+    };
+
+    /**
+     * StaticDFA
+     *
+     * The result of compiling a StaticExpression<N> in a constant expression, with room for at most
+     * MaxStates states. The alphabet is split at the bounds of all the ranges: the class k holds the
+     * characters in [boundaries[k], boundaries[k + 1]).
+     */
+    template <size_t N, size_t MaxStates>
+    struct StaticDFA
+    {
+        static constexpr size_t MAX_CLASSES = 2 * N + 1;
+
+        size_t stateCount = 0;
+        size_t classCount = 0;
+        std::array<char32_t, MAX_CLASSES + 1> boundaries{};
+        std::array<int32_t, MaxStates * MAX_CLASSES> transitions{};
+        std::array<bool, MaxStates> accepting{};
+    };
+
+    /**
+     * StaticCompiler
+     *
+     * Build the Thompson NFA of a static expression and turn it into a DFA by the subset construction,
+     * without any dynamic allocation, so that it can run during the compilation.
+     */
+    class StaticCompiler
+    {
+    public:
+        static constexpr char32_t MAX_CHARACTER = 0x10FFFF;
+        static constexpr size_t NONE = SIZE_MAX;
+
+        template <size_t MaxStates, size_t N>
+        static constexpr StaticDFA<N, MaxStates> Compile(const StaticExpression<N> &expression)
+        {
+            NFA<N> nfa = BuildNFA(expression);
+            StaticDFA<N, MaxStates> dfa;
+            dfa.classCount = Partition(expression, dfa.boundaries);
+
+            std::array<StateSet<N>, MaxStates> sets{};
+            StateSet<N> start;
+            start.Insert(2 * (N - 1));
+            sets[0] = Closure(nfa, start);
+            dfa.stateCount = 1;
+            for (size_t state = 0; state < dfa.stateCount; state++)
+            {
+                dfa.accepting[state] = sets[state].Contains(2 * (N - 1) + 1);
+                for (size_t k = 0; k < dfa.classCount; k++)
+                {
+                    /* all the characters of a class have the same transitions, so take the first */
+                    char32_t c = dfa.boundaries[k];
+                    StateSet<N> next;
+                    bool moved = false;
+                    for (size_t q = 0; q < 2 * N; q++)
+                    {
+                        if (sets[state].Contains(q) && nfa.target[q] != NONE && nfa.lower[q] <= c && c <= nfa.upper[q])
+                        {
+                            next.Insert(nfa.target[q]);
+                            moved = true;
+                        }
+                    }
+                    if (!moved)
+                    {
+                        dfa.transitions[state * dfa.MAX_CLASSES + k] = -1;
+                        continue;
+                    }
+                    next = Closure(nfa, next);
+                    size_t found = NONE;
+                    for (size_t j = 0; j < dfa.stateCount && found == NONE; j++)
+                    {
+                        found = sets[j] == next ? j : NONE;
+                    }
+                    if (found == NONE)
+                    {
+                        if (dfa.stateCount == MaxStates)
+                        {
+                            throw std::length_error("the static expression needs more DFA states than MaxStates");
+                        }
+                        sets[dfa.stateCount] = next;
+                        found = dfa.stateCount++;
+                    }
+                    dfa.transitions[state * dfa.MAX_CLASSES + k] = static_cast<int32_t>(found);
+                }
+            }
+            return dfa;
+        }
+
+    private:
+        template <size_t N>
+        struct StateSet
+        {
+            std::array<uint64_t, (2 * N + 63) / 64> words{};
+
+            constexpr void Insert(size_t q)
+            {
+                words[q / 64] |= uint64_t{1} << (q % 64);
+            }
+            constexpr bool Contains(size_t q) const
+            {
+                return (words[q / 64] >> (q % 64)) & 1;
+            }
+            constexpr bool operator==(const StateSet &other) const
+            {
+                for (size_t i = 0; i < words.size(); i++)
+                {
+                    if (words[i] != other.words[i])
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
+        /* the node i starts at the state 2i and ends at the state 2i + 1. A state has at most two
+           epsilon edges and one character edge. */
+        template <size_t N>
+        struct NFA
+        {
+            std::array<size_t, 2 * N> epsilon0{};
+            std::array<size_t, 2 * N> epsilon1{};
+            std::array<size_t, 2 * N> target{};
+            std::array<char32_t, 2 * N> lower{};
+            std::array<char32_t, 2 * N> upper{};
+
+            constexpr void AddEpsilon(size_t from, size_t to)
+            {
+                if (epsilon0[from] == NONE)
+                {
+                    epsilon0[from] = to;
+                }
+                else
+                {
+                    epsilon1[from] = to;
+                }
+            }
+        };
+
+        template <size_t N>
+        static constexpr NFA<N> BuildNFA(const StaticExpression<N> &expression)
+        {
+            NFA<N> nfa;
+            for (size_t q = 0; q < 2 * N; q++)
+            {
+                nfa.epsilon0[q] = NONE;
+                nfa.epsilon1[q] = NONE;
+                nfa.target[q] = NONE;
+            }
+            for (size_t i = 0; i < N; i++)
+            {
+                const StaticNode &node = expression.nodes[i];
+                size_t start = 2 * i;
+                size_t end = 2 * i + 1;
+                switch (node.kind)
+                {
+                case StaticNodeKind::Epsilon:
+                {
+                    nfa.AddEpsilon(start, end);
+                    break;
+                }
+                case StaticNodeKind::Range:
+                {
+                    nfa.target[start] = end;
+                    nfa.lower[start] = node.lower;
+                    nfa.upper[start] = node.upper;
+                    break;
+                }
+                case StaticNodeKind::Alternation:
+                {
+                    nfa.AddEpsilon(start, 2 * node.left);
+                    nfa.AddEpsilon(start, 2 * node.right);
+                    nfa.AddEpsilon(2 * node.left + 1, end);
+                    nfa.AddEpsilon(2 * node.right + 1, end);
+                    break;
+                }
+                case StaticNodeKind::Concatenation:
+                {
+                    nfa.AddEpsilon(start, 2 * node.left);
+                    nfa.AddEpsilon(2 * node.left + 1, 2 * node.right);
+                    nfa.AddEpsilon(2 * node.right + 1, end);
+                    break;
+                }
+                case StaticNodeKind::KleeneStar:
+                {
+                    nfa.AddEpsilon(start, 2 * node.left);
+                    nfa.AddEpsilon(start, end);
+                    nfa.AddEpsilon(2 * node.left + 1, 2 * node.left);
+                    nfa.AddEpsilon(2 * node.left + 1, end);
+                    break;
+                }
+                }
+            }
+            return nfa;
+        }
+
+        template <size_t N>
+        static constexpr StateSet<N> Closure(const NFA<N> &nfa, StateSet<N> set)
+        {
+            std::array<size_t, 2 * N> stack{};
+            size_t top = 0;
+            for (size_t q = 0; q < 2 * N; q++)
+            {
+                if (set.Contains(q))
+                {
+                    stack[top++] = q;
+                }
+            }
+            while (top > 0)
+            {
+                size_t q = stack[--top];
+                for (size_t next : {nfa.epsilon0[q], nfa.epsilon1[q]})
+                {
+                    if (next != NONE && !set.Contains(next))
+                    {
+                        set.Insert(next);
+                        stack[top++] = next;
+                    }
+                }
+            }
+            return set;
+        }
+
+        /**
+         * StaticCompiler::Partition
+         *
+         * Sort the distinct bounds of the ranges, together with 0 and one past the last character.
+         *
+         * @return {size_t} : the number of classes, one less than the number of bounds
+         */
+        template <size_t N, size_t M>
+        static constexpr size_t Partition(const StaticExpression<N> &expression, std::array<char32_t, M> &boundaries)
+        {
+            size_t count = 0;
+            auto insert = [&boundaries, &count](char32_t bound) {
+                size_t i = 0;
+                while (i < count && boundaries[i] < bound)
+                {
+                    i++;
+                }
+                if (i < count && boundaries[i] == bound)
+                {
+                    return;
+                }
+                for (size_t j = count; j > i; j--)
+                {
+                    boundaries[j] = boundaries[j - 1];
+                }
+                boundaries[i] = bound;
+                count++;
+            };
+            insert(0);
+            insert(MAX_CHARACTER + 1);
+            for (const StaticNode &node : expression.nodes)
+            {
+                if (node.kind == StaticNodeKind::Range)
+                {
+                    insert(node.lower);
+                    insert(node.upper + 1);
+                }
+            }
+            return count - 1;
+        }
+    };
+
+    /**
+     * StaticRegex
+     *
+     * A matcher compiled from a static expression during the compilation. "Expression" must refer
+     * to a constexpr StaticExpression with static storage duration. Only the tables sized to the
+     * actual DFA are kept as read-only data, and all the functions can also run in constant
+     * expressions. The results are the same as the ones of DFAMatrix.
+     */
+    template <const auto &Expression, size_t MaxStates = 256>
+    class StaticRegex
+    {
+    private:
+        static constexpr auto dfa = StaticCompiler::Compile<MaxStates>(Expression);
+
+    public:
+        static constexpr size_t STATE_COUNT = dfa.stateCount;
+        static constexpr size_t CLASS_COUNT = dfa.classCount;
+
+        /**
+         * StaticRegex::Match
+         *
+         * @param  {u32string_view} str : the target string, matched from the beginning
+         * @param  {bool} greedyMode    : If true, search for the longest match. Otherwise, return immediately once matched.
+         * @return {int}                : the length of the matched string. -1 if no match.
+         */
+        static constexpr int Match(std::u32string_view str, bool greedyMode)
+        {
+            size_t state = 0;
+            int lastMatchedLength = -1;
+            for (size_t i = 0; i < str.size(); i++)
+            {
+                if (accepting[state])
+                {
+                    if (greedyMode)
+                    {
+                        lastMatchedLength = static_cast<int>(i);
+                    }
+                    else
+                    {
+                        return static_cast<int>(i);
+                    }
+                }
+                int32_t next = -1;
+                if (str[i] <= StaticCompiler::MAX_CHARACTER)
+                {
+                    next = transitions[state * CLASS_COUNT + ClassOf(str[i])];
+                }
+                if (next == -1)
+                {
+                    return accepting[state] ? static_cast<int>(i) : lastMatchedLength;
+                }
+                state = static_cast<size_t>(next);
+            }
+            return accepting[state] ? static_cast<int>(str.size()) : lastMatchedLength;
+        }
+
+        static constexpr bool FullMatch(std::u32string_view str)
+        {
+            return Match(str, true) == static_cast<int>(str.size());
+        }
+
+        /**
+         * StaticRegex::Search
+         *
+         * @param  {u32string_view} str : the target string
+         * @return {size_t}             : the start position of the first occurrence of the pattern, or str.size() if not found
+         */
+        static constexpr size_t Search(std::u32string_view str)
+        {
+            for (size_t start = 0; start < str.size(); start++)
+            {
+                if (Match(str.substr(start), false) != -1)
+                {
+                    return start;
+                }
+            }
+            return str.size();
+        }
+
+    private:
+        static constexpr std::array<char32_t, CLASS_COUNT + 1> boundaries = [] {
+            std::array<char32_t, CLASS_COUNT + 1> result{};
+            for (size_t k = 0; k <= CLASS_COUNT; k++)
+            {
+                result[k] = dfa.boundaries[k];
+            }
+            return result;
+        }();
+        static constexpr std::array<int32_t, STATE_COUNT * CLASS_COUNT> transitions = [] {
+            std::array<int32_t, STATE_COUNT * CLASS_COUNT> result{};
+            for (size_t state = 0; state < STATE_COUNT; state++)
+            {
+                for (size_t k = 0; k < CLASS_COUNT; k++)
+                {
+                    result[state * CLASS_COUNT + k] = dfa.transitions[state * dfa.MAX_CLASSES + k];
+                }
+            }
+            return result;
+        }();
+        static constexpr std::array<bool, STATE_COUNT> accepting = [] {
+            std::array<bool, STATE_COUNT> result{};
+            for (size_t state = 0; state < STATE_COUNT; state++)
+            {
+                result[state] = dfa.accepting[state];
+            }
+            return result;
+        }();
+
+        static constexpr size_t ClassOf(char32_t c)
+        {
+            size_t low = 0;
+            size_t high = CLASS_COUNT;
+            while (high - low > 1)
+            {
+                size_t middle = (low + high) / 2;
+                if (boundaries[middle] <= c)
+                {
+                    low = middle;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+            return low;
+        }
+    };
+
+    /**
+     * The static counterparts of the notations. The counts of the repetitions are template arguments,
+     * since they decide the size of the result. There are no assertions and no character classes;
+     * use alternations of ranges instead.
+     */
+    namespace static_notations
+    {
+        constexpr StaticExpression<1> Epsilon()
+        {
+            return StaticExpression<1>{};
+        }
+
+        constexpr StaticExpression<1> Range(char32_t lower, char32_t upper)
+        {
+            if (lower > upper || upper > StaticCompiler::MAX_CHARACTER)
+            {
+                throw std::invalid_argument("invalid character range");
+            }
+            StaticExpression<1> result;
+            result.nodes[0] = StaticNode{StaticNodeKind::Range, lower, upper, 0, 0};
+            return result;
+        }
+
+        constexpr StaticExpression<1> Symbol(char32_t c)
+        {
+            return Range(c, c);
+        }
+
+        template <size_t N, size_t M>
+        constexpr StaticExpression<N + M + 1> Combine(StaticNodeKind kind, const StaticExpression<N> &x,
+                                                      const StaticExpression<M> &y)
+        {
+            StaticExpression<N + M + 1> result;
+            for (size_t i = 0; i < N; i++)
+            {
+                result.nodes[i] = x.nodes[i];
+            }
+            for (size_t i = 0; i < M; i++)
+            {
+                StaticNode node = y.nodes[i];
+                node.left += N;
+                node.right += N;
+                result.nodes[N + i] = node;
+            }
+            result.nodes[N + M] = StaticNode{kind, 0, 0, N - 1, N + M - 1};
+            return result;
+        }
+
+        template <size_t N, size_t M>
+        constexpr StaticExpression<N + M + 1> operator|(const StaticExpression<N> &x, const StaticExpression<M> &y)
+        {
+            return Combine(StaticNodeKind::Alternation, x, y);
+        }
+
+        template <size_t N, size_t M>
+        constexpr StaticExpression<N + M + 1> operator+(const StaticExpression<N> &x, const StaticExpression<M> &y)
+        {
+            return Combine(StaticNodeKind::Concatenation, x, y);
+        }
+
+        /* "text" is a string literal, whose last element is the terminating null character */
+        template <size_t L>
+        constexpr StaticExpression<(L < 2 ? 1 : 2 * L - 3)> Literal(const char32_t (&text)[L])
+        {
+            StaticExpression<(L < 2 ? 1 : 2 * L - 3)> result;
+            if (L >= 2)
+            {
+                for (size_t i = 0; i + 1 < L; i++)
+                {
+                    result.nodes[i] = StaticNode{StaticNodeKind::Range, text[i], text[i], 0, 0};
+                }
+                size_t previous = 0;
+                for (size_t i = 1; i + 1 < L; i++)
+                {
+                    size_t index = L - 2 + i;
+                    result.nodes[index] = StaticNode{StaticNodeKind::Concatenation, 0, 0, previous, i};
+                    previous = index;
+                }
+            }
+            return result;
+        }
+
+        template <size_t N>
+        constexpr StaticExpression<N + 2> Optional(const StaticExpression<N> &x)
+        {
+            return x | Epsilon();
+        }
+
+        template <size_t N>
+        constexpr StaticExpression<2 * N + 2> OneOrMore(const StaticExpression<N> &x)
+        {
+            return x + x.Many();
+        }
+
+        template <int Times, size_t N>
+        constexpr auto RepeatExactly(const StaticExpression<N> &x)
+        {
+            static_assert(Times >= 0, "the count of a repetition cannot be negative");
+            if constexpr (Times == 0)
+            {
+                return Epsilon();
+            }
+            else if constexpr (Times == 1)
+            {
+                return x;
+            }
+            else
+            {
+                return x + RepeatExactly<Times - 1>(x);
+            }
+        }
+
+        template <int Times, size_t N>
+        constexpr auto RepeatAtLeast(const StaticExpression<N> &x)
+        {
+            return RepeatExactly<Times>(x) + x.Many();
+        }
+
+        /* x{m,n} is x^m (x(x(...)?)?)?, like the dynamic repetition */
+        template <int AtLeast, int AtMost, size_t N>
+        constexpr auto Repeat(const StaticExpression<N> &x)
+        {
+            static_assert(0 <= AtLeast && AtLeast <= AtMost, "invalid bounds of a repetition");
+            if constexpr (AtLeast > 0)
+            {
+                return RepeatExactly<AtLeast>(x) + Repeat<0, AtMost - AtLeast>(x);
+            }
+            else if constexpr (AtMost == 0)
+            {
+                return Epsilon();
+            }
+            else if constexpr (AtMost == 1)
+            {
+                return Optional(x);
+            }
+            else
+            {
+                return Optional(x + Repeat<0, AtMost - 1>(x));
+            }
+        }
+    } // namespace static_notations
+} // namespace regex
+
+#endif // STATIC_REGEX_HPP
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef STREAM_REPLACER_HPP
+#define STREAM_REPLACER_HPP
+#include <cstdint>
+#include <string>
+
+#include "DFA.hpp"
+#include "Replace.hpp"
+
+namespace regex
+{
+    using std::u32string;
+
+    /**
+     * StreamReplacer
+     *
+     * Replaces the matches of a DFA matrix in a string given in chunks, and writes the result in chunks
+     * too, for inputs too large to hold at once. The matches are the ones ReplaceAll replaces in the whole
+     * string. Only the characters since the start of the current tentative match are buffered: the
+     * characters which cannot start a match are written at once, and the rest is written as soon as the
+     * DFA either dies or accepts the longest match. Assertions see the whole stream across the chunks, and
+     * the matrix must outlive the replacer.
+     */
+    class StreamReplacer
+    {
+    public:
+        StreamReplacer(const DFAMatrix &matrix, const ReplaceTemplate &replacement);
+
+        void Write(const char32_t *begin, const char32_t *end, u32string &out);
+        void Write(const u32string &chunk, u32string &out);
+        void Finish(u32string &out);
+
+        /* the number of matches replaced so far, over every stream */
+        size_t ReplacedCount() const
+        {
+            return replacedCount;
+        }
+        /* the number of characters held back for the current tentative match */
+        size_t BufferedSize() const
+        {
+            return buffer.size() - head;
+        }
+
+    private:
+        const DFAMatrix &matrix;
+        ReplaceTemplate replacement;
+        /* the characters from the start of the tentative match at "head"; the ones before it are stale */
+        u32string buffer;
+        size_t head = 0;
+        /* the next character of the buffer the DFA reads */
+        size_t scanned = 0;
+        int state = 0;
+        /* the context before buffer[head] */
+        CharacterContext behind = CharacterContext::TextEdge;
+        /* the length of the longest match from "head" so far, or -1 */
+        long lastLength = -1;
+        /* the offset of buffer[head] in the stream */
+        size_t position = 0;
+        /* the end of the previous match, SIZE_MAX before the first one */
+        size_t lastEnd = SIZE_MAX;
+        bool everyPosition = false;
+        size_t replacedCount = 0;
+
+        void Run(bool atEnd, u32string &out);
+        void Advance(size_t count);
+        void Restart();
+    };
+} // namespace regex
+
+#endif // STREAM_REPLACER_HPP
\ No newline at end of file
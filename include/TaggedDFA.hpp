@@ -0,0 +1,98 @@
+#ifndef TAGGED_DFA_HPP
+#define TAGGED_DFA_HPP
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CaptureProgram.hpp"
+#include "DFA.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::u32string;
+    using std::vector;
+
+    /**
+     * TaggedDFA
+     *
+     * A DFA which also reports the spans of the capture groups, after Laurikari's tagged automata as
+     * refined by Trofimovich. The opening and closing of every group are tags of the NFA; a state of the
+     * DFA is an ordered list of NFA vertices, each with the registers holding the last position of every
+     * tag on its path. Transitions carry register operations (set to the current position, or copy) which
+     * keep the registers up to date, so matching reads each character once and never simulates the NFA.
+     *
+     * The overall match is the longest one, as with DFAMatrix. Among the paths reaching its end the
+     * groups follow the leftmost-greedy priority: alternatives are tried from the left and repetitions
+     * take as many iterations as they can. A group inside a repetition reports its last iteration.
+     * Search finds the span of the match with the DFA matrix of the expression first, and only runs the
+     * tagged DFA over that span. Expressions cannot use assertions.
+     */
+    class TaggedDFA
+    {
+    public:
+        static constexpr size_t MAX_STATE_COUNT = 1 << 16;
+
+        explicit TaggedDFA(const RegularExpression::Ptr &exp);
+
+        /* the number of groups, group 0 being the whole match */
+        size_t GroupCount() const
+        {
+            return groupCount;
+        }
+        size_t StateCount() const
+        {
+            return accepting.size();
+        }
+        size_t RegisterCount() const
+        {
+            return registerCount;
+        }
+
+        bool Match(const u32string &str, vector<Submatch> &groups) const;
+        bool FullMatch(const u32string &str, vector<Submatch> &groups) const;
+        bool Search(const u32string &str, vector<Submatch> &groups) const;
+
+    private:
+        /* the source of an operation setting a register to the current position */
+        static constexpr int32_t POSITION = -1;
+
+        struct RegisterOp
+        {
+            int32_t target;
+            int32_t source;
+        };
+
+        /* the registers of a run, the values read by a transition, and the tags of the last match */
+        struct RunBuffers
+        {
+            vector<int32_t> registers;
+            vector<int32_t> values;
+            vector<int32_t> snapshot;
+        };
+
+        /* finds the spans searched for */
+        DFAMatrix matrix;
+        size_t groupCount;
+        size_t tagCount;
+        size_t registerCount;
+        size_t columnCount;
+        vector<CaptureColumn> classRanges;
+        /* the next state of each state and column, or -1 */
+        vector<int32_t> transitions;
+        /* the operations of transition i are ops[opOffsets[i], opOffsets[i + 1]) */
+        vector<uint32_t> opOffsets;
+        vector<RegisterOp> ops;
+        /* the operations run before the first character */
+        vector<RegisterOp> initialOps;
+        vector<bool> accepting;
+        /* the register holding each tag when the string ends in each accepting state */
+        vector<int32_t> finalRegisters;
+        size_t maxOpCount = 0;
+
+        int32_t ColumnOf(char32_t c) const;
+        int Run(const u32string &str, size_t start, size_t end, vector<Submatch> &groups, RunBuffers &buffers) const;
+    };
+} // namespace regex
+
+#endif // TAGGED_DFA_HPP
\ No newline at end of file
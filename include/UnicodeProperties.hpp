@@ -0,0 +1,27 @@
+#ifndef UNICODE_PROPERTIES_HPP
+#define UNICODE_PROPERTIES_HPP
+#include <string>
+
+#include "CharClass.hpp"
+#include "RegularExpression.hpp"
+
+namespace regex
+{
+    using std::string;
+
+    /**
+     * Character classes of the Unicode General Category and Script properties, built from the
+     * generated run tables in src/UnicodeTables.cpp. Names are matched loosely: case, spaces,
+     * hyphens and underscores are ignored. An unknown name throws std::invalid_argument.
+     */
+    CharClass GeneralCategoryClass(const string &name);
+    CharClass ScriptClass(const string &name);
+    CharClass UnicodePropertyClass(const string &name);
+
+    namespace notations
+    {
+        RegularExpression::Ptr Property(const string &name);
+    } // namespace notations
+} // namespace regex
+
+#endif // UNICODE_PROPERTIES_HPP
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef UNICODE_TABLES_HPP
+#define UNICODE_TABLES_HPP
+#include <cstddef>
+#include <cstdint>
+
+namespace regex
+{
+    /**
+     * UnicodeRun
+     *
+     * The code points from "first" up to the "first" of the next run all have the
+     * property value "value", which is an index into the names of the property.
+     */
+    struct UnicodeRun
+    {
+        char32_t first;
+        uint8_t value;
+    };
+
+    /**
+     * UnicodeCaseOrbit
+     *
+     * The code points equal under simple case folding, such as k, K and the Kelvin sign, form a
+     * cycle: "next" is the next member of the orbit of "c". The entries are sorted by "c", and code
+     * points without other cases have none.
+     */
+    struct UnicodeCaseOrbit
+    {
+        char32_t c;
+        char32_t next;
+    };
+
+    /* generated by tools/generate_unicode_tables.pl into src/UnicodeTables.cpp */
+    extern const char *const UNICODE_VERSION;
+
+    extern const char *const GENERAL_CATEGORY_NAMES[][2];
+    extern const size_t GENERAL_CATEGORY_COUNT;
+    extern const UnicodeRun GENERAL_CATEGORY_RUNS[];
+    extern const size_t GENERAL_CATEGORY_RUN_COUNT;
+
+    extern const char *const SCRIPT_NAMES[][2];
+    extern const size_t SCRIPT_COUNT;
+    extern const UnicodeRun SCRIPT_RUNS[];
+    extern const size_t SCRIPT_RUN_COUNT;
+
+    extern const UnicodeCaseOrbit CASE_ORBITS[];
+    extern const size_t CASE_ORBIT_COUNT;
+} // namespace regex
+
+#endif // UNICODE_TABLES_HPP
\ No newline at end of file
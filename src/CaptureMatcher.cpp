@@ -0,0 +1,186 @@
+#include "CaptureMatcher.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "FindIter.hpp"
+
+namespace regex
+{
+    CaptureMatcher::CaptureMatcher(const RegularExpression::Ptr &exp) : matrix{exp->Compile()}, program{exp} {}
+
+    bool CaptureMatcher::Match(const u32string &str, vector<Submatch> &groups) const
+    {
+        int length = matrix.Match(str.begin(), str.end(), true);
+        if (length != -1)
+        {
+            return Fill(str, 0, static_cast<size_t>(length), groups);
+        }
+        else
+        {
+            groups.assign(GroupCount(), Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    bool CaptureMatcher::FullMatch(const u32string &str, vector<Submatch> &groups) const
+    {
+        if (matrix.FullMatch(str))
+        {
+            return Fill(str, 0, str.size(), groups);
+        }
+        else
+        {
+            groups.assign(GroupCount(), Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    /**
+     * CaptureMatcher::Search
+     *
+     * @param  {u32string} str             : the string to search
+     * @param  {vector<Submatch>} groups   : receives the groups of the leftmost-longest match found by FindIter
+     * @return {bool}                      : whether the expression matches anywhere in the string
+     */
+    bool CaptureMatcher::Search(const u32string &str, vector<Submatch> &groups) const
+    {
+        FindIter iter(matrix, str);
+        MatchSpan span;
+        if (iter.Next(span))
+        {
+            /* the Pike VM only runs over the span */
+            return Fill(str, span.begin, span.end, groups);
+        }
+        else
+        {
+            groups.assign(GroupCount(), Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    /**
+     * CaptureMatcher::Fill
+     *
+     * Run the Pike VM over a span the DFA matched. The threads of a step are ordered by priority and
+     * there is at most one per vertex: the closure follows the preferred successors first and keeps the
+     * first thread reaching a vertex. Threads reaching the final vertex before the end of the span are
+     * dropped, and the groups come from the first one reaching it at the end.
+     *
+     * @param  {u32string} str             : the searched string
+     * @param  {size_t} begin              : the start of the span
+     * @param  {size_t} end                : the end of the span
+     * @param  {vector<Submatch>} groups   : receives the groups, -1 spans if the program rejects the span
+     * @return {bool}                      : whether the program matches the whole span
+     */
+    bool CaptureMatcher::Fill(const u32string &str, size_t begin, size_t end, vector<Submatch> &groups) const
+    {
+        FillBuffers buffers;
+        return Fill(str, begin, end, groups, buffers);
+    }
+
+    /**
+     * CaptureMatcher::Fill
+     *
+     * @param  {u32string} str             : the searched string
+     * @param  {size_t} begin              : the start of the span
+     * @param  {size_t} end                : the end of the span
+     * @param  {vector<Submatch>} groups   : receives the groups, -1 spans if the program rejects the span
+     * @param  {FillBuffers} buffers       : the buffers of the threads, reused from the previous call
+     * @return {bool}                      : whether the program matches the whole span
+     */
+    bool CaptureMatcher::Fill(const u32string &str, size_t begin, size_t end, vector<Submatch> &groups,
+                              FillBuffers &buffers) const
+    {
+        const vector<CaptureVertex> &vertices = program.vertices;
+        size_t tagCount = program.TagCount();
+        groups.assign(GroupCount(), Submatch{-1, -1});
+
+        using Entry = FillBuffers::Entry;
+        vector<Entry> &stack = buffers.stack;
+        vector<StateID> &current = buffers.current, &next = buffers.next;
+        vector<int32_t> &currentSlots = buffers.currentSlots, &nextSlots = buffers.nextSlots;
+        vector<int32_t> &slots = buffers.slots;
+        vector<size_t> &marks = buffers.marks;
+        stack.clear();
+        current.clear();
+        currentSlots.resize(vertices.size() * tagCount);
+        nextSlots.resize(vertices.size() * tagCount);
+        slots.assign(tagCount, -1);
+        marks.assign(vertices.size(), SIZE_MAX);
+        auto addThread = [&](vector<StateID> &threads, vector<int32_t> &threadSlots, StateID vertex, size_t position) {
+            stack.push_back(Entry{vertex, -1, 0});
+            while (!stack.empty())
+            {
+                Entry entry = stack.back();
+                stack.pop_back();
+                if (entry.tag != -1)
+                {
+                    slots[entry.tag] = entry.value;
+                    continue;
+                }
+                else if (marks[entry.vertex] == position)
+                {
+                    continue;
+                }
+                marks[entry.vertex] = position;
+                const CaptureVertex &v = vertices[entry.vertex];
+                if (v.kind == CaptureVertexKind::Tag)
+                {
+                    stack.push_back(Entry{0, v.tag, slots[v.tag]});
+                    slots[v.tag] = static_cast<int32_t>(position);
+                    stack.push_back(Entry{v.next.front(), -1, 0});
+                }
+                else if (v.kind == CaptureVertexKind::Range || entry.vertex == program.endVertex)
+                {
+                    threads.push_back(entry.vertex);
+                    std::copy(slots.begin(), slots.end(), threadSlots.begin() + entry.vertex * tagCount);
+                }
+                else
+                {
+                    /* push in reverse so that the preferred successor is expanded first */
+                    for (auto it = v.next.rbegin(); it != v.next.rend(); ++it)
+                    {
+                        stack.push_back(Entry{*it, -1, 0});
+                    }
+                }
+            }
+        };
+
+        addThread(current, currentSlots, program.startVertex, begin);
+        for (size_t i = begin; i < end && !current.empty(); i++)
+        {
+            next.clear();
+            for (StateID vertex : current)
+            {
+                const CaptureVertex &v = vertices[vertex];
+                if (v.kind == CaptureVertexKind::Range && v.charClass.Contains(str[i]))
+                {
+                    auto threadSlots = currentSlots.begin() + vertex * tagCount;
+                    std::copy(threadSlots, threadSlots + tagCount, slots.begin());
+                    addThread(next, nextSlots, v.next.front(), i + 1);
+                }
+            }
+            std::swap(current, next);
+            std::swap(currentSlots, nextSlots);
+        }
+        for (StateID vertex : current)
+        {
+            if (vertex == program.endVertex)
+            {
+                groups[0] = Submatch{static_cast<int>(begin), static_cast<int>(end)};
+                for (size_t g = 1; g < GroupCount(); g++)
+                {
+                    int32_t groupBegin = currentSlots[vertex * tagCount + 2 * g - 2];
+                    int32_t groupEnd = currentSlots[vertex * tagCount + 2 * g - 1];
+                    if (groupBegin != -1 && groupEnd != -1)
+                    {
+                        groups[g] = Submatch{groupBegin, groupEnd};
+                    }
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+} // namespace regex
\ No newline at end of file
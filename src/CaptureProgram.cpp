@@ -0,0 +1,231 @@
+#include "CaptureProgram.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace regex
+{
+    namespace
+    {
+        struct CaptureFragment
+        {
+            StateID start;
+            StateID end;
+            StateID first;
+        };
+
+        /**
+         * CaptureProgramBuilder
+         *
+         * Every fragment has a distinct start vertex and an epsilon end vertex without successors,
+         * which is connected by the parent fragment.
+         */
+        class CaptureProgramBuilder : public RegularExpressionFolder<CaptureFragment>
+        {
+        public:
+            vector<CaptureVertex> &vertices;
+            int maxGroup = 0;
+
+            explicit CaptureProgramBuilder(vector<CaptureVertex> &vertices) : vertices{vertices} {}
+
+            CaptureFragment FoldAlternation(const AlternationExpression::Ptr &, vector<CaptureFragment> &items) override
+            {
+                StateID in = AddVertex(CaptureVertexKind::Epsilon);
+                StateID out = AddVertex(CaptureVertexKind::Epsilon);
+                for (const auto &item : items)
+                {
+                    Connect(in, item.start);
+                    Connect(item.end, out);
+                }
+                return CaptureFragment{in, out, items.front().first};
+            }
+            CaptureFragment FoldConcatenation(const ConcatenationExpression::Ptr &,
+                                             vector<CaptureFragment> &items) override
+            {
+                for (size_t i = 0; i + 1 < items.size(); i++)
+                {
+                    Connect(items[i].end, items[i + 1].start);
+                }
+                return CaptureFragment{items.front().start, items.back().end, items.front().first};
+            }
+            CaptureFragment FoldKleeneStar(const KleeneStarExpression::Ptr &, CaptureFragment &inner) override
+            {
+                return AddKleeneStar(inner);
+            }
+            CaptureFragment FoldRepeat(const RepeatExpression::Ptr &exp, CaptureFragment &inner) override
+            {
+                return AddRepeat(inner, exp->atLeast, exp->atMost);
+            }
+            CaptureFragment FoldSymbol(const SymbolExpression::Ptr &exp) override
+            {
+                if (exp->range.rangeType != RangeType::CharacterRange)
+                {
+                    throw std::invalid_argument("capture programs do not support assertions");
+                }
+                return AddRange(CharClass(exp->range.lower, exp->range.upper));
+            }
+            CaptureFragment FoldCharClass(const CharClassExpression::Ptr &exp) override
+            {
+                return AddRange(exp->charClass);
+            }
+            CaptureFragment FoldCapture(const CaptureExpression::Ptr &exp, CaptureFragment &inner) override
+            {
+                maxGroup = std::max(maxGroup, exp->group);
+                StateID open = AddVertex(CaptureVertexKind::Tag);
+                StateID close = AddVertex(CaptureVertexKind::Tag);
+                StateID out = AddVertex(CaptureVertexKind::Epsilon);
+                vertices[open].tag = 2 * exp->group - 2;
+                vertices[close].tag = 2 * exp->group - 1;
+                Connect(open, inner.start);
+                Connect(inner.end, close);
+                Connect(close, out);
+                return CaptureFragment{open, out, inner.first};
+            }
+
+        private:
+            StateID AddVertex(CaptureVertexKind kind)
+            {
+                vertices.push_back(CaptureVertex{kind, CharClass(), -1, {}});
+                return vertices.size() - 1;
+            }
+            void Connect(StateID from, StateID to)
+            {
+                vertices[from].next.push_back(to);
+            }
+            CaptureFragment AddRange(const CharClass &charClass)
+            {
+                StateID start = AddVertex(CaptureVertexKind::Range);
+                StateID end = AddVertex(CaptureVertexKind::Epsilon);
+                vertices[start].charClass = charClass;
+                Connect(start, end);
+                return CaptureFragment{start, end, start};
+            }
+            CaptureFragment AddKleeneStar(const CaptureFragment &inner)
+            {
+                StateID in = AddVertex(CaptureVertexKind::Epsilon);
+                StateID out = AddVertex(CaptureVertexKind::Epsilon);
+                Connect(in, inner.start);
+                Connect(in, out);
+                Connect(inner.end, inner.start);
+                Connect(inner.end, out);
+                return CaptureFragment{in, out, inner.first};
+            }
+            CaptureFragment Clone(const CaptureFragment &fragment, StateID last)
+            {
+                StateID offset = vertices.size() - fragment.first;
+                for (StateID v = fragment.first; v < last; v++)
+                {
+                    CaptureVertex vertex = vertices[v];
+                    for (auto &next : vertex.next)
+                    {
+                        next += offset;
+                    }
+                    vertices.push_back(std::move(vertex));
+                }
+                return CaptureFragment{fragment.start + offset, fragment.end + offset, fragment.first + offset};
+            }
+            /* the same shape as NFA::AddRepeat */
+            CaptureFragment AddRepeat(const CaptureFragment &inner, int atLeast, int atMost)
+            {
+                bool bounded = atMost != RepeatExpression::UNBOUNDED;
+                int copyCount = bounded ? atMost : atLeast + 1;
+                if (copyCount == 0)
+                {
+                    StateID start = AddVertex(CaptureVertexKind::Epsilon);
+                    StateID end = AddVertex(CaptureVertexKind::Epsilon);
+                    Connect(start, end);
+                    return CaptureFragment{start, end, inner.first};
+                }
+                StateID last = vertices.size();
+                vector<CaptureFragment> copies = {inner};
+                for (int i = 1; i < copyCount; i++)
+                {
+                    copies.push_back(Clone(inner, last));
+                }
+                StateID start = AddVertex(CaptureVertexKind::Epsilon);
+                StateID current = start;
+                for (int i = 0; i < atLeast; i++)
+                {
+                    Connect(current, copies[i].start);
+                    current = copies[i].end;
+                }
+                StateID out = AddVertex(CaptureVertexKind::Epsilon);
+                if (bounded)
+                {
+                    for (int i = atLeast; i < atMost; i++)
+                    {
+                        Connect(current, copies[i].start);
+                        Connect(current, out);
+                        current = copies[i].end;
+                    }
+                    Connect(current, out);
+                }
+                else
+                {
+                    CaptureFragment star = AddKleeneStar(copies.back());
+                    Connect(current, star.start);
+                    Connect(star.end, out);
+                }
+                return CaptureFragment{start, out, inner.first};
+            }
+        };
+    } // namespace
+
+    CaptureProgram::CaptureProgram(const RegularExpression::Ptr &exp)
+    {
+        CaptureProgramBuilder builder(vertices);
+        CaptureFragment root = builder.Fold(exp);
+        startVertex = root.start;
+        endVertex = root.end;
+        groupCount = static_cast<size_t>(builder.maxGroup) + 1;
+    }
+
+    /**
+     * CaptureProgram::SplitColumns
+     *
+     * Split the characters of all the ranges of the program into columns, so that every range is a
+     * union of columns and a character can be looked up once per step.
+     *
+     * @param  {vector<vector<int32_t>>} vertexColumns : receives the columns of the range of each vertex
+     * @return {vector<CaptureColumn>}                 : the columns sorted by their lower bounds
+     */
+    vector<CaptureColumn> CaptureProgram::SplitColumns(vector<vector<int32_t>> &vertexColumns) const
+    {
+        vector<CaptureColumn> columns;
+        vector<char32_t> bounds;
+        for (const auto &vertex : vertices)
+        {
+            for (const auto &range : vertex.charClass.Ranges())
+            {
+                bounds.push_back(range.lower);
+                if (range.upper < std::numeric_limits<char32_t>::max())
+                {
+                    bounds.push_back(range.upper + 1);
+                }
+            }
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+        vertexColumns.assign(vertices.size(), {});
+        for (size_t i = 0; i < bounds.size(); i++)
+        {
+            char32_t upper = i + 1 < bounds.size() ? bounds[i + 1] - 1 : std::numeric_limits<char32_t>::max();
+            int32_t column = static_cast<int32_t>(columns.size());
+            bool used = false;
+            for (size_t v = 0; v < vertices.size(); v++)
+            {
+                if (vertices[v].kind == CaptureVertexKind::Range && vertices[v].charClass.Contains(bounds[i]))
+                {
+                    vertexColumns[v].push_back(column);
+                    used = true;
+                }
+            }
+            if (used)
+            {
+                columns.push_back(CaptureColumn{bounds[i], upper, column});
+            }
+        }
+        return columns;
+    }
+} // namespace regex
\ No newline at end of file
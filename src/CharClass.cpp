@@ -0,0 +1,189 @@
+#include "CharClass.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "UnicodeTables.hpp"
+
+namespace regex
+{
+    CharClass::CharClass(char32_t lower, char32_t upper)
+    {
+        AddRange(lower, upper);
+    }
+
+    CharClass::CharClass(std::initializer_list<std::pair<char32_t, char32_t>> ranges)
+    {
+        for (const auto &[lower, upper] : ranges)
+        {
+            AddRange(lower, upper);
+        }
+    }
+
+    CharClass::CharClass(vector<UnicodeRange> ranges) : ranges{std::move(ranges)}
+    {
+        for (const auto &range : this->ranges)
+        {
+            if (range.rangeType != RangeType::CharacterRange || range.lower > range.upper ||
+                range.upper > MAX_CODE_POINT)
+            {
+                throw std::invalid_argument("invalid character range");
+            }
+        }
+        Normalize();
+    }
+
+    CharClass CharClass::Any()
+    {
+        return CharClass(0, MAX_CODE_POINT);
+    }
+
+    /**
+     * CharClass::AddRange
+     *
+     * @param  {char32_t} lower : the first code point of the range
+     * @param  {char32_t} upper : the last code point of the range
+     */
+    void CharClass::AddRange(char32_t lower, char32_t upper)
+    {
+        if (lower > upper || upper > MAX_CODE_POINT)
+        {
+            throw std::invalid_argument("invalid character range");
+        }
+        else
+        {
+            ranges.emplace_back(RangeType::CharacterRange, lower, upper);
+            Normalize();
+        }
+    }
+
+    CharClass CharClass::Union(const CharClass &other) const
+    {
+        CharClass result;
+        result.ranges.reserve(ranges.size() + other.ranges.size());
+        std::merge(ranges.begin(), ranges.end(), other.ranges.begin(), other.ranges.end(),
+                   std::back_inserter(result.ranges),
+                   [](const UnicodeRange &x, const UnicodeRange &y) { return x.lower < y.lower; });
+        result.Normalize();
+        return result;
+    }
+
+    CharClass CharClass::Intersect(const CharClass &other) const
+    {
+        CharClass result;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < ranges.size() && j < other.ranges.size())
+        {
+            char32_t lower = std::max(ranges[i].lower, other.ranges[j].lower);
+            char32_t upper = std::min(ranges[i].upper, other.ranges[j].upper);
+            if (lower <= upper)
+            {
+                result.ranges.emplace_back(RangeType::CharacterRange, lower, upper);
+            }
+            else
+            {
+                // the two ranges do not overlap
+            }
+            /* the range which ends first cannot overlap with any later range of the other class */
+            if (ranges[i].upper < other.ranges[j].upper)
+            {
+                i++;
+            }
+            else
+            {
+                j++;
+            }
+        }
+        return result;
+    }
+
+    CharClass CharClass::Difference(const CharClass &other) const
+    {
+        return Intersect(other.Negate());
+    }
+
+    CharClass CharClass::Negate() const
+    {
+        CharClass result;
+        char32_t next = 0;
+        for (const auto &range : ranges)
+        {
+            if (next < range.lower)
+            {
+                result.ranges.emplace_back(RangeType::CharacterRange, next, range.lower - 1);
+            }
+            next = range.upper + 1;
+        }
+        if (next <= MAX_CODE_POINT)
+        {
+            result.ranges.emplace_back(RangeType::CharacterRange, next, MAX_CODE_POINT);
+        }
+        return result;
+    }
+
+    bool CharClass::Contains(char32_t c) const
+    {
+        auto it = std::upper_bound(ranges.begin(), ranges.end(), c,
+                                   [](char32_t c, const UnicodeRange &range) { return c < range.lower; });
+        return it != ranges.begin() && (it - 1)->upper >= c;
+    }
+
+    /**
+     * CharClass::Normalize
+     *
+     * Sort the ranges and merge the ones which overlap or touch each other.
+     */
+    void CharClass::Normalize()
+    {
+        if (!std::is_sorted(ranges.begin(), ranges.end(),
+                            [](const UnicodeRange &x, const UnicodeRange &y) { return x.lower < y.lower; }))
+        {
+            std::sort(ranges.begin(), ranges.end(),
+                      [](const UnicodeRange &x, const UnicodeRange &y) { return x.lower < y.lower; });
+        }
+        size_t n = 0;
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            if (n > 0 && ranges[i].lower <= ranges[n - 1].upper + 1)
+            {
+                ranges[n - 1].upper = std::max(ranges[n - 1].upper, ranges[i].upper);
+            }
+            else
+            {
+                ranges[n++] = ranges[i];
+            }
+        }
+        ranges.resize(n);
+    }
+
+    /**
+     * CharClass::FoldCase
+     *
+     * @return {CharClass} : the class with every other case of its code points added, by Unicode simple
+     *                       case folding. Only the code points with other cases are visited.
+     */
+    CharClass CharClass::FoldCase() const
+    {
+        const UnicodeCaseOrbit *begin = CASE_ORBITS;
+        const UnicodeCaseOrbit *end = CASE_ORBITS + CASE_ORBIT_COUNT;
+        auto find = [begin, end](char32_t c) {
+            return std::lower_bound(begin, end, c,
+                                    [](const UnicodeCaseOrbit &orbit, char32_t c) { return orbit.c < c; });
+        };
+        vector<UnicodeRange> folded = ranges;
+        for (const auto &range : ranges)
+        {
+            for (auto it = find(range.lower); it != end && it->c <= range.upper; it++)
+            {
+                /* walk the orbit around to the code point of the range */
+                for (char32_t c = it->next; c != it->c; c = find(c)->next)
+                {
+                    folded.emplace_back(RangeType::CharacterRange, c, c);
+                }
+            }
+        }
+        return CharClass(std::move(folded));
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,441 @@
+#include "CodeGenerator.hpp"
+
+#include <cctype>
+#include <stdexcept>
+
+namespace regex
+{
+    using std::ostringstream;
+
+    namespace
+    {
+        bool IsIdentifier(const string &name)
+        {
+            if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+            {
+                return false;
+            }
+            for (char c : name)
+            {
+                if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        string Indent(int indent)
+        {
+            return string(static_cast<size_t>(indent) * 4, ' ');
+        }
+
+        string Hex(char32_t c)
+        {
+            ostringstream out;
+            out << "0x" << std::hex << std::uppercase << static_cast<uint32_t>(c);
+            return out.str();
+        }
+    } // namespace
+
+    /**
+     * CppCodeGenerator::CppCodeGenerator
+     *
+     * @param  {DFAMatrix} matrix    : the compiled matcher, read through its binary image
+     * @param  {string} name         : the name of the generated struct
+     * @param  {string} nameSpace    : the namespace of the generated struct
+     */
+    CppCodeGenerator::CppCodeGenerator(const DFAMatrix &matrix, string name, string nameSpace)
+        : matrix{matrix}, name{std::move(name)}, nameSpace{std::move(nameSpace)}
+    {
+        if (!IsIdentifier(this->name) || !IsIdentifier(this->nameSpace))
+        {
+            throw std::invalid_argument("the name and the namespace of a generated matcher must be identifiers");
+        }
+        else if (matrix.ImageData() == nullptr)
+        {
+            throw std::invalid_argument("cannot generate a matcher from an empty DFA matrix");
+        }
+        else
+        {
+            // pass
+        }
+        header = &ValidateDFAImage(matrix.ImageData(), matrix.ImageSize());
+        /* cover all the code points and one past the last, so that the tree needs no bound check */
+        const auto *ranges = reinterpret_cast<const DFAImageRange *>(matrix.ImageData() + header->rangesOffset);
+        char32_t next = 0;
+        auto append = [this](char32_t lower, int column) {
+            if (segments.empty() || segments.back().column != column)
+            {
+                segments.push_back(Segment{lower, column});
+            }
+            else
+            {
+                /* extends the previous segment */
+            }
+        };
+        for (size_t i = 0; i < header->rangeCount; i++)
+        {
+            if (next < ranges[i].lower)
+            {
+                append(next, -1);
+            }
+            append(ranges[i].lower, ranges[i].column);
+            next = ranges[i].upper + 1;
+        }
+        append(next, -1);
+    }
+
+    /**
+     * CppCodeGenerator::Generate
+     *
+     * @return {string} : the source of a header defining the generated matcher
+     */
+    string CppCodeGenerator::Generate() const
+    {
+        string guard;
+        for (char c : nameSpace + "_" + name + "_HPP")
+        {
+            guard += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+        ostringstream out;
+        out << "// Generated by RegexCodegen from a compiled DFA matrix. Do not edit.\n"
+            << "#ifndef " << guard << "\n"
+            << "#define " << guard << "\n"
+            << "#include <cstddef>\n"
+            << "\n"
+            << "namespace " << nameSpace << "\n"
+            << "{\n";
+        if (HasSearchStates())
+        {
+            /* the reversed matrix reads back from the end of a match to its start */
+            CppCodeGenerator(*matrix.Reversed(), name + "Reverse", nameSpace).GenerateStruct(out, true);
+            out << "\n";
+        }
+        GenerateStruct(out, false);
+        out << "} // namespace " << nameSpace << "\n"
+            << "\n"
+            << "#endif // " << guard << "\n";
+        return out.str();
+    }
+
+    /**
+     * CppCodeGenerator::HasSearchStates
+     *
+     * @return {bool} : whether the matrix has search states and the reversed matrix to find the start of a match
+     */
+    bool CppCodeGenerator::HasSearchStates() const
+    {
+        return header->stateCount > 0 && header->searchStartStates[0] != -1 && matrix.Reversed() != nullptr;
+    }
+
+    /**
+     * CppCodeGenerator::GenerateStruct
+     *
+     * Emit the struct of the matcher. A backward matcher reads from "end" back to "begin" like
+     * DFAMatrix::MatchBackward, and only has the Column, Context and MatchFrom functions.
+     *
+     * @param  {ostringstream} out : the generated source
+     * @param  {bool} backward     : whether the matcher reads the string backwards
+     */
+    void CppCodeGenerator::GenerateStruct(ostringstream &out, bool backward) const
+    {
+        bool search = !backward && HasSearchStates();
+        size_t stateCount = search ? header->stateCount : header->anchoredStateCount;
+        out << "    struct " << name << "\n"
+            << "    {\n"
+            << "        static int Column(char32_t c)\n"
+            << "        {\n";
+        GenerateColumnTree(out, 0, segments.size(), 3);
+        out << "        }\n"
+            << "\n";
+        bool contexts = header->assertionTypes != 0 && header->stateCount > 0;
+        if (contexts)
+        {
+            /* the same contexts as CharacterContext */
+            out << "        static int Context(char32_t c)\n"
+                << "        {\n"
+                << "            if (c == 0xA)\n"
+                << "            {\n"
+                << "                return 1;\n"
+                << "            }\n"
+                << "            else if ((c >= 0x30 && c <= 0x39) || (c >= 0x41 && c <= 0x5A) || (c >= 0x61 && c <= 0x7A) ||\n"
+                << "                     c == 0x5F)\n"
+                << "            {\n"
+                << "                return 2;\n"
+                << "            }\n"
+                << "            return 3;\n"
+                << "        }\n"
+                << "\n";
+        }
+        if (!backward)
+        {
+            out << "        static int Match(const char32_t *begin, const char32_t *end, bool greedy)\n"
+                << "        {\n"
+                << "            return MatchFrom(" << header->startStates[0] << ", begin, end, greedy);\n"
+                << "        }\n"
+                << "\n";
+        }
+        out << "        static int MatchFrom(int state, const char32_t *begin, const char32_t *end, bool greedy)\n"
+            << "        {\n";
+        if (header->stateCount == 0)
+        {
+            out << "            (void)state;\n"
+                << "            (void)begin;\n"
+                << "            (void)end;\n"
+                << "            (void)greedy;\n"
+                << "            return -1;\n";
+        }
+        else
+        {
+            bool accepting = false;
+            for (size_t state = 0; state < stateCount; state++)
+            {
+                accepting = accepting || AcceptsAtEnd(state);
+            }
+            /* greedy is unused if every accepting state is a dead end */
+            out << "            (void)greedy;\n"
+                << "            int last = -1;\n";
+            if (backward)
+            {
+                out << "            const char32_t *i = end;\n"
+                    << "            while (i > begin)\n";
+            }
+            else
+            {
+                out << "            const char32_t *i = begin;\n"
+                    << "            while (i < end)\n";
+            }
+            out << "            {\n"
+                << "                switch (state)\n"
+                << "                {\n";
+            for (size_t state = 0; state < stateCount; state++)
+            {
+                GenerateState(out, state, backward);
+            }
+            out << "                default:\n"
+                << "                    return -1;\n"
+                << "                }\n"
+                << "            }\n"
+                << "            switch (state)\n"
+                << "            {\n";
+            for (size_t state = 0; state < stateCount; state++)
+            {
+                if (AcceptsAtEnd(state))
+                {
+                    out << "            case " << state << ":\n";
+                }
+            }
+            if (accepting)
+            {
+                out << "                return static_cast<int>(end - begin);\n";
+            }
+            out << "            default:\n"
+                << "                return last;\n"
+                << "            }\n";
+        }
+        out << "        }\n";
+        if (!backward)
+        {
+            out << "\n"
+                << "        static bool FullMatch(const char32_t *begin, const char32_t *end)\n"
+                << "        {\n"
+                << "            return Match(begin, end, true) == static_cast<int>(end - begin);\n"
+                << "        }\n"
+                << "\n"
+                << "        static const char32_t *Search(const char32_t *begin, const char32_t *end)\n"
+                << "        {\n";
+            GenerateSearch(out, contexts);
+            out << "        }\n";
+        }
+        out << "    };\n";
+    }
+
+    /**
+     * CppCodeGenerator::GenerateSearch
+     *
+     * Emit the body of Search. With search states, it reads the string once to the end of the
+     * leftmost-longest match and reads back to its start with the reversed matrix, like
+     * DFAMatrix::Search. Otherwise it tries an anchored match at every start, in quadratic time.
+     *
+     * @param  {ostringstream} out : the generated source
+     * @param  {bool} contexts     : whether the matrix has assertions
+     */
+    void CppCodeGenerator::GenerateSearch(ostringstream &out, bool contexts) const
+    {
+        if (HasSearchStates())
+        {
+            const auto &reversed = *matrix.Reversed();
+            const auto &reverseHeader = ValidateDFAImage(reversed.ImageData(), reversed.ImageSize());
+            const string reverse = name + "Reverse";
+            out << "            int length = MatchFrom(" << header->searchStartStates[0] << ", begin, end, true);\n"
+                << "            if (length == -1)\n"
+                << "            {\n"
+                << "                return end;\n"
+                << "            }\n"
+                << "            const char32_t *matchEnd = begin + length;\n";
+            if (reverseHeader.assertionTypes != 0)
+            {
+                out << "            static const int starts[] = {" << reverseHeader.startStates[0] << ", "
+                    << reverseHeader.startStates[1] << ", " << reverseHeader.startStates[2] << ", "
+                    << reverseHeader.startStates[3] << "};\n"
+                    << "            int state = starts[matchEnd == end ? 0 : " << reverse << "::Context(*matchEnd)];\n";
+            }
+            else
+            {
+                out << "            int state = " << reverseHeader.startStates[0] << ";\n";
+            }
+            out << "            return matchEnd - " << reverse << "::MatchFrom(state, begin, matchEnd, true);\n";
+        }
+        else
+        {
+            if (contexts)
+            {
+                out << "            static const int starts[] = {" << header->startStates[0] << ", "
+                    << header->startStates[1] << ", " << header->startStates[2] << ", " << header->startStates[3]
+                    << "};\n"
+                    << "            for (const char32_t *start = begin; start < end; start++)\n"
+                    << "            {\n"
+                    << "                int state = starts[start == begin ? 0 : Context(start[-1])];\n"
+                    << "                if (MatchFrom(state, start, end, false) != -1)\n";
+            }
+            else
+            {
+                out << "            for (const char32_t *start = begin; start < end; start++)\n"
+                    << "            {\n"
+                    << "                if (Match(start, end, false) != -1)\n";
+            }
+            out << "                {\n"
+                << "                    return start;\n"
+                << "                }\n"
+                << "            }\n"
+                << "            return end;\n";
+        }
+    }
+
+    int CppCodeGenerator::Next(size_t state, int column) const
+    {
+        const auto *transitions = reinterpret_cast<const int32_t *>(matrix.ImageData() + header->transitionsOffset);
+        return transitions[state * header->columnCount + column];
+    }
+
+    uint8_t CppCodeGenerator::Accepting(size_t state) const
+    {
+        return matrix.ImageData()[header->acceptingOffset + state] & DFA_IMAGE_ALWAYS_ACCEPTING;
+    }
+
+    bool CppCodeGenerator::AcceptsAtEnd(size_t state) const
+    {
+        return (Accepting(state) >> static_cast<int>(CharacterContext::TextEdge)) & 1;
+    }
+
+    /**
+     * CppCodeGenerator::GenerateColumnTree
+     *
+     * Emit a balanced tree of comparisons finding the column of c among the segments [first, last).
+     *
+     * @param  {ostringstream} out : the generated source
+     * @param  {size_t} first      : the first segment
+     * @param  {size_t} last       : one past the last segment
+     * @param  {int} indent        : the indentation level of the emitted statements
+     */
+    void CppCodeGenerator::GenerateColumnTree(ostringstream &out, size_t first, size_t last, int indent) const
+    {
+        if (last - first == 1)
+        {
+            out << Indent(indent) << "return " << segments[first].column << ";\n";
+        }
+        else
+        {
+            size_t middle = first + (last - first) / 2;
+            out << Indent(indent) << "if (c < " << Hex(segments[middle].lower) << ")\n"
+                << Indent(indent) << "{\n";
+            GenerateColumnTree(out, first, middle, indent + 1);
+            out << Indent(indent) << "}\n"
+                << Indent(indent) << "else\n"
+                << Indent(indent) << "{\n";
+            GenerateColumnTree(out, middle, last, indent + 1);
+            out << Indent(indent) << "}\n";
+        }
+    }
+
+    /**
+     * CppCodeGenerator::GenerateState
+     *
+     * Emit the case of a state, following the semantics of DFAMatrix::MatchFrom, or of
+     * DFAMatrix::MatchBackward for a backward matcher. A state accepting in some contexts only checks
+     * the context of the next character.
+     *
+     * @param  {ostringstream} out : the generated source
+     * @param  {size_t} state      : the state
+     * @param  {bool} backward     : whether the matcher reads the string backwards
+     */
+    void CppCodeGenerator::GenerateState(ostringstream &out, size_t state, bool backward) const
+    {
+        const string body = Indent(5);
+        const string character = backward ? "i[-1]" : "*i";
+        const string length = backward ? "static_cast<int>(end - i)" : "static_cast<int>(i - begin)";
+        uint8_t accepting = Accepting(state);
+        const string fail = accepting == DFA_IMAGE_ALWAYS_ACCEPTING ? "return " + length + ";" : "return last;";
+        out << "                case " << state << ":\n"
+            << "                {\n";
+        vector<std::pair<int, int>> characters;
+        for (int column = 0; column < static_cast<int>(header->columnCount); column++)
+        {
+            if (Next(state, column) != -1)
+            {
+                characters.emplace_back(column, Next(state, column));
+            }
+        }
+        if (accepting == DFA_IMAGE_ALWAYS_ACCEPTING && !characters.empty())
+        {
+            out << body << "if (!greedy)\n"
+                << body << "{\n"
+                << body << "    return " << length << ";\n"
+                << body << "}\n"
+                << body << "last = " << length << ";\n";
+        }
+        else if (accepting != 0 && accepting != DFA_IMAGE_ALWAYS_ACCEPTING)
+        {
+            out << body << "if ((" << static_cast<int>(accepting) << " >> Context(" << character << ")) & 1)\n"
+                << body << "{\n";
+            if (!characters.empty())
+            {
+                out << body << "    if (!greedy)\n"
+                    << body << "    {\n"
+                    << body << "        return " << length << ";\n"
+                    << body << "    }\n"
+                    << body << "    last = " << length << ";\n";
+            }
+            else
+            {
+                out << body << "    return " << length << ";\n";
+            }
+            out << body << "}\n";
+        }
+        else
+        {
+            /* a dead end returns at once */
+        }
+        if (characters.empty())
+        {
+            out << body << fail << "\n";
+        }
+        else
+        {
+            out << body << "switch (Column(" << character << "))\n"
+                << body << "{\n";
+            for (const auto &[column, next] : characters)
+            {
+                out << body << "case " << column << ":\n"
+                    << body << "    state = " << next << ";\n"
+                    << body << "    " << (backward ? "i--" : "i++") << ";\n"
+                    << body << "    continue;\n";
+            }
+            out << body << "default:\n"
+                << body << "    " << fail << "\n"
+                << body << "}\n";
+        }
+        out << "                }\n";
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,604 @@
+#include "CountingMatcher.hpp"
+
+#include <algorithm>
+
+namespace regex
+{
+    struct CountingFragment
+    {
+        StateID start;
+        StateID end;
+        StateID first;
+    };
+
+    static int UnrolledSize(const RepeatExpression &exp)
+    {
+        return exp.IsBounded() ? exp.atMost : exp.atLeast + 1;
+    }
+
+    static bool IsSingleCharacter(const RegularExpression::Ptr &exp)
+    {
+        return exp->Kind() == RegularExpressionKind::CharClass ||
+               (exp->Kind() == RegularExpressionKind::Symbol &&
+                static_cast<const SymbolExpression &>(*exp).range.rangeType == RangeType::CharacterRange);
+    }
+
+    static RangeType AssertionType(CountingStateKind kind)
+    {
+        switch (kind)
+        {
+        case CountingStateKind::LineBegin:
+            return RangeType::LineBegin;
+        case CountingStateKind::LineEnd:
+            return RangeType::LineEnd;
+        case CountingStateKind::WordBoundary:
+            return RangeType::WordBoundary;
+        default:
+            return RangeType::NotWordBoundary;
+        }
+    }
+
+    static CharClass CharacterSet(const RegularExpression::Ptr &exp)
+    {
+        if (exp->Kind() == RegularExpressionKind::CharClass)
+        {
+            return static_cast<const CharClassExpression &>(*exp).charClass;
+        }
+        else
+        {
+            const UnicodeRange &range = static_cast<const SymbolExpression &>(*exp).range;
+            return CharClass(range.lower, range.upper);
+        }
+    }
+
+    /**
+     * CountingProgramBuilder
+     *
+     * Builds the Thompson NFA of a counting matcher. Every fragment has a distinct start state and
+     * an epsilon end state without successors, which is connected by the parent fragment.
+     */
+    class CountingProgramBuilder : public RegularExpressionFolder<CountingFragment>
+    {
+    public:
+        CountingMatcher &matcher;
+        int threshold;
+
+        CountingProgramBuilder(CountingMatcher &matcher, int threshold) : matcher{matcher}, threshold{threshold} {}
+
+        CountingFragment FoldAlternation(const AlternationExpression::Ptr &, vector<CountingFragment> &items) override
+        {
+            StateID in = AddState(CountingStateKind::Epsilon);
+            StateID out = AddState(CountingStateKind::Epsilon);
+            for (const auto &item : items)
+            {
+                Connect(in, item.start);
+                Connect(item.end, out);
+            }
+            return CountingFragment{in, out, items.front().first};
+        }
+        CountingFragment FoldConcatenation(const ConcatenationExpression::Ptr &,
+                                           vector<CountingFragment> &items) override
+        {
+            for (size_t i = 0; i + 1 < items.size(); i++)
+            {
+                Connect(items[i].end, items[i + 1].start);
+            }
+            return CountingFragment{items.front().start, items.back().end, items.front().first};
+        }
+        CountingFragment FoldKleeneStar(const KleeneStarExpression::Ptr &, CountingFragment &inner) override
+        {
+            return AddKleeneStar(inner);
+        }
+        CountingFragment FoldRepeat(const RepeatExpression::Ptr &exp, CountingFragment &inner) override
+        {
+            if (IsSingleCharacter(exp->innerExp) && UnrolledSize(*exp) > threshold)
+            {
+                return AddCounter(CharacterSet(exp->innerExp), exp->atLeast, exp->atMost, inner.first);
+            }
+            else
+            {
+                return AddRepeat(inner, exp->atLeast, exp->atMost);
+            }
+        }
+        CountingFragment FoldSymbol(const SymbolExpression::Ptr &exp) override
+        {
+            CountingStateKind kind;
+            switch (exp->range.rangeType)
+            {
+            case RangeType::LineBegin:
+                kind = CountingStateKind::LineBegin;
+                break;
+            case RangeType::LineEnd:
+                kind = CountingStateKind::LineEnd;
+                break;
+            case RangeType::WordBoundary:
+                kind = CountingStateKind::WordBoundary;
+                break;
+            case RangeType::NotWordBoundary:
+                kind = CountingStateKind::NotWordBoundary;
+                break;
+            default:
+                kind = CountingStateKind::Range;
+                break;
+            }
+            StateID start = AddState(kind);
+            StateID end = AddState(CountingStateKind::Epsilon);
+            if (kind == CountingStateKind::Range)
+            {
+                matcher.states[start].charClass = CharClass(exp->range.lower, exp->range.upper);
+            }
+            Connect(start, end);
+            return CountingFragment{start, end, start};
+        }
+        CountingFragment FoldCharClass(const CharClassExpression::Ptr &exp) override
+        {
+            StateID start = AddState(CountingStateKind::Range);
+            StateID end = AddState(CountingStateKind::Epsilon);
+            matcher.states[start].charClass = exp->charClass;
+            Connect(start, end);
+            return CountingFragment{start, end, start};
+        }
+        CountingFragment FoldCapture(const CaptureExpression::Ptr &, CountingFragment &inner) override
+        {
+            return inner;
+        }
+
+    private:
+        StateID AddState(CountingStateKind kind)
+        {
+            matcher.states.push_back(CountingState{kind, CharClass(), {}, -1});
+            return matcher.states.size() - 1;
+        }
+        void Connect(StateID from, StateID to)
+        {
+            matcher.states[from].next.push_back(to);
+        }
+        int AddCounterEntry(const CharClass &charClass, int atLeast, int atMost, StateID exit)
+        {
+            int bits = atMost == RepeatExpression::UNBOUNDED ? std::max(atLeast, 1) : atMost;
+            size_t words = (static_cast<size_t>(bits) + 63) / 64;
+            matcher.counters.push_back(Counter{charClass, atLeast, atMost, exit, matcher.windowSize, words, bits});
+            matcher.windowSize += words;
+            return static_cast<int>(matcher.counters.size()) - 1;
+        }
+        CountingFragment AddCounter(const CharClass &charClass, int atLeast, int atMost, StateID first)
+        {
+            StateID start = AddState(CountingStateKind::Counter);
+            StateID end = AddState(CountingStateKind::Epsilon);
+            matcher.states[start].counter = AddCounterEntry(charClass, atLeast, atMost, end);
+            if (atLeast == 0)
+            {
+                /* zero repetitions: the counter can be left right after entering it */
+                Connect(start, end);
+            }
+            return CountingFragment{start, end, first};
+        }
+        CountingFragment AddKleeneStar(const CountingFragment &inner)
+        {
+            StateID in = AddState(CountingStateKind::Epsilon);
+            StateID out = AddState(CountingStateKind::Epsilon);
+            Connect(in, inner.start);
+            Connect(in, out);
+            Connect(inner.end, inner.start);
+            Connect(inner.end, out);
+            return CountingFragment{in, out, inner.first};
+        }
+        CountingFragment Clone(const CountingFragment &fragment, StateID last)
+        {
+            StateID offset = matcher.states.size() - fragment.first;
+            for (StateID s = fragment.first; s < last; s++)
+            {
+                CountingState state = matcher.states[s];
+                for (auto &next : state.next)
+                {
+                    next += offset;
+                }
+                if (state.kind == CountingStateKind::Counter)
+                {
+                    const Counter counter = matcher.counters[state.counter];
+                    state.counter = AddCounterEntry(counter.charClass, counter.atLeast, counter.atMost,
+                                                    counter.exit + offset);
+                }
+                matcher.states.push_back(state);
+            }
+            return CountingFragment{fragment.start + offset, fragment.end + offset, fragment.first + offset};
+        }
+        /* the same shape as NFA::AddRepeat */
+        CountingFragment AddRepeat(const CountingFragment &inner, int atLeast, int atMost)
+        {
+            bool bounded = atMost != RepeatExpression::UNBOUNDED;
+            int copyCount = bounded ? atMost : atLeast + 1;
+            if (copyCount == 0)
+            {
+                StateID start = AddState(CountingStateKind::Epsilon);
+                StateID end = AddState(CountingStateKind::Epsilon);
+                Connect(start, end);
+                return CountingFragment{start, end, inner.first};
+            }
+            StateID last = matcher.states.size();
+            vector<CountingFragment> copies = {inner};
+            for (int i = 1; i < copyCount; i++)
+            {
+                copies.push_back(Clone(inner, last));
+            }
+            StateID start = AddState(CountingStateKind::Epsilon);
+            StateID current = start;
+            for (int i = 0; i < atLeast; i++)
+            {
+                Connect(current, copies[i].start);
+                current = copies[i].end;
+            }
+            StateID out = AddState(CountingStateKind::Epsilon);
+            if (bounded)
+            {
+                for (int i = atLeast; i < atMost; i++)
+                {
+                    Connect(current, copies[i].start);
+                    Connect(current, out);
+                    current = copies[i].end;
+                }
+                Connect(current, out);
+            }
+            else
+            {
+                CountingFragment star = AddKleeneStar(copies.back());
+                Connect(current, star.start);
+                Connect(star.end, out);
+            }
+            return CountingFragment{start, out, inner.first};
+        }
+    };
+
+    class CountedRepetitionCounter : public RegularExpressionFolder<size_t>
+    {
+    public:
+        int threshold;
+
+        explicit CountedRepetitionCounter(int threshold) : threshold{threshold} {}
+
+        size_t FoldAlternation(const AlternationExpression::Ptr &, vector<size_t> &items) override
+        {
+            return Sum(items);
+        }
+        size_t FoldConcatenation(const ConcatenationExpression::Ptr &, vector<size_t> &items) override
+        {
+            return Sum(items);
+        }
+        size_t FoldKleeneStar(const KleeneStarExpression::Ptr &, size_t &inner) override
+        {
+            return inner;
+        }
+        size_t FoldRepeat(const RepeatExpression::Ptr &exp, size_t &inner) override
+        {
+            return inner + ((IsSingleCharacter(exp->innerExp) && UnrolledSize(*exp) > threshold) ? 1 : 0);
+        }
+        size_t FoldSymbol(const SymbolExpression::Ptr &) override
+        {
+            return 0;
+        }
+        size_t FoldCharClass(const CharClassExpression::Ptr &) override
+        {
+            return 0;
+        }
+        size_t FoldCapture(const CaptureExpression::Ptr &, size_t &inner) override
+        {
+            return inner;
+        }
+
+    private:
+        static size_t Sum(const vector<size_t> &items)
+        {
+            size_t sum = 0;
+            for (size_t item : items)
+            {
+                sum += item;
+            }
+            return sum;
+        }
+    };
+
+    /**
+     * CountingMatcher::CountingMatcher
+     *
+     * @param  {RegularExpression::Ptr} exp : the expression to match
+     * @param  {int} threshold              : repetitions of a single character class that would be unrolled
+     *                                        to more than "threshold" copies are executed as counters
+     */
+    CountingMatcher::CountingMatcher(const RegularExpression::Ptr &exp, int threshold) : windowSize{0}
+    {
+        CountingProgramBuilder builder(*this, threshold);
+        CountingFragment fragment = builder.Fold(exp);
+        startState = fragment.start;
+        acceptState = fragment.end;
+    }
+
+    /**
+     * CountingMatcher::HasCountedRepetition
+     *
+     * @return {bool} : true if the expression contains a repetition that would be executed as a counter
+     */
+    bool CountingMatcher::HasCountedRepetition(const RegularExpression::Ptr &exp, int threshold)
+    {
+        CountedRepetitionCounter counter(threshold);
+        return counter.Fold(exp) > 0;
+    }
+
+    CountingMatcher::Threads::Threads(size_t stateCount, size_t windowSize, size_t counterCount)
+        : marks(stateCount, 0), generation{1}, windows(windowSize, 0), entered(counterCount, false) {}
+
+    void CountingMatcher::Threads::Clear()
+    {
+        list.clear();
+        generation++;
+        if (generation == 0)
+        {
+            std::fill(marks.begin(), marks.end(), 0);
+            generation = 1;
+        }
+        std::fill(windows.begin(), windows.end(), 0);
+        std::fill(entered.begin(), entered.end(), false);
+    }
+
+    CountingMatcher::RunBuffers::RunBuffers(size_t stateCount, size_t windowSize, size_t counterCount)
+        : current(stateCount, windowSize, counterCount), next(stateCount, windowSize, counterCount) {}
+
+    bool CountingMatcher::Threads::IsEmpty() const
+    {
+        return list.empty() && std::find(entered.begin(), entered.end(), true) == entered.end() &&
+               std::find_if(windows.begin(), windows.end(), [](uint64_t word) { return word != 0; }) == windows.end();
+    }
+
+    bool CountingMatcher::FullMatch(const u32string &str) const
+    {
+        return Match(str.begin(), str.end(), true) == static_cast<int>(str.size());
+    }
+
+    /**
+     * CountingMatcher::Search
+     *
+     * One unanchored simulation finds the end of the first match, so a string without a match is read
+     * once. The leftmost match starts at or before that end, and only those starts are tried.
+     *
+     * @return {u32string::const_iterator} : The start position of the first occurrence of the pattern. It equals to "strEnd" if the pattern is not found.
+     */
+    u32string::const_iterator CountingMatcher::Search(
+        u32string::const_iterator strBegin, u32string::const_iterator strEnd) const
+    {
+        RunBuffers buffers(states.size(), windowSize, counters.size());
+        int firstEnd = FirstMatchEnd(strBegin, strEnd, buffers);
+        if (firstEnd == -1)
+        {
+            return strEnd;
+        }
+        for (u32string::const_iterator start = strBegin; start < strEnd && start <= strBegin + firstEnd; start++)
+        {
+            if (MatchFrom(strBegin, start, strEnd, false, buffers) != -1)
+            {
+                return start;
+            }
+        }
+        return strEnd;
+    }
+
+    /**
+     * CountingMatcher::Match
+     *
+     * Match the pattern from the beginning. Same semantics as DFAMatrix::Match.
+     *
+     * @return {int} : the length of the matched string. -1 if no match.
+     */
+    int CountingMatcher::Match(
+        u32string::const_iterator strBegin, u32string::const_iterator strEnd, bool greedyMode) const
+    {
+        RunBuffers buffers(states.size(), windowSize, counters.size());
+        return MatchFrom(strBegin, strBegin, strEnd, greedyMode, buffers);
+    }
+
+    /**
+     * CountingMatcher::MatchFrom
+     *
+     * @param  {u32string::const_iterator} textBegin : the start of the text, which the assertions look back to
+     * @param  {RunBuffers} buffers                  : the thread sets, cleared before they are used
+     * @return {int}                                 : the length of the string matched from strBegin. -1 if no match.
+     */
+    int CountingMatcher::MatchFrom(u32string::const_iterator textBegin, u32string::const_iterator strBegin,
+                                   u32string::const_iterator strEnd, bool greedyMode, RunBuffers &buffers) const
+    {
+        Threads *current = &buffers.current;
+        Threads *next = &buffers.next;
+        int lastMatchedLength = -1;
+        u32string::const_iterator i = strBegin;
+        current->Clear();
+        AddThread(*current, startState, i, textBegin, strEnd, buffers.stack);
+        while (true)
+        {
+            if (IsAccepting(*current))
+            {
+                if (greedyMode)
+                {
+                    lastMatchedLength = static_cast<int>(i - strBegin);
+                }
+                else
+                {
+                    return static_cast<int>(i - strBegin);
+                }
+            }
+            if (i == strEnd || current->IsEmpty())
+            {
+                return lastMatchedLength;
+            }
+            Step(*current, *next, *i, i + 1, textBegin, strEnd, buffers.stack);
+            std::swap(current, next);
+            i++;
+        }
+    }
+
+    /**
+     * CountingMatcher::FirstMatchEnd
+     *
+     * Simulate the expression from every start at once, adding the start state at each position.
+     *
+     * @param  {RunBuffers} buffers : the thread sets, cleared before they are used
+     * @return {int}                : the end of the first match to end, from strBegin. -1 if no match.
+     */
+    int CountingMatcher::FirstMatchEnd(u32string::const_iterator strBegin, u32string::const_iterator strEnd,
+                                       RunBuffers &buffers) const
+    {
+        Threads *current = &buffers.current;
+        Threads *next = &buffers.next;
+        u32string::const_iterator i = strBegin;
+        current->Clear();
+        AddThread(*current, startState, i, strBegin, strEnd, buffers.stack);
+        while (!IsAccepting(*current))
+        {
+            if (i == strEnd)
+            {
+                return -1;
+            }
+            Step(*current, *next, *i, i + 1, strBegin, strEnd, buffers.stack);
+            /* a match may start after the character */
+            AddThread(*next, startState, i + 1, strBegin, strEnd, buffers.stack);
+            std::swap(current, next);
+            i++;
+        }
+        return static_cast<int>(i - strBegin);
+    }
+
+    /**
+     * CountingMatcher::AddThread
+     *
+     * Add a state and its epsilon closure at position i to the thread set.
+     */
+    void CountingMatcher::AddThread(Threads &threads, StateID state, u32string::const_iterator i,
+                                    u32string::const_iterator textBegin, u32string::const_iterator strEnd,
+                                    vector<StateID> &stack) const
+    {
+        stack.clear();
+        stack.push_back(state);
+        while (!stack.empty())
+        {
+            StateID s = stack.back();
+            stack.pop_back();
+            if (threads.marks[s] == threads.generation)
+            {
+                continue;
+            }
+            threads.marks[s] = threads.generation;
+            const CountingState &st = states[s];
+            switch (st.kind)
+            {
+            case CountingStateKind::Range:
+            {
+                threads.list.push_back(s);
+                break;
+            }
+            case CountingStateKind::LineBegin:
+            case CountingStateKind::LineEnd:
+            case CountingStateKind::WordBoundary:
+            case CountingStateKind::NotWordBoundary:
+            {
+                /* the same contexts as the states of DFAMatrix */
+                CharacterContext behind = i == textBegin ? CharacterContext::TextEdge : ContextOf(i[-1]);
+                CharacterContext ahead = i == strEnd ? CharacterContext::TextEdge : ContextOf(*i);
+                if (AssertionHolds(AssertionType(st.kind), behind, ahead))
+                {
+                    stack.push_back(st.next[0]);
+                }
+                break;
+            }
+            case CountingStateKind::Counter:
+            {
+                threads.entered[st.counter] = true;
+                for (auto it = st.next.rbegin(); it != st.next.rend(); it++)
+                {
+                    stack.push_back(*it);
+                }
+                break;
+            }
+            default:
+            {
+                for (auto it = st.next.rbegin(); it != st.next.rend(); it++)
+                {
+                    stack.push_back(*it);
+                }
+                break;
+            }
+            }
+        }
+    }
+
+    /**
+     * CountingMatcher::Step
+     *
+     * Consume the character c and compute the thread set at position i (the position after c).
+     */
+    void CountingMatcher::Step(const Threads &current, Threads &next, char32_t c, u32string::const_iterator i,
+                               u32string::const_iterator textBegin, u32string::const_iterator strEnd,
+                               vector<StateID> &stack) const
+    {
+        next.Clear();
+        for (size_t k = 0; k < counters.size(); k++)
+        {
+            const Counter &counter = counters[k];
+            if (!counter.charClass.Contains(c))
+            {
+                /* all the windows are already zero after Clear() */
+                continue;
+            }
+            const uint64_t *from = &current.windows[counter.windowOffset];
+            uint64_t *to = &next.windows[counter.windowOffset];
+            /* every active count grows by one, and a thread entering the counter consumes its first character */
+            uint64_t carry = current.entered[k] ? 1 : 0;
+            for (size_t w = 0; w < counter.windowWords; w++)
+            {
+                to[w] = (from[w] << 1) | carry;
+                carry = from[w] >> 63;
+            }
+            size_t topWord = (counter.windowBits - 1) / 64;
+            int topBit = (counter.windowBits - 1) % 64;
+            bool saturated = (from[topWord] >> topBit) & 1;
+            if (topBit < 63)
+            {
+                to[topWord] &= (uint64_t{2} << topBit) - 1;
+            }
+            if (saturated && counter.atMost == RepeatExpression::UNBOUNDED)
+            {
+                to[topWord] |= uint64_t{1} << topBit;
+            }
+        }
+        for (StateID s : current.list)
+        {
+            const CountingState &st = states[s];
+            if (st.charClass.Contains(c))
+            {
+                AddThread(next, st.next[0], i, textBegin, strEnd, stack);
+            }
+        }
+        for (size_t k = 0; k < counters.size(); k++)
+        {
+            const Counter &counter = counters[k];
+            /* leave the counter if any active count is in [atLeast, atMost] */
+            const uint64_t *window = &next.windows[counter.windowOffset];
+            int lowest = std::max(counter.atLeast, 1) - 1;
+            bool canExit = false;
+            for (size_t w = lowest / 64; w < counter.windowWords && !canExit; w++)
+            {
+                uint64_t word = window[w];
+                if (w == static_cast<size_t>(lowest / 64))
+                {
+                    word &= ~((uint64_t{1} << (lowest % 64)) - 1);
+                }
+                canExit = word != 0;
+            }
+            if (canExit)
+            {
+                AddThread(next, counter.exit, i, textBegin, strEnd, stack);
+            }
+        }
+    }
+
+    bool CountingMatcher::IsAccepting(const Threads &threads) const
+    {
+        return threads.marks[acceptState] == threads.generation;
+    }
+} // namespace regex
@@ -1,8 +1,12 @@
 #include "DFA.hpp"
 
+#include <algorithm>
+#include <map>
 #include <stack>
 #include <stdexcept>
 
+#include "FindIter.hpp"
+
 namespace regex
 {
     u32string UnicodeRange::ToString() const
@@ -19,6 +23,14 @@ namespace regex
         {
             return U"$";
         }
+        else if (rangeType == RangeType::WordBoundary)
+        {
+            return U"\\b";
+        }
+        else if (rangeType == RangeType::NotWordBoundary)
+        {
+            return U"\\B";
+        }
         else if (lower == upper)
         {
             return u32string({lower});
@@ -39,8 +51,10 @@ namespace regex
         for (int i = 0, n = static_cast<int>(patterns.Size()); i < n - 1; i++)
         {
             // add all the patterns except epsilon
-            auto pattern = patterns.GetPatternByID(i);
-            graph.patterns.Add(pattern, i);
+            for (const auto &pattern : patterns.GetPatternsByID(i))
+            {
+                graph.patterns.Add(pattern, i);
+            }
         }
         for (auto row : rows)
         {
@@ -59,8 +73,10 @@ namespace regex
                     if (!nextState.empty())
                     {
                         StateID to = RecordState(statesID, nextState);
-                        auto pattern = patterns.GetPatternByID(patternID);
-                        graph.G.AddEdge(Edge(from, to, pattern));
+                        for (const auto &pattern : patterns.GetPatternsByID(patternID))
+                        {
+                            graph.G.AddEdge(Edge(from, to, pattern));
+                        }
                     }
                     patternID++;
                 }
@@ -101,18 +117,194 @@ namespace regex
             return n;
         }
     }
+    /**
+     * BuildClassMap
+     *
+     * Build the two-stage table from characters to columns, so that finding the class of a
+     * character costs two lookups whatever the number of ranges. Identical blocks are shared:
+     * blocks outside of every range and blocks inside a single range are only stored once.
+     *
+     * @param  {DFAImageContents} contents : the contents of an image with its ranges filled in
+     */
+    static void BuildClassMap(DFAImageContents &contents)
+    {
+        const uint16_t noColumn = UINT16_MAX;
+        const auto &ranges = contents.ranges;
+        std::map<vector<uint16_t>, uint16_t> blocks;
+        unordered_map<uint16_t, uint16_t> uniformBlocks;
+        vector<uint16_t> block(DFA_IMAGE_BLOCK_SIZE);
+        size_t r = 0;
+        contents.blockIndices.resize(DFA_IMAGE_BLOCK_INDEX_COUNT);
+        for (size_t b = 0; b < DFA_IMAGE_BLOCK_INDEX_COUNT; b++)
+        {
+            char32_t first = static_cast<char32_t>(b * DFA_IMAGE_BLOCK_SIZE);
+            char32_t last = first + static_cast<char32_t>(DFA_IMAGE_BLOCK_SIZE - 1);
+            while (r < ranges.size() && ranges[r].upper < first)
+            {
+                r++;
+            }
+            uint16_t uniform;
+            if (r == ranges.size() || ranges[r].lower > last)
+            {
+                /* no range meets the block */
+                uniform = noColumn;
+            }
+            else if (ranges[r].lower <= first && ranges[r].upper >= last)
+            {
+                /* a single range covers the block */
+                uniform = static_cast<uint16_t>(ranges[r].column);
+            }
+            else
+            {
+                for (size_t i = 0, k = r; i < DFA_IMAGE_BLOCK_SIZE; i++)
+                {
+                    char32_t c = first + static_cast<char32_t>(i);
+                    while (k < ranges.size() && ranges[k].upper < c)
+                    {
+                        k++;
+                    }
+                    block[i] = k < ranges.size() && ranges[k].lower <= c ? static_cast<uint16_t>(ranges[k].column)
+                                                                          : noColumn;
+                }
+                auto [it, inserted] =
+                    blocks.emplace(block, static_cast<uint16_t>(contents.blockColumns.size() / DFA_IMAGE_BLOCK_SIZE));
+                if (inserted)
+                {
+                    contents.blockColumns.insert(contents.blockColumns.end(), block.begin(), block.end());
+                }
+                contents.blockIndices[b] = it->second;
+                continue;
+            }
+            auto [it, inserted] = uniformBlocks.emplace(
+                uniform, static_cast<uint16_t>(contents.blockColumns.size() / DFA_IMAGE_BLOCK_SIZE));
+            if (inserted)
+            {
+                contents.blockColumns.insert(contents.blockColumns.end(), DFA_IMAGE_BLOCK_SIZE, uniform);
+            }
+            contents.blockIndices[b] = it->second;
+        }
+    }
+
+    /**
+     * DFAMatrix::MarkUniversalStates
+     *
+     * A state is universal if the string is accepted however it goes on from there: it accepts in every
+     * context, every character has a transition, and all of its successors are universal. The
+     * candidates are narrowed down until they are closed under the transitions, once when the image is
+     * built, so that loading it stays free.
+     *
+     * @param  {DFAImageContents} contents : the contents of an image with its ranges sorted
+     */
+    void DFAMatrix::MarkUniversalStates(DFAImageContents &contents)
+    {
+        const auto &ranges = contents.ranges;
+        size_t columnCount = contents.columnCount;
+        bool covered = !ranges.empty() && ranges.front().lower == 0 && ranges.back().upper >= MAX_CHARACTER;
+        for (size_t i = 1; i < ranges.size() && covered; i++)
+        {
+            covered = ranges[i].lower == ranges[i - 1].upper + 1;
+        }
+        if (!covered)
+        {
+            /* some characters have no column and fail everywhere */
+            return;
+        }
+        vector<bool> universal(contents.stateCount, false);
+        for (size_t state = 0; state < contents.stateCount; state++)
+        {
+            universal[state] = contents.accepting[state] == DFA_IMAGE_ALWAYS_ACCEPTING;
+            for (size_t column = 0; column < columnCount && universal[state]; column++)
+            {
+                universal[state] = contents.transitions[state * columnCount + column] != -1;
+            }
+        }
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (size_t state = 0; state < contents.stateCount; state++)
+            {
+                for (size_t column = 0; column < columnCount && universal[state]; column++)
+                {
+                    if (!universal[contents.transitions[state * columnCount + column]])
+                    {
+                        universal[state] = false;
+                        changed = true;
+                    }
+                }
+            }
+        }
+        for (size_t state = 0; state < contents.stateCount; state++)
+        {
+            if (universal[state])
+            {
+                contents.accepting[state] |= DFA_IMAGE_UNIVERSAL;
+            }
+        }
+    }
+
+    /**
+     * DFAMatrix::DFAMatrix
+     *
+     * Lay out a DFA graph as a matrix. A graph has no room for the contexts around the assertions, so
+     * it must not have any; BuildDFAMatrix compiles them.
+     *
+     * @param  {DFA} dfaGraph : a DFA without assertions, whose start state is 0
+     */
     DFAMatrix::DFAMatrix(const DFA &dfaGraph)
-        : matrix(dfaGraph.G.NodeCount(), vector<int>(dfaGraph.patterns.Size(), -1)), patterns{dfaGraph.patterns},
-          endStates{dfaGraph.endStates}
     {
-        for (auto edges : dfaGraph.G.adj)
+        DFAImageContents contents;
+        contents.stateCount = static_cast<uint32_t>(dfaGraph.G.NodeCount());
+        contents.anchoredStateCount = contents.stateCount;
+        contents.columnCount = static_cast<uint32_t>(dfaGraph.patterns.Size());
+        contents.transitions.assign(static_cast<size_t>(contents.stateCount) * contents.columnCount, -1);
+        contents.accepting.assign(contents.stateCount, 0);
+        for (const auto &[pattern, id] : dfaGraph.patterns.patternToID)
+        {
+            if (pattern.rangeType == RangeType::CharacterRange)
+            {
+                contents.ranges.push_back(DFAImageRange{pattern.lower, pattern.upper, id});
+            }
+            else if (!pattern.IsEpsilon())
+            {
+                throw std::invalid_argument("the assertions of a DFA graph have no context");
+            }
+        }
+        for (const auto &edges : dfaGraph.G.adj)
         {
-            for (auto edge : edges)
+            for (const auto &edge : edges)
             {
                 int patternID = dfaGraph.patterns.GetIDByPattern(edge.pattern);
-                matrix.at(edge.from).at(patternID) = edge.to;
+                contents.transitions.at(edge.from * contents.columnCount + patternID) = static_cast<int32_t>(edge.to);
             }
         }
+        for (StateID state : dfaGraph.endStates)
+        {
+            contents.accepting.at(state) = DFA_IMAGE_ALWAYS_ACCEPTING;
+        }
+        *this = FromContents(std::move(contents));
+    }
+    /**
+     * DFAMatrix::FromContents
+     *
+     * @param  {DFAImageContents} contents : the states, transitions and ranges of a DFA; the ranges
+     *                                       can come in any order, and the class map is built here
+     * @return {DFAMatrix}                 : the matrix owning a new image of the contents
+     */
+    DFAMatrix DFAMatrix::FromContents(DFAImageContents contents)
+    {
+        std::sort(contents.ranges.begin(), contents.ranges.end(),
+                  [](const DFAImageRange &x, const DFAImageRange &y) { return x.lower < y.lower; });
+        if (contents.columnCount < NO_COLUMN)
+        {
+            BuildClassMap(contents);
+        }
+        else
+        {
+            /* fall back to the binary search over the ranges */
+        }
+        MarkUniversalStates(contents);
+        return FromImage(BuildDFAImage(contents));
     }
     /**
      * DFAMatrix::FullMatch
@@ -133,11 +325,22 @@ namespace regex
      */
     u32string::const_iterator DFAMatrix::Search(u32string::const_iterator strBegin, u32string::const_iterator strEnd) const
     {
-        if (matrix.size() > 0)
+        if (stateCount > 0 && reversed != nullptr && SearchStartState(CharacterContext::TextEdge) != -1)
+        {
+            /* the end of the leftmost-longest match in one pass, then its start read backwards */
+            int length = MatchFrom(SearchStartState(CharacterContext::TextEdge), strBegin, strEnd, true);
+            if (length == -1)
+            {
+                return strEnd;
+            }
+            auto end = strBegin + length;
+            return end - reversed->MatchBackward(strBegin, strBegin, end, strEnd);
+        }
+        else if (stateCount > 0)
         {
             for (u32string::const_iterator start = strBegin; start < strEnd; start++)
             {
-                int length = Match(start, strEnd, false);
+                int length = MatchFrom(StartState(strBegin, start), start, strEnd, false);
                 if (length != -1)
                 {
                     return start;
@@ -153,7 +356,7 @@ namespace regex
     /**
      * DFAMatrix::Match
      *
-     * Match the pattern from the beginning.
+     * Match the pattern from the beginning, which is taken as the start of the text.
      *
      * @param  {u32string::const_iterator} strBegin : start of the target character range
      * @param  {u32string::const_iterator} strEnd   : end of the target character range
@@ -162,142 +365,266 @@ namespace regex
      */
     int DFAMatrix::Match(u32string::const_iterator strBegin, u32string::const_iterator strEnd, bool greedyMode) const
     {
-        if (matrix.size() > 0)
+        if (stateCount > 0)
         {
-            int state = 0;
-            int lastMatchedLength = -1;
-            u32string::const_iterator i = strBegin;
-            while (i < strEnd)
+            return MatchFrom(StartState(CharacterContext::TextEdge), strBegin, strEnd, greedyMode);
+        }
+        else
+        {
+            return (-1);
+        }
+    }
+    /**
+     * DFAMatrix::MatchFrom
+     *
+     * @param  {int} state                          : the start state, picked by the context before strBegin
+     * @param  {u32string::const_iterator} strBegin : start of the target character range
+     * @param  {u32string::const_iterator} strEnd   : end of the target character range, which is the end of the text
+     * @param  {bool} greedyMode                    : If true, search for the longest match. Otherwise, return immediately once matched.
+     * @return {int}                                : the length of the matched string. -1 if no match.
+     */
+    int DFAMatrix::MatchFrom(int state, u32string::const_iterator strBegin, u32string::const_iterator strEnd,
+                             bool greedyMode) const
+    {
+        int lastMatchedLength = -1;
+        u32string::const_iterator i = strBegin;
+        while (true)
+        {
+            if (Accepts(state, i == strEnd ? CharacterContext::TextEdge : ContextOf(*i)))
             {
-                char32_t c = *i;
-                bool matched = false;
-                if (IsEndState(state))
+                if (!greedyMode)
                 {
-                    if (greedyMode)
-                    {
-                        /* if in greedy mode, keep matching */
-                        /* try to find the longest match */
-                        lastMatchedLength = static_cast<int>(i - strBegin);
-                    }
-                    else
-                    {
-                        /* if not in greedy mode, return the matched length */
-                        return i - strBegin;
-                    }
+                    /* if not in greedy mode, return the matched length */
+                    return static_cast<int>(i - strBegin);
                 }
-                for (size_t j = 0; j < matrix.at(0).size(); j++)
+                else if (IsUniversal(state))
                 {
-                    if (matrix.at(state).at(j) != -1)
-                    {
-                        /* can transit from the current state to the next state if pattern j is matched  */
-                        auto pattern = patterns.GetPatternByID(static_cast<int>(j));
-                        matched = MatchPattern(state, pattern, c, i, j, strBegin, strEnd);
-                        if (matched)
-                        {
-                            /* if found a viable transition, jump out of the searching loop. */
-                            break;
-                        }
-                        else
-                        {
-                            /* keep searching the next possible transition */
-                        }
-                    }
+                    /* every continuation is accepted, so the longest match takes the rest of the string */
+                    return static_cast<int>(strEnd - strBegin);
                 }
-                if (!matched)
+                else
                 {
-                    /* if cannot match any pattern */
-                    if (IsEndState(state))
-                    {
-                        /* if the current state is acceptable, return the current match. */
-                        return i - strBegin;
-                    }
-                    else
-                    {
-                        /* if the current state is not acceptable, return the previous longest match */
-                        return lastMatchedLength;
-                    }
+                    /* keep matching to find the longest match */
+                    lastMatchedLength = static_cast<int>(i - strBegin);
                 }
             }
-            /* reaches to the end of the string */
-            if (IsEndState(state))
+            if (i == strEnd)
             {
-                /* if the current state is acceptable, return the current match. */
-                return strEnd - strBegin;
+                /* reaches to the end of the string */
+                return lastMatchedLength;
             }
-            else
+            int column = CharacterColumn(*i);
+            state = column == -1 ? -1 : Next(state, column);
+            if (state == -1)
             {
-                /* if the current state is not acceptable, return the previous longest match */
+                /* if cannot match any pattern, return the previous longest match */
                 return lastMatchedLength;
             }
+            i++;
         }
-        else
+    }
+
+    /**
+     * DFAMatrix::MatchBackward
+     *
+     * Run the matrix of a reversed expression from "strEnd" back to "strBegin" at the furthest. Read
+     * backward, the character after a position is the one behind, and the character before it is the
+     * one ahead.
+     *
+     * @param  {u32string::const_iterator} textBegin : start of the text
+     * @param  {u32string::const_iterator} strBegin  : the leftmost position a match may start at
+     * @param  {u32string::const_iterator} strEnd    : the end of the matches
+     * @param  {u32string::const_iterator} textEnd   : end of the text
+     * @return {int}                                 : the length of the longest match ending at "strEnd", -1 if
+     *                                                 none does
+     */
+    int DFAMatrix::MatchBackward(u32string::const_iterator textBegin, u32string::const_iterator strBegin,
+                                 u32string::const_iterator strEnd, u32string::const_iterator textEnd) const
+    {
+        if (stateCount == 0)
         {
-            return (-1);
+            return -1;
         }
+        int lastMatchedLength = -1;
+        int state = StartState(strEnd == textEnd ? CharacterContext::TextEdge : ContextOf(*strEnd));
+        u32string::const_iterator i = strEnd;
+        while (true)
+        {
+            if (Accepts(state, i == textBegin ? CharacterContext::TextEdge : ContextOf(i[-1])))
+            {
+                if (IsUniversal(state))
+                {
+                    /* every continuation is accepted, so the longest match reaches "strBegin" */
+                    return static_cast<int>(strEnd - strBegin);
+                }
+                lastMatchedLength = static_cast<int>(strEnd - i);
+            }
+            if (i == strBegin)
+            {
+                return lastMatchedLength;
+            }
+            int column = CharacterColumn(i[-1]);
+            state = column == -1 ? -1 : Next(state, column);
+            if (state == -1)
+            {
+                return lastMatchedLength;
+            }
+            i--;
+        }
+    }
+
+    bool DFAMatrix::IsEndState(int state) const
+    {
+        return accepting[state] != 0;
     }
 
-    bool DFAMatrix::MatchPattern(
-        int &state,
-        const UnicodeRange &pattern,
-        char32_t c,
-        u32string::const_iterator &i,
-        size_t j,
-        u32string::const_iterator strBegin,
-        u32string::const_iterator strEnd) const
+    /**
+     * DFAMatrix::IsMatch
+     *
+     * @param  {u32string} str : the target string
+     * @return {bool}          : true if the pattern matches a substring of str, possibly an empty one. The
+     *                           search states scan the string once and stop at the first accepting one;
+     *                           without them every position is tried.
+     */
+    bool DFAMatrix::IsMatch(const u32string &str) const
     {
-        switch (pattern.rangeType)
+        if (stateCount == 0)
         {
-        case RangeType::CharacterRange:
+            return false;
+        }
+        else if (SearchStartState(CharacterContext::TextEdge) != -1)
+        {
+            return MatchFrom(SearchStartState(CharacterContext::TextEdge), str.begin(), str.end(), false) != -1;
+        }
+        bool everyPosition = StartsWithoutCharacter();
+        for (auto start = str.begin(); start <= str.end(); start++)
         {
-            if (pattern.InBetween(c))
+            if (!everyPosition && (start == str.end() || !CanStartWith(*start)))
+            {
+                continue;
+            }
+            else if (MatchFrom(StartState(str.begin(), start), start, str.end(), false) != -1)
             {
-                // move to the next state
-                state = matrix.at(state).at(j);
-                i++;
                 return true;
             }
             else
             {
-                return false;
+                // try the next position
             }
         }
-        case RangeType::LineBegin:
+        return false;
+    }
+
+    /**
+     * DFAMatrix::Count
+     *
+     * Only the ends of the matches are needed to count them: each search goes on from the end of the
+     * previous match, and an empty match there is skipped, which is what FindIter does whether the
+     * previous match was empty or not.
+     *
+     * @param  {u32string} str : the target string
+     * @return {size_t}        : the number of matches FindIter finds in str
+     */
+    size_t DFAMatrix::Count(const u32string &str) const
+    {
+        size_t count = 0;
+        if (stateCount == 0)
         {
-            if (i == strBegin)
+            return count;
+        }
+        else if (SearchStartState(CharacterContext::TextEdge) == -1)
+        {
+            FindIter iter(*this, str);
+            MatchSpan span;
+            while (iter.Next(span))
             {
-                // move to the next state
-                state = matrix.at(state).at(j);
-                return true;
+                count++;
+            }
+            return count;
+        }
+        size_t lastEnd = SIZE_MAX;
+        for (auto position = str.begin(); position <= str.end();)
+        {
+            CharacterContext behind = position == str.begin() ? CharacterContext::TextEdge : ContextOf(position[-1]);
+            int length = MatchFrom(SearchStartState(behind), position, str.end(), true);
+            size_t offset = static_cast<size_t>(position - str.begin());
+            if (length == -1)
+            {
+                break;
+            }
+            else if (length == 0 && offset == lastEnd)
+            {
+                position++;
             }
             else
             {
-                return false;
+                count++;
+                position += length;
+                lastEnd = offset + static_cast<size_t>(length);
             }
         }
-        case RangeType::LineEnd:
+        return count;
+    }
+
+    /**
+     * DFAMatrix::StartsWithoutCharacter
+     *
+     * @return {bool} : true if a match can start without reading a character: a start state accepts
+     *                  in some context. Otherwise only the characters of CanStartWith start a match.
+     */
+    bool DFAMatrix::StartsWithoutCharacter() const
+    {
+        for (size_t behind = 0; behind < DFA_IMAGE_CONTEXT_COUNT; behind++)
         {
-            if (i + 1 == strEnd)
+            if (IsEndState(startStates[behind]))
             {
-                // move to the next state
-                state = matrix.at(state).at(j);
                 return true;
             }
-            else
-            {
-                return false;
-            }
         }
-        default:
+        return false;
+    }
+
+    /**
+     * DFAMatrix::CanStartWith
+     *
+     * @param  {char32_t} c : a character
+     * @return {bool}       : true if some start state has a transition on c
+     */
+    bool DFAMatrix::CanStartWith(char32_t c) const
+    {
+        int column = CharacterColumn(c);
+        if (column == -1)
         {
-            /* all the epsilon edges have been eliminated */
-            throw std::runtime_error("unreachable case branch");
+            return false;
         }
+        for (size_t behind = 0; behind < DFA_IMAGE_CONTEXT_COUNT; behind++)
+        {
+            if (Next(startStates[behind], column) != -1)
+            {
+                return true;
+            }
         }
+        return false;
     }
 
-    bool DFAMatrix::IsEndState(int state) const
+    /**
+     * DFAMatrix::CharacterColumn
+     *
+     * @param  {char32_t} c : a character
+     * @return {int}        : the column of the class containing c, or -1 if no pattern contains c
+     */
+    int DFAMatrix::CharacterColumn(char32_t c) const
     {
-        return endStates.count(state);
+        if (c > MAX_CHARACTER)
+        {
+            return -1;
+        }
+        else if (blockIndices != nullptr)
+        {
+            uint16_t column = blockColumns[(size_t{blockIndices[c >> BLOCK_BITS]} << BLOCK_BITS) | (c & BLOCK_MASK)];
+            return column == NO_COLUMN ? -1 : column;
+        }
+        return FindRangeColumn(ranges, rangeCount, c);
     }
 
     bool CanTransit(const Graph &G, StateID s1, StateID s2)
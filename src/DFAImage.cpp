@@ -0,0 +1,297 @@
+#include "DFAImage.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+#include "DFA.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define REGEX_HAS_MMAP 1
+#endif
+
+namespace regex
+{
+    using std::shared_ptr;
+
+    static uint64_t Align(uint64_t offset)
+    {
+        return (offset + DFA_IMAGE_ALIGNMENT - 1) / DFA_IMAGE_ALIGNMENT * DFA_IMAGE_ALIGNMENT;
+    }
+
+    template <typename T>
+    static uint64_t AppendSection(vector<uint8_t> &image, const vector<T> &section)
+    {
+        uint64_t offset = Align(image.size());
+        image.resize(offset + section.size() * sizeof(T));
+        if (!section.empty())
+        {
+            std::memcpy(image.data() + offset, section.data(), section.size() * sizeof(T));
+        }
+        return offset;
+    }
+
+    /**
+     * BuildDFAImage
+     *
+     * @param  {DFAImageContents} contents : the sections of the image
+     * @return {vector<uint8_t>}           : the laid out image, starting with its header
+     */
+    vector<uint8_t> BuildDFAImage(const DFAImageContents &contents)
+    {
+        DFAImageHeader header{};
+        header.magic = DFA_IMAGE_MAGIC;
+        header.version = DFA_IMAGE_VERSION;
+        header.byteOrder = DFA_IMAGE_BYTE_ORDER;
+        header.stateCount = contents.stateCount;
+        header.columnCount = contents.columnCount;
+        header.rangeCount = static_cast<uint32_t>(contents.ranges.size());
+        header.assertionTypes = contents.assertionTypes;
+        header.anchoredStateCount = contents.anchoredStateCount;
+        std::memcpy(header.startStates, contents.startStates, sizeof(header.startStates));
+        std::memcpy(header.searchStartStates, contents.searchStartStates, sizeof(header.searchStartStates));
+        header.blockCount = static_cast<uint32_t>(contents.blockColumns.size() / DFA_IMAGE_BLOCK_SIZE);
+
+        vector<uint8_t> image(sizeof(DFAImageHeader));
+        header.transitionsOffset = AppendSection(image, contents.transitions);
+        header.acceptingOffset = AppendSection(image, contents.accepting);
+        header.rangesOffset = AppendSection(image, contents.ranges);
+        header.blockIndicesOffset = AppendSection(image, contents.blockIndices);
+        header.blockColumnsOffset = AppendSection(image, contents.blockColumns);
+        header.reverseOffset = AppendSection(image, contents.reverse);
+        header.reverseSize = contents.reverse.size();
+        header.metadataOffset = AppendSection(image, vector<char>(contents.metadata.begin(), contents.metadata.end()));
+        header.metadataSize = contents.metadata.size();
+        header.imageSize = image.size();
+        std::memcpy(image.data(), &header, sizeof(header));
+        return image;
+    }
+
+    static bool ValidSection(const DFAImageHeader &header, uint64_t offset, uint64_t count, uint64_t itemSize)
+    {
+        return offset % DFA_IMAGE_ALIGNMENT == 0 && offset >= sizeof(DFAImageHeader) && offset <= header.imageSize &&
+               (itemSize == 0 || count <= (header.imageSize - offset) / itemSize);
+    }
+
+    /**
+     * ValidateDFAImage
+     *
+     * Check the header of an image and that all of its sections lie inside of it, in constant time.
+     * The contents of the sections are trusted.
+     *
+     * @param  {void*} data         : the start of the image, aligned to DFA_IMAGE_ALIGNMENT bytes
+     * @param  {size_t} size        : the number of bytes available at "data"
+     * @return {DFAImageHeader}     : the header of the image
+     */
+    const DFAImageHeader &ValidateDFAImage(const void *data, size_t size)
+    {
+        if (reinterpret_cast<uintptr_t>(data) % DFA_IMAGE_ALIGNMENT != 0)
+        {
+            throw std::invalid_argument("misaligned DFA image");
+        }
+        else if (size < sizeof(DFAImageHeader))
+        {
+            throw std::runtime_error("truncated DFA image");
+        }
+        const auto &header = *static_cast<const DFAImageHeader *>(data);
+        if (header.magic != DFA_IMAGE_MAGIC || header.byteOrder != DFA_IMAGE_BYTE_ORDER)
+        {
+            throw std::runtime_error("not a DFA image, or written with another byte order");
+        }
+        else if (header.version != DFA_IMAGE_VERSION)
+        {
+            throw std::runtime_error("unsupported DFA image version");
+        }
+        else if (header.imageSize > size)
+        {
+            throw std::runtime_error("truncated DFA image");
+        }
+        uint64_t cells = uint64_t{header.stateCount} * header.columnCount;
+        bool valid = (header.stateCount == 0 || cells / header.stateCount == header.columnCount) &&
+                     ValidSection(header, header.transitionsOffset, cells, sizeof(int32_t)) &&
+                     ValidSection(header, header.acceptingOffset, header.stateCount, sizeof(uint8_t)) &&
+                     ValidSection(header, header.rangesOffset, header.rangeCount, sizeof(DFAImageRange)) &&
+                     ValidSection(header, header.blockIndicesOffset, header.blockCount > 0 ? DFA_IMAGE_BLOCK_INDEX_COUNT : 0,
+                                  sizeof(uint16_t)) &&
+                     ValidSection(header, header.blockColumnsOffset, uint64_t{header.blockCount} * DFA_IMAGE_BLOCK_SIZE,
+                                  sizeof(uint16_t)) &&
+                     ValidSection(header, header.reverseOffset, header.reverseSize, 1) &&
+                     ValidSection(header, header.metadataOffset, header.metadataSize, 1) &&
+                     header.metadataOffset + header.metadataSize == header.imageSize &&
+                     header.anchoredStateCount <= header.stateCount;
+        for (int32_t state : header.startStates)
+        {
+            valid = valid &&
+                    (header.stateCount == 0 || (state >= 0 && static_cast<uint32_t>(state) < header.anchoredStateCount));
+        }
+        for (int32_t state : header.searchStartStates)
+        {
+            valid = valid && (state == -1 || (state >= 0 && static_cast<uint32_t>(state) < header.stateCount));
+        }
+        if (!valid)
+        {
+            throw std::runtime_error("corrupted DFA image");
+        }
+        return header;
+    }
+
+    void DFAMatrix::Attach(shared_ptr<const void> owner, const void *data, size_t size)
+    {
+        const DFAImageHeader &header = ValidateDFAImage(data, size);
+        this->owner = std::move(owner);
+        image = static_cast<const uint8_t *>(data);
+        stateCount = header.stateCount;
+        anchoredStateCount = header.anchoredStateCount;
+        columnCount = header.columnCount;
+        transitions = reinterpret_cast<const int32_t *>(image + header.transitionsOffset);
+        accepting = image + header.acceptingOffset;
+        ranges = reinterpret_cast<const DFAImageRange *>(image + header.rangesOffset);
+        rangeCount = header.rangeCount;
+        startStates = header.startStates;
+        searchStartStates = header.searchStartStates;
+        assertionTypes = header.assertionTypes;
+        if (header.blockCount > 0)
+        {
+            blockIndices = reinterpret_cast<const uint16_t *>(image + header.blockIndicesOffset);
+            blockColumns = reinterpret_cast<const uint16_t *>(image + header.blockColumnsOffset);
+        }
+        else
+        {
+            blockIndices = nullptr;
+            blockColumns = nullptr;
+        }
+        if (header.reverseSize > 0)
+        {
+            auto matrix = std::make_shared<DFAMatrix>();
+            matrix->Attach(this->owner, image + header.reverseOffset, header.reverseSize);
+            reversed = std::move(matrix);
+        }
+        else
+        {
+            reversed = nullptr;
+        }
+    }
+
+    /**
+     * DFAMatrix::FromImage
+     *
+     * Use an image in place, without copying it. The memory must outlive the matrix and all of its copies.
+     *
+     * @param  {void*} data  : the start of the image, aligned to DFA_IMAGE_ALIGNMENT bytes
+     * @param  {size_t} size : the number of bytes available at "data"
+     * @return {DFAMatrix}   : the matrix stored in the image
+     */
+    DFAMatrix DFAMatrix::FromImage(const void *data, size_t size)
+    {
+        DFAMatrix matrix;
+        matrix.Attach(nullptr, data, size);
+        return matrix;
+    }
+
+    /**
+     * DFAMatrix::FromImage
+     *
+     * @param  {vector<uint8_t>} image : an image, which is moved into the matrix
+     * @return {DFAMatrix}             : the matrix stored in the image
+     */
+    DFAMatrix DFAMatrix::FromImage(vector<uint8_t> image)
+    {
+        auto buffer = std::make_shared<const vector<uint8_t>>(std::move(image));
+        DFAMatrix matrix;
+        matrix.Attach(buffer, buffer->data(), buffer->size());
+        return matrix;
+    }
+
+    /**
+     * DFAMatrix::Load
+     *
+     * Map an image file into memory. The pages are shared with every other process mapping the
+     * same file, and nothing is parsed: loading takes constant time whatever the size of the DFA.
+     *
+     * @param  {string} path : the path of a file written by DFAMatrix::Save
+     * @return {DFAMatrix}   : the matrix stored in the file
+     */
+    DFAMatrix DFAMatrix::Load(const std::string &path)
+    {
+#ifdef REGEX_HAS_MMAP
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("cannot open " + path);
+        }
+        struct stat status;
+        if (fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(DFAImageHeader)))
+        {
+            close(fd);
+            throw std::runtime_error("truncated DFA image");
+        }
+        size_t size = static_cast<size_t>(status.st_size);
+        void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            throw std::runtime_error("cannot map " + path);
+        }
+        shared_ptr<const void> mapping(data, [size](const void *p) { munmap(const_cast<void *>(p), size); });
+        DFAMatrix matrix;
+        matrix.Attach(mapping, data, size);
+        return matrix;
+#else
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            throw std::runtime_error("cannot open " + path);
+        }
+        vector<uint8_t> image((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        return FromImage(std::move(image));
+#endif
+    }
+
+    /**
+     * DFAMatrix::Save
+     *
+     * @param  {string} path     : the file to write the image to
+     * @param  {string} metadata : bytes stored along with the image, returned by DFAMatrix::Metadata
+     */
+    void DFAMatrix::Save(const std::string &path, const std::string &metadata) const
+    {
+        if (image == nullptr)
+        {
+            throw std::runtime_error("cannot save an empty DFA matrix");
+        }
+        DFAImageHeader header;
+        std::memcpy(&header, image, sizeof(header));
+        /* the metadata is the last section, so it can be replaced without moving the others */
+        uint64_t sectionsSize = header.metadataOffset;
+        header.metadataSize = metadata.size();
+        header.imageSize = header.metadataOffset + metadata.size();
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char *>(image) + sizeof(header), sectionsSize - sizeof(header));
+        stream.write(metadata.data(), metadata.size());
+        if (!stream)
+        {
+            throw std::runtime_error("cannot write " + path);
+        }
+    }
+
+    size_t DFAMatrix::ImageSize() const
+    {
+        return image == nullptr ? 0 : reinterpret_cast<const DFAImageHeader *>(image)->imageSize;
+    }
+
+    std::string DFAMatrix::Metadata() const
+    {
+        if (image == nullptr)
+        {
+            return "";
+        }
+        const auto &header = *reinterpret_cast<const DFAImageHeader *>(image);
+        return std::string(reinterpret_cast<const char *>(image + header.metadataOffset), header.metadataSize);
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,398 @@
+#include "ExpressionArena.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "NFA.hpp"
+
+namespace regex
+{
+    using std::make_shared;
+    using std::unordered_map;
+
+    static ArenaNode SymbolNode(RangeType rangeType, char32_t lower, char32_t upper)
+    {
+        return ArenaNode{RegularExpressionKind::Symbol, UnicodeRange(rangeType, lower, upper), 0, 0, 0, 0, 0};
+    }
+    static ArenaNode InnerNode(RegularExpressionKind kind, size_t childCount)
+    {
+        return ArenaNode{kind, UnicodeRange::EPSILON, 0, static_cast<uint32_t>(childCount), 0, 0, 0};
+    }
+
+    NodeIndex ExpressionArena::Symbol(char32_t c)
+    {
+        return MakeNode(SymbolNode(RangeType::CharacterRange, c, c), nullptr);
+    }
+    NodeIndex ExpressionArena::Range(char32_t lower, char32_t upper)
+    {
+        return MakeNode(SymbolNode(RangeType::CharacterRange, lower, upper), nullptr);
+    }
+    NodeIndex ExpressionArena::LineBegin()
+    {
+        return MakeNode(SymbolNode(RangeType::LineBegin, 0, 0), nullptr);
+    }
+    NodeIndex ExpressionArena::LineEnd()
+    {
+        return MakeNode(SymbolNode(RangeType::LineEnd, 0, 0), nullptr);
+    }
+    NodeIndex ExpressionArena::WordBoundary()
+    {
+        return MakeNode(SymbolNode(RangeType::WordBoundary, 0, 0), nullptr);
+    }
+    NodeIndex ExpressionArena::NotWordBoundary()
+    {
+        return MakeNode(SymbolNode(RangeType::NotWordBoundary, 0, 0), nullptr);
+    }
+    /**
+     * ExpressionArena::Class
+     *
+     * @param  {CharClass} charClass : the set of characters to match
+     * @return {NodeIndex}           : the node matching one character of the set. Equal sets share the node.
+     */
+    NodeIndex ExpressionArena::Class(const CharClass &charClass)
+    {
+        auto [it, inserted] = classIndices.emplace(charClass, static_cast<uint32_t>(classes.size()));
+        if (inserted)
+        {
+            classes.push_back(charClass);
+        }
+        ArenaNode node = InnerNode(RegularExpressionKind::CharClass, 0);
+        node.charClass = it->second;
+        return MakeNode(node, nullptr);
+    }
+    NodeIndex ExpressionArena::Alternation(NodeIndex x, NodeIndex y)
+    {
+        NodeIndex items[] = {x, y};
+        return MakeNode(InnerNode(RegularExpressionKind::Alternation, 2), items);
+    }
+    NodeIndex ExpressionArena::Concatenation(NodeIndex x, NodeIndex y)
+    {
+        NodeIndex items[] = {x, y};
+        return MakeNode(InnerNode(RegularExpressionKind::Concatenation, 2), items);
+    }
+    NodeIndex ExpressionArena::Alternation(const vector<NodeIndex> &items)
+    {
+        if (items.size() == 1)
+        {
+            return items.front();
+        }
+        else
+        {
+            return MakeNode(InnerNode(RegularExpressionKind::Alternation, items.size()), items.data());
+        }
+    }
+    NodeIndex ExpressionArena::Concatenation(const vector<NodeIndex> &items)
+    {
+        if (items.size() == 1)
+        {
+            return items.front();
+        }
+        else
+        {
+            return MakeNode(InnerNode(RegularExpressionKind::Concatenation, items.size()), items.data());
+        }
+    }
+    NodeIndex ExpressionArena::KleeneStar(NodeIndex x)
+    {
+        return MakeNode(InnerNode(RegularExpressionKind::KleeneStar, 1), &x);
+    }
+    NodeIndex ExpressionArena::Literal(const u32string &text)
+    {
+        if (text.empty())
+        {
+            return NONE;
+        }
+        else
+        {
+            vector<NodeIndex> items;
+            items.reserve(text.size());
+            for (char32_t c : text)
+            {
+                items.push_back(Symbol(c));
+            }
+            return Concatenation(items);
+        }
+    }
+    NodeIndex ExpressionArena::RepeatExactly(NodeIndex x, int times)
+    {
+        return Repeat(x, times, times);
+    }
+    NodeIndex ExpressionArena::RepeatAtLeast(NodeIndex x, int times)
+    {
+        return Repeat(x, times, RepeatExpression::UNBOUNDED);
+    }
+    NodeIndex ExpressionArena::Repeat(NodeIndex x, int atLeast, int atMost)
+    {
+        if (atLeast < 0 || (atMost != RepeatExpression::UNBOUNDED && atMost < atLeast))
+        {
+            throw std::invalid_argument("invalid repetition bounds");
+        }
+        else if (atLeast == 1 && atMost == 1)
+        {
+            return x;
+        }
+        else
+        {
+            ArenaNode node = InnerNode(RegularExpressionKind::Repeat, 1);
+            node.atLeast = atLeast;
+            node.atMost = atMost;
+            return MakeNode(node, &x);
+        }
+    }
+    NodeIndex ExpressionArena::Optional(NodeIndex x)
+    {
+        return Repeat(x, 0, 1);
+    }
+    NodeIndex ExpressionArena::OneOrMore(NodeIndex x)
+    {
+        return Repeat(x, 1, RepeatExpression::UNBOUNDED);
+    }
+    NodeIndex ExpressionArena::Capture(NodeIndex x, int group)
+    {
+        if (group < 1)
+        {
+            throw std::invalid_argument("capture groups are numbered from 1");
+        }
+        else
+        {
+            ArenaNode node = InnerNode(RegularExpressionKind::Capture, 1);
+            node.atLeast = group;
+            return MakeNode(node, &x);
+        }
+    }
+
+    class ArenaInterner : public RegularExpressionFolder<NodeIndex>
+    {
+    public:
+        ExpressionArena &arena;
+
+        explicit ArenaInterner(ExpressionArena &arena) : arena{arena} {}
+
+        NodeIndex FoldAlternation(const AlternationExpression::Ptr &, vector<NodeIndex> &items) override
+        {
+            return arena.Alternation(items);
+        }
+        NodeIndex FoldConcatenation(const ConcatenationExpression::Ptr &, vector<NodeIndex> &items) override
+        {
+            return arena.Concatenation(items);
+        }
+        NodeIndex FoldKleeneStar(const KleeneStarExpression::Ptr &, NodeIndex &inner) override
+        {
+            return arena.KleeneStar(inner);
+        }
+        NodeIndex FoldRepeat(const RepeatExpression::Ptr &exp, NodeIndex &inner) override
+        {
+            return arena.Repeat(inner, exp->atLeast, exp->atMost);
+        }
+        NodeIndex FoldSymbol(const SymbolExpression::Ptr &exp) override
+        {
+            switch (exp->range.rangeType)
+            {
+            case RangeType::LineBegin:
+                return arena.LineBegin();
+            case RangeType::LineEnd:
+                return arena.LineEnd();
+            case RangeType::WordBoundary:
+                return arena.WordBoundary();
+            case RangeType::NotWordBoundary:
+                return arena.NotWordBoundary();
+            default:
+                return arena.Range(exp->range.lower, exp->range.upper);
+            }
+        }
+        NodeIndex FoldCharClass(const CharClassExpression::Ptr &exp) override
+        {
+            return arena.Class(exp->charClass);
+        }
+        NodeIndex FoldCapture(const CaptureExpression::Ptr &exp, NodeIndex &inner) override
+        {
+            return arena.Capture(inner, exp->group);
+        }
+    };
+
+    /**
+     * ExpressionArena::Intern
+     *
+     * @param  {RegularExpression::Ptr} exp : an expression tree built with the notations
+     * @return {NodeIndex}                  : the node of the same expression in this arena
+     */
+    NodeIndex ExpressionArena::Intern(const RegularExpression::Ptr &exp)
+    {
+        ArenaInterner interner(*this);
+        return interner.Fold(exp);
+    }
+
+    /**
+     * ExpressionArena::ToExpression
+     *
+     * @param  {NodeIndex} node         : a node in this arena
+     * @return {RegularExpression::Ptr} : an equivalent expression tree. Shared nodes become shared pointers.
+     */
+    RegularExpression::Ptr ExpressionArena::ToExpression(NodeIndex node) const
+    {
+        unordered_map<NodeIndex, RegularExpression::Ptr> exported;
+        vector<NodeIndex> stack = {node};
+        while (!stack.empty())
+        {
+            NodeIndex current = stack.back();
+            const ArenaNode &n = nodes.at(current);
+            bool ready = true;
+            for (uint32_t i = 0; i < n.childCount; i++)
+            {
+                if (!exported.count(Child(current, i)))
+                {
+                    stack.push_back(Child(current, i));
+                    ready = false;
+                }
+            }
+            if (ready)
+            {
+                stack.pop_back();
+                vector<RegularExpression::Ptr> items;
+                for (uint32_t i = 0; i < n.childCount; i++)
+                {
+                    items.push_back(exported.at(Child(current, i)));
+                }
+                switch (n.kind)
+                {
+                case RegularExpressionKind::Alternation:
+                    exported[current] = make_shared<AlternationExpression>(std::move(items));
+                    break;
+                case RegularExpressionKind::Concatenation:
+                    exported[current] = make_shared<ConcatenationExpression>(std::move(items));
+                    break;
+                case RegularExpressionKind::KleeneStar:
+                    exported[current] = make_shared<KleeneStarExpression>(items.at(0));
+                    break;
+                case RegularExpressionKind::Repeat:
+                    exported[current] = make_shared<RepeatExpression>(items.at(0), n.atLeast, n.atMost);
+                    break;
+                case RegularExpressionKind::Capture:
+                    exported[current] = make_shared<CaptureExpression>(items.at(0), n.atLeast);
+                    break;
+                case RegularExpressionKind::CharClass:
+                    exported[current] = make_shared<CharClassExpression>(classes.at(n.charClass));
+                    break;
+                default:
+                    exported[current] = make_shared<SymbolExpression>(n.range);
+                    break;
+                }
+            }
+            else
+            {
+                /* export the children first */
+            }
+        }
+        return exported.at(node);
+    }
+
+    /**
+     * ExpressionArena::Compile
+     *
+     * Unlike RegularExpression::Compile, the NFA is built straight from the nodes, without Simplify and
+     * without the pattern cache, so that no expression tree is allocated. The matrix accepts the same
+     * strings, but it may have more columns and states. A case-insensitive compilation needs the
+     * character classes folded, so it exports the expression and runs the whole pipeline instead.
+     *
+     * @param  {NodeIndex} node      : a node in this arena
+     * @param  {CompileFlags} flags  : the options of the compilation
+     * @return {DFAMatrix}           : the compiled matrix
+     */
+    DFAMatrix ExpressionArena::Compile(NodeIndex node, CompileFlags flags) const
+    {
+        if (HasFlag(flags, CompileFlags::CaseInsensitive))
+        {
+            return BuildDFAMatrix(ToExpression(node), flags);
+        }
+        else
+        {
+            NFA nfa(*this, node);
+            return BuildDFAMatrix(nfa);
+        }
+    }
+
+    void ExpressionArena::Reserve(size_t nodeCount)
+    {
+        nodes.reserve(nodeCount);
+        hashes.reserve(nodeCount);
+        children.reserve(nodeCount * 2);
+        size_t bucketCount = 16;
+        while (bucketCount < nodeCount * 2)
+        {
+            bucketCount *= 2;
+        }
+        if (bucketCount > buckets.size())
+        {
+            Rehash(bucketCount);
+        }
+    }
+
+    static size_t HashNode(const ArenaNode &node, const NodeIndex *items)
+    {
+        size_t hash = static_cast<size_t>(node.kind) + 1;
+        hash = hash * 31 + UnicodeRangeHash()(node.range);
+        hash = hash * 31 + static_cast<size_t>(node.atLeast);
+        hash = hash * 31 + static_cast<size_t>(node.atMost);
+        hash = hash * 31 + node.charClass;
+        for (uint32_t i = 0; i < node.childCount; i++)
+        {
+            hash = hash * 1000003 + items[i];
+        }
+        return hash ^ (hash >> 29);
+    }
+
+    NodeIndex ExpressionArena::MakeNode(ArenaNode node, const NodeIndex *items)
+    {
+        if ((nodes.size() + 1) * 2 > buckets.size())
+        {
+            Rehash(std::max<size_t>(16, buckets.size() * 2));
+        }
+        size_t hash = HashNode(node, items);
+        size_t mask = buckets.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            NodeIndex candidate = buckets[i];
+            if (candidate == NONE)
+            {
+                NodeIndex index = static_cast<NodeIndex>(nodes.size());
+                node.firstChild = static_cast<uint32_t>(children.size());
+                nodes.push_back(node);
+                children.insert(children.end(), items, items + node.childCount);
+                hashes.push_back(hash);
+                buckets[i] = index;
+                return index;
+            }
+            else if (hashes[candidate] == hash && SameNode(candidate, node, items))
+            {
+                return candidate;
+            }
+            else
+            {
+                // probe the next bucket
+            }
+        }
+    }
+
+    bool ExpressionArena::SameNode(NodeIndex index, const ArenaNode &node, const NodeIndex *items) const
+    {
+        const ArenaNode &n = nodes[index];
+        return n.kind == node.kind && n.range == node.range && n.atLeast == node.atLeast &&
+               n.atMost == node.atMost && n.charClass == node.charClass && n.childCount == node.childCount &&
+               std::equal(items, items + node.childCount, children.begin() + n.firstChild);
+    }
+
+    void ExpressionArena::Rehash(size_t bucketCount)
+    {
+        buckets.assign(bucketCount, NONE);
+        size_t mask = bucketCount - 1;
+        for (NodeIndex node = 0; node < nodes.size(); node++)
+        {
+            size_t i = hashes[node] & mask;
+            while (buckets[i] != NONE)
+            {
+                i = (i + 1) & mask;
+            }
+            buckets[i] = node;
+        }
+    }
+} // namespace regex
\ No newline at end of file
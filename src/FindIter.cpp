@@ -0,0 +1,77 @@
+#include "FindIter.hpp"
+
+namespace regex
+{
+    FindIter::FindIter(const DFAMatrix &matrix, const u32string &str) : matrix{matrix}, str{str}
+    {
+        if (matrix.StateCount() == 0)
+        {
+            /* nothing matches */
+            position = str.size() + 1;
+        }
+        else
+        {
+            everyPosition = matrix.StartsWithoutCharacter();
+            reversed = matrix.SearchStartState(CharacterContext::TextEdge) != -1 ? matrix.Reversed() : nullptr;
+        }
+    }
+
+    /**
+     * FindIter::Next
+     *
+     * @param  {MatchSpan} span : receives the offsets of the next match
+     * @return {bool}           : false once there are no more matches
+     */
+    bool FindIter::Next(MatchSpan &span)
+    {
+        while (reversed != nullptr && position <= str.size())
+        {
+            auto start = str.begin() + position;
+            CharacterContext behind = position == 0 ? CharacterContext::TextEdge : ContextOf(str[position - 1]);
+            int length = matrix.MatchFrom(matrix.SearchStartState(behind), start, str.end(), true);
+            if (length == -1)
+            {
+                break;
+            }
+            size_t end = position + static_cast<size_t>(length);
+            size_t begin = end - reversed->MatchBackward(str.begin(), start, str.begin() + end, str.end());
+            if (begin == end && begin == lastEnd)
+            {
+                position = begin + 1;
+                continue;
+            }
+            span = MatchSpan{begin, end};
+            lastEnd = end;
+            position = begin == end ? end + 1 : end;
+            return true;
+        }
+        while (reversed == nullptr && position <= str.size())
+        {
+            if (!everyPosition)
+            {
+                while (position < str.size() && !matrix.CanStartWith(str[position]))
+                {
+                    position++;
+                }
+                if (position == str.size())
+                {
+                    /* only the empty string could match here, and the start state does not accept it */
+                    break;
+                }
+            }
+            auto start = str.begin() + position;
+            int length = matrix.MatchFrom(matrix.StartState(str.begin(), start), start, str.end(), true);
+            if (length == -1 || (length == 0 && position == lastEnd))
+            {
+                position++;
+                continue;
+            }
+            span = MatchSpan{position, position + static_cast<size_t>(length)};
+            lastEnd = span.end;
+            position = length == 0 ? position + 1 : span.end;
+            return true;
+        }
+        position = str.size() + 1;
+        return false;
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include "JitMatcher.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "DFAImage.hpp"
+
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/mman.h>
+#define REGEX_HAS_JIT 1
+#endif
+
+namespace regex
+{
+    using std::vector;
+
+    namespace
+    {
+        /* the expected input must be this many characters per state to pay back the compilation */
+        constexpr size_t INPUT_SIZE_PER_STATE = 256;
+
+        /* a run of characters [lower, next lower) with the same next state, -1 for no transition */
+        struct Segment
+        {
+            uint32_t lower;
+            int target;
+        };
+
+        /**
+         * Assembler
+         *
+         * Emits the few x86-64 instructions used by the matcher. The registers are fixed:
+         * rdi = begin, rsi = end, rdx = greedy mode, rcx = the current position,
+         * rax = the last matched length, r8d = the current character, r9d = a scratch register.
+         */
+        class Assembler
+        {
+        public:
+            vector<uint8_t> code;
+
+            size_t NewLabel()
+            {
+                labels.push_back(UNBOUND);
+                return labels.size() - 1;
+            }
+            void Bind(size_t label)
+            {
+                labels[label] = code.size();
+            }
+            /* rel32 jumps, patched by Resolve */
+            void Jump(size_t label)
+            {
+                Emit({0xE9});
+                Fixup(label);
+            }
+            void JumpIfZero(size_t label)
+            {
+                Emit({0x0F, 0x84});
+                Fixup(label);
+            }
+            void JumpIfBelow(size_t label)
+            {
+                Emit({0x0F, 0x82});
+                Fixup(label);
+            }
+            void JumpIfBelowOrEqual(size_t label)
+            {
+                Emit({0x0F, 0x86});
+                Fixup(label);
+            }
+            void JumpIfAboveOrEqual(size_t label)
+            {
+                Emit({0x0F, 0x83});
+                Fixup(label);
+            }
+            void Emit(std::initializer_list<uint8_t> bytes)
+            {
+                code.insert(code.end(), bytes);
+            }
+            void Emit32(uint32_t value)
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    code.push_back(static_cast<uint8_t>(value >> (8 * i)));
+                }
+            }
+            void Resolve()
+            {
+                for (const auto &[position, label] : fixups)
+                {
+                    if (labels[label] == UNBOUND)
+                    {
+                        throw std::runtime_error("unbound label");
+                    }
+                    int64_t offset = static_cast<int64_t>(labels[label]) - static_cast<int64_t>(position + 4);
+                    uint32_t value = static_cast<uint32_t>(static_cast<int32_t>(offset));
+                    for (int i = 0; i < 4; i++)
+                    {
+                        code[position + i] = static_cast<uint8_t>(value >> (8 * i));
+                    }
+                }
+            }
+
+        private:
+            static constexpr size_t UNBOUND = SIZE_MAX;
+            vector<size_t> labels;
+            vector<std::pair<size_t, size_t>> fixups;
+
+            void Fixup(size_t label)
+            {
+                fixups.emplace_back(code.size(), label);
+                Emit32(0);
+            }
+        };
+
+        /**
+         * EmitDispatch
+         *
+         * Emit a balanced tree of comparisons of r8d jumping to the label of the segment holding it.
+         */
+        void EmitDispatch(Assembler &assembler, const vector<Segment> &segments, const vector<size_t> &leaves,
+                          size_t first, size_t last)
+        {
+            if (last - first == 1)
+            {
+                assembler.Jump(leaves[first]);
+            }
+            else
+            {
+                size_t middle = first + (last - first) / 2;
+                size_t left = assembler.NewLabel();
+                /* cmp r8d, imm32 */
+                assembler.Emit({0x41, 0x81, 0xF8});
+                assembler.Emit32(segments[middle].lower);
+                assembler.JumpIfBelow(left);
+                EmitDispatch(assembler, segments, leaves, middle, last);
+                assembler.Bind(left);
+                EmitDispatch(assembler, segments, leaves, first, middle);
+            }
+        }
+    } // namespace
+
+    JitMatcher::JitMatcher(DFAMatrix matrix, size_t expectedInputSize) : matrix{std::move(matrix)}
+    {
+        if (ShouldCompile(this->matrix, expectedInputSize))
+        {
+            Compile();
+        }
+        else
+        {
+            /* the table interpreter is cheaper for this matcher */
+        }
+    }
+
+    bool JitMatcher::IsSupported()
+    {
+#ifdef REGEX_HAS_JIT
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * JitMatcher::ShouldCompile
+     *
+     * @param  {DFAMatrix} matrix         : a matcher
+     * @param  {size_t} expectedInputSize : the number of characters the matcher is expected to scan in its lifetime
+     * @return {bool}                     : true if the matcher can be compiled and the input is large enough
+     */
+    bool JitMatcher::ShouldCompile(const DFAMatrix &matrix, size_t expectedInputSize)
+    {
+        if (!IsSupported() || matrix.StateCount() == 0 || matrix.StateCount() > MAX_STATE_COUNT)
+        {
+            return false;
+        }
+        else if (matrix.HasAssertions())
+        {
+            /* the states accepting in some contexts only, and the start states, are left to the interpreter */
+            return false;
+        }
+        else
+        {
+            return expectedInputSize >= MIN_INPUT_SIZE &&
+                   expectedInputSize / INPUT_SIZE_PER_STATE >= matrix.StateCount();
+        }
+    }
+
+    bool JitMatcher::FullMatch(const u32string &str) const
+    {
+        return Match(str.begin(), str.end(), true) == static_cast<int>(str.size());
+    }
+
+    /**
+     * JitMatcher::Search
+     *
+     * The compiled search states find the end of the leftmost-longest match in one pass, as in
+     * DFAMatrix::Search, and the reversed matrix reads back from there to its start.
+     *
+     * @param  {u32string::const_iterator} strBegin : start of the target character range
+     * @param  {u32string::const_iterator} strEnd   : end of the target character range
+     * @return {u32string::const_iterator}          : the start of the first occurrence, or "strEnd" if none
+     */
+    u32string::const_iterator JitMatcher::Search(u32string::const_iterator strBegin, u32string::const_iterator strEnd) const
+    {
+        if (searchFunction != nullptr)
+        {
+            const char32_t *begin = strBegin == strEnd ? nullptr : &*strBegin;
+            int64_t length = searchFunction(begin, begin + (strEnd - strBegin), 1);
+            if (length == -1)
+            {
+                return strEnd;
+            }
+            auto end = strBegin + length;
+            return end - matrix.Reversed()->MatchBackward(strBegin, strBegin, end, strEnd);
+        }
+        else
+        {
+            return matrix.Search(strBegin, strEnd);
+        }
+    }
+
+    /**
+     * JitMatcher::Match
+     *
+     * @param  {u32string::const_iterator} strBegin : start of the target character range
+     * @param  {u32string::const_iterator} strEnd   : end of the target character range
+     * @param  {bool} greedyMode                    : If true, search for the longest match. Otherwise, return immediately once matched.
+     * @return {int}                                : the length of the matched string. -1 if no match.
+     */
+    int JitMatcher::Match(u32string::const_iterator strBegin, u32string::const_iterator strEnd, bool greedyMode) const
+    {
+        if (function != nullptr)
+        {
+            const char32_t *begin = strBegin == strEnd ? nullptr : &*strBegin;
+            return static_cast<int>(function(begin, begin + (strEnd - strBegin), greedyMode ? 1 : 0));
+        }
+        else
+        {
+            return matrix.Match(strBegin, strEnd, greedyMode);
+        }
+    }
+
+    /**
+     * JitMatcher::Compile
+     *
+     * Emit the code of all the states and map it executable. Failing to map the code is not an
+     * error, the matcher keeps using the interpreter.
+     */
+    void JitMatcher::Compile()
+    {
+#ifdef REGEX_HAS_JIT
+        const DFAImageHeader &header = ValidateDFAImage(matrix.ImageData(), matrix.ImageSize());
+        const auto *ranges = reinterpret_cast<const DFAImageRange *>(matrix.ImageData() + header.rangesOffset);
+        const auto *transitions = reinterpret_cast<const int32_t *>(matrix.ImageData() + header.transitionsOffset);
+        const uint8_t *accepting = matrix.ImageData() + header.acceptingOffset;
+
+        /* the columns of all the characters, then the next state of every character, per state */
+        vector<Segment> columns;
+        uint32_t next = 0;
+        for (size_t i = 0; i < header.rangeCount; i++)
+        {
+            if (next < ranges[i].lower)
+            {
+                columns.push_back(Segment{next, -1});
+            }
+            columns.push_back(Segment{ranges[i].lower, ranges[i].column});
+            next = ranges[i].upper + 1;
+        }
+        /* also covers the values above the last code point */
+        columns.push_back(Segment{next, -1});
+
+        /* the search states are compiled too when the start of a match can be read back with the reversed
+           matrix */
+        bool search = header.searchStartStates[0] != -1 && matrix.Reversed() != nullptr;
+        size_t stateCount = search ? header.stateCount : header.anchoredStateCount;
+        Assembler assembler;
+        vector<size_t> stateLabels;
+        for (size_t state = 0; state < stateCount; state++)
+        {
+            stateLabels.push_back(assembler.NewLabel());
+        }
+        size_t returnLength = assembler.NewLabel();
+        size_t returnLast = assembler.NewLabel();
+
+        /* an entry point per start state, the anchored one first: mov rax, -1; mov rcx, rdi; jmp start */
+        auto emitEntry = [&](int32_t start) {
+            size_t entry = assembler.code.size();
+            assembler.Emit({0x48, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF});
+            assembler.Emit({0x48, 0x89, 0xF9});
+            assembler.Jump(stateLabels[start]);
+            return entry;
+        };
+        emitEntry(header.startStates[0]);
+        size_t searchEntry = search ? emitEntry(header.searchStartStates[0]) : 0;
+        for (size_t state = 0; state < stateCount; state++)
+        {
+            bool isAccepting = accepting[state] != 0;
+            size_t fail = isAccepting ? returnLength : returnLast;
+            vector<Segment> segments;
+            for (const Segment &column : columns)
+            {
+                int target = column.target == -1 ? -1 : transitions[state * header.columnCount + column.target];
+                if (segments.empty() || segments.back().target != target)
+                {
+                    segments.push_back(Segment{column.lower, target});
+                }
+            }
+
+            assembler.Bind(stateLabels[state]);
+            if (isAccepting)
+            {
+                /* test rdx, rdx; jz returnLength; last = (rcx - rdi) >> 2 */
+                assembler.Emit({0x48, 0x85, 0xD2});
+                assembler.JumpIfZero(returnLength);
+                assembler.Emit({0x48, 0x89, 0xC8, 0x48, 0x29, 0xF8, 0x48, 0xC1, 0xF8, 0x02});
+            }
+            /* cmp rcx, rsi; jae fail; mov r8d, [rcx] */
+            assembler.Emit({0x48, 0x39, 0xF1});
+            assembler.JumpIfAboveOrEqual(fail);
+            assembler.Emit({0x44, 0x8B, 0x01});
+
+            size_t selfLoop = assembler.NewLabel();
+            size_t loopCount = 0;
+            size_t loopSegment = 0;
+            for (size_t i = 0; i < segments.size(); i++)
+            {
+                if (segments[i].target == static_cast<int>(state))
+                {
+                    loopCount++;
+                    loopSegment = i;
+                }
+            }
+            if (loopCount == 1 && segments.size() > 2)
+            {
+                /* the range of a self loop is checked with one comparison before the dispatch:
+                   mov r9d, r8d; sub r9d, lower; cmp r9d, upper - lower; jbe selfLoop */
+                uint32_t lower = segments[loopSegment].lower;
+                uint32_t upper = segments[loopSegment + 1].lower - 1;
+                assembler.Emit({0x45, 0x89, 0xC1, 0x41, 0x81, 0xE9});
+                assembler.Emit32(lower);
+                assembler.Emit({0x41, 0x81, 0xF9});
+                assembler.Emit32(upper - lower);
+                assembler.JumpIfBelowOrEqual(selfLoop);
+            }
+
+            vector<size_t> leaves;
+            vector<std::pair<size_t, int>> targets;
+            for (const Segment &segment : segments)
+            {
+                if (segment.target == -1)
+                {
+                    leaves.push_back(fail);
+                }
+                else if (segment.target == static_cast<int>(state))
+                {
+                    leaves.push_back(selfLoop);
+                }
+                else
+                {
+                    leaves.push_back(assembler.NewLabel());
+                    targets.emplace_back(leaves.back(), segment.target);
+                }
+            }
+            EmitDispatch(assembler, segments, leaves, 0, segments.size());
+            /* add rcx, 4; jmp next state */
+            assembler.Bind(selfLoop);
+            assembler.Emit({0x48, 0x83, 0xC1, 0x04});
+            assembler.Jump(stateLabels[state]);
+            for (const auto &[label, target] : targets)
+            {
+                assembler.Bind(label);
+                assembler.Emit({0x48, 0x83, 0xC1, 0x04});
+                assembler.Jump(stateLabels[target]);
+            }
+            if (assembler.code.size() > MAX_CODE_SIZE)
+            {
+                return;
+            }
+        }
+        /* returnLength: rax = (rcx - rdi) >> 2; ret */
+        assembler.Bind(returnLength);
+        assembler.Emit({0x48, 0x89, 0xC8, 0x48, 0x29, 0xF8, 0x48, 0xC1, 0xF8, 0x02, 0xC3});
+        assembler.Bind(returnLast);
+        assembler.Emit({0xC3});
+        assembler.Resolve();
+
+        size_t size = assembler.code.size();
+        void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+        {
+            return;
+        }
+        std::memcpy(memory, assembler.code.data(), size);
+        if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0)
+        {
+            munmap(memory, size);
+            return;
+        }
+        code = std::shared_ptr<void>(memory, [size](void *p) { munmap(p, size); });
+        codeSize = size;
+        function = reinterpret_cast<Function>(memory);
+        searchFunction = search ? reinterpret_cast<Function>(static_cast<uint8_t *>(memory) + searchEntry) : nullptr;
+#endif
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "Lexer.hpp"
+
+#include <stdexcept>
+
+#include "NFA.hpp"
+#include "Simplifier.hpp"
+
+namespace regex
+{
+    /**
+     * Lexer::Lexer
+     *
+     * Build the anchored states of the DFA matrix of the rules, and find the rule accepted in each.
+     *
+     * @param  {vector<RegularExpression::Ptr>} rules : the rules, whose IDs are their indices
+     */
+    Lexer::Lexer(const vector<RegularExpression::Ptr> &rules) : ruleCount{rules.size()}
+    {
+        vector<RegularExpression::Ptr> simplified;
+        for (const auto &rule : rules)
+        {
+            simplified.push_back(Simplify(rule));
+        }
+        NFA nfa(simplified);
+        const Graph &G = nfa.G;
+        for (const auto &edge : G.GetEdges())
+        {
+            if (!edge.pattern.IsEpsilon() && edge.pattern.rangeType != RangeType::CharacterRange)
+            {
+                throw std::invalid_argument("the rules of a lexer cannot use assertions");
+            }
+        }
+        vector<vector<StateID>> states;
+        /* the subset construction stops as soon as it goes past the limit */
+        matrix = BuildAnchoredDFAMatrix(nfa, states, MAX_STATE_COUNT);
+        vector<int32_t> endRules(G.NodeCount(), -1);
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            endRules.at(nfa.endVertices[i]) = static_cast<int32_t>(i);
+        }
+        for (const auto &vertices : states)
+        {
+            int32_t rule = -1;
+            for (StateID v : vertices)
+            {
+                if (endRules[v] != -1 && (rule == -1 || endRules[v] < rule))
+                {
+                    rule = endRules[v];
+                }
+            }
+            accepting.push_back(rule);
+        }
+    }
+
+    size_t Lexer::Tokenize(const u32string &input, vector<int> &ids, vector<TokenSpan> &spans) const
+    {
+        return Tokenize(input.data(), input.data() + input.size(), ids, spans);
+    }
+
+    /**
+     * Lexer::Tokenize
+     *
+     * Split the input into the longest tokens, one after another, until the end or a position where
+     * no rule matches a non-empty string. The vectors are cleared first but keep their capacity, so
+     * they can be reused for every buffer without allocating.
+     *
+     * @param  {char32_t*} begin          : start of the input
+     * @param  {char32_t*} end            : end of the input
+     * @param  {vector<int>} ids          : receives the rule of each token
+     * @param  {vector<TokenSpan>} spans  : receives the span of each token, as offsets from begin
+     * @return {size_t}                   : the number of characters tokenized, end - begin if all of them
+     */
+    size_t Lexer::Tokenize(const char32_t *begin, const char32_t *end, vector<int> &ids, vector<TokenSpan> &spans) const
+    {
+        ids.clear();
+        spans.clear();
+        const char32_t *position = begin;
+        int32_t start = matrix.StartState(CharacterContext::TextEdge);
+        while (position < end)
+        {
+            int32_t state = start;
+            int32_t rule = -1;
+            const char32_t *tokenEnd = position;
+            for (const char32_t *i = position; i < end; i++)
+            {
+                int column = matrix.CharacterColumn(*i);
+                state = column == -1 ? -1 : matrix.Next(state, column);
+                if (state == -1)
+                {
+                    break;
+                }
+                else if (accepting[state] != -1)
+                {
+                    rule = accepting[state];
+                    tokenEnd = i + 1;
+                }
+                else
+                {
+                    // keep reading for a longer token
+                }
+            }
+            if (rule == -1)
+            {
+                break;
+            }
+            ids.push_back(rule);
+            spans.push_back(TokenSpan{static_cast<size_t>(position - begin), static_cast<size_t>(tokenEnd - begin)});
+            position = tokenEnd;
+        }
+        return static_cast<size_t>(position - begin);
+    }
+} // namespace regex
\ No newline at end of file
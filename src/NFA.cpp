@@ -1,76 +1,411 @@
 #include "NFA.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
 #include <stack>
+#include <stdexcept>
+#include <tuple>
 #include <unordered_set>
 #include <utfcpp/utf8/cpp11.h>
 
 #include "DFA.hpp"
+#include "Simplifier.hpp"
 
 namespace regex
 {
     using std::static_pointer_cast;
     using std::unordered_set;
 
+    /**
+     * ArenaNFABuilder
+     *
+     * Walks the nodes of an expression arena and adds the corresponding subgraphs to an NFA.
+     * A node shared by several parents is expanded once per occurrence.
+     */
+    class ArenaNFABuilder : public ArenaFolder<NFASubgraph>
+    {
+    public:
+        NFA &nfa;
+
+        ArenaNFABuilder(const ExpressionArena &arena, NFA &nfa) : ArenaFolder<NFASubgraph>(arena), nfa{nfa} {}
+
+        NFASubgraph FoldAlternation(NodeIndex, vector<NFASubgraph> &items) override
+        {
+            return nfa.AddAlternation(items);
+        }
+        NFASubgraph FoldConcatenation(NodeIndex, vector<NFASubgraph> &items) override
+        {
+            return nfa.AddConcatenation(items);
+        }
+        NFASubgraph FoldKleeneStar(NodeIndex, NFASubgraph &inner) override
+        {
+            return nfa.AddKleeneStar(inner);
+        }
+        NFASubgraph FoldRepeat(NodeIndex node, NFASubgraph &inner) override
+        {
+            return nfa.AddRepeat(inner, arena.Node(node).atLeast, arena.Node(node).atMost);
+        }
+        NFASubgraph FoldSymbol(NodeIndex node) override
+        {
+            return nfa.AddSymbol(arena.Node(node).range);
+        }
+        NFASubgraph FoldCharClass(NodeIndex node) override
+        {
+            return nfa.AddCharClass(arena.NodeClass(node));
+        }
+        NFASubgraph FoldCapture(NodeIndex, NFASubgraph &inner) override
+        {
+            return inner;
+        }
+    };
+
     NFA::NFA(const RegularExpression::Ptr &exp)
     {
-        auto subgraph = VisitRegularExpression(exp);
+        auto subgraph = Fold(exp);
         this->startVertex = subgraph.start;
         this->endVertex = subgraph.end;
         NumberPatterns();
     }
-    NFASubgraph NFA::VisitAlternation(const AlternationExpression::Ptr &exp)
+    /**
+     * NFA::NFA
+     *
+     * Build the union of several expressions, remembering the end vertex of each one.
+     *
+     * @param  {vector<RegularExpression::Ptr>} exps : the expressions, at least one
+     */
+    NFA::NFA(const vector<RegularExpression::Ptr> &exps)
+    {
+        if (exps.empty())
+        {
+            throw std::invalid_argument("the union of no expressions");
+        }
+        vector<NFASubgraph> items;
+        for (const auto &exp : exps)
+        {
+            items.push_back(Fold(exp));
+            endVertices.push_back(items.back().end);
+        }
+        auto subgraph = AddAlternation(items);
+        this->startVertex = subgraph.start;
+        this->endVertex = subgraph.end;
+        NumberPatterns();
+    }
+    NFA::NFA(const ExpressionArena &arena, NodeIndex root)
+    {
+        ArenaNFABuilder builder(arena, *this);
+        auto subgraph = builder.Fold(root);
+        this->startVertex = subgraph.start;
+        this->endVertex = subgraph.end;
+        NumberPatterns();
+    }
+    NFASubgraph NFA::FoldAlternation(const AlternationExpression::Ptr &, vector<NFASubgraph> &items)
+    {
+        return AddAlternation(items);
+    }
+    NFASubgraph NFA::FoldConcatenation(const ConcatenationExpression::Ptr &, vector<NFASubgraph> &items)
+    {
+        return AddConcatenation(items);
+    }
+    NFASubgraph NFA::FoldKleeneStar(const KleeneStarExpression::Ptr &, NFASubgraph &inner)
+    {
+        return AddKleeneStar(inner);
+    }
+    NFASubgraph NFA::FoldRepeat(const RepeatExpression::Ptr &exp, NFASubgraph &inner)
+    {
+        return AddRepeat(inner, exp->atLeast, exp->atMost);
+    }
+    NFASubgraph NFA::FoldSymbol(const SymbolExpression::Ptr &exp)
+    {
+        return AddSymbol(exp->range);
+    }
+    NFASubgraph NFA::FoldCharClass(const CharClassExpression::Ptr &exp)
+    {
+        return AddCharClass(exp->charClass);
+    }
+    NFASubgraph NFA::FoldCapture(const CaptureExpression::Ptr &, NFASubgraph &inner)
+    {
+        /* the automaton only decides membership, so a group is its inner expression */
+        return inner;
+    }
+    NFASubgraph NFA::AddAlternation(const vector<NFASubgraph> &graphs)
     {
-        NFASubgraph graph1 = VisitRegularExpression(exp->left);
-        NFASubgraph graph2 = VisitRegularExpression(exp->right);
         int in = G.AddNode();
         int out = G.AddNode();
-        G.AddEdge(Edge(in, graph1.start, UnicodeRange::EPSILON));
-        G.AddEdge(Edge(in, graph2.start, UnicodeRange::EPSILON));
-        G.AddEdge(Edge(graph1.end, out, UnicodeRange::EPSILON));
-        G.AddEdge(Edge(graph2.end, out, UnicodeRange::EPSILON));
-        return NFASubgraph(in, out);
+        for (const auto &graph : graphs)
+        {
+            G.AddEdge(Edge(in, graph.start, UnicodeRange::EPSILON));
+        }
+        for (const auto &graph : graphs)
+        {
+            G.AddEdge(Edge(graph.end, out, UnicodeRange::EPSILON));
+        }
+        return NFASubgraph(in, out, graphs.front().first);
     }
-    NFASubgraph NFA::VisitConcatenation(const ConcatenationExpression::Ptr &exp)
+    NFASubgraph NFA::AddConcatenation(const vector<NFASubgraph> &graphs)
     {
-        NFASubgraph src = VisitRegularExpression(exp->left);
-        NFASubgraph dest = VisitRegularExpression(exp->right);
-        G.AddEdge(Edge(src.end, dest.start, UnicodeRange::EPSILON));
-        return NFASubgraph(src.start, dest.end);
+        for (size_t i = 0; i + 1 < graphs.size(); i++)
+        {
+            G.AddEdge(Edge(graphs[i].end, graphs[i + 1].start, UnicodeRange::EPSILON));
+        }
+        return NFASubgraph(graphs.front().start, graphs.back().end, graphs.front().first);
     }
-    NFASubgraph NFA::VisitKleeneStar(const KleeneStarExpression::Ptr &exp)
+    NFASubgraph NFA::AddKleeneStar(const NFASubgraph &graph)
     {
-        NFASubgraph graph = VisitRegularExpression(exp->innerExp);
         int in = G.AddNode();
         int out = G.AddNode();
         G.AddEdge(Edge(in, graph.start, UnicodeRange::EPSILON));
         G.AddEdge(Edge(out, graph.start, UnicodeRange::EPSILON));
         G.AddEdge(Edge(graph.end, out, UnicodeRange::EPSILON));
         G.AddEdge(Edge(in, out, UnicodeRange::EPSILON));
-        return NFASubgraph(in, out);
+        return NFASubgraph(in, out, graph.first);
     }
-    NFASubgraph NFA::VisitSymbol(const SymbolExpression::Ptr &exp)
+    /**
+     * NFA::AddRepeat
+     *
+     * Build x{m,n} as x^m (x(x(...)?)?)? with n - m nested optional copies, or x^m x* if
+     * there is no upper bound. The subgraph of x is reused as the first copy, the
+     * other copies are cloned from it, so the size of the result is linear in n.
+     *
+     * @param  {NFASubgraph} graph : the subgraph of x, which must be the last one built
+     * @param  {int} atLeast       : m
+     * @param  {int} atMost        : n, or RepeatExpression::UNBOUNDED
+     * @return {NFASubgraph}       : the subgraph of the repetition
+     */
+    NFASubgraph NFA::AddRepeat(const NFASubgraph &graph, int atLeast, int atMost)
+    {
+        bool bounded = atMost != RepeatExpression::UNBOUNDED;
+        int copyCount = bounded ? atMost : atLeast + 1;
+        if (copyCount == 0)
+        {
+            /* x{0,0} only matches the empty string */
+            StateID node = G.AddNode();
+            return NFASubgraph(node, node, graph.first);
+        }
+        /* clone all the copies before connecting them, so that the connections are not cloned */
+        StateID last = G.NodeCount();
+        vector<NFASubgraph> copies = {graph};
+        for (int i = 1; i < copyCount; i++)
+        {
+            copies.push_back(CloneSubgraph(graph, last));
+        }
+        StateID start;
+        StateID current;
+        if (atLeast > 0)
+        {
+            for (int i = 0; i + 1 < atLeast; i++)
+            {
+                G.AddEdge(Edge(copies[i].end, copies[i + 1].start, UnicodeRange::EPSILON));
+            }
+            start = copies.front().start;
+            current = copies[atLeast - 1].end;
+        }
+        else
+        {
+            start = G.AddNode();
+            current = start;
+        }
+        if (bounded)
+        {
+            if (atMost == atLeast)
+            {
+                return NFASubgraph(start, current, graph.first);
+            }
+            StateID out = G.AddNode();
+            for (int i = atLeast; i < atMost; i++)
+            {
+                G.AddEdge(Edge(current, copies[i].start, UnicodeRange::EPSILON));
+                G.AddEdge(Edge(current, out, UnicodeRange::EPSILON));
+                current = copies[i].end;
+            }
+            G.AddEdge(Edge(current, out, UnicodeRange::EPSILON));
+            return NFASubgraph(start, out, graph.first);
+        }
+        else
+        {
+            NFASubgraph star = AddKleeneStar(copies.back());
+            G.AddEdge(Edge(current, star.start, UnicodeRange::EPSILON));
+            return NFASubgraph(start, star.end, graph.first);
+        }
+    }
+    /**
+     * NFA::CloneSubgraph
+     *
+     * @param  {NFASubgraph} graph : the subgraph to copy
+     * @param  {StateID} last      : one past the last vertex of the subgraph
+     * @return {NFASubgraph}       : a copy of the subgraph with fresh vertices
+     */
+    NFASubgraph NFA::CloneSubgraph(const NFASubgraph &graph, StateID last)
+    {
+        StateID offset = G.NodeCount() - graph.first;
+        for (StateID v = graph.first; v < last; v++)
+        {
+            G.AddNode();
+        }
+        for (StateID v = graph.first; v < last; v++)
+        {
+            for (size_t i = 0, n = G.Adj(v).size(); i < n; i++)
+            {
+                Edge edge = G.Adj(v)[i];
+                G.AddEdge(Edge(edge.from + offset, edge.to + offset, edge.pattern));
+            }
+        }
+        return NFASubgraph(graph.start + offset, graph.end + offset, graph.first + offset);
+    }
+    NFASubgraph NFA::AddSymbol(const UnicodeRange &pattern)
     {
         int start = G.AddNode();
         int end = G.AddNode();
-        UnicodeRange pattern = exp->range;
         G.AddEdge(Edge(start, end, pattern));
         return NFASubgraph(start, end);
     }
+    /**
+     * NFA::AddCharClass
+     *
+     * A character class is a single transition between two vertices, made of one edge per range.
+     * An empty class has no edge and never matches.
+     *
+     * @param  {CharClass} charClass : the set of characters to match
+     * @return {NFASubgraph}         : the subgraph of the class
+     */
+    NFASubgraph NFA::AddCharClass(const CharClass &charClass)
+    {
+        int start = G.AddNode();
+        int end = G.AddNode();
+        for (const auto &range : charClass.Ranges())
+        {
+            G.AddEdge(Edge(start, end, range));
+        }
+        return NFASubgraph(start, end);
+    }
     /**
      * NFA::NumberPatterns
-     * 
-     * Give every pattern (Unicode range) a number as a unique identifier
+     *
+     * Partition the characters used by the edges into classes of characters which lead along the same
+     * transitions, and give every class (and every assertion) a number as a unique identifier. The
+     * classes are disjoint, so the subset construction over them yields a deterministic automaton even
+     * if the ranges of the edges overlap, and all the ranges of a character class share one column of
+     * the DFA matrix. Classes are numbered in the order their first edge appears.
+     *
+     * If the graph has assertions, the characters of a class also share their CharacterContext, which
+     * decides the assertions around them.
      */
     void NFA::NumberPatterns()
     {
         patterns.Add(UnicodeRange::EPSILON, EPSILON);
-        for (auto edge : G.GetEdges())
+        auto edges = G.GetEdges();
+        bool hasAssertions = std::any_of(edges.begin(), edges.end(),
+                                         [](const Edge &edge) { return IsAssertion(edge.pattern.rangeType); });
+
+        /* the elementary intervals between the boundaries of all the character ranges */
+        vector<char32_t> boundaries;
+        for (const auto &edge : edges)
+        {
+            if (edge.pattern.rangeType == RangeType::CharacterRange)
+            {
+                boundaries.push_back(edge.pattern.lower);
+                boundaries.push_back(edge.pattern.upper + 1);
+            }
+        }
+        if (hasAssertions && !boundaries.empty())
+        {
+            /* the edges of the contexts: "\n", [0-9], [A-Z], "_" and [a-z] */
+            for (char32_t c : {U'\n', U'0', U'A', U'_', U'a'})
+            {
+                boundaries.push_back(c);
+            }
+            for (char32_t c : {U'\n', U'9', U'Z', U'_', U'z'})
+            {
+                boundaries.push_back(c + 1);
+            }
+        }
+        std::sort(boundaries.begin(), boundaries.end());
+        boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+        auto boundaryIndex = [&boundaries](char32_t c) {
+            return static_cast<size_t>(std::lower_bound(boundaries.begin(), boundaries.end(), c) - boundaries.begin());
+        };
+
+        /* the signature of an interval is the set of transitions (pairs of vertices) it can take */
+        size_t intervalCount = boundaries.empty() ? 0 : boundaries.size() - 1;
+        vector<vector<size_t>> signatures(intervalCount);
+        std::map<std::pair<StateID, StateID>, size_t> transitions;
+        for (const auto &edge : edges)
         {
-            if (!patterns.HasPattern(edge.pattern))
+            if (edge.pattern.rangeType == RangeType::CharacterRange)
             {
-                int n = static_cast<int>(patterns.Size());
-                patterns.Add(edge.pattern, n - 1);
+                size_t t = transitions.emplace(std::make_pair(edge.from, edge.to), transitions.size()).first->second;
+                for (size_t k = boundaryIndex(edge.pattern.lower), n = boundaryIndex(edge.pattern.upper + 1); k < n; k++)
+                {
+                    signatures[k].push_back(t);
+                }
+            }
+        }
+        const size_t UNCOVERED = SIZE_MAX;
+        std::map<vector<size_t>, size_t> groups;
+        vector<size_t> intervalGroups(intervalCount, UNCOVERED);
+        for (size_t k = 0; k < intervalCount; k++)
+        {
+            if (!signatures[k].empty())
+            {
+                std::sort(signatures[k].begin(), signatures[k].end());
+                signatures[k].erase(std::unique(signatures[k].begin(), signatures[k].end()), signatures[k].end());
+                if (hasAssertions)
+                {
+                    /* a marker no transition can take apart the contexts */
+                    signatures[k].push_back(SIZE_MAX - static_cast<size_t>(ContextOf(boundaries[k])));
+                }
+                intervalGroups[k] = groups.emplace(std::move(signatures[k]), groups.size()).first->second;
+            }
+        }
+
+        /* number the groups and the assertions in the order of the edges */
+        vector<int> groupIDs(groups.size(), EPSILON);
+        int nextID = 0;
+        for (const auto &edge : edges)
+        {
+            if (edge.pattern.IsEpsilon() || rangeClasses.count(edge.pattern))
+            {
+                continue;
+            }
+            else if (edge.pattern.rangeType != RangeType::CharacterRange)
+            {
+                patterns.Add(edge.pattern, nextID);
+                rangeClasses[edge.pattern] = {nextID};
+                nextID++;
+                continue;
+            }
+            vector<int> &classes = rangeClasses[edge.pattern];
+            for (size_t k = boundaryIndex(edge.pattern.lower), n = boundaryIndex(edge.pattern.upper + 1); k < n; k++)
+            {
+                int &id = groupIDs[intervalGroups[k]];
+                if (id == EPSILON)
+                {
+                    id = nextID++;
+                }
+                if (std::find(classes.begin(), classes.end(), id) == classes.end())
+                {
+                    classes.push_back(id);
+                }
+            }
+        }
+
+        /* the ranges of a class are its intervals, with adjacent intervals merged */
+        for (size_t k = 0; k < intervalCount; k++)
+        {
+            if (intervalGroups[k] != UNCOVERED)
+            {
+                char32_t lower = boundaries[k];
+                while (k + 1 < intervalCount && intervalGroups[k + 1] == intervalGroups[k])
+                {
+                    k++;
+                }
+                patterns.Add(UnicodeRange(RangeType::CharacterRange, lower, boundaries[k + 1] - 1),
+                             groupIDs[intervalGroups[k]]);
+            }
+            else
+            {
+                // no edge accepts the characters of the interval
             }
         }
     }
@@ -82,37 +417,62 @@ namespace regex
      * @param  {UnicodeRange} pattern : current unicode pattern
      * @param  {NFA::Table} table     : the table for recording next states after
      * transitions
-     * @param  {vector<bool>} visited : keep track of visited vertices
+     * @param  {vector<bool>} visited : keep track of the vertices visited before any character
      */
     void NFA::FindNextStates(int start, int vertex, UnicodeRange pattern, NFA::Table &table, vector<bool> &visited)
     {
+        /* depth-first search with an explicit stack of (vertex, pattern, next edge) frames */
+        struct Frame
+        {
+            StateID vertex;
+            UnicodeRange pattern;
+            size_t nextEdge;
+        };
+        vector<Frame> stack;
         if (!visited.at(vertex))
         {
             visited.at(vertex) = true;
-            for (const auto &adjEdge : G.Adj(vertex))
+            stack.push_back(Frame{static_cast<StateID>(vertex), pattern, 0});
+        }
+        else
+        {
+            // the program has already visited the current vertex
+        }
+        while (!stack.empty())
+        {
+            Frame &frame = stack.back();
+            const auto &adj = G.Adj(frame.vertex);
+            if (frame.nextEdge == adj.size())
             {
-                if (adjEdge.pattern.IsEpsilon() && !pattern.IsEpsilon())
-                {
-                    table[start][pattern].insert(adjEdge.to);
-                    FindNextStates(start, adjEdge.to, pattern, table, visited);
-                }
-                else if (pattern.IsEpsilon())
+                stack.pop_back();
+                continue;
+            }
+            const auto &adjEdge = adj[frame.nextEdge];
+            frame.nextEdge++;
+            UnicodeRange current = frame.pattern;
+            if (current.IsEpsilon() && adjEdge.pattern.IsEpsilon())
+            {
+                if (!visited.at(adjEdge.to))
                 {
-                    if (!adjEdge.pattern.IsEpsilon())
-                    {
-                        table[start][adjEdge.pattern].insert(adjEdge.to);
-                    }
-                    FindNextStates(start, adjEdge.to, adjEdge.pattern, table, visited);
+                    visited.at(adjEdge.to) = true;
+                    stack.push_back(Frame{adjEdge.to, current, 0});
                 }
-                else
+            }
+            else if (current.IsEpsilon() || adjEdge.pattern.IsEpsilon())
+            {
+                /* a vertex is visited once per pattern: the vertices reached after a pattern are its own
+                   visited set, since reaching a vertex after one pattern says nothing of the others */
+                UnicodeRange nextPattern = current.IsEpsilon() ? adjEdge.pattern : current;
+                if (table[start][nextPattern].insert(adjEdge.to).second)
                 {
-                    // both adjEdge.pattern and pattern are not epsilon.
+                    stack.push_back(Frame{adjEdge.to, nextPattern, 0});
                 }
             }
-        }
-        else
-        {
-            // the program has already visited the current vertex
+            else
+            {
+                // both adjEdge.pattern and pattern are not epsilon.
+                continue;
+            }
         }
     }
     /**
@@ -181,8 +541,11 @@ namespace regex
 
             for (auto [pattern, nextStatesSet] : nextStatesMap)
             {
-                int index = patterns.GetIDByPattern(pattern);
-                nextStates.at(index) = std::set<StateID>(nextStatesSet.begin(), nextStatesSet.end());
+                /* a range leads to the same states for every class it covers */
+                for (int id : rangeClasses.at(pattern))
+                {
+                    nextStates.at(id).insert(nextStatesSet.begin(), nextStatesSet.end());
+                }
             }
             rows.push_back(DFATableRow(index, nextStates));
             for (auto state : nextStates)
@@ -204,4 +567,437 @@ namespace regex
         }
         return rows;
     }
-} // namespace regex
+
+    /**
+     * BuildDFAMatrix
+     *
+     * Run the whole compilation pipeline without consulting any cache. The expression
+     * is case-folded if asked to, and simplified before its NFA is built.
+     *
+     * @param  {RegularExpression::Ptr} exp : the expression to compile
+     * @param  {CompileFlags} flags         : the options of the compilation
+     * @return {DFAMatrix}                  : the compiled matrix
+     */
+    DFAMatrix BuildDFAMatrix(const RegularExpression::Ptr &exp, CompileFlags flags)
+    {
+        NFA nfa{Simplify(HasFlag(flags, CompileFlags::CaseInsensitive) ? FoldCase(exp) : exp)};
+        return BuildDFAMatrix(nfa);
+    }
+
+    /**
+     * BuildDFAContents
+     *
+     * The subset construction with the assertions compiled in. A state of the DFA is a set of vertices
+     * closed under the epsilon edges, together with the context behind the current position. The
+     * assertion edges can only be followed once the context ahead is known too: before deciding whether
+     * the state accepts, and before taking the transition of a character class, whose characters share
+     * one context. Only "^" and the word boundaries look behind: without them the context behind is always
+     * TextEdge, and there is one start state.
+     *
+     * The search states are built next if asked for, as for ".*" in front of the expression but with the
+     * sets of vertices kept apart by the position their matches started at. Once a set accepts, the later
+     * ones are dropped and no more matches start, so that scanning to the last accepting position finds
+     * the end of the leftmost-longest match. They are given up past MAX_SEARCH_STATES.
+     *
+     * The construction stops with an error as soon as the anchored states outnumber "maxStateCount".
+     *
+     * @param  {NFA} nfa                          : the NFA whose patterns give the columns
+     * @param  {Graph} G                          : the edges of the NFA, or the same edges reversed
+     * @param  {size_t} startVertex               : the vertex the matches start from
+     * @param  {size_t} endVertex                 : the vertex the matches end at
+     * @param  {bool} search                      : true to build the search states
+     * @param  {vector<vector<StateID>>} vertices : receives the vertices of each anchored state, if not null
+     * @param  {size_t} maxStateCount             : the most anchored states allowed
+     * @return {DFAImageContents}                 : the states, transitions and ranges of the matrix
+     */
+    static DFAImageContents BuildDFAContents(const NFA &nfa, const Graph &G, size_t startVertex, size_t endVertex,
+                                             bool search, vector<vector<StateID>> *vertices = nullptr,
+                                             size_t maxStateCount = SIZE_MAX)
+    {
+        size_t vertexCount = G.NodeCount();
+        int contextCount = static_cast<int>(DFA_IMAGE_CONTEXT_COUNT);
+        DFAImageContents contents;
+        for (size_t v = 0; v < vertexCount; v++)
+        {
+            for (const auto &edge : G.Adj(v))
+            {
+                if (IsAssertion(edge.pattern.rangeType))
+                {
+                    contents.assertionTypes |= uint32_t{1} << static_cast<uint32_t>(edge.pattern.rangeType);
+                }
+            }
+        }
+        bool hasAssertions = contents.assertionTypes != 0;
+        bool keysBehind = (contents.assertionTypes & ~(uint32_t{1} << static_cast<uint32_t>(RangeType::LineEnd))) != 0;
+
+        /* the columns are the character classes, with the assertions left out */
+        int classCount = static_cast<int>(nfa.patterns.Size()) - 1;
+        vector<int> classColumns(classCount, -1);
+        vector<CharacterContext> columnContexts;
+        for (int id = 0; id < classCount; id++)
+        {
+            const UnicodeRange &range = nfa.patterns.GetPatternByID(id);
+            if (range.rangeType == RangeType::CharacterRange)
+            {
+                classColumns[id] = static_cast<int>(columnContexts.size());
+                columnContexts.push_back(ContextOf(range.lower));
+            }
+        }
+        for (const auto &[pattern, id] : nfa.patterns.patternToID)
+        {
+            if (pattern.rangeType == RangeType::CharacterRange)
+            {
+                contents.ranges.push_back(DFAImageRange{pattern.lower, pattern.upper, classColumns[id]});
+            }
+        }
+
+        /* the characters no edge takes get columns of their own too, one per context, so that the search
+           states can start over after them */
+        vector<DFAImageRange> covered = contents.ranges;
+        std::sort(covered.begin(), covered.end(),
+                  [](const DFAImageRange &x, const DFAImageRange &y) { return x.lower < y.lower; });
+        vector<char32_t> gapBoundaries;
+        char32_t next = 0;
+        for (const auto &range : covered)
+        {
+            if (range.lower > next)
+            {
+                gapBoundaries.insert(gapBoundaries.end(), {next, range.lower});
+            }
+            next = range.upper + 1;
+        }
+        if (next <= CharClass::MAX_CODE_POINT)
+        {
+            gapBoundaries.insert(gapBoundaries.end(), {next, CharClass::MAX_CODE_POINT + 1});
+        }
+        int gapColumns[DFA_IMAGE_CONTEXT_COUNT] = {-1, -1, -1, -1};
+        const char32_t contextEdges[] = {U'\n', U'\n' + 1, U'0', U'9' + 1, U'A',
+                                         U'Z' + 1, U'_', U'_' + 1, U'a', U'z' + 1};
+        for (size_t i = 0; i < gapBoundaries.size(); i += 2)
+        {
+            /* a gap is cut where the context changes */
+            vector<char32_t> cuts = {gapBoundaries[i]};
+            for (char32_t c : contextEdges)
+            {
+                if (hasAssertions && c > gapBoundaries[i] && c < gapBoundaries[i + 1])
+                {
+                    cuts.push_back(c);
+                }
+            }
+            std::sort(cuts.begin(), cuts.end());
+            cuts.push_back(gapBoundaries[i + 1]);
+            for (size_t k = 0; k + 1 < cuts.size(); k++)
+            {
+                CharacterContext context = ContextOf(cuts[k]);
+                int &column = gapColumns[static_cast<int>(context)];
+                if (column == -1)
+                {
+                    column = static_cast<int>(columnContexts.size());
+                    columnContexts.push_back(context);
+                }
+                contents.ranges.push_back(DFAImageRange{cuts[k], cuts[k + 1] - 1, column});
+            }
+        }
+        size_t columnCount = columnContexts.size();
+
+        /* the vertices reached from "vertices" along the epsilon edges, and the assertions holding between
+           "behind" and "ahead" unless "epsilonOnly" */
+        vector<bool> marked(vertexCount, false);
+        auto close = [&](const vector<StateID> &vertices, bool epsilonOnly, CharacterContext behind,
+                         CharacterContext ahead) {
+            vector<StateID> closure;
+            std::stack<StateID> stack;
+            for (StateID v : vertices)
+            {
+                stack.push(v);
+            }
+            while (!stack.empty())
+            {
+                StateID v = stack.top();
+                stack.pop();
+                if (marked[v])
+                {
+                    continue;
+                }
+                marked[v] = true;
+                closure.push_back(v);
+                for (const auto &edge : G.Adj(v))
+                {
+                    RangeType type = edge.pattern.rangeType;
+                    if (type == RangeType::Epsilon ||
+                        (!epsilonOnly && IsAssertion(type) && AssertionHolds(type, behind, ahead)))
+                    {
+                        stack.push(edge.to);
+                    }
+                }
+            }
+            for (StateID v : closure)
+            {
+                marked[v] = false;
+            }
+            std::sort(closure.begin(), closure.end());
+            return closure;
+        };
+
+        /* a state is a list of sets of vertices, each closed under the epsilon edges and carrying on the
+           matches started at one position, the earliest first; whether a match may still start at the next
+           position; and the context behind. An anchored state has a single set and starts no more matches */
+        struct State
+        {
+            vector<vector<StateID>> groups;
+            bool restart;
+            int behind;
+
+            bool operator<(const State &other) const
+            {
+                return std::tie(groups, restart, behind) < std::tie(other.groups, other.restart, other.behind);
+            }
+        };
+        std::map<State, int32_t> stateIDs;
+        vector<State> states;
+        auto record = [&stateIDs, &states](State state) {
+            auto [it, inserted] = stateIDs.emplace(state, static_cast<int32_t>(states.size()));
+            if (inserted)
+            {
+                states.push_back(std::move(state));
+            }
+            return it->second;
+        };
+        vector<StateID> start = close({static_cast<StateID>(startVertex)}, true, CharacterContext::TextEdge,
+                                      CharacterContext::TextEdge);
+        for (int behind = 0; behind < contextCount; behind++)
+        {
+            contents.startStates[behind] = record(State{{start}, false, keysBehind ? behind : 0});
+        }
+
+        /* the targets of the character edges of each column, with the index of the set they leave */
+        vector<vector<std::pair<size_t, StateID>>> moves(columnCount);
+        vector<bool> seen(vertexCount, false);
+        auto expand = [&](size_t s) {
+            /* "states" grows while it is walked, so the state is copied */
+            State state = states[s];
+            CharacterContext behind = static_cast<CharacterContext>(state.behind);
+            uint8_t accepting = 0;
+            /* whether matches may start after a character, by the context ahead */
+            bool restarts[DFA_IMAGE_CONTEXT_COUNT] = {};
+            for (int ahead = 0; ahead < contextCount; ahead++)
+            {
+                size_t groupCount = state.groups.size();
+                vector<vector<StateID>> closures;
+                size_t first = groupCount;
+                for (size_t g = 0; g < groupCount; g++)
+                {
+                    closures.push_back(
+                        close(state.groups[g], !hasAssertions, behind, static_cast<CharacterContext>(ahead)));
+                    if (first == groupCount &&
+                        std::binary_search(closures[g].begin(), closures[g].end(), static_cast<StateID>(endVertex)))
+                    {
+                        first = g;
+                    }
+                }
+                if (first < groupCount)
+                {
+                    /* the match ending here is the leftmost one: the sets of the later starts are dropped */
+                    accepting |= uint8_t{1} << ahead;
+                    groupCount = first + 1;
+                }
+                restarts[ahead] = state.restart && first == state.groups.size();
+                for (size_t g = 0; g < groupCount; g++)
+                {
+                    for (StateID v : closures[g])
+                    {
+                        for (const auto &edge : G.Adj(v))
+                        {
+                            if (edge.pattern.rangeType != RangeType::CharacterRange)
+                            {
+                                continue;
+                            }
+                            for (int id : nfa.RangeClasses(edge.pattern))
+                            {
+                                int column = classColumns[id];
+                                if (!hasAssertions || static_cast<int>(columnContexts[column]) == ahead)
+                                {
+                                    moves[column].emplace_back(g, edge.to);
+                                }
+                            }
+                        }
+                    }
+                }
+                if (!hasAssertions)
+                {
+                    /* the closure is the same whatever comes next */
+                    accepting = accepting != 0 ? DFA_IMAGE_ALWAYS_ACCEPTING : 0;
+                    break;
+                }
+            }
+            contents.accepting.push_back(accepting);
+            for (size_t column = 0; column < columnCount; column++)
+            {
+                int ahead = hasAssertions ? static_cast<int>(columnContexts[column]) : 0;
+                /* a vertex reached by an earlier set is left out of the later ones, which could only
+                   find the same matches with later starts */
+                vector<vector<StateID>> groups;
+                auto add = [&](const vector<StateID> &targets) {
+                    vector<StateID> group;
+                    for (StateID v : close(targets, true, behind, behind))
+                    {
+                        if (!seen[v])
+                        {
+                            seen[v] = true;
+                            group.push_back(v);
+                        }
+                    }
+                    if (!group.empty())
+                    {
+                        groups.push_back(std::move(group));
+                    }
+                };
+                const auto &targets = moves[column];
+                for (size_t i = 0, j = 0; i < targets.size(); i = j)
+                {
+                    vector<StateID> group;
+                    for (j = i; j < targets.size() && targets[j].first == targets[i].first; j++)
+                    {
+                        group.push_back(targets[j].second);
+                    }
+                    add(group);
+                }
+                if (restarts[ahead])
+                {
+                    add(start);
+                }
+                for (const auto &group : groups)
+                {
+                    for (StateID v : group)
+                    {
+                        seen[v] = false;
+                    }
+                }
+                moves[column].clear();
+                if (groups.empty())
+                {
+                    contents.transitions.push_back(-1);
+                }
+                else
+                {
+                    int next = keysBehind ? static_cast<int>(columnContexts[column]) : 0;
+                    contents.transitions.push_back(record(State{std::move(groups), restarts[ahead], next}));
+                }
+            }
+        };
+        for (size_t s = 0; s < states.size(); s++)
+        {
+            expand(s);
+            if (states.size() > maxStateCount)
+            {
+                throw std::runtime_error("the DFA needs more than " + std::to_string(maxStateCount) + " states");
+            }
+        }
+
+        /* the search states only follow the anchored ones, which never lead to them */
+        size_t anchoredCount = states.size();
+        for (int behind = 0; search && behind < contextCount; behind++)
+        {
+            contents.searchStartStates[behind] = record(State{{start}, true, keysBehind ? behind : 0});
+        }
+        for (size_t s = anchoredCount; s < states.size(); s++)
+        {
+            if (states.size() - anchoredCount > MAX_SEARCH_STATES)
+            {
+                /* searching falls back to trying the anchored states at every position */
+                contents.transitions.resize(anchoredCount * columnCount);
+                contents.accepting.resize(anchoredCount);
+                states.resize(anchoredCount);
+                std::fill(std::begin(contents.searchStartStates), std::end(contents.searchStartStates), -1);
+                break;
+            }
+            expand(s);
+        }
+        for (size_t s = 0; vertices != nullptr && s < anchoredCount; s++)
+        {
+            vertices->push_back(std::move(states[s].groups.front()));
+        }
+        contents.stateCount = static_cast<uint32_t>(states.size());
+        contents.anchoredStateCount = static_cast<uint32_t>(anchoredCount);
+        contents.columnCount = static_cast<uint32_t>(columnCount);
+        return contents;
+    }
+
+    /**
+     * BuildDFAMatrix
+     *
+     * Build the matrix of the expression, with its search states, and the matrix of the reversed
+     * expression stored inside of it. The reversed one follows the edges of the NFA backwards with "^" and
+     * "$" traded, and reads a match from its end to find its start.
+     *
+     * @param  {NFA} nfa    : the NFA of the expression
+     * @return {DFAMatrix}  : the compiled matrix
+     */
+    DFAMatrix BuildDFAMatrix(NFA &nfa)
+    {
+        const Graph &G = nfa.G;
+        Graph reversedGraph;
+        reversedGraph.adj.resize(G.NodeCount());
+        for (size_t v = 0; v < G.NodeCount(); v++)
+        {
+            for (const auto &edge : G.Adj(v))
+            {
+                UnicodeRange pattern = edge.pattern;
+                if (pattern.rangeType == RangeType::LineBegin)
+                {
+                    pattern.rangeType = RangeType::LineEnd;
+                }
+                else if (pattern.rangeType == RangeType::LineEnd)
+                {
+                    pattern.rangeType = RangeType::LineBegin;
+                }
+                else
+                {
+                    // the word boundaries look both ways
+                }
+                reversedGraph.AddEdge(Edge(edge.to, edge.from, pattern));
+            }
+        }
+        DFAMatrix reversed =
+            DFAMatrix::FromContents(BuildDFAContents(nfa, reversedGraph, nfa.endVertex, nfa.startVertex, false));
+        DFAImageContents contents = BuildDFAContents(nfa, G, nfa.startVertex, nfa.endVertex, true);
+        contents.reverse.assign(reversed.ImageData(), reversed.ImageData() + reversed.ImageSize());
+        return DFAMatrix::FromContents(std::move(contents));
+    }
+
+    /**
+     * BuildAnchoredDFAMatrix
+     *
+     * Build the anchored states only, and tell which vertices of the NFA make up each of them, for the
+     * callers which need more than whether a state accepts, such as which expression of a union ends there.
+     *
+     * @param  {NFA} nfa                        : the NFA of the expression
+     * @param  {vector<vector<StateID>>} states : receives the vertices of each state, closed under the
+     *                                            epsilon edges
+     * @param  {size_t} maxStateCount           : the most states allowed, a std::runtime_error is thrown as soon
+     *                                            as the construction goes past it
+     * @return {DFAMatrix}                      : the compiled matrix, without search states
+     */
+    DFAMatrix BuildAnchoredDFAMatrix(const NFA &nfa, vector<vector<StateID>> &states, size_t maxStateCount)
+    {
+        states.clear();
+        return DFAMatrix::FromContents(
+            BuildDFAContents(nfa, nfa.G, nfa.startVertex, nfa.endVertex, false, &states, maxStateCount));
+    }
+
+    /**
+     * BuildAnchoredDFAMatrix
+     *
+     * Run the same pipeline as BuildDFAMatrix, without the search states and the reversed matrix, for the
+     * matrices which are only ever read from a known start.
+     *
+     * @param  {RegularExpression::Ptr} exp : the expression to compile
+     * @param  {CompileFlags} flags         : the options of the compilation
+     * @return {DFAMatrix}                  : the compiled matrix, without search states
+     */
+    DFAMatrix BuildAnchoredDFAMatrix(const RegularExpression::Ptr &exp, CompileFlags flags)
+    {
+        NFA nfa{Simplify(HasFlag(flags, CompileFlags::CaseInsensitive) ? FoldCase(exp) : exp)};
+        return DFAMatrix::FromContents(BuildDFAContents(nfa, nfa.G, nfa.startVertex, nfa.endVertex, false));
+    }
+} // namespace regex
\ No newline at end of file
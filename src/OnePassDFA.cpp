@@ -0,0 +1,246 @@
+#include "OnePassDFA.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "FindIter.hpp"
+
+namespace regex
+{
+    OnePassDFA::OnePassDFA(const RegularExpression::Ptr &exp)
+    {
+        CaptureProgram program(exp);
+        if (!Build(program))
+        {
+            throw std::invalid_argument("the expression is not one-pass");
+        }
+        matrix = exp->Compile();
+    }
+
+    /**
+     * OnePassDFA::IsOnePass
+     *
+     * @param  {RegularExpression::Ptr} exp : an expression
+     * @return {bool}                       : whether a one-pass DFA can be built for it
+     */
+    bool OnePassDFA::IsOnePass(const RegularExpression::Ptr &exp)
+    {
+        try
+        {
+            CaptureProgram program(exp);
+            OnePassDFA dfa;
+            return dfa.Build(program);
+        }
+        catch (const std::invalid_argument &)
+        {
+            /* expressions with assertions have no capture program */
+            return false;
+        }
+    }
+
+    /**
+     * OnePassDFA::Build
+     *
+     * The states are the start vertex of the program and the vertices following a character. The closure
+     * of a state must reach every vertex by one path at most, and the ranges it reaches must not overlap;
+     * each column then leads through a single path, whose tags become the tags of the transition.
+     *
+     * @param  {CaptureProgram} program : the program of the expression
+     * @return {bool}                   : false if the program is not one-pass
+     */
+    bool OnePassDFA::Build(const CaptureProgram &program)
+    {
+        const vector<CaptureVertex> &vertices = program.vertices;
+        groupCount = program.groupCount;
+        tagCount = program.TagCount();
+        vector<vector<int32_t>> vertexColumns;
+        classRanges = program.SplitColumns(vertexColumns);
+        columnCount = classRanges.size();
+
+        vector<StateID> entries = {program.startVertex};
+        vector<int32_t> stateOf(vertices.size(), -1);
+        stateOf[program.startVertex] = 0;
+        vector<uint32_t> marks(vertices.size(), 0);
+        vector<std::pair<StateID, vector<int32_t>>> stack;
+        vector<int32_t> next(columnCount);
+        vector<vector<int32_t>> columnTags(columnCount);
+        for (size_t state = 0; state < entries.size(); state++)
+        {
+            uint32_t generation = static_cast<uint32_t>(state) + 1;
+            std::fill(next.begin(), next.end(), -1);
+            bool final = false;
+            vector<int32_t> finalTags;
+            stack.emplace_back(entries[state], vector<int32_t>());
+            while (!stack.empty())
+            {
+                auto [vertex, path] = std::move(stack.back());
+                stack.pop_back();
+                if (marks[vertex] == generation)
+                {
+                    /* two paths reach the vertex */
+                    return false;
+                }
+                marks[vertex] = generation;
+                const CaptureVertex &v = vertices[vertex];
+                if (v.kind == CaptureVertexKind::Tag)
+                {
+                    path.push_back(v.tag);
+                    stack.emplace_back(v.next.front(), std::move(path));
+                }
+                else if (v.kind == CaptureVertexKind::Range)
+                {
+                    StateID target = v.next.front();
+                    if (stateOf[target] == -1)
+                    {
+                        stateOf[target] = static_cast<int32_t>(entries.size());
+                        entries.push_back(target);
+                    }
+                    for (int32_t column : vertexColumns[vertex])
+                    {
+                        if (next[column] != -1)
+                        {
+                            /* two ranges of the state share the column */
+                            return false;
+                        }
+                        next[column] = stateOf[target];
+                        columnTags[column] = path;
+                    }
+                }
+                else
+                {
+                    if (vertex == program.endVertex)
+                    {
+                        final = true;
+                        finalTags = path;
+                    }
+                    for (StateID successor : v.next)
+                    {
+                        stack.emplace_back(successor, path);
+                    }
+                }
+            }
+            for (size_t column = 0; column < columnCount; column++)
+            {
+                transitions.push_back(next[column]);
+                tagOffsets.push_back(static_cast<uint32_t>(tags.size()));
+                if (next[column] != -1)
+                {
+                    tags.insert(tags.end(), columnTags[column].begin(), columnTags[column].end());
+                }
+            }
+            accepting.push_back(final);
+            finalOffsets.push_back(static_cast<uint32_t>(endTags.size()));
+            endTags.insert(endTags.end(), finalTags.begin(), finalTags.end());
+        }
+        tagOffsets.push_back(static_cast<uint32_t>(tags.size()));
+        finalOffsets.push_back(static_cast<uint32_t>(endTags.size()));
+        stateCount = entries.size();
+        return true;
+    }
+
+    bool OnePassDFA::Match(const u32string &str, vector<Submatch> &groups) const
+    {
+        RunBuffers buffers;
+        return Run(str, 0, str.size(), groups, buffers) != -1;
+    }
+
+    bool OnePassDFA::FullMatch(const u32string &str, vector<Submatch> &groups) const
+    {
+        RunBuffers buffers;
+        if (Run(str, 0, str.size(), groups, buffers) == static_cast<int>(str.size()))
+        {
+            return true;
+        }
+        else
+        {
+            groups.assign(groupCount, Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    bool OnePassDFA::Search(const u32string &str, vector<Submatch> &groups) const
+    {
+        FindIter iter(matrix, str);
+        MatchSpan span;
+        if (iter.Next(span))
+        {
+            RunBuffers buffers;
+            return Run(str, span.begin, span.end, groups, buffers) != -1;
+        }
+        else
+        {
+            groups.assign(groupCount, Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    /**
+     * OnePassDFA::Run
+     *
+     * @param  {u32string} str             : the string to match
+     * @param  {size_t} start              : the offset the match is anchored at
+     * @param  {size_t} end                : the offset reading stops at
+     * @param  {vector<Submatch>} groups   : receives the groups of the longest match, or -1 spans
+     * @param  {RunBuffers} buffers        : the slots, sized here
+     * @return {int}                       : the end of the longest match, -1 if there is none
+     */
+    int OnePassDFA::Run(const u32string &str, size_t start, size_t end, vector<Submatch> &groups,
+                        RunBuffers &buffers) const
+    {
+        vector<int32_t> &slots = buffers.slots;
+        vector<int32_t> &snapshot = buffers.snapshot;
+        slots.assign(tagCount, -1);
+        snapshot.assign(tagCount, -1);
+        int matchEnd = -1;
+        int32_t state = 0;
+        for (size_t i = start;; i++)
+        {
+            if (accepting[state])
+            {
+                matchEnd = static_cast<int>(i);
+                snapshot = slots;
+                for (uint32_t j = finalOffsets[state]; j < finalOffsets[state + 1]; j++)
+                {
+                    snapshot[endTags[j]] = static_cast<int32_t>(i);
+                }
+            }
+            if (i == end)
+            {
+                break;
+            }
+            int32_t column = ColumnOf(str[i]);
+            if (column == -1)
+            {
+                break;
+            }
+            size_t transition = static_cast<size_t>(state) * columnCount + column;
+            if (transitions[transition] == -1)
+            {
+                break;
+            }
+            for (uint32_t j = tagOffsets[transition]; j < tagOffsets[transition + 1]; j++)
+            {
+                slots[tags[j]] = static_cast<int32_t>(i);
+            }
+            state = transitions[transition];
+        }
+        groups.assign(groupCount, Submatch{-1, -1});
+        if (matchEnd != -1)
+        {
+            groups[0] = Submatch{static_cast<int>(start), matchEnd};
+            for (size_t g = 1; g < groupCount; g++)
+            {
+                if (snapshot[2 * g - 2] != -1 && snapshot[2 * g - 1] != -1)
+                {
+                    groups[g] = Submatch{snapshot[2 * g - 2], snapshot[2 * g - 1]};
+                }
+            }
+        }
+        return matchEnd;
+    }
+
+    int32_t OnePassDFA::ColumnOf(char32_t c) const
+    {
+        return FindRangeColumn(classRanges.data(), classRanges.size(), c);
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "PatternCache.hpp"
+
+#include "NFA.hpp"
+
+namespace regex
+{
+    using std::make_shared;
+
+    PatternCache::PatternCache(size_t capacity) : capacity{capacity}, hits{0}, misses{0} {}
+
+    /**
+     * PatternCache::Compile
+     *
+     * Return the compiled matrix of a structurally equal expression with the same flags if there is
+     * one in the cache. Otherwise, compile the expression and remember the result as the most
+     * recently used entry.
+     *
+     * @param  {RegularExpression::Ptr} exp   : the expression to compile
+     * @param  {CompileFlags} flags           : the options of the compilation
+     * @return {shared_ptr<const DFAMatrix>}  : the compiled matrix
+     */
+    shared_ptr<const DFAMatrix> PatternCache::Compile(const RegularExpression::Ptr &exp, CompileFlags flags)
+    {
+        Key key{exp, flags};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = index.find(key);
+            if (found != index.end())
+            {
+                hits++;
+                entries.splice(entries.begin(), entries, found->second);
+                return found->second->second;
+            }
+            else
+            {
+                misses++;
+            }
+        }
+        /* compile outside of the lock, so that other patterns are not blocked */
+        auto matrix = make_shared<const DFAMatrix>(BuildDFAMatrix(exp, flags));
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = index.find(key);
+        if (found != index.end())
+        {
+            /* another thread has compiled the same pattern in the meantime */
+            entries.splice(entries.begin(), entries, found->second);
+            return found->second->second;
+        }
+        else if (capacity > 0)
+        {
+            entries.emplace_front(key, matrix);
+            index[key] = entries.begin();
+            Evict();
+        }
+        return matrix;
+    }
+
+    size_t PatternCache::Hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hits;
+    }
+
+    size_t PatternCache::Misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return misses;
+    }
+
+    size_t PatternCache::Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    size_t PatternCache::Capacity() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return capacity;
+    }
+
+    void PatternCache::SetCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->capacity = capacity;
+        Evict();
+    }
+
+    void PatternCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        index.clear();
+        hits = 0;
+        misses = 0;
+    }
+
+    PatternCache &PatternCache::Global()
+    {
+        static PatternCache cache;
+        return cache;
+    }
+
+    void PatternCache::Evict()
+    {
+        while (entries.size() > capacity)
+        {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,465 @@
+#include "RegexSet.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "Simplifier.hpp"
+
+namespace regex
+{
+    /**
+     * RegexSet::RegexSet
+     *
+     * @param  {vector<RegularExpression::Ptr>} exps : the expressions, whose IDs are their indices
+     */
+    RegexSet::RegexSet(const vector<RegularExpression::Ptr> &exps) : patternCount{exps.size()}
+    {
+        vector<RegularExpression::Ptr> simplified;
+        for (const auto &exp : exps)
+        {
+            simplified.push_back(Simplify(exp));
+        }
+        nfa = std::make_unique<NFA>(simplified);
+        classCount = nfa->patterns.Size() - 1;
+        for (const auto &[id, ranges] : nfa->patterns.IDToPatterns)
+        {
+            for (const auto &range : ranges)
+            {
+                if (id != NFA::EPSILON && range.rangeType == RangeType::CharacterRange)
+                {
+                    classRanges.push_back(DFAImageRange{range.lower, range.upper, id});
+                }
+            }
+        }
+        std::sort(classRanges.begin(), classRanges.end(),
+                  [](const DFAImageRange &x, const DFAImageRange &y) { return x.lower < y.lower; });
+
+        size_t vertexCount = nfa->G.NodeCount();
+        endPatterns.assign(vertexCount, SIZE_MAX);
+        for (size_t i = 0; i < patternCount; i++)
+        {
+            endPatterns.at(nfa->endVertices[i]) = i;
+        }
+        transitions.resize(vertexCount);
+        reverseTransitions.resize(vertexCount);
+        reverseEpsilons.resize(vertexCount);
+        for (StateID v = 0; v < vertexCount; v++)
+        {
+            for (const auto &edge : nfa->G.Adj(v))
+            {
+                if (edge.pattern.rangeType == RangeType::CharacterRange)
+                {
+                    transitions[v].emplace_back(&nfa->RangeClasses(edge.pattern), edge.to);
+                    reverseTransitions[edge.to].emplace_back(&nfa->RangeClasses(edge.pattern), v);
+                }
+                else if (edge.pattern.rangeType == RangeType::WordBoundary ||
+                         edge.pattern.rangeType == RangeType::NotWordBoundary)
+                {
+                    throw std::invalid_argument("the expressions of a regex set cannot use word boundaries");
+                }
+                else
+                {
+                    reverseEpsilons[edge.to].emplace_back(edge.pattern.rangeType, v);
+                }
+            }
+        }
+        marks.assign(vertexCount, 0);
+        inRestart.assign(vertexCount, false);
+        restart = Closure({static_cast<StateID>(nfa->startVertex)}, false, false, false);
+        for (StateID v : restart)
+        {
+            inRestart[v] = true;
+            if (endPatterns[v] != SIZE_MAX)
+            {
+                restartMatches.push_back(endPatterns[v]);
+            }
+        }
+        for (StateID v : Closure({static_cast<StateID>(nfa->startVertex)}, true, false, false))
+        {
+            if (!inRestart[v])
+            {
+                /* reached through "^" */
+                initial.push_back(v);
+            }
+        }
+        restartMoves.resize(classCount + 1);
+        hasRestartMove.assign(classCount + 1, false);
+    }
+
+    /**
+     * RegexSet::Matches
+     *
+     * @param  {u32string} str  : the target string
+     * @return {vector<size_t>} : the IDs of all the expressions matching a substring of str, in ascending order
+     */
+    vector<size_t> RegexSet::Matches(const u32string &str)
+    {
+        return Scan(str, false);
+    }
+
+    /**
+     * RegexSet::IsMatch
+     *
+     * @param  {u32string} str : the target string
+     * @return {bool}          : true if any of the expressions matches a substring of str
+     */
+    bool RegexSet::IsMatch(const u32string &str)
+    {
+        return !Scan(str, true).empty();
+    }
+
+    vector<size_t> RegexSet::Scan(const u32string &str, bool firstOnly)
+    {
+        vector<bool> found(patternCount, false);
+        vector<size_t> result;
+        auto report = [&found, &result](const vector<size_t> &ids) {
+            for (size_t id : ids)
+            {
+                if (!found[id])
+                {
+                    found[id] = true;
+                    result.push_back(id);
+                }
+            }
+        };
+        int state = AddState(initial, true);
+        for (size_t i = 0;; i++)
+        {
+            bool lineEnd = i == str.size() || str[i] == U'\n';
+            report(lineEnd ? LineEndMatches(state) : states[state].matches);
+            if (i == str.size() || result.size() == patternCount || (firstOnly && !result.empty()))
+            {
+                /* nothing more to learn from the rest of the string */
+                break;
+            }
+            state = Next(state, str[i]);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    /**
+     * RegexSet::ForEachMatch
+     *
+     * Scan the string once and report every (expression, end) pair of a match, in ascending order of
+     * the ends and then of the IDs.
+     *
+     * @param  {u32string} str           : the target string
+     * @param  {function} callback       : called with each match
+     * @param  {bool} recoverStarts      : if true, the leftmost start of each match is computed too
+     */
+    void RegexSet::ForEachMatch(const u32string &str, const std::function<void(const SetMatch &)> &callback,
+                                bool recoverStarts)
+    {
+        auto report = [&](const vector<size_t> &ids, size_t end) {
+            for (size_t id : ids)
+            {
+                callback(SetMatch{id, recoverStarts ? MatchStart(str, id, end) : SIZE_MAX, end});
+            }
+        };
+        int state = AddState(initial, true);
+        for (size_t i = 0;; i++)
+        {
+            bool lineEnd = i == str.size() || str[i] == U'\n';
+            report(lineEnd ? LineEndMatches(state) : states[state].matches, i);
+            if (i == str.size())
+            {
+                break;
+            }
+            state = Next(state, str[i]);
+        }
+    }
+
+    /**
+     * RegexSet::ClassOf
+     *
+     * @param  {char32_t} c : a character
+     * @return {int}        : the class of c, or classCount if no edge accepts c
+     */
+    int RegexSet::ClassOf(char32_t c) const
+    {
+        int32_t column = FindRangeColumn(classRanges.data(), classRanges.size(), c);
+        return column == -1 ? static_cast<int>(classCount) : column;
+    }
+
+    /**
+     * RegexSet::Closure
+     *
+     * @param  {vector<StateID>} vertices : the vertices to start from
+     * @param  {bool} atBegin             : if true, "^" edges are followed
+     * @param  {bool} atEnd               : if true, "$" edges are followed
+     * @param  {bool} live                : if true, the vertices of the start closure are left out
+     * @return {vector<StateID>}          : the sorted vertices reachable without consuming a character
+     */
+    vector<StateID> RegexSet::Closure(vector<StateID> vertices, bool atBegin, bool atEnd, bool live)
+    {
+        if (++generation == 0)
+        {
+            std::fill(marks.begin(), marks.end(), 0);
+            generation = 1;
+        }
+        vector<StateID> stack;
+        for (StateID v : vertices)
+        {
+            if (marks[v] != generation)
+            {
+                marks[v] = generation;
+                stack.push_back(v);
+            }
+        }
+        vertices.clear();
+        while (!stack.empty())
+        {
+            StateID v = stack.back();
+            stack.pop_back();
+            if (live && inRestart[v])
+            {
+                /* every state contains the start closure, and it is closed */
+                continue;
+            }
+            vertices.push_back(v);
+            for (const auto &edge : nfa->G.Adj(v))
+            {
+                RangeType type = edge.pattern.rangeType;
+                bool follow = edge.pattern.IsEpsilon() || (atBegin && type == RangeType::LineBegin) ||
+                              (atEnd && type == RangeType::LineEnd);
+                if (follow && marks[edge.to] != generation)
+                {
+                    marks[edge.to] = generation;
+                    stack.push_back(edge.to);
+                }
+            }
+        }
+        std::sort(vertices.begin(), vertices.end());
+        return vertices;
+    }
+
+    /**
+     * RegexSet::Move
+     *
+     * @param  {vector<StateID>} vertices : a set of vertices
+     * @param  {int} classID              : the class of a character
+     * @return {vector<StateID>}          : the vertices reached by the character, before the closure
+     */
+    vector<StateID> RegexSet::Move(const vector<StateID> &vertices, int classID) const
+    {
+        vector<StateID> result;
+        for (StateID v : vertices)
+        {
+            for (const auto &[classes, to] : transitions[v])
+            {
+                if (std::find(classes->begin(), classes->end(), classID) != classes->end())
+                {
+                    result.push_back(to);
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * RegexSet::AddState
+     *
+     * @param  {vector<StateID>} vertices : the sorted and closed live vertices of a state
+     * @param  {bool} afterLineBegin      : true if "^" holds at the position of the state
+     * @return {int}                      : the cached state of the set, created if needed
+     */
+    int RegexSet::AddState(vector<StateID> vertices, bool afterLineBegin)
+    {
+        auto it = stateIndices.find(std::make_pair(vertices, afterLineBegin));
+        if (it != stateIndices.end())
+        {
+            return it->second;
+        }
+        else
+        {
+            State state;
+            state.matches = restartMatches;
+            for (StateID v : vertices)
+            {
+                if (endPatterns[v] != SIZE_MAX)
+                {
+                    state.matches.push_back(endPatterns[v]);
+                }
+            }
+            std::sort(state.matches.begin(), state.matches.end());
+            state.next.assign(classCount + 2, UNKNOWN);
+            state.vertices = std::move(vertices);
+            state.afterLineBegin = afterLineBegin;
+            int index = static_cast<int>(states.size());
+            stateIndices.emplace(std::make_pair(state.vertices, afterLineBegin), index);
+            states.push_back(std::move(state));
+            return index;
+        }
+    }
+
+    /**
+     * RegexSet::Next
+     *
+     * A newline has a column of its own after the classes: "$" holds before it and "^" after it, so
+     * the vertices behind "$" edges move over it and the ones behind "^" edges are added after it.
+     *
+     * @param  {int} state  : the current state
+     * @param  {char32_t} c : the next character
+     * @return {int}        : the state after the character
+     */
+    int RegexSet::Next(int state, char32_t c)
+    {
+        bool newline = c == U'\n';
+        size_t column = newline ? classCount + 1 : static_cast<size_t>(ClassOf(c));
+        if (states[state].next[column] != UNKNOWN)
+        {
+            return states[state].next[column];
+        }
+        vector<StateID> merged;
+        if (newline)
+        {
+            vector<StateID> vertices = states[state].vertices;
+            vertices.insert(vertices.end(), restart.begin(), restart.end());
+            vertices = Closure(Move(Closure(vertices, states[state].afterLineBegin, true, false), ClassOf(c)), true,
+                               false, true);
+            std::set_union(vertices.begin(), vertices.end(), initial.begin(), initial.end(),
+                           std::back_inserter(merged));
+        }
+        else
+        {
+            int classID = static_cast<int>(column);
+            if (!hasRestartMove[classID])
+            {
+                restartMoves[classID] = Closure(Move(restart, classID), false, false, true);
+                hasRestartMove[classID] = true;
+            }
+            vector<StateID> vertices = Closure(Move(states[state].vertices, classID), false, false, true);
+            std::set_union(vertices.begin(), vertices.end(), restartMoves[classID].begin(),
+                           restartMoves[classID].end(), std::back_inserter(merged));
+        }
+        if (states.size() >= MAX_CACHED_STATES && stateIndices.count(std::make_pair(merged, newline)) == 0)
+        {
+            /* flush the cache, the current state is not kept */
+            states.clear();
+            stateIndices.clear();
+            return AddState(std::move(merged), newline);
+        }
+        else
+        {
+            int next = AddState(std::move(merged), newline);
+            states[state].next[column] = next;
+            return next;
+        }
+    }
+
+    /**
+     * RegexSet::LineEndMatches
+     *
+     * @param  {int} state      : the state at the end of the string or before a newline
+     * @return {vector<size_t>} : the IDs of the expressions accepted there, sorted
+     */
+    const vector<size_t> &RegexSet::LineEndMatches(int state)
+    {
+        if (!states[state].hasEndMatches)
+        {
+            vector<StateID> vertices = states[state].vertices;
+            vertices.insert(vertices.end(), restart.begin(), restart.end());
+            for (StateID v : Closure(vertices, states[state].afterLineBegin, true, false))
+            {
+                if (endPatterns[v] != SIZE_MAX)
+                {
+                    states[state].endMatches.push_back(endPatterns[v]);
+                }
+            }
+            std::sort(states[state].endMatches.begin(), states[state].endMatches.end());
+            states[state].hasEndMatches = true;
+        }
+        return states[state].endMatches;
+    }
+
+    /**
+     * RegexSet::ReverseClosure
+     *
+     * @param  {vector<StateID>} vertices : the vertices to start from
+     * @param  {bool} atBegin             : if true, "^" edges are followed
+     * @param  {bool} atEnd               : if true, "$" edges are followed
+     * @return {vector<StateID>}          : the vertices reaching them without consuming a character
+     */
+    vector<StateID> RegexSet::ReverseClosure(vector<StateID> vertices, bool atBegin, bool atEnd)
+    {
+        if (++generation == 0)
+        {
+            std::fill(marks.begin(), marks.end(), 0);
+            generation = 1;
+        }
+        vector<StateID> stack;
+        for (StateID v : vertices)
+        {
+            if (marks[v] != generation)
+            {
+                marks[v] = generation;
+                stack.push_back(v);
+            }
+        }
+        vertices.clear();
+        while (!stack.empty())
+        {
+            StateID v = stack.back();
+            stack.pop_back();
+            vertices.push_back(v);
+            for (const auto &[type, from] : reverseEpsilons[v])
+            {
+                bool follow = type == RangeType::Epsilon || (atBegin && type == RangeType::LineBegin) ||
+                              (atEnd && type == RangeType::LineEnd);
+                if (follow && marks[from] != generation)
+                {
+                    marks[from] = generation;
+                    stack.push_back(from);
+                }
+            }
+        }
+        return vertices;
+    }
+
+    /**
+     * RegexSet::MatchStart
+     *
+     * Simulate the NFA of one expression backwards from the end of a match, keeping the last position
+     * at which the start vertex is reached.
+     *
+     * @param  {u32string} str : the target string
+     * @param  {size_t} id     : the ID of the expression
+     * @param  {size_t} end    : the end of a match of the expression
+     * @return {size_t}        : the leftmost start of a match ending at "end"
+     */
+    size_t RegexSet::MatchStart(const u32string &str, size_t id, size_t end)
+    {
+        StateID start = nfa->startVertex;
+        auto lineBegin = [&str](size_t i) { return i == 0 || str[i - 1] == U'\n'; };
+        auto lineEnd = [&str](size_t i) { return i == str.size() || str[i] == U'\n'; };
+        vector<StateID> vertices = ReverseClosure({nfa->endVertices[id]}, lineBegin(end), lineEnd(end));
+        size_t matchStart = SIZE_MAX;
+        for (size_t i = end;; i--)
+        {
+            if (std::find(vertices.begin(), vertices.end(), start) != vertices.end())
+            {
+                matchStart = i;
+            }
+            if (i == 0 || vertices.empty())
+            {
+                break;
+            }
+            int classID = ClassOf(str[i - 1]);
+            vector<StateID> previous;
+            for (StateID v : vertices)
+            {
+                for (const auto &[classes, from] : reverseTransitions[v])
+                {
+                    if (std::find(classes->begin(), classes->end(), classID) != classes->end())
+                    {
+                        previous.push_back(from);
+                    }
+                }
+            }
+            vertices = ReverseClosure(std::move(previous), lineBegin(i - 1), lineEnd(i - 1));
+        }
+        return matchStart;
+    }
+} // namespace regex
\ No newline at end of file
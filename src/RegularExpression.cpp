@@ -1,18 +1,24 @@
 #include "RegularExpression.hpp"
 
 #include "NFA.hpp"
+#include "PatternCache.hpp"
 
 namespace regex
 {
     using std::make_shared;
 
-    DFAMatrix RegularExpression::Compile()
+    /**
+     * RegularExpression::Compile
+     *
+     * Compile the expression through the process-wide pattern cache, so that
+     * structurally equal trees are only turned into a DFA once.
+     *
+     * @param  {CompileFlags} flags : the options of the compilation
+     * @return {DFAMatrix}          : the compiled matrix
+     */
+    DFAMatrix RegularExpression::Compile(CompileFlags flags)
     {
-        RegularExpression::Ptr exp = shared_from_this();
-        NFA nfa{exp};
-        auto dfaTable = nfa.EpsilonClosure();
-        auto dfaGraph = DFATableRowsToDFAGraph(dfaTable, nfa.patterns, nfa.G, nfa.endVertex);
-        return DFAMatrix(dfaGraph);
+        return *PatternCache::Global().Compile(shared_from_this(), flags);
     }
 
     RegularExpression::Ptr RegularExpression::Many()
@@ -23,7 +29,9 @@ namespace regex
 
     AlternationExpression::AlternationExpression(
         const RegularExpression::Ptr &left, const RegularExpression::Ptr &right)
-        : left{left}, right{right} {}
+        : items{left, right} {}
+
+    AlternationExpression::AlternationExpression(vector<RegularExpression::Ptr> items) : items{std::move(items)} {}
 
     RegularExpressionKind AlternationExpression::Kind() const
     {
@@ -32,7 +40,9 @@ namespace regex
 
     ConcatenationExpression::ConcatenationExpression(
         const RegularExpression::Ptr &left, const RegularExpression::Ptr &right)
-        : left{left}, right{right} {}
+        : items{left, right} {}
+
+    ConcatenationExpression::ConcatenationExpression(vector<RegularExpression::Ptr> items) : items{std::move(items)} {}
 
     RegularExpressionKind ConcatenationExpression::Kind() const
     {
@@ -46,6 +56,20 @@ namespace regex
         return RegularExpressionKind::KleeneStar;
     }
 
+    RepeatExpression::RepeatExpression(const RegularExpression::Ptr &innerExp, int atLeast, int atMost)
+        : innerExp{innerExp}, atLeast{atLeast}, atMost{atMost}
+    {
+        if (atLeast < 0 || (atMost != UNBOUNDED && atMost < atLeast))
+        {
+            throw std::invalid_argument("invalid repetition bounds");
+        }
+    }
+
+    RegularExpressionKind RepeatExpression::Kind() const
+    {
+        return RegularExpressionKind::Repeat;
+    }
+
     SymbolExpression::SymbolExpression(UnicodeRange range) : range{range} {}
 
     RegularExpressionKind SymbolExpression::Kind() const
@@ -53,15 +77,240 @@ namespace regex
         return RegularExpressionKind::Symbol;
     }
 
+    CharClassExpression::CharClassExpression(CharClass charClass) : charClass{std::move(charClass)} {}
+
+    RegularExpressionKind CharClassExpression::Kind() const
+    {
+        return RegularExpressionKind::CharClass;
+    }
+
+    CaptureExpression::CaptureExpression(const RegularExpression::Ptr &innerExp, int group)
+        : innerExp{innerExp}, group{group}
+    {
+        if (group < 1)
+        {
+            throw std::invalid_argument("capture groups are numbered from 1");
+        }
+    }
+
+    RegularExpressionKind CaptureExpression::Kind() const
+    {
+        return RegularExpressionKind::Capture;
+    }
+
+    class StructuralHasher : public RegularExpressionFolder<size_t>
+    {
+    public:
+        size_t FoldAlternation(const AlternationExpression::Ptr &exp, vector<size_t> &items) override
+        {
+            return CombineAll(Seed(exp), items);
+        }
+        size_t FoldConcatenation(const ConcatenationExpression::Ptr &exp, vector<size_t> &items) override
+        {
+            return CombineAll(Seed(exp), items);
+        }
+        size_t FoldKleeneStar(const KleeneStarExpression::Ptr &exp, size_t &inner) override
+        {
+            return Combine(Seed(exp), inner);
+        }
+        size_t FoldRepeat(const RepeatExpression::Ptr &exp, size_t &inner) override
+        {
+            return Combine(Combine(Combine(Seed(exp), exp->atLeast), exp->atMost), inner);
+        }
+        size_t FoldSymbol(const SymbolExpression::Ptr &exp) override
+        {
+            return Combine(Seed(exp), UnicodeRangeHash()(exp->range));
+        }
+        size_t FoldCharClass(const CharClassExpression::Ptr &exp) override
+        {
+            return Combine(Seed(exp), CharClassHash()(exp->charClass));
+        }
+        size_t FoldCapture(const CaptureExpression::Ptr &exp, size_t &inner) override
+        {
+            return Combine(Combine(Seed(exp), exp->group), inner);
+        }
+
+    private:
+        static size_t Seed(const RegularExpression::Ptr &exp)
+        {
+            return static_cast<size_t>(exp->Kind()) + 1;
+        }
+        static size_t Combine(size_t seed, size_t value)
+        {
+            return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+        }
+        static size_t CombineAll(size_t seed, const vector<size_t> &values)
+        {
+            for (size_t value : values)
+            {
+                seed = Combine(seed, value);
+            }
+            return seed;
+        }
+    };
+
+    size_t RegularExpressionHash::operator()(const RegularExpression::Ptr &exp) const
+    {
+        StructuralHasher hasher;
+        return hasher.Fold(exp);
+    }
+
+    bool RegularExpressionEqual::operator()(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y) const
+    {
+        vector<std::pair<const RegularExpression *, const RegularExpression *>> stack = {{x.get(), y.get()}};
+        while (!stack.empty())
+        {
+            auto [left, right] = stack.back();
+            stack.pop_back();
+            if (left == right)
+            {
+                continue;
+            }
+            else if (left->Kind() != right->Kind())
+            {
+                return false;
+            }
+            switch (left->Kind())
+            {
+            case RegularExpressionKind::Alternation:
+            case RegularExpressionKind::Concatenation:
+            {
+                const auto &items1 = left->Kind() == RegularExpressionKind::Alternation
+                                         ? static_cast<const AlternationExpression *>(left)->items
+                                         : static_cast<const ConcatenationExpression *>(left)->items;
+                const auto &items2 = right->Kind() == RegularExpressionKind::Alternation
+                                         ? static_cast<const AlternationExpression *>(right)->items
+                                         : static_cast<const ConcatenationExpression *>(right)->items;
+                if (items1.size() != items2.size())
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < items1.size(); i++)
+                {
+                    stack.emplace_back(items1[i].get(), items2[i].get());
+                }
+                break;
+            }
+            case RegularExpressionKind::KleeneStar:
+            {
+                stack.emplace_back(static_cast<const KleeneStarExpression *>(left)->innerExp.get(),
+                                   static_cast<const KleeneStarExpression *>(right)->innerExp.get());
+                break;
+            }
+            case RegularExpressionKind::Repeat:
+            {
+                auto x1 = static_cast<const RepeatExpression *>(left);
+                auto x2 = static_cast<const RepeatExpression *>(right);
+                if (x1->atLeast != x2->atLeast || x1->atMost != x2->atMost)
+                {
+                    return false;
+                }
+                stack.emplace_back(x1->innerExp.get(), x2->innerExp.get());
+                break;
+            }
+            case RegularExpressionKind::Symbol:
+            {
+                if (!(static_cast<const SymbolExpression *>(left)->range ==
+                      static_cast<const SymbolExpression *>(right)->range))
+                {
+                    return false;
+                }
+                break;
+            }
+            case RegularExpressionKind::CharClass:
+            {
+                if (static_cast<const CharClassExpression *>(left)->charClass !=
+                    static_cast<const CharClassExpression *>(right)->charClass)
+                {
+                    return false;
+                }
+                break;
+            }
+            case RegularExpressionKind::Capture:
+            {
+                auto x1 = static_cast<const CaptureExpression *>(left);
+                auto x2 = static_cast<const CaptureExpression *>(right);
+                if (x1->group != x2->group)
+                {
+                    return false;
+                }
+                stack.emplace_back(x1->innerExp.get(), x2->innerExp.get());
+                break;
+            }
+            default:
+            {
+                throw std::runtime_error("unreachable case branch");
+            }
+            }
+        }
+        return true;
+    }
+
+    template <typename NaryExpression>
+    static void AppendFlattened(vector<RegularExpression::Ptr> &items, const RegularExpression::Ptr &exp,
+                                RegularExpressionKind kind)
+    {
+        if (exp->Kind() == kind)
+        {
+            const auto &nested = static_cast<const NaryExpression &>(*exp).items;
+            items.insert(items.end(), nested.begin(), nested.end());
+        }
+        else
+        {
+            items.push_back(exp);
+        }
+    }
+
+    /**
+     * MakeNary
+     *
+     * Build an n-ary node of the given type from two operands. Operands of the same
+     * type are flattened into the new node, so that chains of operators stay shallow.
+     */
+    template <typename NaryExpression>
+    static RegularExpression::Ptr MakeNary(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y,
+                                           RegularExpressionKind kind)
+    {
+        vector<RegularExpression::Ptr> items;
+        AppendFlattened<NaryExpression>(items, x, kind);
+        AppendFlattened<NaryExpression>(items, y, kind);
+        return make_shared<NaryExpression>(std::move(items));
+    }
+
+    template <typename NaryExpression>
+    static RegularExpression::Ptr MakeNary(RegularExpression::Ptr &&x, const RegularExpression::Ptr &y,
+                                           RegularExpressionKind kind)
+    {
+        if (x->Kind() == kind && x.use_count() == 1 && x != y)
+        {
+            /* nobody else can observe the temporary node, so extend it in place */
+            auto &items = static_cast<NaryExpression &>(*x).items;
+            AppendFlattened<NaryExpression>(items, y, kind);
+            return std::move(x);
+        }
+        else
+        {
+            return MakeNary<NaryExpression>(static_cast<const RegularExpression::Ptr &>(x), y, kind);
+        }
+    }
+
     namespace notations
     {
         RegularExpression::Ptr operator|(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y)
         {
-            return make_shared<AlternationExpression>(x, y);
+            return MakeNary<AlternationExpression>(x, y, RegularExpressionKind::Alternation);
+        }
+        RegularExpression::Ptr operator|(RegularExpression::Ptr &&x, const RegularExpression::Ptr &y)
+        {
+            return MakeNary<AlternationExpression>(std::move(x), y, RegularExpressionKind::Alternation);
         }
         RegularExpression::Ptr operator+(const RegularExpression::Ptr &x, const RegularExpression::Ptr &y)
         {
-            return make_shared<ConcatenationExpression>(x, y);
+            return MakeNary<ConcatenationExpression>(x, y, RegularExpressionKind::Concatenation);
+        }
+        RegularExpression::Ptr operator+(RegularExpression::Ptr &&x, const RegularExpression::Ptr &y)
+        {
+            return MakeNary<ConcatenationExpression>(std::move(x), y, RegularExpressionKind::Concatenation);
         }
         RegularExpression::Ptr Symbol(char32_t c)
         {
@@ -69,26 +318,29 @@ namespace regex
         }
         RegularExpression::Ptr Literal(const u32string &text)
         {
-            RegularExpression::Ptr res;
-            int N = text.size();
-            for (int i = N - 1; i >= 0; i--)
+            if (text.size() <= 1)
             {
-                char32_t c = text[i];
-                if (res)
-                {
-                    res = Symbol(c) + res;
-                }
-                else
+                return text.empty() ? RegularExpression::Ptr() : Symbol(text[0]);
+            }
+            else
+            {
+                vector<RegularExpression::Ptr> items;
+                items.reserve(text.size());
+                for (char32_t c : text)
                 {
-                    res = Symbol(c);
+                    items.push_back(Symbol(c));
                 }
+                return make_shared<ConcatenationExpression>(std::move(items));
             }
-            return res;
         }
         RegularExpression::Ptr Range(char32_t lower, char32_t upper)
         {
             return make_shared<SymbolExpression>(UnicodeRange(RangeType::CharacterRange, lower, upper));
         }
+        RegularExpression::Ptr Class(const CharClass &charClass)
+        {
+            return make_shared<CharClassExpression>(charClass);
+        }
         RegularExpression::Ptr LineBegin()
         {
             return make_shared<SymbolExpression>(UnicodeRange(RangeType::LineBegin, char32_t{0}, char32_t{0}));
@@ -97,27 +349,44 @@ namespace regex
         {
             return make_shared<SymbolExpression>(UnicodeRange(RangeType::LineEnd, char32_t{0}, char32_t{0}));
         }
+        RegularExpression::Ptr WordBoundary()
+        {
+            return make_shared<SymbolExpression>(UnicodeRange(RangeType::WordBoundary, char32_t{0}, char32_t{0}));
+        }
+        RegularExpression::Ptr NotWordBoundary()
+        {
+            return make_shared<SymbolExpression>(UnicodeRange(RangeType::NotWordBoundary, char32_t{0}, char32_t{0}));
+        }
         RegularExpression::Ptr RepeatExactly(const RegularExpression::Ptr &x, int times)
         {
-            auto result = x;
-            for (int i = 0; i < times - 1; i++)
-            {
-                result = result + x;
-            }
-            return result;
+            return Repeat(x, times, times);
         }
         RegularExpression::Ptr RepeatAtLeast(const RegularExpression::Ptr &x, int times)
         {
-            return RepeatExactly(x, times) + x->Many();
+            return Repeat(x, times, RepeatExpression::UNBOUNDED);
         }
         RegularExpression::Ptr Repeat(const RegularExpression::Ptr &x, int atLeast, int atMost)
         {
-            auto result = RepeatExactly(x, atLeast);
-            for (int i = atLeast + 1; i <= atMost; i++)
+            if (atLeast == 1 && atMost == 1)
             {
-                result = result | RepeatExactly(x, i);
+                return x;
             }
-            return result;
+            else
+            {
+                return make_shared<RepeatExpression>(x, atLeast, atMost);
+            }
+        }
+        RegularExpression::Ptr Optional(const RegularExpression::Ptr &x)
+        {
+            return Repeat(x, 0, 1);
+        }
+        RegularExpression::Ptr OneOrMore(const RegularExpression::Ptr &x)
+        {
+            return Repeat(x, 1, RepeatExpression::UNBOUNDED);
+        }
+        RegularExpression::Ptr Capture(const RegularExpression::Ptr &x, int group)
+        {
+            return make_shared<CaptureExpression>(x, group);
         }
     } // namespace notations
 } // namespace regex
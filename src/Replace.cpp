@@ -0,0 +1,243 @@
+#include "Replace.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace regex
+{
+    namespace
+    {
+        /* copy the string to "out" with at most "limit" matches replaced by what "expand" appends */
+        template <typename Expand>
+        size_t ReplaceMatches(const DFAMatrix &matrix, const u32string &str, size_t limit, u32string &out,
+                              const Expand &expand)
+        {
+            FindIter iter(matrix, str);
+            MatchSpan span;
+            size_t copied = 0;
+            size_t count = 0;
+            while (count < limit && iter.Next(span))
+            {
+                out.append(str, copied, span.begin - copied);
+                expand(span);
+                copied = span.end;
+                count++;
+            }
+            out.append(str, copied, u32string::npos);
+            return count;
+        }
+
+        void CheckWholeMatch(const ReplaceTemplate &replacement)
+        {
+            if (replacement.MaxGroup() > 0)
+            {
+                throw std::invalid_argument("a DFA matrix only reports the whole match, group 0");
+            }
+        }
+
+        void CheckGroups(const CaptureMatcher &matcher, const ReplaceTemplate &replacement)
+        {
+            if (replacement.MaxGroup() >= matcher.GroupCount())
+            {
+                throw std::invalid_argument("the replacement references a group the expression does not have");
+            }
+        }
+
+        size_t ReplaceGroups(const CaptureMatcher &matcher, const u32string &str, const ReplaceTemplate &replacement,
+                             size_t limit, u32string &out)
+        {
+            CheckGroups(matcher, replacement);
+            /* reused by every match */
+            vector<Submatch> groups;
+            CaptureMatcher::FillBuffers buffers;
+            return ReplaceMatches(matcher.Matrix(), str, limit, out, [&](const MatchSpan &span) {
+                matcher.Fill(str, span.begin, span.end, groups, buffers);
+                replacement.Expand(str, groups, out);
+            });
+        }
+    } // namespace
+
+    /**
+     * ReplaceTemplate::ReplaceTemplate
+     *
+     * @param  {u32string} text : the replacement, with "$n", "${n}" and "$$"
+     */
+    ReplaceTemplate::ReplaceTemplate(const u32string &text) : text{text}
+    {
+        size_t literalBegin = 0;
+        size_t i = 0;
+        auto flush = [&](size_t end) {
+            if (end > literalBegin)
+            {
+                pieces.push_back(Piece{LITERAL, literalBegin, end});
+            }
+        };
+        while (i < text.size())
+        {
+            if (text[i] != U'$')
+            {
+                i++;
+                continue;
+            }
+            flush(i);
+            size_t j = i + 1;
+            bool braced = j < text.size() && text[j] == U'{';
+            if (j < text.size() && text[j] == U'$')
+            {
+                /* the second "$" starts the next literal piece */
+                literalBegin = j;
+                i = j + 1;
+                continue;
+            }
+            else if (braced)
+            {
+                j++;
+            }
+            else
+            {
+                // a bare group number
+            }
+            size_t group = 0;
+            size_t digitBegin = j;
+            while (j < text.size() && text[j] >= U'0' && text[j] <= U'9')
+            {
+                group = group * 10 + (text[j] - U'0');
+                if (group > UINT16_MAX)
+                {
+                    throw std::invalid_argument("the group number of the replacement is too large");
+                }
+                j++;
+            }
+            if (j == digitBegin || (braced && (j == text.size() || text[j] != U'}')))
+            {
+                throw std::invalid_argument("\"$\" in a replacement must be followed by a group number or \"$\"");
+            }
+            else if (braced)
+            {
+                j++;
+            }
+            else
+            {
+                // the number ends at the first other character
+            }
+            pieces.push_back(Piece{group, 0, 0});
+            maxGroup = std::max(maxGroup, group);
+            literalBegin = j;
+            i = j;
+        }
+        flush(text.size());
+    }
+
+    /**
+     * ReplaceTemplate::Expand
+     *
+     * @param  {u32string} str             : the matched string
+     * @param  {vector<Submatch>} groups   : the groups of the match, at least MaxGroup() + 1 of them
+     * @param  {u32string} out             : receives the replacement, appended
+     */
+    void ReplaceTemplate::Expand(const u32string &str, const vector<Submatch> &groups, u32string &out) const
+    {
+        for (const Piece &piece : pieces)
+        {
+            if (piece.group == LITERAL)
+            {
+                out.append(text, piece.begin, piece.end - piece.begin);
+            }
+            else if (groups[piece.group].begin != -1)
+            {
+                const Submatch &group = groups[piece.group];
+                out.append(str, group.begin, group.end - group.begin);
+            }
+            else
+            {
+                // an unmatched group inserts nothing
+            }
+        }
+    }
+
+    void ReplaceTemplate::Expand(const u32string &str, const MatchSpan &span, u32string &out) const
+    {
+        for (const Piece &piece : pieces)
+        {
+            if (piece.group == LITERAL)
+            {
+                out.append(text, piece.begin, piece.end - piece.begin);
+            }
+            else
+            {
+                out.append(str, span.begin, span.end - span.begin);
+            }
+        }
+    }
+
+    bool Replace(const DFAMatrix &matrix, const u32string &str, const ReplaceTemplate &replacement, u32string &out)
+    {
+        CheckWholeMatch(replacement);
+        return ReplaceMatches(matrix, str, 1, out,
+                              [&](const MatchSpan &span) { replacement.Expand(str, span, out); }) == 1;
+    }
+
+    /**
+     * ReplaceAll
+     *
+     * @param  {DFAMatrix} matrix              : the compiled expression
+     * @param  {u32string} str                 : the string to replace the matches in
+     * @param  {ReplaceTemplate} replacement   : the replacement of every match
+     * @param  {u32string} out                 : receives the result, appended
+     * @return {size_t}                        : the number of matches replaced
+     */
+    size_t ReplaceAll(const DFAMatrix &matrix, const u32string &str, const ReplaceTemplate &replacement,
+                      u32string &out)
+    {
+        CheckWholeMatch(replacement);
+        return ReplaceMatches(matrix, str, SIZE_MAX, out,
+                              [&](const MatchSpan &span) { replacement.Expand(str, span, out); });
+    }
+
+    bool Replace(const CaptureMatcher &matcher, const u32string &str, const ReplaceTemplate &replacement,
+                 u32string &out)
+    {
+        return ReplaceGroups(matcher, str, replacement, 1, out) == 1;
+    }
+
+    /**
+     * ReplaceAll
+     *
+     * The DFA of the matcher finds the matches, and the groups are only extracted from their spans.
+     *
+     * @param  {CaptureMatcher} matcher        : the expression with its groups
+     * @param  {u32string} str                 : the string to replace the matches in
+     * @param  {ReplaceTemplate} replacement   : the replacement of every match, with group references
+     * @param  {u32string} out                 : receives the result, appended
+     * @return {size_t}                        : the number of matches replaced
+     */
+    size_t ReplaceAll(const CaptureMatcher &matcher, const u32string &str, const ReplaceTemplate &replacement,
+                      u32string &out)
+    {
+        return ReplaceGroups(matcher, str, replacement, SIZE_MAX, out);
+    }
+
+    /**
+     * Split
+     *
+     * @param  {DFAMatrix} matrix                  : the compiled separator
+     * @param  {u32string} str                     : the string to split
+     * @param  {vector<u32string_view>} pieces     : receives the views between the matches, one more than them
+     * @return {size_t}                            : the number of pieces
+     */
+    size_t Split(const DFAMatrix &matrix, const u32string &str, vector<u32string_view> &pieces)
+    {
+        pieces.clear();
+        u32string_view view(str);
+        FindIter iter(matrix, str);
+        MatchSpan span;
+        size_t pieceBegin = 0;
+        while (iter.Next(span))
+        {
+            pieces.push_back(view.substr(pieceBegin, span.begin - pieceBegin));
+            pieceBegin = span.end;
+        }
+        pieces.push_back(view.substr(pieceBegin));
+        return pieces.size();
+    }
+} // namespace regex
\ No newline at end of file
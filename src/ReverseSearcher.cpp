@@ -0,0 +1,222 @@
+#include "ReverseSearcher.hpp"
+
+#include <algorithm>
+
+#include "NFA.hpp"
+
+namespace regex
+{
+    using std::make_shared;
+
+    namespace
+    {
+        /* true if every path of the expression ends with "$" */
+        bool EndsWithLineEnd(const RegularExpression::Ptr &exp)
+        {
+            switch (exp->Kind())
+            {
+            case RegularExpressionKind::Symbol:
+            {
+                return static_cast<const SymbolExpression &>(*exp).range.rangeType == RangeType::LineEnd;
+            }
+            case RegularExpressionKind::Concatenation:
+            {
+                const auto &items = static_cast<const ConcatenationExpression &>(*exp).items;
+                return !items.empty() && EndsWithLineEnd(items.back());
+            }
+            case RegularExpressionKind::Alternation:
+            {
+                const auto &items = static_cast<const AlternationExpression &>(*exp).items;
+                return std::all_of(items.begin(), items.end(), EndsWithLineEnd);
+            }
+            case RegularExpressionKind::Capture:
+            {
+                return EndsWithLineEnd(static_cast<const CaptureExpression &>(*exp).innerExp);
+            }
+            default:
+            {
+                return false;
+            }
+            }
+        }
+
+        /* append the literal every match ends with to "reversedSuffix", last character first; true if the
+           expression is nothing but that literal */
+        bool TrailingLiteral(const RegularExpression::Ptr &exp, u32string &reversedSuffix)
+        {
+            switch (exp->Kind())
+            {
+            case RegularExpressionKind::Symbol:
+            {
+                const UnicodeRange &range = static_cast<const SymbolExpression &>(*exp).range;
+                if (range.rangeType == RangeType::CharacterRange && range.lower == range.upper)
+                {
+                    reversedSuffix.push_back(range.lower);
+                    return true;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            case RegularExpressionKind::Concatenation:
+            {
+                const auto &items = static_cast<const ConcatenationExpression &>(*exp).items;
+                for (auto it = items.rbegin(); it != items.rend(); ++it)
+                {
+                    if (!TrailingLiteral(*it, reversedSuffix))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case RegularExpressionKind::Capture:
+            {
+                return TrailingLiteral(static_cast<const CaptureExpression &>(*exp).innerExp, reversedSuffix);
+            }
+            default:
+            {
+                return false;
+            }
+            }
+        }
+    } // namespace
+
+    RegularExpression::Ptr Reverser::FoldAlternation(const AlternationExpression::Ptr &,
+                                                     vector<RegularExpression::Ptr> &items)
+    {
+        return make_shared<AlternationExpression>(items);
+    }
+
+    RegularExpression::Ptr Reverser::FoldConcatenation(const ConcatenationExpression::Ptr &,
+                                                       vector<RegularExpression::Ptr> &items)
+    {
+        return make_shared<ConcatenationExpression>(vector<RegularExpression::Ptr>(items.rbegin(), items.rend()));
+    }
+
+    RegularExpression::Ptr Reverser::FoldKleeneStar(const KleeneStarExpression::Ptr &,
+                                                    RegularExpression::Ptr &inner)
+    {
+        return make_shared<KleeneStarExpression>(inner);
+    }
+
+    RegularExpression::Ptr Reverser::FoldRepeat(const RepeatExpression::Ptr &exp, RegularExpression::Ptr &inner)
+    {
+        return make_shared<RepeatExpression>(inner, exp->atLeast, exp->atMost);
+    }
+
+    RegularExpression::Ptr Reverser::FoldSymbol(const SymbolExpression::Ptr &exp)
+    {
+        if (exp->range.rangeType == RangeType::LineBegin)
+        {
+            return notations::LineEnd();
+        }
+        else if (exp->range.rangeType == RangeType::LineEnd)
+        {
+            return notations::LineBegin();
+        }
+        else
+        {
+            return exp;
+        }
+    }
+
+    RegularExpression::Ptr Reverser::FoldCharClass(const CharClassExpression::Ptr &exp)
+    {
+        return exp;
+    }
+
+    RegularExpression::Ptr Reverser::FoldCapture(const CaptureExpression::Ptr &, RegularExpression::Ptr &inner)
+    {
+        return inner;
+    }
+
+    /**
+     * Reverse
+     *
+     * @param  {RegularExpression::Ptr} exp : an expression
+     * @return {RegularExpression::Ptr}     : an expression matching the reversed strings of exp
+     */
+    RegularExpression::Ptr Reverse(const RegularExpression::Ptr &exp)
+    {
+        Reverser reverser;
+        return reverser.Fold(exp);
+    }
+
+    ReverseSearcher::ReverseSearcher(const RegularExpression::Ptr &exp)
+        : forward{exp->Compile()},
+          backward{BuildAnchoredDFAMatrix(make_shared<ConcatenationExpression>(vector<RegularExpression::Ptr>{
+              notations::Class(CharClass::Any())->Many(), Reverse(exp)}))},
+          endAnchored{EndsWithLineEnd(exp)}
+    {
+        TrailingLiteral(exp, suffix);
+        std::reverse(suffix.begin(), suffix.end());
+    }
+
+    /**
+     * ReverseSearcher::Search
+     *
+     * Every match ends where "$" holds, or after an occurrence of the suffix, so no match ends past the
+     * last of them. The string is read backwards once from there: the reversed expression after ".*"
+     * accepts at the start of every match, and the last position it accepts at is the leftmost start.
+     * The longest match from there ends at one of the ends tried.
+     *
+     * @param  {u32string} str     : the string to search
+     * @param  {MatchSpan} span    : receives the leftmost match, and the longest one from there
+     * @return {bool}              : whether the expression matches anywhere in the string
+     */
+    bool ReverseSearcher::Search(const u32string &str, MatchSpan &span) const
+    {
+        size_t last;
+        if (endAnchored)
+        {
+            /* "$" holds at the end of the string */
+            last = str.size();
+        }
+        else if (!suffix.empty())
+        {
+            last = str.rfind(suffix);
+            if (last == u32string::npos)
+            {
+                return false;
+            }
+            last += suffix.size();
+        }
+        else
+        {
+            FindIter iter(forward, str);
+            return iter.Next(span);
+        }
+        int length = backward.MatchBackward(str.begin(), str.begin(), str.begin() + last, str.end());
+        if (length == -1)
+        {
+            return false;
+        }
+        auto start = str.begin() + last - length;
+        span.begin = last - length;
+        span.end = span.begin + forward.MatchFrom(forward.StartState(str.begin(), start), start, str.end(), true);
+        return true;
+    }
+
+    /**
+     * ReverseSearcher::MatchStart
+     *
+     * Run the reversed DFA backward from "end" for as long as it lives, and keep the last position where
+     * it accepts.
+     *
+     * @param  {u32string} str     : the searched string
+     * @param  {size_t} end        : the end of a match
+     * @return {size_t}            : the leftmost start of a match ending at "end", or SIZE_MAX if none does
+     */
+    size_t ReverseSearcher::MatchStart(const u32string &str, size_t end) const
+    {
+        const DFAMatrix *reverse = forward.Reversed();
+        if (reverse == nullptr)
+        {
+            return SIZE_MAX;
+        }
+        int length = reverse->MatchBackward(str.begin(), str.begin(), str.begin() + end, str.end());
+        return length == -1 ? SIZE_MAX : end - length;
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,480 @@
+#include "Simplifier.hpp"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace regex
+{
+    using std::make_shared;
+    using std::unordered_map;
+    using std::unordered_set;
+
+    static bool IsCharacter(const RegularExpression::Ptr &exp)
+    {
+        return exp->Kind() == RegularExpressionKind::CharClass ||
+               (exp->Kind() == RegularExpressionKind::Symbol &&
+                static_cast<const SymbolExpression &>(*exp).range.rangeType == RangeType::CharacterRange);
+    }
+
+    static CharClass CharacterSet(const RegularExpression::Ptr &exp)
+    {
+        if (exp->Kind() == RegularExpressionKind::CharClass)
+        {
+            return static_cast<const CharClassExpression &>(*exp).charClass;
+        }
+        else
+        {
+            const UnicodeRange &range = static_cast<const SymbolExpression &>(*exp).range;
+            return CharClass(range.lower, range.upper);
+        }
+    }
+
+    /* the items of a concatenation, or the expression itself */
+    static vector<RegularExpression::Ptr> Sequence(const RegularExpression::Ptr &exp)
+    {
+        if (exp->Kind() == RegularExpressionKind::Concatenation)
+        {
+            return static_cast<const ConcatenationExpression &>(*exp).items;
+        }
+        else
+        {
+            return {exp};
+        }
+    }
+
+    RegularExpression::Ptr Simplifier::FoldAlternation(const AlternationExpression::Ptr &exp,
+                                                       vector<RegularExpression::Ptr> &items)
+    {
+        auto result = SimplifyAlternation(items);
+        if (result->Kind() == RegularExpressionKind::Alternation &&
+            static_cast<const AlternationExpression &>(*result).items == exp->items)
+        {
+            return exp;
+        }
+        else
+        {
+            return result;
+        }
+    }
+
+    RegularExpression::Ptr Simplifier::FoldConcatenation(const ConcatenationExpression::Ptr &exp,
+                                                         vector<RegularExpression::Ptr> &items)
+    {
+        auto result = SimplifyConcatenation(items);
+        if (result->Kind() == RegularExpressionKind::Concatenation &&
+            static_cast<const ConcatenationExpression &>(*result).items == exp->items)
+        {
+            return exp;
+        }
+        else
+        {
+            return result;
+        }
+    }
+
+    RegularExpression::Ptr Simplifier::FoldKleeneStar(const KleeneStarExpression::Ptr &exp,
+                                                      RegularExpression::Ptr &inner)
+    {
+        if (inner->Kind() == RegularExpressionKind::KleeneStar)
+        {
+            /* (x*)* = x* */
+            return inner;
+        }
+        else if (inner->Kind() == RegularExpressionKind::Repeat)
+        {
+            const auto &repeat = static_cast<const RepeatExpression &>(*inner);
+            if (repeat.atLeast <= 1 && (repeat.atMost == RepeatExpression::UNBOUNDED || repeat.atMost == 1))
+            {
+                /* (x?)* = (x+)* = x* */
+                return make_shared<KleeneStarExpression>(repeat.innerExp);
+            }
+        }
+        if (inner == exp->innerExp)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<KleeneStarExpression>(inner);
+        }
+    }
+
+    RegularExpression::Ptr Simplifier::FoldRepeat(const RepeatExpression::Ptr &exp, RegularExpression::Ptr &inner)
+    {
+        if (inner->Kind() == RegularExpressionKind::KleeneStar && exp->atMost != 0)
+        {
+            /* (x*){m,n} = x* unless n is 0 */
+            return inner;
+        }
+        else if (exp->atLeast == 1 && exp->atMost == 1)
+        {
+            return inner;
+        }
+        else if (inner == exp->innerExp)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<RepeatExpression>(inner, exp->atLeast, exp->atMost);
+        }
+    }
+
+    RegularExpression::Ptr Simplifier::FoldSymbol(const SymbolExpression::Ptr &exp)
+    {
+        return exp;
+    }
+
+    RegularExpression::Ptr Simplifier::FoldCharClass(const CharClassExpression::Ptr &exp)
+    {
+        return exp;
+    }
+
+    RegularExpression::Ptr Simplifier::FoldCapture(const CaptureExpression::Ptr &exp, RegularExpression::Ptr &inner)
+    {
+        if (inner == exp->innerExp)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<CaptureExpression>(inner, exp->group);
+        }
+    }
+
+    /**
+     * Simplifier::SimplifyAlternation
+     *
+     * @param  {vector<RegularExpression::Ptr>} items : simplified alternatives
+     * @return {RegularExpression::Ptr}               : the simplified alternation of the items
+     */
+    RegularExpression::Ptr Simplifier::SimplifyAlternation(vector<RegularExpression::Ptr> items)
+    {
+        vector<RegularExpression::Ptr> unique;
+        unordered_set<RegularExpression::Ptr, RegularExpressionHash, RegularExpressionEqual> seen;
+        for (const auto &item : items)
+        {
+            if (item->Kind() == RegularExpressionKind::Alternation)
+            {
+                for (const auto &nested : static_cast<const AlternationExpression &>(*item).items)
+                {
+                    if (seen.insert(nested).second)
+                    {
+                        unique.push_back(nested);
+                    }
+                }
+            }
+            else if (seen.insert(item).second)
+            {
+                unique.push_back(item);
+            }
+            else
+            {
+                // drop the duplicate alternative
+            }
+        }
+        auto merged = MergeCharacters(FactorPrefixes(unique));
+        if (merged.size() == 1)
+        {
+            return merged.front();
+        }
+        else
+        {
+            return make_shared<AlternationExpression>(std::move(merged));
+        }
+    }
+
+    /**
+     * Simplifier::SimplifyConcatenation
+     *
+     * @param  {vector<RegularExpression::Ptr>} items : simplified items
+     * @return {RegularExpression::Ptr}               : the simplified concatenation of the items
+     */
+    RegularExpression::Ptr Simplifier::SimplifyConcatenation(vector<RegularExpression::Ptr> items)
+    {
+        vector<RegularExpression::Ptr> flat;
+        RegularExpressionEqual equal;
+        auto append = [&flat, &equal](const RegularExpression::Ptr &item) {
+            if (item->Kind() == RegularExpressionKind::KleeneStar && !flat.empty() && equal(flat.back(), item))
+            {
+                /* x*x* = x* */
+                return;
+            }
+            flat.push_back(item);
+        };
+        for (const auto &item : items)
+        {
+            if (item->Kind() == RegularExpressionKind::Concatenation)
+            {
+                for (const auto &nested : static_cast<const ConcatenationExpression &>(*item).items)
+                {
+                    append(nested);
+                }
+            }
+            else
+            {
+                append(item);
+            }
+        }
+        if (flat.size() == 1)
+        {
+            return flat.front();
+        }
+        else
+        {
+            return make_shared<ConcatenationExpression>(std::move(flat));
+        }
+    }
+
+    /**
+     * Simplifier::FactorPrefixes
+     *
+     * Alternatives starting with the same item are replaced by their longest common prefix followed
+     * by the alternation of their remainders, recursively, which turns alternated literals into a trie:
+     * abc|abd|ab|x becomes ab(c|d)?|x.
+     *
+     * @param  {vector<RegularExpression::Ptr>} items : distinct alternatives
+     * @return {vector<RegularExpression::Ptr>}       : the alternatives after factoring
+     */
+    vector<RegularExpression::Ptr> Simplifier::FactorPrefixes(const vector<RegularExpression::Ptr> &items)
+    {
+        unordered_map<RegularExpression::Ptr, size_t, RegularExpressionHash, RegularExpressionEqual> groupIndices;
+        vector<vector<size_t>> groups;
+        vector<vector<RegularExpression::Ptr>> sequences;
+        for (size_t i = 0; i < items.size(); i++)
+        {
+            sequences.push_back(Sequence(items[i]));
+            auto [it, inserted] = groupIndices.emplace(sequences.back().front(), groups.size());
+            if (inserted)
+            {
+                groups.emplace_back();
+            }
+            groups[it->second].push_back(i);
+        }
+        if (groups.size() == items.size())
+        {
+            /* no two alternatives start with the same item */
+            return items;
+        }
+        RegularExpressionEqual equal;
+        vector<RegularExpression::Ptr> result;
+        for (const auto &group : groups)
+        {
+            if (group.size() == 1)
+            {
+                result.push_back(items[group.front()]);
+                continue;
+            }
+            const auto &first = sequences[group.front()];
+            size_t prefixLength = first.size();
+            for (size_t i : group)
+            {
+                size_t n = 0;
+                while (n < prefixLength && n < sequences[i].size() && equal(sequences[i][n], first[n]))
+                {
+                    n++;
+                }
+                prefixLength = n;
+            }
+            vector<RegularExpression::Ptr> factored(first.begin(), first.begin() + prefixLength);
+            vector<RegularExpression::Ptr> remainders;
+            bool optional = false;
+            for (size_t i : group)
+            {
+                const auto &sequence = sequences[i];
+                if (sequence.size() == prefixLength)
+                {
+                    optional = true;
+                }
+                else if (sequence.size() == prefixLength + 1)
+                {
+                    remainders.push_back(sequence.back());
+                }
+                else
+                {
+                    remainders.push_back(make_shared<ConcatenationExpression>(
+                        vector<RegularExpression::Ptr>(sequence.begin() + prefixLength, sequence.end())));
+                }
+            }
+            auto tail = SimplifyAlternation(std::move(remainders));
+            if (optional)
+            {
+                tail = make_shared<RepeatExpression>(tail, 0, 1);
+            }
+            factored.push_back(tail);
+            result.push_back(SimplifyConcatenation(std::move(factored)));
+        }
+        return result;
+    }
+
+    /**
+     * Simplifier::MergeCharacters
+     *
+     * @param  {vector<RegularExpression::Ptr>} items : alternatives
+     * @return {vector<RegularExpression::Ptr>}       : the alternatives with all the single-character
+     *                                                  ones merged into one class, at the place of the first
+     */
+    vector<RegularExpression::Ptr> Simplifier::MergeCharacters(const vector<RegularExpression::Ptr> &items)
+    {
+        size_t count = 0;
+        CharClass merged;
+        for (const auto &item : items)
+        {
+            if (IsCharacter(item))
+            {
+                merged = merged.Union(CharacterSet(item));
+                count++;
+            }
+        }
+        if (count < 2)
+        {
+            return items;
+        }
+        RegularExpression::Ptr mergedExp;
+        if (merged.Ranges().size() == 1)
+        {
+            mergedExp = make_shared<SymbolExpression>(merged.Ranges().front());
+        }
+        else
+        {
+            mergedExp = make_shared<CharClassExpression>(merged);
+        }
+        vector<RegularExpression::Ptr> result;
+        for (const auto &item : items)
+        {
+            if (!IsCharacter(item))
+            {
+                result.push_back(item);
+            }
+            else if (mergedExp)
+            {
+                result.push_back(mergedExp);
+                mergedExp = nullptr;
+            }
+            else
+            {
+                // already merged into the class
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Simplify
+     *
+     * @param  {RegularExpression::Ptr} exp : an expression tree
+     * @return {RegularExpression::Ptr}     : an equivalent tree with fewer nodes
+     */
+    RegularExpression::Ptr Simplify(const RegularExpression::Ptr &exp)
+    {
+        Simplifier simplifier;
+        return simplifier.Fold(exp);
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldAlternation(const AlternationExpression::Ptr &exp,
+                                                       vector<RegularExpression::Ptr> &items)
+    {
+        if (items == exp->items)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<AlternationExpression>(items);
+        }
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldConcatenation(const ConcatenationExpression::Ptr &exp,
+                                                         vector<RegularExpression::Ptr> &items)
+    {
+        if (items == exp->items)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<ConcatenationExpression>(items);
+        }
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldKleeneStar(const KleeneStarExpression::Ptr &exp,
+                                                      RegularExpression::Ptr &inner)
+    {
+        if (inner == exp->innerExp)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<KleeneStarExpression>(inner);
+        }
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldRepeat(const RepeatExpression::Ptr &exp, RegularExpression::Ptr &inner)
+    {
+        if (inner == exp->innerExp)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<RepeatExpression>(inner, exp->atLeast, exp->atMost);
+        }
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldSymbol(const SymbolExpression::Ptr &exp)
+    {
+        if (exp->range.rangeType != RangeType::CharacterRange)
+        {
+            /* an assertion has no case */
+            return exp;
+        }
+        CharClass charClass(exp->range.lower, exp->range.upper);
+        CharClass folded = charClass.FoldCase();
+        if (folded == charClass)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<CharClassExpression>(folded);
+        }
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldCharClass(const CharClassExpression::Ptr &exp)
+    {
+        CharClass folded = exp->charClass.FoldCase();
+        if (folded == exp->charClass)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<CharClassExpression>(folded);
+        }
+    }
+
+    RegularExpression::Ptr CaseFolder::FoldCapture(const CaptureExpression::Ptr &exp, RegularExpression::Ptr &inner)
+    {
+        if (inner == exp->innerExp)
+        {
+            return exp;
+        }
+        else
+        {
+            return make_shared<CaptureExpression>(inner, exp->group);
+        }
+    }
+
+    /**
+     * FoldCase
+     *
+     * @param  {RegularExpression::Ptr} exp : an expression tree
+     * @return {RegularExpression::Ptr}     : the case-insensitive version of the expression
+     */
+    RegularExpression::Ptr FoldCase(const RegularExpression::Ptr &exp)
+    {
+        CaseFolder folder;
+        return folder.Fold(exp);
+    }
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "StreamReplacer.hpp"
+
+#include <stdexcept>
+
+namespace regex
+{
+    /**
+     * StreamReplacer::StreamReplacer
+     *
+     * @param  {DFAMatrix} matrix              : the compiled expression
+     * @param  {ReplaceTemplate} replacement   : the replacement of every match, which can only use $0
+     */
+    StreamReplacer::StreamReplacer(const DFAMatrix &matrix, const ReplaceTemplate &replacement)
+        : matrix{matrix}, replacement{replacement}
+    {
+        if (replacement.MaxGroup() > 0)
+        {
+            throw std::invalid_argument("a DFA matrix only reports the whole match, group 0");
+        }
+        else if (matrix.StateCount() > 0)
+        {
+            everyPosition = matrix.StartsWithoutCharacter();
+            Restart();
+        }
+        else
+        {
+            // nothing matches, and every chunk is written as it is
+        }
+    }
+
+    void StreamReplacer::Write(const u32string &chunk, u32string &out)
+    {
+        Write(chunk.data(), chunk.data() + chunk.size(), out);
+    }
+
+    /**
+     * StreamReplacer::Write
+     *
+     * @param  {char32_t*} begin   : the start of the next chunk of the stream
+     * @param  {char32_t*} end     : the end of the chunk
+     * @param  {u32string} out     : receives the part of the result which is settled, appended
+     */
+    void StreamReplacer::Write(const char32_t *begin, const char32_t *end, u32string &out)
+    {
+        if (matrix.StateCount() == 0)
+        {
+            out.append(begin, end);
+            return;
+        }
+        /* drop the characters already written before the buffer grows */
+        buffer.erase(0, head);
+        scanned -= head;
+        head = 0;
+        buffer.append(begin, end);
+        Run(false, out);
+    }
+
+    /**
+     * StreamReplacer::Finish
+     *
+     * End the stream: the tentative match is settled and written. The replacer can then take a new stream.
+     *
+     * @param  {u32string} out : receives the rest of the result, appended
+     */
+    void StreamReplacer::Finish(u32string &out)
+    {
+        if (matrix.StateCount() > 0)
+        {
+            Run(true, out);
+        }
+        buffer.clear();
+        head = 0;
+        position = 0;
+        lastEnd = SIZE_MAX;
+        behind = CharacterContext::TextEdge;
+        if (matrix.StateCount() > 0)
+        {
+            Restart();
+        }
+    }
+
+    /**
+     * StreamReplacer::Run
+     *
+     * Settle the matches which the buffered characters decide, in the manner of FindIter: the DFA reads
+     * from "head" until it dies, then the longest match found is replaced, or the character at "head" is
+     * written, and matching starts over after it.
+     *
+     * @param  {bool} atEnd        : true if the stream ends after the buffer
+     * @param  {u32string} out     : receives the settled part of the result
+     */
+    void StreamReplacer::Run(bool atEnd, u32string &out)
+    {
+        while (true)
+        {
+            if (!everyPosition && scanned == head)
+            {
+                /* write the characters which cannot start a match without buffering them */
+                size_t skipped = head;
+                while (skipped < buffer.size() && !matrix.CanStartWith(buffer[skipped]))
+                {
+                    skipped++;
+                }
+                out.append(buffer, head, skipped - head);
+                Advance(skipped - head);
+                Restart();
+                if (head == buffer.size())
+                {
+                    return;
+                }
+            }
+            /* a state accepts depending on the character after it, so it is decided once that one comes */
+            while (state != -1 && scanned < buffer.size())
+            {
+                char32_t c = buffer[scanned];
+                if (matrix.Accepts(state, ContextOf(c)))
+                {
+                    lastLength = static_cast<long>(scanned - head);
+                }
+                int column = matrix.CharacterColumn(c);
+                state = column == -1 ? -1 : matrix.Next(state, column);
+                if (state != -1)
+                {
+                    scanned++;
+                }
+            }
+            if (state != -1 && !atEnd)
+            {
+                /* a longer match may come with the next chunk */
+                return;
+            }
+            else if (state != -1 && matrix.Accepts(state, CharacterContext::TextEdge))
+            {
+                /* the DFA read the whole stream */
+                lastLength = static_cast<long>(scanned - head);
+            }
+            bool skipEmpty = lastLength == 0 && position == lastEnd;
+            if (lastLength != -1 && !skipEmpty)
+            {
+                size_t length = static_cast<size_t>(lastLength);
+                replacement.Expand(buffer, MatchSpan{head, head + length}, out);
+                replacedCount++;
+                lastEnd = position + length;
+                Advance(length);
+                if (length > 0)
+                {
+                    Restart();
+                    continue;
+                }
+            }
+            if (head < buffer.size())
+            {
+                /* no match here, or an empty one: go on from the next character */
+                out.push_back(buffer[head]);
+                Advance(1);
+                Restart();
+            }
+            else
+            {
+                /* the stream ended, and its end has been tried */
+                return;
+            }
+        }
+    }
+
+    void StreamReplacer::Advance(size_t count)
+    {
+        if (count > 0)
+        {
+            behind = ContextOf(buffer[head + count - 1]);
+        }
+        head += count;
+        position += count;
+        scanned = head;
+    }
+
+    void StreamReplacer::Restart()
+    {
+        scanned = head;
+        state = matrix.StartState(behind);
+        lastLength = -1;
+    }
+} // namespace regex
\ No newline at end of file
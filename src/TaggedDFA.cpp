@@ -0,0 +1,351 @@
+#include "TaggedDFA.hpp"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "FindIter.hpp"
+
+namespace regex
+{
+    namespace
+    {
+        /* a vertex of the NFA with the register holding each tag on the path which reached it */
+        struct Configuration
+        {
+            StateID vertex;
+            vector<int32_t> registers;
+        };
+
+        /* the placeholder of the register a transition sets to the current position for a tag */
+        int32_t Fresh(int tag)
+        {
+            return -2 - tag;
+        }
+        bool IsFresh(int32_t reg)
+        {
+            return reg <= -2;
+        }
+    } // namespace
+
+    /**
+     * TaggedDFA::TaggedDFA
+     *
+     * Build the whole tagged DFA by the subset construction. The closure of a state follows the
+     * epsilon edges depth-first in priority order and keeps the first path reaching each vertex, so
+     * the list of a state is sorted from the preferred path down. The configurations reached after a
+     * character set the crossed tags to placeholders. If an existing state has the same vertices and
+     * its registers can be filled from the new ones, the transition goes there with the copies doing
+     * so; otherwise a new state is made, with new registers for the placeholders.
+     *
+     * @param  {RegularExpression::Ptr} exp : the expression, with groups made by notations::Capture
+     */
+    TaggedDFA::TaggedDFA(const RegularExpression::Ptr &exp) : matrix{exp->Compile()}
+    {
+        CaptureProgram program(exp);
+        const vector<CaptureVertex> &vertices = program.vertices;
+        StateID finalVertex = program.endVertex;
+        groupCount = program.groupCount;
+        tagCount = program.TagCount();
+        registerCount = tagCount;
+
+        vector<vector<int32_t>> vertexColumns;
+        classRanges = program.SplitColumns(vertexColumns);
+        columnCount = classRanges.size();
+
+        vector<uint32_t> marks(vertices.size(), 0);
+        uint32_t generation = 0;
+        auto closure = [&](const vector<Configuration> &seeds) {
+            generation++;
+            vector<Configuration> result;
+            vector<Configuration> stack;
+            for (const auto &seed : seeds)
+            {
+                stack.push_back(seed);
+                while (!stack.empty())
+                {
+                    Configuration current = std::move(stack.back());
+                    stack.pop_back();
+                    if (marks[current.vertex] == generation)
+                    {
+                        continue;
+                    }
+                    marks[current.vertex] = generation;
+                    const CaptureVertex &vertex = vertices[current.vertex];
+                    if (vertex.kind == CaptureVertexKind::Range)
+                    {
+                        result.push_back(std::move(current));
+                    }
+                    else if (vertex.kind == CaptureVertexKind::Tag)
+                    {
+                        current.registers[vertex.tag] = Fresh(vertex.tag);
+                        current.vertex = vertex.next.front();
+                        stack.push_back(std::move(current));
+                    }
+                    else
+                    {
+                        /* push in reverse so that the preferred successor is expanded first */
+                        for (auto it = vertex.next.rbegin(); it != vertex.next.rend(); ++it)
+                        {
+                            stack.push_back(Configuration{*it, current.registers});
+                        }
+                        if (current.vertex == finalVertex)
+                        {
+                            result.push_back(std::move(current));
+                        }
+                    }
+                }
+            }
+            return result;
+        };
+
+        vector<vector<Configuration>> states;
+        std::map<vector<StateID>, vector<int32_t>> stateIndices;
+        /* find the target of a transition reaching the configurations, and the operations to get there */
+        auto addState = [&](vector<Configuration> configurations, vector<RegisterOp> &transitionOps) {
+            vector<StateID> key;
+            for (const auto &configuration : configurations)
+            {
+                key.push_back(configuration.vertex);
+            }
+            vector<int32_t> &candidates = stateIndices[key];
+            for (int32_t candidate : candidates)
+            {
+                /* every register of the candidate must be filled from a single register or the position */
+                std::unordered_map<int32_t, int32_t> sources;
+                bool mapped = true;
+                for (size_t i = 0; i < configurations.size() && mapped; i++)
+                {
+                    for (size_t t = 0; t < tagCount && mapped; t++)
+                    {
+                        auto [it, inserted] = sources.emplace(states[candidate][i].registers[t],
+                                                              configurations[i].registers[t]);
+                        mapped = inserted || it->second == configurations[i].registers[t];
+                    }
+                }
+                if (mapped)
+                {
+                    for (const auto &[target, source] : sources)
+                    {
+                        if (IsFresh(source))
+                        {
+                            transitionOps.push_back(RegisterOp{target, POSITION});
+                        }
+                        else if (source != target)
+                        {
+                            transitionOps.push_back(RegisterOp{target, source});
+                        }
+                        else
+                        {
+                            // the register already holds the value
+                        }
+                    }
+                    return candidate;
+                }
+            }
+            if (states.size() == MAX_STATE_COUNT)
+            {
+                throw std::runtime_error("the expression needs too many tagged DFA states");
+            }
+            vector<int32_t> freshRegisters(tagCount, -1);
+            for (auto &configuration : configurations)
+            {
+                for (auto &reg : configuration.registers)
+                {
+                    if (IsFresh(reg))
+                    {
+                        int tag = -2 - reg;
+                        if (freshRegisters[tag] == -1)
+                        {
+                            freshRegisters[tag] = static_cast<int32_t>(registerCount++);
+                            transitionOps.push_back(RegisterOp{freshRegisters[tag], POSITION});
+                        }
+                        reg = freshRegisters[tag];
+                    }
+                }
+            }
+            int32_t state = static_cast<int32_t>(states.size());
+            auto final = std::find_if(configurations.begin(), configurations.end(),
+                                      [finalVertex](const Configuration &c) { return c.vertex == finalVertex; });
+            accepting.push_back(final != configurations.end());
+            for (size_t t = 0; t < tagCount; t++)
+            {
+                finalRegisters.push_back(final != configurations.end() ? final->registers[t] : -1);
+            }
+            candidates.push_back(state);
+            states.push_back(std::move(configurations));
+            return state;
+        };
+
+        vector<int32_t> initialRegisters(tagCount);
+        for (size_t t = 0; t < tagCount; t++)
+        {
+            initialRegisters[t] = static_cast<int32_t>(t);
+        }
+        addState(closure({Configuration{program.startVertex, initialRegisters}}), initialOps);
+        maxOpCount = initialOps.size();
+        for (size_t state = 0; state < states.size(); state++)
+        {
+            vector<vector<Configuration>> moves(columnCount);
+            for (const auto &configuration : states[state])
+            {
+                for (int32_t column : vertexColumns[configuration.vertex])
+                {
+                    moves[column].push_back(
+                        Configuration{vertices[configuration.vertex].next.front(), configuration.registers});
+                }
+            }
+            for (size_t column = 0; column < columnCount; column++)
+            {
+                opOffsets.push_back(static_cast<uint32_t>(ops.size()));
+                if (moves[column].empty())
+                {
+                    transitions.push_back(-1);
+                }
+                else
+                {
+                    vector<RegisterOp> transitionOps;
+                    transitions.push_back(addState(closure(moves[column]), transitionOps));
+                    maxOpCount = std::max(maxOpCount, transitionOps.size());
+                    ops.insert(ops.end(), transitionOps.begin(), transitionOps.end());
+                }
+            }
+        }
+        opOffsets.push_back(static_cast<uint32_t>(ops.size()));
+    }
+
+    bool TaggedDFA::Match(const u32string &str, vector<Submatch> &groups) const
+    {
+        RunBuffers buffers;
+        return Run(str, 0, str.size(), groups, buffers) != -1;
+    }
+
+    bool TaggedDFA::FullMatch(const u32string &str, vector<Submatch> &groups) const
+    {
+        RunBuffers buffers;
+        if (Run(str, 0, str.size(), groups, buffers) == static_cast<int>(str.size()))
+        {
+            return true;
+        }
+        else
+        {
+            groups.assign(groupCount, Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    /**
+     * TaggedDFA::Search
+     *
+     * @param  {u32string} str             : the string to search
+     * @param  {vector<Submatch>} groups   : receives the groups of the leftmost match
+     * @return {bool}                      : whether the expression matches anywhere in the string
+     */
+    bool TaggedDFA::Search(const u32string &str, vector<Submatch> &groups) const
+    {
+        FindIter iter(matrix, str);
+        MatchSpan span;
+        if (iter.Next(span))
+        {
+            /* the longest match of the tagged DFA from there ends where the one of the matrix does */
+            RunBuffers buffers;
+            return Run(str, span.begin, span.end, groups, buffers) != -1;
+        }
+        else
+        {
+            groups.assign(groupCount, Submatch{-1, -1});
+            return false;
+        }
+    }
+
+    /**
+     * TaggedDFA::Run
+     *
+     * @param  {u32string} str             : the string to match
+     * @param  {size_t} start              : the offset the match is anchored at
+     * @param  {size_t} end                : the offset reading stops at
+     * @param  {vector<Submatch>} groups   : receives the groups of the longest match, or -1 spans
+     * @param  {RunBuffers} buffers        : the registers, sized here
+     * @return {int}                       : the end of the longest match, -1 if there is none
+     */
+    int TaggedDFA::Run(const u32string &str, size_t start, size_t end, vector<Submatch> &groups,
+                       RunBuffers &buffers) const
+    {
+        vector<int32_t> &registers = buffers.registers;
+        vector<int32_t> &values = buffers.values;
+        vector<int32_t> &snapshot = buffers.snapshot;
+        registers.assign(registerCount, -1);
+        values.resize(maxOpCount);
+        snapshot.assign(tagCount, -1);
+        auto apply = [&](const RegisterOp *first, const RegisterOp *last, int32_t position) {
+            /* the operations of a transition run in parallel: read every source before writing */
+            for (const RegisterOp *op = first; op < last; op++)
+            {
+                values[op - first] = op->source == POSITION ? position : registers[op->source];
+            }
+            for (const RegisterOp *op = first; op < last; op++)
+            {
+                registers[op->target] = values[op - first];
+            }
+        };
+        apply(initialOps.data(), initialOps.data() + initialOps.size(), static_cast<int32_t>(start));
+        int matchEnd = -1;
+        int32_t state = 0;
+        auto accept = [&](int position) {
+            matchEnd = position;
+            for (size_t t = 0; t < tagCount; t++)
+            {
+                snapshot[t] = registers[finalRegisters[state * tagCount + t]];
+            }
+        };
+        if (accepting[state])
+        {
+            accept(static_cast<int>(start));
+        }
+        for (size_t i = start; i < end; i++)
+        {
+            int32_t column = ColumnOf(str[i]);
+            if (column == -1)
+            {
+                break;
+            }
+            size_t transition = static_cast<size_t>(state) * columnCount + column;
+            state = transitions[transition];
+            if (state == -1)
+            {
+                break;
+            }
+            apply(ops.data() + opOffsets[transition], ops.data() + opOffsets[transition + 1],
+                  static_cast<int32_t>(i + 1));
+            if (accepting[state])
+            {
+                accept(static_cast<int>(i + 1));
+            }
+            else
+            {
+                // keep reading for a longer match
+            }
+        }
+        groups.assign(groupCount, Submatch{-1, -1});
+        if (matchEnd != -1)
+        {
+            groups[0] = Submatch{static_cast<int>(start), matchEnd};
+            for (size_t g = 1; g < groupCount; g++)
+            {
+                int groupBegin = snapshot[2 * g - 2];
+                int groupEnd = snapshot[2 * g - 1];
+                if (groupBegin != -1 && groupEnd != -1)
+                {
+                    groups[g] = Submatch{groupBegin, groupEnd};
+                }
+            }
+        }
+        return matchEnd;
+    }
+
+    int32_t TaggedDFA::ColumnOf(char32_t c) const
+    {
+        return FindRangeColumn(classRanges.data(), classRanges.size(), c);
+    }
+} // namespace regex
\ No newline at end of file
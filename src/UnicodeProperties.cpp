@@ -0,0 +1,188 @@
+#include "UnicodeProperties.hpp"
+
+#include <cctype>
+#include <stdexcept>
+#include <vector>
+
+#include "UnicodeTables.hpp"
+
+namespace regex
+{
+    using std::vector;
+
+    static string LooseName(const string &name)
+    {
+        string loose;
+        for (char c : name)
+        {
+            if (c != ' ' && c != '-' && c != '_')
+            {
+                loose.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+            }
+        }
+        return loose;
+    }
+
+    /**
+     * PropertyValues
+     *
+     * @param  {char*[][2]} names : the short and long names of the values of a property
+     * @param  {size_t} count     : the number of values
+     * @param  {string} name      : the name to look for
+     * @return {vector<bool>}     : the values matching the name, all false if there is none
+     */
+    static vector<bool> PropertyValues(const char *const names[][2], size_t count, const string &name)
+    {
+        vector<bool> selected(count, false);
+        string loose = LooseName(name);
+        for (size_t i = 0; i < count; i++)
+        {
+            selected[i] = LooseName(names[i][0]) == loose || LooseName(names[i][1]) == loose;
+        }
+        return selected;
+    }
+
+    static CharClass ClassOfRuns(const UnicodeRun runs[], size_t runCount, const vector<bool> &selected)
+    {
+        vector<UnicodeRange> ranges;
+        for (size_t i = 0; i < runCount; i++)
+        {
+            if (selected[runs[i].value])
+            {
+                char32_t upper = i + 1 < runCount ? runs[i + 1].first - 1 : CharClass::MAX_CODE_POINT;
+                ranges.emplace_back(RangeType::CharacterRange, runs[i].first, upper);
+            }
+        }
+        return CharClass(std::move(ranges));
+    }
+
+    static bool AnySelected(const vector<bool> &selected)
+    {
+        for (bool s : selected)
+        {
+            if (s)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * GeneralCategoryClass
+     *
+     * @param  {string} name : a category such as "Lu" or "Uppercase_Letter", or a group of categories
+     *                         such as "L" or "Letter", "LC" or "Cased_Letter"
+     * @return {CharClass}   : the code points of the category
+     */
+    CharClass GeneralCategoryClass(const string &name)
+    {
+        static const char *const GROUPS[][2] = {{"L", "Letter"}, {"M", "Mark"},        {"N", "Number"},
+                                                {"P", "Punctuation"}, {"S", "Symbol"}, {"Z", "Separator"},
+                                                {"C", "Other"}};
+        vector<bool> selected = PropertyValues(GENERAL_CATEGORY_NAMES, GENERAL_CATEGORY_COUNT, name);
+        string loose = LooseName(name);
+        for (const auto &group : GROUPS)
+        {
+            if (LooseName(group[0]) == loose || LooseName(group[1]) == loose)
+            {
+                /* a group contains the categories whose short names start with the letter of the group */
+                for (size_t i = 0; i < GENERAL_CATEGORY_COUNT; i++)
+                {
+                    selected[i] = selected[i] || GENERAL_CATEGORY_NAMES[i][0][0] == group[0][0];
+                }
+            }
+        }
+        if (loose == "lc" || loose == "casedletter")
+        {
+            for (size_t i = 0; i < GENERAL_CATEGORY_COUNT; i++)
+            {
+                string category = GENERAL_CATEGORY_NAMES[i][0];
+                selected[i] = selected[i] || category == "Lu" || category == "Ll" || category == "Lt";
+            }
+        }
+        if (!AnySelected(selected))
+        {
+            throw std::invalid_argument("unknown general category: " + name);
+        }
+        return ClassOfRuns(GENERAL_CATEGORY_RUNS, GENERAL_CATEGORY_RUN_COUNT, selected);
+    }
+
+    /**
+     * ScriptClass
+     *
+     * @param  {string} name : a script such as "Han" or "Hani"
+     * @return {CharClass}   : the code points of the script
+     */
+    CharClass ScriptClass(const string &name)
+    {
+        vector<bool> selected = PropertyValues(SCRIPT_NAMES, SCRIPT_COUNT, name);
+        if (!AnySelected(selected))
+        {
+            throw std::invalid_argument("unknown script: " + name);
+        }
+        return ClassOfRuns(SCRIPT_RUNS, SCRIPT_RUN_COUNT, selected);
+    }
+
+    /**
+     * UnicodePropertyClass
+     *
+     * The class of \p{name}. The name is either "gc=...", "General_Category=...", "sc=..." or
+     * "Script=...", a general category, a script, or one of "Any", "Assigned" and "ASCII".
+     *
+     * @param  {string} name : the property
+     * @return {CharClass}   : the code points having the property
+     */
+    CharClass UnicodePropertyClass(const string &name)
+    {
+        size_t equal = name.find('=');
+        if (equal != string::npos)
+        {
+            string property = LooseName(name.substr(0, equal));
+            string value = name.substr(equal + 1);
+            if (property == "gc" || property == "generalcategory")
+            {
+                return GeneralCategoryClass(value);
+            }
+            else if (property == "sc" || property == "script")
+            {
+                return ScriptClass(value);
+            }
+            else
+            {
+                throw std::invalid_argument("unknown property: " + name);
+            }
+        }
+        string loose = LooseName(name);
+        if (loose == "any")
+        {
+            return CharClass::Any();
+        }
+        else if (loose == "assigned")
+        {
+            return GeneralCategoryClass("Cn").Negate();
+        }
+        else if (loose == "ascii")
+        {
+            return CharClass(0, 0x7F);
+        }
+        else if (AnySelected(PropertyValues(SCRIPT_NAMES, SCRIPT_COUNT, name)) &&
+                 !AnySelected(PropertyValues(GENERAL_CATEGORY_NAMES, GENERAL_CATEGORY_COUNT, name)))
+        {
+            return ScriptClass(name);
+        }
+        else
+        {
+            /* general categories take precedence, as in most regular expression engines */
+            return GeneralCategoryClass(name);
+        }
+    }
+
+    namespace notations
+    {
+        RegularExpression::Ptr Property(const string &name)
+        {
+            return Class(UnicodePropertyClass(name));
+        }
+    } // namespace notations
+} // namespace regex
\ No newline at end of file
@@ -0,0 +1,1634 @@
+// Generated by tools/generate_unicode_tables.pl. Do not edit.
+#include "UnicodeTables.hpp"
+
+namespace regex
+{
+    const char *const UNICODE_VERSION = "14.0.0";
+
+    const char *const GENERAL_CATEGORY_NAMES[][2] = {
+        {"Cc", "Control"},
+        {"Cf", "Format"},
+        {"Cn", "Unassigned"},
+        {"Co", "Private_Use"},
+        {"Cs", "Surrogate"},
+        {"Ll", "Lowercase_Letter"},
+        {"Lm", "Modifier_Letter"},
+        {"Lo", "Other_Letter"},
+        {"Lt", "Titlecase_Letter"},
+        {"Lu", "Uppercase_Letter"},
+        {"Mc", "Spacing_Mark"},
+        {"Me", "Enclosing_Mark"},
+        {"Mn", "Nonspacing_Mark"},
+        {"Nd", "Decimal_Number"},
+        {"Nl", "Letter_Number"},
+        {"No", "Other_Number"},
+        {"Pc", "Connector_Punctuation"},
+        {"Pd", "Dash_Punctuation"},
+        {"Pe", "Close_Punctuation"},
+        {"Pf", "Final_Punctuation"},
+        {"Pi", "Initial_Punctuation"},
+        {"Po", "Other_Punctuation"},
+        {"Ps", "Open_Punctuation"},
+        {"Sc", "Currency_Symbol"},
+        {"Sk", "Modifier_Symbol"},
+        {"Sm", "Math_Symbol"},
+        {"So", "Other_Symbol"},
+        {"Zl", "Line_Separator"},
+        {"Zp", "Paragraph_Separator"},
+        {"Zs", "Space_Separator"},
+    };
+    const size_t GENERAL_CATEGORY_COUNT = 30;
+
+    const UnicodeRun GENERAL_CATEGORY_RUNS[] = {
+        {0x0, 0}, {0x20, 29}, {0x21, 21}, {0x24, 23}, {0x25, 21}, {0x28, 22},
+        {0x29, 18}, {0x2A, 21}, {0x2B, 25}, {0x2C, 21}, {0x2D, 17}, {0x2E, 21},
+        {0x30, 13}, {0x3A, 21}, {0x3C, 25}, {0x3F, 21}, {0x41, 9}, {0x5B, 22},
+        {0x5C, 21}, {0x5D, 18}, {0x5E, 24}, {0x5F, 16}, {0x60, 24}, {0x61, 5},
+        {0x7B, 22}, {0x7C, 25}, {0x7D, 18}, {0x7E, 25}, {0x7F, 0}, {0xA0, 29},
+        {0xA1, 21}, {0xA2, 23}, {0xA6, 26}, {0xA7, 21}, {0xA8, 24}, {0xA9, 26},
+        {0xAA, 7}, {0xAB, 20}, {0xAC, 25}, {0xAD, 1}, {0xAE, 26}, {0xAF, 24},
+        {0xB0, 26}, {0xB1, 25}, {0xB2, 15}, {0xB4, 24}, {0xB5, 5}, {0xB6, 21},
+        {0xB8, 24}, {0xB9, 15}, {0xBA, 7}, {0xBB, 19}, {0xBC, 15}, {0xBF, 21},
+        {0xC0, 9}, {0xD7, 25}, {0xD8, 9}, {0xDF, 5}, {0xF7, 25}, {0xF8, 5},
+        {0x100, 9}, {0x101, 5}, {0x102, 9}, {0x103, 5}, {0x104, 9}, {0x105, 5},
+        {0x106, 9}, {0x107, 5}, {0x108, 9}, {0x109, 5}, {0x10A, 9}, {0x10B, 5},
+        {0x10C, 9}, {0x10D, 5}, {0x10E, 9}, {0x10F, 5}, {0x110, 9}, {0x111, 5},
+        {0x112, 9}, {0x113, 5}, {0x114, 9}, {0x115, 5}, {0x116, 9}, {0x117, 5},
+        {0x118, 9}, {0x119, 5}, {0x11A, 9}, {0x11B, 5}, {0x11C, 9}, {0x11D, 5},
+        {0x11E, 9}, {0x11F, 5}, {0x120, 9}, {0x121, 5}, {0x122, 9}, {0x123, 5},
+        {0x124, 9}, {0x125, 5}, {0x126, 9}, {0x127, 5}, {0x128, 9}, {0x129, 5},
+        {0x12A, 9}, {0x12B, 5}, {0x12C, 9}, {0x12D, 5}, {0x12E, 9}, {0x12F, 5},
+        {0x130, 9}, {0x131, 5}, {0x132, 9}, {0x133, 5}, {0x134, 9}, {0x135, 5},
+        {0x136, 9}, {0x137, 5}, {0x139, 9}, {0x13A, 5}, {0x13B, 9}, {0x13C, 5},
+        {0x13D, 9}, {0x13E, 5}, {0x13F, 9}, {0x140, 5}, {0x141, 9}, {0x142, 5},
+        {0x143, 9}, {0x144, 5}, {0x145, 9}, {0x146, 5}, {0x147, 9}, {0x148, 5},
+        {0x14A, 9}, {0x14B, 5}, {0x14C, 9}, {0x14D, 5}, {0x14E, 9}, {0x14F, 5},
+        {0x150, 9}, {0x151, 5}, {0x152, 9}, {0x153, 5}, {0x154, 9}, {0x155, 5},
+        {0x156, 9}, {0x157, 5}, {0x158, 9}, {0x159, 5}, {0x15A, 9}, {0x15B, 5},
+        {0x15C, 9}, {0x15D, 5}, {0x15E, 9}, {0x15F, 5}, {0x160, 9}, {0x161, 5},
+        {0x162, 9}, {0x163, 5}, {0x164, 9}, {0x165, 5}, {0x166, 9}, {0x167, 5},
+        {0x168, 9}, {0x169, 5}, {0x16A, 9}, {0x16B, 5}, {0x16C, 9}, {0x16D, 5},
+        {0x16E, 9}, {0x16F, 5}, {0x170, 9}, {0x171, 5}, {0x172, 9}, {0x173, 5},
+        {0x174, 9}, {0x175, 5}, {0x176, 9}, {0x177, 5}, {0x178, 9}, {0x17A, 5},
+        {0x17B, 9}, {0x17C, 5}, {0x17D, 9}, {0x17E, 5}, {0x181, 9}, {0x183, 5},
+        {0x184, 9}, {0x185, 5}, {0x186, 9}, {0x188, 5}, {0x189, 9}, {0x18C, 5},
+        {0x18E, 9}, {0x192, 5}, {0x193, 9}, {0x195, 5}, {0x196, 9}, {0x199, 5},
+        {0x19C, 9}, {0x19E, 5}, {0x19F, 9}, {0x1A1, 5}, {0x1A2, 9}, {0x1A3, 5},
+        {0x1A4, 9}, {0x1A5, 5}, {0x1A6, 9}, {0x1A8, 5}, {0x1A9, 9}, {0x1AA, 5},
+        {0x1AC, 9}, {0x1AD, 5}, {0x1AE, 9}, {0x1B0, 5}, {0x1B1, 9}, {0x1B4, 5},
+        {0x1B5, 9}, {0x1B6, 5}, {0x1B7, 9}, {0x1B9, 5}, {0x1BB, 7}, {0x1BC, 9},
+        {0x1BD, 5}, {0x1C0, 7}, {0x1C4, 9}, {0x1C5, 8}, {0x1C6, 5}, {0x1C7, 9},
+        {0x1C8, 8}, {0x1C9, 5}, {0x1CA, 9}, {0x1CB, 8}, {0x1CC, 5}, {0x1CD, 9},
+        {0x1CE, 5}, {0x1CF, 9}, {0x1D0, 5}, {0x1D1, 9}, {0x1D2, 5}, {0x1D3, 9},
+        {0x1D4, 5}, {0x1D5, 9}, {0x1D6, 5}, {0x1D7, 9}, {0x1D8, 5}, {0x1D9, 9},
+        {0x1DA, 5}, {0x1DB, 9}, {0x1DC, 5}, {0x1DE, 9}, {0x1DF, 5}, {0x1E0, 9},
+        {0x1E1, 5}, {0x1E2, 9}, {0x1E3, 5}, {0x1E4, 9}, {0x1E5, 5}, {0x1E6, 9},
+        {0x1E7, 5}, {0x1E8, 9}, {0x1E9, 5}, {0x1EA, 9}, {0x1EB, 5}, {0x1EC, 9},
+        {0x1ED, 5}, {0x1EE, 9}, {0x1EF, 5}, {0x1F1, 9}, {0x1F2, 8}, {0x1F3, 5},
+        {0x1F4, 9}, {0x1F5, 5}, {0x1F6, 9}, {0x1F9, 5}, {0x1FA, 9}, {0x1FB, 5},
+        {0x1FC, 9}, {0x1FD, 5}, {0x1FE, 9}, {0x1FF, 5}, {0x200, 9}, {0x201, 5},
+        {0x202, 9}, {0x203, 5}, {0x204, 9}, {0x205, 5}, {0x206, 9}, {0x207, 5},
+        {0x208, 9}, {0x209, 5}, {0x20A, 9}, {0x20B, 5}, {0x20C, 9}, {0x20D, 5},
+        {0x20E, 9}, {0x20F, 5}, {0x210, 9}, {0x211, 5}, {0x212, 9}, {0x213, 5},
+        {0x214, 9}, {0x215, 5}, {0x216, 9}, {0x217, 5}, {0x218, 9}, {0x219, 5},
+        {0x21A, 9}, {0x21B, 5}, {0x21C, 9}, {0x21D, 5}, {0x21E, 9}, {0x21F, 5},
+        {0x220, 9}, {0x221, 5}, {0x222, 9}, {0x223, 5}, {0x224, 9}, {0x225, 5},
+        {0x226, 9}, {0x227, 5}, {0x228, 9}, {0x229, 5}, {0x22A, 9}, {0x22B, 5},
+        {0x22C, 9}, {0x22D, 5}, {0x22E, 9}, {0x22F, 5}, {0x230, 9}, {0x231, 5},
+        {0x232, 9}, {0x233, 5}, {0x23A, 9}, {0x23C, 5}, {0x23D, 9}, {0x23F, 5},
+        {0x241, 9}, {0x242, 5}, {0x243, 9}, {0x247, 5}, {0x248, 9}, {0x249, 5},
+        {0x24A, 9}, {0x24B, 5}, {0x24C, 9}, {0x24D, 5}, {0x24E, 9}, {0x24F, 5},
+        {0x294, 7}, {0x295, 5}, {0x2B0, 6}, {0x2C2, 24}, {0x2C6, 6}, {0x2D2, 24},
+        {0x2E0, 6}, {0x2E5, 24}, {0x2EC, 6}, {0x2ED, 24}, {0x2EE, 6}, {0x2EF, 24},
+        {0x300, 12}, {0x370, 9}, {0x371, 5}, {0x372, 9}, {0x373, 5}, {0x374, 6},
+        {0x375, 24}, {0x376, 9}, {0x377, 5}, {0x378, 2}, {0x37A, 6}, {0x37B, 5},
+        {0x37E, 21}, {0x37F, 9}, {0x380, 2}, {0x384, 24}, {0x386, 9}, {0x387, 21},
+        {0x388, 9}, {0x38B, 2}, {0x38C, 9}, {0x38D, 2}, {0x38E, 9}, {0x390, 5},
+        {0x391, 9}, {0x3A2, 2}, {0x3A3, 9}, {0x3AC, 5}, {0x3CF, 9}, {0x3D0, 5},
+        {0x3D2, 9}, {0x3D5, 5}, {0x3D8, 9}, {0x3D9, 5}, {0x3DA, 9}, {0x3DB, 5},
+        {0x3DC, 9}, {0x3DD, 5}, {0x3DE, 9}, {0x3DF, 5}, {0x3E0, 9}, {0x3E1, 5},
+        {0x3E2, 9}, {0x3E3, 5}, {0x3E4, 9}, {0x3E5, 5}, {0x3E6, 9}, {0x3E7, 5},
+        {0x3E8, 9}, {0x3E9, 5}, {0x3EA, 9}, {0x3EB, 5}, {0x3EC, 9}, {0x3ED, 5},
+        {0x3EE, 9}, {0x3EF, 5}, {0x3F4, 9}, {0x3F5, 5}, {0x3F6, 25}, {0x3F7, 9},
+        {0x3F8, 5}, {0x3F9, 9}, {0x3FB, 5}, {0x3FD, 9}, {0x430, 5}, {0x460, 9},
+        {0x461, 5}, {0x462, 9}, {0x463, 5}, {0x464, 9}, {0x465, 5}, {0x466, 9},
+        {0x467, 5}, {0x468, 9}, {0x469, 5}, {0x46A, 9}, {0x46B, 5}, {0x46C, 9},
+        {0x46D, 5}, {0x46E, 9}, {0x46F, 5}, {0x470, 9}, {0x471, 5}, {0x472, 9},
+        {0x473, 5}, {0x474, 9}, {0x475, 5}, {0x476, 9}, {0x477, 5}, {0x478, 9},
+        {0x479, 5}, {0x47A, 9}, {0x47B, 5}, {0x47C, 9}, {0x47D, 5}, {0x47E, 9},
+        {0x47F, 5}, {0x480, 9}, {0x481, 5}, {0x482, 26}, {0x483, 12}, {0x488, 11},
+        {0x48A, 9}, {0x48B, 5}, {0x48C, 9}, {0x48D, 5}, {0x48E, 9}, {0x48F, 5},
+        {0x490, 9}, {0x491, 5}, {0x492, 9}, {0x493, 5}, {0x494, 9}, {0x495, 5},
+        {0x496, 9}, {0x497, 5}, {0x498, 9}, {0x499, 5}, {0x49A, 9}, {0x49B, 5},
+        {0x49C, 9}, {0x49D, 5}, {0x49E, 9}, {0x49F, 5}, {0x4A0, 9}, {0x4A1, 5},
+        {0x4A2, 9}, {0x4A3, 5}, {0x4A4, 9}, {0x4A5, 5}, {0x4A6, 9}, {0x4A7, 5},
+        {0x4A8, 9}, {0x4A9, 5}, {0x4AA, 9}, {0x4AB, 5}, {0x4AC, 9}, {0x4AD, 5},
+        {0x4AE, 9}, {0x4AF, 5}, {0x4B0, 9}, {0x4B1, 5}, {0x4B2, 9}, {0x4B3, 5},
+        {0x4B4, 9}, {0x4B5, 5}, {0x4B6, 9}, {0x4B7, 5}, {0x4B8, 9}, {0x4B9, 5},
+        {0x4BA, 9}, {0x4BB, 5}, {0x4BC, 9}, {0x4BD, 5}, {0x4BE, 9}, {0x4BF, 5},
+        {0x4C0, 9}, {0x4C2, 5}, {0x4C3, 9}, {0x4C4, 5}, {0x4C5, 9}, {0x4C6, 5},
+        {0x4C7, 9}, {0x4C8, 5}, {0x4C9, 9}, {0x4CA, 5}, {0x4CB, 9}, {0x4CC, 5},
+        {0x4CD, 9}, {0x4CE, 5}, {0x4D0, 9}, {0x4D1, 5}, {0x4D2, 9}, {0x4D3, 5},
+        {0x4D4, 9}, {0x4D5, 5}, {0x4D6, 9}, {0x4D7, 5}, {0x4D8, 9}, {0x4D9, 5},
+        {0x4DA, 9}, {0x4DB, 5}, {0x4DC, 9}, {0x4DD, 5}, {0x4DE, 9}, {0x4DF, 5},
+        {0x4E0, 9}, {0x4E1, 5}, {0x4E2, 9}, {0x4E3, 5}, {0x4E4, 9}, {0x4E5, 5},
+        {0x4E6, 9}, {0x4E7, 5}, {0x4E8, 9}, {0x4E9, 5}, {0x4EA, 9}, {0x4EB, 5},
+        {0x4EC, 9}, {0x4ED, 5}, {0x4EE, 9}, {0x4EF, 5}, {0x4F0, 9}, {0x4F1, 5},
+        {0x4F2, 9}, {0x4F3, 5}, {0x4F4, 9}, {0x4F5, 5}, {0x4F6, 9}, {0x4F7, 5},
+        {0x4F8, 9}, {0x4F9, 5}, {0x4FA, 9}, {0x4FB, 5}, {0x4FC, 9}, {0x4FD, 5},
+        {0x4FE, 9}, {0x4FF, 5}, {0x500, 9}, {0x501, 5}, {0x502, 9}, {0x503, 5},
+        {0x504, 9}, {0x505, 5}, {0x506, 9}, {0x507, 5}, {0x508, 9}, {0x509, 5},
+        {0x50A, 9}, {0x50B, 5}, {0x50C, 9}, {0x50D, 5}, {0x50E, 9}, {0x50F, 5},
+        {0x510, 9}, {0x511, 5}, {0x512, 9}, {0x513, 5}, {0x514, 9}, {0x515, 5},
+        {0x516, 9}, {0x517, 5}, {0x518, 9}, {0x519, 5}, {0x51A, 9}, {0x51B, 5},
+        {0x51C, 9}, {0x51D, 5}, {0x51E, 9}, {0x51F, 5}, {0x520, 9}, {0x521, 5},
+        {0x522, 9}, {0x523, 5}, {0x524, 9}, {0x525, 5}, {0x526, 9}, {0x527, 5},
+        {0x528, 9}, {0x529, 5}, {0x52A, 9}, {0x52B, 5}, {0x52C, 9}, {0x52D, 5},
+        {0x52E, 9}, {0x52F, 5}, {0x530, 2}, {0x531, 9}, {0x557, 2}, {0x559, 6},
+        {0x55A, 21}, {0x560, 5}, {0x589, 21}, {0x58A, 17}, {0x58B, 2}, {0x58D, 26},
+        {0x58F, 23}, {0x590, 2}, {0x591, 12}, {0x5BE, 17}, {0x5BF, 12}, {0x5C0, 21},
+        {0x5C1, 12}, {0x5C3, 21}, {0x5C4, 12}, {0x5C6, 21}, {0x5C7, 12}, {0x5C8, 2},
+        {0x5D0, 7}, {0x5EB, 2}, {0x5EF, 7}, {0x5F3, 21}, {0x5F5, 2}, {0x600, 1},
+        {0x606, 25}, {0x609, 21}, {0x60B, 23}, {0x60C, 21}, {0x60E, 26}, {0x610, 12},
+        {0x61B, 21}, {0x61C, 1}, {0x61D, 21}, {0x620, 7}, {0x640, 6}, {0x641, 7},
+        {0x64B, 12}, {0x660, 13}, {0x66A, 21}, {0x66E, 7}, {0x670, 12}, {0x671, 7},
+        {0x6D4, 21}, {0x6D5, 7}, {0x6D6, 12}, {0x6DD, 1}, {0x6DE, 26}, {0x6DF, 12},
+        {0x6E5, 6}, {0x6E7, 12}, {0x6E9, 26}, {0x6EA, 12}, {0x6EE, 7}, {0x6F0, 13},
+        {0x6FA, 7}, {0x6FD, 26}, {0x6FF, 7}, {0x700, 21}, {0x70E, 2}, {0x70F, 1},
+        {0x710, 7}, {0x711, 12}, {0x712, 7}, {0x730, 12}, {0x74B, 2}, {0x74D, 7},
+        {0x7A6, 12}, {0x7B1, 7}, {0x7B2, 2}, {0x7C0, 13}, {0x7CA, 7}, {0x7EB, 12},
+        {0x7F4, 6}, {0x7F6, 26}, {0x7F7, 21}, {0x7FA, 6}, {0x7FB, 2}, {0x7FD, 12},
+        {0x7FE, 23}, {0x800, 7}, {0x816, 12}, {0x81A, 6}, {0x81B, 12}, {0x824, 6},
+        {0x825, 12}, {0x828, 6}, {0x829, 12}, {0x82E, 2}, {0x830, 21}, {0x83F, 2},
+        {0x840, 7}, {0x859, 12}, {0x85C, 2}, {0x85E, 21}, {0x85F, 2}, {0x860, 7},
+        {0x86B, 2}, {0x870, 7}, {0x888, 24}, {0x889, 7}, {0x88F, 2}, {0x890, 1},
+        {0x892, 2}, {0x898, 12}, {0x8A0, 7}, {0x8C9, 6}, {0x8CA, 12}, {0x8E2, 1},
+        {0x8E3, 12}, {0x903, 10}, {0x904, 7}, {0x93A, 12}, {0x93B, 10}, {0x93C, 12},
+        {0x93D, 7}, {0x93E, 10}, {0x941, 12}, {0x949, 10}, {0x94D, 12}, {0x94E, 10},
+        {0x950, 7}, {0x951, 12}, {0x958, 7}, {0x962, 12}, {0x964, 21}, {0x966, 13},
+        {0x970, 21}, {0x971, 6}, {0x972, 7}, {0x981, 12}, {0x982, 10}, {0x984, 2},
+        {0x985, 7}, {0x98D, 2}, {0x98F, 7}, {0x991, 2}, {0x993, 7}, {0x9A9, 2},
+        {0x9AA, 7}, {0x9B1, 2}, {0x9B2, 7}, {0x9B3, 2}, {0x9B6, 7}, {0x9BA, 2},
+        {0x9BC, 12}, {0x9BD, 7}, {0x9BE, 10}, {0x9C1, 12}, {0x9C5, 2}, {0x9C7, 10},
+        {0x9C9, 2}, {0x9CB, 10}, {0x9CD, 12}, {0x9CE, 7}, {0x9CF, 2}, {0x9D7, 10},
+        {0x9D8, 2}, {0x9DC, 7}, {0x9DE, 2}, {0x9DF, 7}, {0x9E2, 12}, {0x9E4, 2},
+        {0x9E6, 13}, {0x9F0, 7}, {0x9F2, 23}, {0x9F4, 15}, {0x9FA, 26}, {0x9FB, 23},
+        {0x9FC, 7}, {0x9FD, 21}, {0x9FE, 12}, {0x9FF, 2}, {0xA01, 12}, {0xA03, 10},
+        {0xA04, 2}, {0xA05, 7}, {0xA0B, 2}, {0xA0F, 7}, {0xA11, 2}, {0xA13, 7},
+        {0xA29, 2}, {0xA2A, 7}, {0xA31, 2}, {0xA32, 7}, {0xA34, 2}, {0xA35, 7},
+        {0xA37, 2}, {0xA38, 7}, {0xA3A, 2}, {0xA3C, 12}, {0xA3D, 2}, {0xA3E, 10},
+        {0xA41, 12}, {0xA43, 2}, {0xA47, 12}, {0xA49, 2}, {0xA4B, 12}, {0xA4E, 2},
+        {0xA51, 12}, {0xA52, 2}, {0xA59, 7}, {0xA5D, 2}, {0xA5E, 7}, {0xA5F, 2},
+        {0xA66, 13}, {0xA70, 12}, {0xA72, 7}, {0xA75, 12}, {0xA76, 21}, {0xA77, 2},
+        {0xA81, 12}, {0xA83, 10}, {0xA84, 2}, {0xA85, 7}, {0xA8E, 2}, {0xA8F, 7},
+        {0xA92, 2}, {0xA93, 7}, {0xAA9, 2}, {0xAAA, 7}, {0xAB1, 2}, {0xAB2, 7},
+        {0xAB4, 2}, {0xAB5, 7}, {0xABA, 2}, {0xABC, 12}, {0xABD, 7}, {0xABE, 10},
+        {0xAC1, 12}, {0xAC6, 2}, {0xAC7, 12}, {0xAC9, 10}, {0xACA, 2}, {0xACB, 10},
+        {0xACD, 12}, {0xACE, 2}, {0xAD0, 7}, {0xAD1, 2}, {0xAE0, 7}, {0xAE2, 12},
+        {0xAE4, 2}, {0xAE6, 13}, {0xAF0, 21}, {0xAF1, 23}, {0xAF2, 2}, {0xAF9, 7},
+        {0xAFA, 12}, {0xB00, 2}, {0xB01, 12}, {0xB02, 10}, {0xB04, 2}, {0xB05, 7},
+        {0xB0D, 2}, {0xB0F, 7}, {0xB11, 2}, {0xB13, 7}, {0xB29, 2}, {0xB2A, 7},
+        {0xB31, 2}, {0xB32, 7}, {0xB34, 2}, {0xB35, 7}, {0xB3A, 2}, {0xB3C, 12},
+        {0xB3D, 7}, {0xB3E, 10}, {0xB3F, 12}, {0xB40, 10}, {0xB41, 12}, {0xB45, 2},
+        {0xB47, 10}, {0xB49, 2}, {0xB4B, 10}, {0xB4D, 12}, {0xB4E, 2}, {0xB55, 12},
+        {0xB57, 10}, {0xB58, 2}, {0xB5C, 7}, {0xB5E, 2}, {0xB5F, 7}, {0xB62, 12},
+        {0xB64, 2}, {0xB66, 13}, {0xB70, 26}, {0xB71, 7}, {0xB72, 15}, {0xB78, 2},
+        {0xB82, 12}, {0xB83, 7}, {0xB84, 2}, {0xB85, 7}, {0xB8B, 2}, {0xB8E, 7},
+        {0xB91, 2}, {0xB92, 7}, {0xB96, 2}, {0xB99, 7}, {0xB9B, 2}, {0xB9C, 7},
+        {0xB9D, 2}, {0xB9E, 7}, {0xBA0, 2}, {0xBA3, 7}, {0xBA5, 2}, {0xBA8, 7},
+        {0xBAB, 2}, {0xBAE, 7}, {0xBBA, 2}, {0xBBE, 10}, {0xBC0, 12}, {0xBC1, 10},
+        {0xBC3, 2}, {0xBC6, 10}, {0xBC9, 2}, {0xBCA, 10}, {0xBCD, 12}, {0xBCE, 2},
+        {0xBD0, 7}, {0xBD1, 2}, {0xBD7, 10}, {0xBD8, 2}, {0xBE6, 13}, {0xBF0, 15},
+        {0xBF3, 26}, {0xBF9, 23}, {0xBFA, 26}, {0xBFB, 2}, {0xC00, 12}, {0xC01, 10},
+        {0xC04, 12}, {0xC05, 7}, {0xC0D, 2}, {0xC0E, 7}, {0xC11, 2}, {0xC12, 7},
+        {0xC29, 2}, {0xC2A, 7}, {0xC3A, 2}, {0xC3C, 12}, {0xC3D, 7}, {0xC3E, 12},
+        {0xC41, 10}, {0xC45, 2}, {0xC46, 12}, {0xC49, 2}, {0xC4A, 12}, {0xC4E, 2},
+        {0xC55, 12}, {0xC57, 2}, {0xC58, 7}, {0xC5B, 2}, {0xC5D, 7}, {0xC5E, 2},
+        {0xC60, 7}, {0xC62, 12}, {0xC64, 2}, {0xC66, 13}, {0xC70, 2}, {0xC77, 21},
+        {0xC78, 15}, {0xC7F, 26}, {0xC80, 7}, {0xC81, 12}, {0xC82, 10}, {0xC84, 21},
+        {0xC85, 7}, {0xC8D, 2}, {0xC8E, 7}, {0xC91, 2}, {0xC92, 7}, {0xCA9, 2},
+        {0xCAA, 7}, {0xCB4, 2}, {0xCB5, 7}, {0xCBA, 2}, {0xCBC, 12}, {0xCBD, 7},
+        {0xCBE, 10}, {0xCBF, 12}, {0xCC0, 10}, {0xCC5, 2}, {0xCC6, 12}, {0xCC7, 10},
+        {0xCC9, 2}, {0xCCA, 10}, {0xCCC, 12}, {0xCCE, 2}, {0xCD5, 10}, {0xCD7, 2},
+        {0xCDD, 7}, {0xCDF, 2}, {0xCE0, 7}, {0xCE2, 12}, {0xCE4, 2}, {0xCE6, 13},
+        {0xCF0, 2}, {0xCF1, 7}, {0xCF3, 2}, {0xD00, 12}, {0xD02, 10}, {0xD04, 7},
+        {0xD0D, 2}, {0xD0E, 7}, {0xD11, 2}, {0xD12, 7}, {0xD3B, 12}, {0xD3D, 7},
+        {0xD3E, 10}, {0xD41, 12}, {0xD45, 2}, {0xD46, 10}, {0xD49, 2}, {0xD4A, 10},
+        {0xD4D, 12}, {0xD4E, 7}, {0xD4F, 26}, {0xD50, 2}, {0xD54, 7}, {0xD57, 10},
+        {0xD58, 15}, {0xD5F, 7}, {0xD62, 12}, {0xD64, 2}, {0xD66, 13}, {0xD70, 15},
+        {0xD79, 26}, {0xD7A, 7}, {0xD80, 2}, {0xD81, 12}, {0xD82, 10}, {0xD84, 2},
+        {0xD85, 7}, {0xD97, 2}, {0xD9A, 7}, {0xDB2, 2}, {0xDB3, 7}, {0xDBC, 2},
+        {0xDBD, 7}, {0xDBE, 2}, {0xDC0, 7}, {0xDC7, 2}, {0xDCA, 12}, {0xDCB, 2},
+        {0xDCF, 10}, {0xDD2, 12}, {0xDD5, 2}, {0xDD6, 12}, {0xDD7, 2}, {0xDD8, 10},
+        {0xDE0, 2}, {0xDE6, 13}, {0xDF0, 2}, {0xDF2, 10}, {0xDF4, 21}, {0xDF5, 2},
+        {0xE01, 7}, {0xE31, 12}, {0xE32, 7}, {0xE34, 12}, {0xE3B, 2}, {0xE3F, 23},
+        {0xE40, 7}, {0xE46, 6}, {0xE47, 12}, {0xE4F, 21}, {0xE50, 13}, {0xE5A, 21},
+        {0xE5C, 2}, {0xE81, 7}, {0xE83, 2}, {0xE84, 7}, {0xE85, 2}, {0xE86, 7},
+        {0xE8B, 2}, {0xE8C, 7}, {0xEA4, 2}, {0xEA5, 7}, {0xEA6, 2}, {0xEA7, 7},
+        {0xEB1, 12}, {0xEB2, 7}, {0xEB4, 12}, {0xEBD, 7}, {0xEBE, 2}, {0xEC0, 7},
+        {0xEC5, 2}, {0xEC6, 6}, {0xEC7, 2}, {0xEC8, 12}, {0xECE, 2}, {0xED0, 13},
+        {0xEDA, 2}, {0xEDC, 7}, {0xEE0, 2}, {0xF00, 7}, {0xF01, 26}, {0xF04, 21},
+        {0xF13, 26}, {0xF14, 21}, {0xF15, 26}, {0xF18, 12}, {0xF1A, 26}, {0xF20, 13},
+        {0xF2A, 15}, {0xF34, 26}, {0xF35, 12}, {0xF36, 26}, {0xF37, 12}, {0xF38, 26},
+        {0xF39, 12}, {0xF3A, 22}, {0xF3B, 18}, {0xF3C, 22}, {0xF3D, 18}, {0xF3E, 10},
+        {0xF40, 7}, {0xF48, 2}, {0xF49, 7}, {0xF6D, 2}, {0xF71, 12}, {0xF7F, 10},
+        {0xF80, 12}, {0xF85, 21}, {0xF86, 12}, {0xF88, 7}, {0xF8D, 12}, {0xF98, 2},
+        {0xF99, 12}, {0xFBD, 2}, {0xFBE, 26}, {0xFC6, 12}, {0xFC7, 26}, {0xFCD, 2},
+        {0xFCE, 26}, {0xFD0, 21}, {0xFD5, 26}, {0xFD9, 21}, {0xFDB, 2}, {0x1000, 7},
+        {0x102B, 10}, {0x102D, 12}, {0x1031, 10}, {0x1032, 12}, {0x1038, 10}, {0x1039, 12},
+        {0x103B, 10}, {0x103D, 12}, {0x103F, 7}, {0x1040, 13}, {0x104A, 21}, {0x1050, 7},
+        {0x1056, 10}, {0x1058, 12}, {0x105A, 7}, {0x105E, 12}, {0x1061, 7}, {0x1062, 10},
+        {0x1065, 7}, {0x1067, 10}, {0x106E, 7}, {0x1071, 12}, {0x1075, 7}, {0x1082, 12},
+        {0x1083, 10}, {0x1085, 12}, {0x1087, 10}, {0x108D, 12}, {0x108E, 7}, {0x108F, 10},
+        {0x1090, 13}, {0x109A, 10}, {0x109D, 12}, {0x109E, 26}, {0x10A0, 9}, {0x10C6, 2},
+        {0x10C7, 9}, {0x10C8, 2}, {0x10CD, 9}, {0x10CE, 2}, {0x10D0, 5}, {0x10FB, 21},
+        {0x10FC, 6}, {0x10FD, 5}, {0x1100, 7}, {0x1249, 2}, {0x124A, 7}, {0x124E, 2},
+        {0x1250, 7}, {0x1257, 2}, {0x1258, 7}, {0x1259, 2}, {0x125A, 7}, {0x125E, 2},
+        {0x1260, 7}, {0x1289, 2}, {0x128A, 7}, {0x128E, 2}, {0x1290, 7}, {0x12B1, 2},
+        {0x12B2, 7}, {0x12B6, 2}, {0x12B8, 7}, {0x12BF, 2}, {0x12C0, 7}, {0x12C1, 2},
+        {0x12C2, 7}, {0x12C6, 2}, {0x12C8, 7}, {0x12D7, 2}, {0x12D8, 7}, {0x1311, 2},
+        {0x1312, 7}, {0x1316, 2}, {0x1318, 7}, {0x135B, 2}, {0x135D, 12}, {0x1360, 21},
+        {0x1369, 15}, {0x137D, 2}, {0x1380, 7}, {0x1390, 26}, {0x139A, 2}, {0x13A0, 9},
+        {0x13F6, 2}, {0x13F8, 5}, {0x13FE, 2}, {0x1400, 17}, {0x1401, 7}, {0x166D, 26},
+        {0x166E, 21}, {0x166F, 7}, {0x1680, 29}, {0x1681, 7}, {0x169B, 22}, {0x169C, 18},
+        {0x169D, 2}, {0x16A0, 7}, {0x16EB, 21}, {0x16EE, 14}, {0x16F1, 7}, {0x16F9, 2},
+        {0x1700, 7}, {0x1712, 12}, {0x1715, 10}, {0x1716, 2}, {0x171F, 7}, {0x1732, 12},
+        {0x1734, 10}, {0x1735, 21}, {0x1737, 2}, {0x1740, 7}, {0x1752, 12}, {0x1754, 2},
+        {0x1760, 7}, {0x176D, 2}, {0x176E, 7}, {0x1771, 2}, {0x1772, 12}, {0x1774, 2},
+        {0x1780, 7}, {0x17B4, 12}, {0x17B6, 10}, {0x17B7, 12}, {0x17BE, 10}, {0x17C6, 12},
+        {0x17C7, 10}, {0x17C9, 12}, {0x17D4, 21}, {0x17D7, 6}, {0x17D8, 21}, {0x17DB, 23},
+        {0x17DC, 7}, {0x17DD, 12}, {0x17DE, 2}, {0x17E0, 13}, {0x17EA, 2}, {0x17F0, 15},
+        {0x17FA, 2}, {0x1800, 21}, {0x1806, 17}, {0x1807, 21}, {0x180B, 12}, {0x180E, 1},
+        {0x180F, 12}, {0x1810, 13}, {0x181A, 2}, {0x1820, 7}, {0x1843, 6}, {0x1844, 7},
+        {0x1879, 2}, {0x1880, 7}, {0x1885, 12}, {0x1887, 7}, {0x18A9, 12}, {0x18AA, 7},
+        {0x18AB, 2}, {0x18B0, 7}, {0x18F6, 2}, {0x1900, 7}, {0x191F, 2}, {0x1920, 12},
+        {0x1923, 10}, {0x1927, 12}, {0x1929, 10}, {0x192C, 2}, {0x1930, 10}, {0x1932, 12},
+        {0x1933, 10}, {0x1939, 12}, {0x193C, 2}, {0x1940, 26}, {0x1941, 2}, {0x1944, 21},
+        {0x1946, 13}, {0x1950, 7}, {0x196E, 2}, {0x1970, 7}, {0x1975, 2}, {0x1980, 7},
+        {0x19AC, 2}, {0x19B0, 7}, {0x19CA, 2}, {0x19D0, 13}, {0x19DA, 15}, {0x19DB, 2},
+        {0x19DE, 26}, {0x1A00, 7}, {0x1A17, 12}, {0x1A19, 10}, {0x1A1B, 12}, {0x1A1C, 2},
+        {0x1A1E, 21}, {0x1A20, 7}, {0x1A55, 10}, {0x1A56, 12}, {0x1A57, 10}, {0x1A58, 12},
+        {0x1A5F, 2}, {0x1A60, 12}, {0x1A61, 10}, {0x1A62, 12}, {0x1A63, 10}, {0x1A65, 12},
+        {0x1A6D, 10}, {0x1A73, 12}, {0x1A7D, 2}, {0x1A7F, 12}, {0x1A80, 13}, {0x1A8A, 2},
+        {0x1A90, 13}, {0x1A9A, 2}, {0x1AA0, 21}, {0x1AA7, 6}, {0x1AA8, 21}, {0x1AAE, 2},
+        {0x1AB0, 12}, {0x1ABE, 11}, {0x1ABF, 12}, {0x1ACF, 2}, {0x1B00, 12}, {0x1B04, 10},
+        {0x1B05, 7}, {0x1B34, 12}, {0x1B35, 10}, {0x1B36, 12}, {0x1B3B, 10}, {0x1B3C, 12},
+        {0x1B3D, 10}, {0x1B42, 12}, {0x1B43, 10}, {0x1B45, 7}, {0x1B4D, 2}, {0x1B50, 13},
+        {0x1B5A, 21}, {0x1B61, 26}, {0x1B6B, 12}, {0x1B74, 26}, {0x1B7D, 21}, {0x1B7F, 2},
+        {0x1B80, 12}, {0x1B82, 10}, {0x1B83, 7}, {0x1BA1, 10}, {0x1BA2, 12}, {0x1BA6, 10},
+        {0x1BA8, 12}, {0x1BAA, 10}, {0x1BAB, 12}, {0x1BAE, 7}, {0x1BB0, 13}, {0x1BBA, 7},
+        {0x1BE6, 12}, {0x1BE7, 10}, {0x1BE8, 12}, {0x1BEA, 10}, {0x1BED, 12}, {0x1BEE, 10},
+        {0x1BEF, 12}, {0x1BF2, 10}, {0x1BF4, 2}, {0x1BFC, 21}, {0x1C00, 7}, {0x1C24, 10},
+        {0x1C2C, 12}, {0x1C34, 10}, {0x1C36, 12}, {0x1C38, 2}, {0x1C3B, 21}, {0x1C40, 13},
+        {0x1C4A, 2}, {0x1C4D, 7}, {0x1C50, 13}, {0x1C5A, 7}, {0x1C78, 6}, {0x1C7E, 21},
+        {0x1C80, 5}, {0x1C89, 2}, {0x1C90, 9}, {0x1CBB, 2}, {0x1CBD, 9}, {0x1CC0, 21},
+        {0x1CC8, 2}, {0x1CD0, 12}, {0x1CD3, 21}, {0x1CD4, 12}, {0x1CE1, 10}, {0x1CE2, 12},
+        {0x1CE9, 7}, {0x1CED, 12}, {0x1CEE, 7}, {0x1CF4, 12}, {0x1CF5, 7}, {0x1CF7, 10},
+        {0x1CF8, 12}, {0x1CFA, 7}, {0x1CFB, 2}, {0x1D00, 5}, {0x1D2C, 6}, {0x1D6B, 5},
+        {0x1D78, 6}, {0x1D79, 5}, {0x1D9B, 6}, {0x1DC0, 12}, {0x1E00, 9}, {0x1E01, 5},
+        {0x1E02, 9}, {0x1E03, 5}, {0x1E04, 9}, {0x1E05, 5}, {0x1E06, 9}, {0x1E07, 5},
+        {0x1E08, 9}, {0x1E09, 5}, {0x1E0A, 9}, {0x1E0B, 5}, {0x1E0C, 9}, {0x1E0D, 5},
+        {0x1E0E, 9}, {0x1E0F, 5}, {0x1E10, 9}, {0x1E11, 5}, {0x1E12, 9}, {0x1E13, 5},
+        {0x1E14, 9}, {0x1E15, 5}, {0x1E16, 9}, {0x1E17, 5}, {0x1E18, 9}, {0x1E19, 5},
+        {0x1E1A, 9}, {0x1E1B, 5}, {0x1E1C, 9}, {0x1E1D, 5}, {0x1E1E, 9}, {0x1E1F, 5},
+        {0x1E20, 9}, {0x1E21, 5}, {0x1E22, 9}, {0x1E23, 5}, {0x1E24, 9}, {0x1E25, 5},
+        {0x1E26, 9}, {0x1E27, 5}, {0x1E28, 9}, {0x1E29, 5}, {0x1E2A, 9}, {0x1E2B, 5},
+        {0x1E2C, 9}, {0x1E2D, 5}, {0x1E2E, 9}, {0x1E2F, 5}, {0x1E30, 9}, {0x1E31, 5},
+        {0x1E32, 9}, {0x1E33, 5}, {0x1E34, 9}, {0x1E35, 5}, {0x1E36, 9}, {0x1E37, 5},
+        {0x1E38, 9}, {0x1E39, 5}, {0x1E3A, 9}, {0x1E3B, 5}, {0x1E3C, 9}, {0x1E3D, 5},
+        {0x1E3E, 9}, {0x1E3F, 5}, {0x1E40, 9}, {0x1E41, 5}, {0x1E42, 9}, {0x1E43, 5},
+        {0x1E44, 9}, {0x1E45, 5}, {0x1E46, 9}, {0x1E47, 5}, {0x1E48, 9}, {0x1E49, 5},
+        {0x1E4A, 9}, {0x1E4B, 5}, {0x1E4C, 9}, {0x1E4D, 5}, {0x1E4E, 9}, {0x1E4F, 5},
+        {0x1E50, 9}, {0x1E51, 5}, {0x1E52, 9}, {0x1E53, 5}, {0x1E54, 9}, {0x1E55, 5},
+        {0x1E56, 9}, {0x1E57, 5}, {0x1E58, 9}, {0x1E59, 5}, {0x1E5A, 9}, {0x1E5B, 5},
+        {0x1E5C, 9}, {0x1E5D, 5}, {0x1E5E, 9}, {0x1E5F, 5}, {0x1E60, 9}, {0x1E61, 5},
+        {0x1E62, 9}, {0x1E63, 5}, {0x1E64, 9}, {0x1E65, 5}, {0x1E66, 9}, {0x1E67, 5},
+        {0x1E68, 9}, {0x1E69, 5}, {0x1E6A, 9}, {0x1E6B, 5}, {0x1E6C, 9}, {0x1E6D, 5},
+        {0x1E6E, 9}, {0x1E6F, 5}, {0x1E70, 9}, {0x1E71, 5}, {0x1E72, 9}, {0x1E73, 5},
+        {0x1E74, 9}, {0x1E75, 5}, {0x1E76, 9}, {0x1E77, 5}, {0x1E78, 9}, {0x1E79, 5},
+        {0x1E7A, 9}, {0x1E7B, 5}, {0x1E7C, 9}, {0x1E7D, 5}, {0x1E7E, 9}, {0x1E7F, 5},
+        {0x1E80, 9}, {0x1E81, 5}, {0x1E82, 9}, {0x1E83, 5}, {0x1E84, 9}, {0x1E85, 5},
+        {0x1E86, 9}, {0x1E87, 5}, {0x1E88, 9}, {0x1E89, 5}, {0x1E8A, 9}, {0x1E8B, 5},
+        {0x1E8C, 9}, {0x1E8D, 5}, {0x1E8E, 9}, {0x1E8F, 5}, {0x1E90, 9}, {0x1E91, 5},
+        {0x1E92, 9}, {0x1E93, 5}, {0x1E94, 9}, {0x1E95, 5}, {0x1E9E, 9}, {0x1E9F, 5},
+        {0x1EA0, 9}, {0x1EA1, 5}, {0x1EA2, 9}, {0x1EA3, 5}, {0x1EA4, 9}, {0x1EA5, 5},
+        {0x1EA6, 9}, {0x1EA7, 5}, {0x1EA8, 9}, {0x1EA9, 5}, {0x1EAA, 9}, {0x1EAB, 5},
+        {0x1EAC, 9}, {0x1EAD, 5}, {0x1EAE, 9}, {0x1EAF, 5}, {0x1EB0, 9}, {0x1EB1, 5},
+        {0x1EB2, 9}, {0x1EB3, 5}, {0x1EB4, 9}, {0x1EB5, 5}, {0x1EB6, 9}, {0x1EB7, 5},
+        {0x1EB8, 9}, {0x1EB9, 5}, {0x1EBA, 9}, {0x1EBB, 5}, {0x1EBC, 9}, {0x1EBD, 5},
+        {0x1EBE, 9}, {0x1EBF, 5}, {0x1EC0, 9}, {0x1EC1, 5}, {0x1EC2, 9}, {0x1EC3, 5},
+        {0x1EC4, 9}, {0x1EC5, 5}, {0x1EC6, 9}, {0x1EC7, 5}, {0x1EC8, 9}, {0x1EC9, 5},
+        {0x1ECA, 9}, {0x1ECB, 5}, {0x1ECC, 9}, {0x1ECD, 5}, {0x1ECE, 9}, {0x1ECF, 5},
+        {0x1ED0, 9}, {0x1ED1, 5}, {0x1ED2, 9}, {0x1ED3, 5}, {0x1ED4, 9}, {0x1ED5, 5},
+        {0x1ED6, 9}, {0x1ED7, 5}, {0x1ED8, 9}, {0x1ED9, 5}, {0x1EDA, 9}, {0x1EDB, 5},
+        {0x1EDC, 9}, {0x1EDD, 5}, {0x1EDE, 9}, {0x1EDF, 5}, {0x1EE0, 9}, {0x1EE1, 5},
+        {0x1EE2, 9}, {0x1EE3, 5}, {0x1EE4, 9}, {0x1EE5, 5}, {0x1EE6, 9}, {0x1EE7, 5},
+        {0x1EE8, 9}, {0x1EE9, 5}, {0x1EEA, 9}, {0x1EEB, 5}, {0x1EEC, 9}, {0x1EED, 5},
+        {0x1EEE, 9}, {0x1EEF, 5}, {0x1EF0, 9}, {0x1EF1, 5}, {0x1EF2, 9}, {0x1EF3, 5},
+        {0x1EF4, 9}, {0x1EF5, 5}, {0x1EF6, 9}, {0x1EF7, 5}, {0x1EF8, 9}, {0x1EF9, 5},
+        {0x1EFA, 9}, {0x1EFB, 5}, {0x1EFC, 9}, {0x1EFD, 5}, {0x1EFE, 9}, {0x1EFF, 5},
+        {0x1F08, 9}, {0x1F10, 5}, {0x1F16, 2}, {0x1F18, 9}, {0x1F1E, 2}, {0x1F20, 5},
+        {0x1F28, 9}, {0x1F30, 5}, {0x1F38, 9}, {0x1F40, 5}, {0x1F46, 2}, {0x1F48, 9},
+        {0x1F4E, 2}, {0x1F50, 5}, {0x1F58, 2}, {0x1F59, 9}, {0x1F5A, 2}, {0x1F5B, 9},
+        {0x1F5C, 2}, {0x1F5D, 9}, {0x1F5E, 2}, {0x1F5F, 9}, {0x1F60, 5}, {0x1F68, 9},
+        {0x1F70, 5}, {0x1F7E, 2}, {0x1F80, 5}, {0x1F88, 8}, {0x1F90, 5}, {0x1F98, 8},
+        {0x1FA0, 5}, {0x1FA8, 8}, {0x1FB0, 5}, {0x1FB5, 2}, {0x1FB6, 5}, {0x1FB8, 9},
+        {0x1FBC, 8}, {0x1FBD, 24}, {0x1FBE, 5}, {0x1FBF, 24}, {0x1FC2, 5}, {0x1FC5, 2},
+        {0x1FC6, 5}, {0x1FC8, 9}, {0x1FCC, 8}, {0x1FCD, 24}, {0x1FD0, 5}, {0x1FD4, 2},
+        {0x1FD6, 5}, {0x1FD8, 9}, {0x1FDC, 2}, {0x1FDD, 24}, {0x1FE0, 5}, {0x1FE8, 9},
+        {0x1FED, 24}, {0x1FF0, 2}, {0x1FF2, 5}, {0x1FF5, 2}, {0x1FF6, 5}, {0x1FF8, 9},
+        {0x1FFC, 8}, {0x1FFD, 24}, {0x1FFF, 2}, {0x2000, 29}, {0x200B, 1}, {0x2010, 17},
+        {0x2016, 21}, {0x2018, 20}, {0x2019, 19}, {0x201A, 22}, {0x201B, 20}, {0x201D, 19},
+        {0x201E, 22}, {0x201F, 20}, {0x2020, 21}, {0x2028, 27}, {0x2029, 28}, {0x202A, 1},
+        {0x202F, 29}, {0x2030, 21}, {0x2039, 20}, {0x203A, 19}, {0x203B, 21}, {0x203F, 16},
+        {0x2041, 21}, {0x2044, 25}, {0x2045, 22}, {0x2046, 18}, {0x2047, 21}, {0x2052, 25},
+        {0x2053, 21}, {0x2054, 16}, {0x2055, 21}, {0x205F, 29}, {0x2060, 1}, {0x2065, 2},
+        {0x2066, 1}, {0x2070, 15}, {0x2071, 6}, {0x2072, 2}, {0x2074, 15}, {0x207A, 25},
+        {0x207D, 22}, {0x207E, 18}, {0x207F, 6}, {0x2080, 15}, {0x208A, 25}, {0x208D, 22},
+        {0x208E, 18}, {0x208F, 2}, {0x2090, 6}, {0x209D, 2}, {0x20A0, 23}, {0x20C1, 2},
+        {0x20D0, 12}, {0x20DD, 11}, {0x20E1, 12}, {0x20E2, 11}, {0x20E5, 12}, {0x20F1, 2},
+        {0x2100, 26}, {0x2102, 9}, {0x2103, 26}, {0x2107, 9}, {0x2108, 26}, {0x210A, 5},
+        {0x210B, 9}, {0x210E, 5}, {0x2110, 9}, {0x2113, 5}, {0x2114, 26}, {0x2115, 9},
+        {0x2116, 26}, {0x2118, 25}, {0x2119, 9}, {0x211E, 26}, {0x2124, 9}, {0x2125, 26},
+        {0x2126, 9}, {0x2127, 26}, {0x2128, 9}, {0x2129, 26}, {0x212A, 9}, {0x212E, 26},
+        {0x212F, 5}, {0x2130, 9}, {0x2134, 5}, {0x2135, 7}, {0x2139, 5}, {0x213A, 26},
+        {0x213C, 5}, {0x213E, 9}, {0x2140, 25}, {0x2145, 9}, {0x2146, 5}, {0x214A, 26},
+        {0x214B, 25}, {0x214C, 26}, {0x214E, 5}, {0x214F, 26}, {0x2150, 15}, {0x2160, 14},
+        {0x2183, 9}, {0x2184, 5}, {0x2185, 14}, {0x2189, 15}, {0x218A, 26}, {0x218C, 2},
+        {0x2190, 25}, {0x2195, 26}, {0x219A, 25}, {0x219C, 26}, {0x21A0, 25}, {0x21A1, 26},
+        {0x21A3, 25}, {0x21A4, 26}, {0x21A6, 25}, {0x21A7, 26}, {0x21AE, 25}, {0x21AF, 26},
+        {0x21CE, 25}, {0x21D0, 26}, {0x21D2, 25}, {0x21D3, 26}, {0x21D4, 25}, {0x21D5, 26},
+        {0x21F4, 25}, {0x2300, 26}, {0x2308, 22}, {0x2309, 18}, {0x230A, 22}, {0x230B, 18},
+        {0x230C, 26}, {0x2320, 25}, {0x2322, 26}, {0x2329, 22}, {0x232A, 18}, {0x232B, 26},
+        {0x237C, 25}, {0x237D, 26}, {0x239B, 25}, {0x23B4, 26}, {0x23DC, 25}, {0x23E2, 26},
+        {0x2427, 2}, {0x2440, 26}, {0x244B, 2}, {0x2460, 15}, {0x249C, 26}, {0x24EA, 15},
+        {0x2500, 26}, {0x25B7, 25}, {0x25B8, 26}, {0x25C1, 25}, {0x25C2, 26}, {0x25F8, 25},
+        {0x2600, 26}, {0x266F, 25}, {0x2670, 26}, {0x2768, 22}, {0x2769, 18}, {0x276A, 22},
+        {0x276B, 18}, {0x276C, 22}, {0x276D, 18}, {0x276E, 22}, {0x276F, 18}, {0x2770, 22},
+        {0x2771, 18}, {0x2772, 22}, {0x2773, 18}, {0x2774, 22}, {0x2775, 18}, {0x2776, 15},
+        {0x2794, 26}, {0x27C0, 25}, {0x27C5, 22}, {0x27C6, 18}, {0x27C7, 25}, {0x27E6, 22},
+        {0x27E7, 18}, {0x27E8, 22}, {0x27E9, 18}, {0x27EA, 22}, {0x27EB, 18}, {0x27EC, 22},
+        {0x27ED, 18}, {0x27EE, 22}, {0x27EF, 18}, {0x27F0, 25}, {0x2800, 26}, {0x2900, 25},
+        {0x2983, 22}, {0x2984, 18}, {0x2985, 22}, {0x2986, 18}, {0x2987, 22}, {0x2988, 18},
+        {0x2989, 22}, {0x298A, 18}, {0x298B, 22}, {0x298C, 18}, {0x298D, 22}, {0x298E, 18},
+        {0x298F, 22}, {0x2990, 18}, {0x2991, 22}, {0x2992, 18}, {0x2993, 22}, {0x2994, 18},
+        {0x2995, 22}, {0x2996, 18}, {0x2997, 22}, {0x2998, 18}, {0x2999, 25}, {0x29D8, 22},
+        {0x29D9, 18}, {0x29DA, 22}, {0x29DB, 18}, {0x29DC, 25}, {0x29FC, 22}, {0x29FD, 18},
+        {0x29FE, 25}, {0x2B00, 26}, {0x2B30, 25}, {0x2B45, 26}, {0x2B47, 25}, {0x2B4D, 26},
+        {0x2B74, 2}, {0x2B76, 26}, {0x2B96, 2}, {0x2B97, 26}, {0x2C00, 9}, {0x2C30, 5},
+        {0x2C60, 9}, {0x2C61, 5}, {0x2C62, 9}, {0x2C65, 5}, {0x2C67, 9}, {0x2C68, 5},
+        {0x2C69, 9}, {0x2C6A, 5}, {0x2C6B, 9}, {0x2C6C, 5}, {0x2C6D, 9}, {0x2C71, 5},
+        {0x2C72, 9}, {0x2C73, 5}, {0x2C75, 9}, {0x2C76, 5}, {0x2C7C, 6}, {0x2C7E, 9},
+        {0x2C81, 5}, {0x2C82, 9}, {0x2C83, 5}, {0x2C84, 9}, {0x2C85, 5}, {0x2C86, 9},
+        {0x2C87, 5}, {0x2C88, 9}, {0x2C89, 5}, {0x2C8A, 9}, {0x2C8B, 5}, {0x2C8C, 9},
+        {0x2C8D, 5}, {0x2C8E, 9}, {0x2C8F, 5}, {0x2C90, 9}, {0x2C91, 5}, {0x2C92, 9},
+        {0x2C93, 5}, {0x2C94, 9}, {0x2C95, 5}, {0x2C96, 9}, {0x2C97, 5}, {0x2C98, 9},
+        {0x2C99, 5}, {0x2C9A, 9}, {0x2C9B, 5}, {0x2C9C, 9}, {0x2C9D, 5}, {0x2C9E, 9},
+        {0x2C9F, 5}, {0x2CA0, 9}, {0x2CA1, 5}, {0x2CA2, 9}, {0x2CA3, 5}, {0x2CA4, 9},
+        {0x2CA5, 5}, {0x2CA6, 9}, {0x2CA7, 5}, {0x2CA8, 9}, {0x2CA9, 5}, {0x2CAA, 9},
+        {0x2CAB, 5}, {0x2CAC, 9}, {0x2CAD, 5}, {0x2CAE, 9}, {0x2CAF, 5}, {0x2CB0, 9},
+        {0x2CB1, 5}, {0x2CB2, 9}, {0x2CB3, 5}, {0x2CB4, 9}, {0x2CB5, 5}, {0x2CB6, 9},
+        {0x2CB7, 5}, {0x2CB8, 9}, {0x2CB9, 5}, {0x2CBA, 9}, {0x2CBB, 5}, {0x2CBC, 9},
+        {0x2CBD, 5}, {0x2CBE, 9}, {0x2CBF, 5}, {0x2CC0, 9}, {0x2CC1, 5}, {0x2CC2, 9},
+        {0x2CC3, 5}, {0x2CC4, 9}, {0x2CC5, 5}, {0x2CC6, 9}, {0x2CC7, 5}, {0x2CC8, 9},
+        {0x2CC9, 5}, {0x2CCA, 9}, {0x2CCB, 5}, {0x2CCC, 9}, {0x2CCD, 5}, {0x2CCE, 9},
+        {0x2CCF, 5}, {0x2CD0, 9}, {0x2CD1, 5}, {0x2CD2, 9}, {0x2CD3, 5}, {0x2CD4, 9},
+        {0x2CD5, 5}, {0x2CD6, 9}, {0x2CD7, 5}, {0x2CD8, 9}, {0x2CD9, 5}, {0x2CDA, 9},
+        {0x2CDB, 5}, {0x2CDC, 9}, {0x2CDD, 5}, {0x2CDE, 9}, {0x2CDF, 5}, {0x2CE0, 9},
+        {0x2CE1, 5}, {0x2CE2, 9}, {0x2CE3, 5}, {0x2CE5, 26}, {0x2CEB, 9}, {0x2CEC, 5},
+        {0x2CED, 9}, {0x2CEE, 5}, {0x2CEF, 12}, {0x2CF2, 9}, {0x2CF3, 5}, {0x2CF4, 2},
+        {0x2CF9, 21}, {0x2CFD, 15}, {0x2CFE, 21}, {0x2D00, 5}, {0x2D26, 2}, {0x2D27, 5},
+        {0x2D28, 2}, {0x2D2D, 5}, {0x2D2E, 2}, {0x2D30, 7}, {0x2D68, 2}, {0x2D6F, 6},
+        {0x2D70, 21}, {0x2D71, 2}, {0x2D7F, 12}, {0x2D80, 7}, {0x2D97, 2}, {0x2DA0, 7},
+        {0x2DA7, 2}, {0x2DA8, 7}, {0x2DAF, 2}, {0x2DB0, 7}, {0x2DB7, 2}, {0x2DB8, 7},
+        {0x2DBF, 2}, {0x2DC0, 7}, {0x2DC7, 2}, {0x2DC8, 7}, {0x2DCF, 2}, {0x2DD0, 7},
+        {0x2DD7, 2}, {0x2DD8, 7}, {0x2DDF, 2}, {0x2DE0, 12}, {0x2E00, 21}, {0x2E02, 20},
+        {0x2E03, 19}, {0x2E04, 20}, {0x2E05, 19}, {0x2E06, 21}, {0x2E09, 20}, {0x2E0A, 19},
+        {0x2E0B, 21}, {0x2E0C, 20}, {0x2E0D, 19}, {0x2E0E, 21}, {0x2E17, 17}, {0x2E18, 21},
+        {0x2E1A, 17}, {0x2E1B, 21}, {0x2E1C, 20}, {0x2E1D, 19}, {0x2E1E, 21}, {0x2E20, 20},
+        {0x2E21, 19}, {0x2E22, 22}, {0x2E23, 18}, {0x2E24, 22}, {0x2E25, 18}, {0x2E26, 22},
+        {0x2E27, 18}, {0x2E28, 22}, {0x2E29, 18}, {0x2E2A, 21}, {0x2E2F, 6}, {0x2E30, 21},
+        {0x2E3A, 17}, {0x2E3C, 21}, {0x2E40, 17}, {0x2E41, 21}, {0x2E42, 22}, {0x2E43, 21},
+        {0x2E50, 26}, {0x2E52, 21}, {0x2E55, 22}, {0x2E56, 18}, {0x2E57, 22}, {0x2E58, 18},
+        {0x2E59, 22}, {0x2E5A, 18}, {0x2E5B, 22}, {0x2E5C, 18}, {0x2E5D, 17}, {0x2E5E, 2},
+        {0x2E80, 26}, {0x2E9A, 2}, {0x2E9B, 26}, {0x2EF4, 2}, {0x2F00, 26}, {0x2FD6, 2},
+        {0x2FF0, 26}, {0x2FFC, 2}, {0x3000, 29}, {0x3001, 21}, {0x3004, 26}, {0x3005, 6},
+        {0x3006, 7}, {0x3007, 14}, {0x3008, 22}, {0x3009, 18}, {0x300A, 22}, {0x300B, 18},
+        {0x300C, 22}, {0x300D, 18}, {0x300E, 22}, {0x300F, 18}, {0x3010, 22}, {0x3011, 18},
+        {0x3012, 26}, {0x3014, 22}, {0x3015, 18}, {0x3016, 22}, {0x3017, 18}, {0x3018, 22},
+        {0x3019, 18}, {0x301A, 22}, {0x301B, 18}, {0x301C, 17}, {0x301D, 22}, {0x301E, 18},
+        {0x3020, 26}, {0x3021, 14}, {0x302A, 12}, {0x302E, 10}, {0x3030, 17}, {0x3031, 6},
+        {0x3036, 26}, {0x3038, 14}, {0x303B, 6}, {0x303C, 7}, {0x303D, 21}, {0x303E, 26},
+        {0x3040, 2}, {0x3041, 7}, {0x3097, 2}, {0x3099, 12}, {0x309B, 24}, {0x309D, 6},
+        {0x309F, 7}, {0x30A0, 17}, {0x30A1, 7}, {0x30FB, 21}, {0x30FC, 6}, {0x30FF, 7},
+        {0x3100, 2}, {0x3105, 7}, {0x3130, 2}, {0x3131, 7}, {0x318F, 2}, {0x3190, 26},
+        {0x3192, 15}, {0x3196, 26}, {0x31A0, 7}, {0x31C0, 26}, {0x31E4, 2}, {0x31F0, 7},
+        {0x3200, 26}, {0x321F, 2}, {0x3220, 15}, {0x322A, 26}, {0x3248, 15}, {0x3250, 26},
+        {0x3251, 15}, {0x3260, 26}, {0x3280, 15}, {0x328A, 26}, {0x32B1, 15}, {0x32C0, 26},
+        {0x3400, 7}, {0x4DC0, 26}, {0x4E00, 7}, {0xA015, 6}, {0xA016, 7}, {0xA48D, 2},
+        {0xA490, 26}, {0xA4C7, 2}, {0xA4D0, 7}, {0xA4F8, 6}, {0xA4FE, 21}, {0xA500, 7},
+        {0xA60C, 6}, {0xA60D, 21}, {0xA610, 7}, {0xA620, 13}, {0xA62A, 7}, {0xA62C, 2},
+        {0xA640, 9}, {0xA641, 5}, {0xA642, 9}, {0xA643, 5}, {0xA644, 9}, {0xA645, 5},
+        {0xA646, 9}, {0xA647, 5}, {0xA648, 9}, {0xA649, 5}, {0xA64A, 9}, {0xA64B, 5},
+        {0xA64C, 9}, {0xA64D, 5}, {0xA64E, 9}, {0xA64F, 5}, {0xA650, 9}, {0xA651, 5},
+        {0xA652, 9}, {0xA653, 5}, {0xA654, 9}, {0xA655, 5}, {0xA656, 9}, {0xA657, 5},
+        {0xA658, 9}, {0xA659, 5}, {0xA65A, 9}, {0xA65B, 5}, {0xA65C, 9}, {0xA65D, 5},
+        {0xA65E, 9}, {0xA65F, 5}, {0xA660, 9}, {0xA661, 5}, {0xA662, 9}, {0xA663, 5},
+        {0xA664, 9}, {0xA665, 5}, {0xA666, 9}, {0xA667, 5}, {0xA668, 9}, {0xA669, 5},
+        {0xA66A, 9}, {0xA66B, 5}, {0xA66C, 9}, {0xA66D, 5}, {0xA66E, 7}, {0xA66F, 12},
+        {0xA670, 11}, {0xA673, 21}, {0xA674, 12}, {0xA67E, 21}, {0xA67F, 6}, {0xA680, 9},
+        {0xA681, 5}, {0xA682, 9}, {0xA683, 5}, {0xA684, 9}, {0xA685, 5}, {0xA686, 9},
+        {0xA687, 5}, {0xA688, 9}, {0xA689, 5}, {0xA68A, 9}, {0xA68B, 5}, {0xA68C, 9},
+        {0xA68D, 5}, {0xA68E, 9}, {0xA68F, 5}, {0xA690, 9}, {0xA691, 5}, {0xA692, 9},
+        {0xA693, 5}, {0xA694, 9}, {0xA695, 5}, {0xA696, 9}, {0xA697, 5}, {0xA698, 9},
+        {0xA699, 5}, {0xA69A, 9}, {0xA69B, 5}, {0xA69C, 6}, {0xA69E, 12}, {0xA6A0, 7},
+        {0xA6E6, 14}, {0xA6F0, 12}, {0xA6F2, 21}, {0xA6F8, 2}, {0xA700, 24}, {0xA717, 6},
+        {0xA720, 24}, {0xA722, 9}, {0xA723, 5}, {0xA724, 9}, {0xA725, 5}, {0xA726, 9},
+        {0xA727, 5}, {0xA728, 9}, {0xA729, 5}, {0xA72A, 9}, {0xA72B, 5}, {0xA72C, 9},
+        {0xA72D, 5}, {0xA72E, 9}, {0xA72F, 5}, {0xA732, 9}, {0xA733, 5}, {0xA734, 9},
+        {0xA735, 5}, {0xA736, 9}, {0xA737, 5}, {0xA738, 9}, {0xA739, 5}, {0xA73A, 9},
+        {0xA73B, 5}, {0xA73C, 9}, {0xA73D, 5}, {0xA73E, 9}, {0xA73F, 5}, {0xA740, 9},
+        {0xA741, 5}, {0xA742, 9}, {0xA743, 5}, {0xA744, 9}, {0xA745, 5}, {0xA746, 9},
+        {0xA747, 5}, {0xA748, 9}, {0xA749, 5}, {0xA74A, 9}, {0xA74B, 5}, {0xA74C, 9},
+        {0xA74D, 5}, {0xA74E, 9}, {0xA74F, 5}, {0xA750, 9}, {0xA751, 5}, {0xA752, 9},
+        {0xA753, 5}, {0xA754, 9}, {0xA755, 5}, {0xA756, 9}, {0xA757, 5}, {0xA758, 9},
+        {0xA759, 5}, {0xA75A, 9}, {0xA75B, 5}, {0xA75C, 9}, {0xA75D, 5}, {0xA75E, 9},
+        {0xA75F, 5}, {0xA760, 9}, {0xA761, 5}, {0xA762, 9}, {0xA763, 5}, {0xA764, 9},
+        {0xA765, 5}, {0xA766, 9}, {0xA767, 5}, {0xA768, 9}, {0xA769, 5}, {0xA76A, 9},
+        {0xA76B, 5}, {0xA76C, 9}, {0xA76D, 5}, {0xA76E, 9}, {0xA76F, 5}, {0xA770, 6},
+        {0xA771, 5}, {0xA779, 9}, {0xA77A, 5}, {0xA77B, 9}, {0xA77C, 5}, {0xA77D, 9},
+        {0xA77F, 5}, {0xA780, 9}, {0xA781, 5}, {0xA782, 9}, {0xA783, 5}, {0xA784, 9},
+        {0xA785, 5}, {0xA786, 9}, {0xA787, 5}, {0xA788, 6}, {0xA789, 24}, {0xA78B, 9},
+        {0xA78C, 5}, {0xA78D, 9}, {0xA78E, 5}, {0xA78F, 7}, {0xA790, 9}, {0xA791, 5},
+        {0xA792, 9}, {0xA793, 5}, {0xA796, 9}, {0xA797, 5}, {0xA798, 9}, {0xA799, 5},
+        {0xA79A, 9}, {0xA79B, 5}, {0xA79C, 9}, {0xA79D, 5}, {0xA79E, 9}, {0xA79F, 5},
+        {0xA7A0, 9}, {0xA7A1, 5}, {0xA7A2, 9}, {0xA7A3, 5}, {0xA7A4, 9}, {0xA7A5, 5},
+        {0xA7A6, 9}, {0xA7A7, 5}, {0xA7A8, 9}, {0xA7A9, 5}, {0xA7AA, 9}, {0xA7AF, 5},
+        {0xA7B0, 9}, {0xA7B5, 5}, {0xA7B6, 9}, {0xA7B7, 5}, {0xA7B8, 9}, {0xA7B9, 5},
+        {0xA7BA, 9}, {0xA7BB, 5}, {0xA7BC, 9}, {0xA7BD, 5}, {0xA7BE, 9}, {0xA7BF, 5},
+        {0xA7C0, 9}, {0xA7C1, 5}, {0xA7C2, 9}, {0xA7C3, 5}, {0xA7C4, 9}, {0xA7C8, 5},
+        {0xA7C9, 9}, {0xA7CA, 5}, {0xA7CB, 2}, {0xA7D0, 9}, {0xA7D1, 5}, {0xA7D2, 2},
+        {0xA7D3, 5}, {0xA7D4, 2}, {0xA7D5, 5}, {0xA7D6, 9}, {0xA7D7, 5}, {0xA7D8, 9},
+        {0xA7D9, 5}, {0xA7DA, 2}, {0xA7F2, 6}, {0xA7F5, 9}, {0xA7F6, 5}, {0xA7F7, 7},
+        {0xA7F8, 6}, {0xA7FA, 5}, {0xA7FB, 7}, {0xA802, 12}, {0xA803, 7}, {0xA806, 12},
+        {0xA807, 7}, {0xA80B, 12}, {0xA80C, 7}, {0xA823, 10}, {0xA825, 12}, {0xA827, 10},
+        {0xA828, 26}, {0xA82C, 12}, {0xA82D, 2}, {0xA830, 15}, {0xA836, 26}, {0xA838, 23},
+        {0xA839, 26}, {0xA83A, 2}, {0xA840, 7}, {0xA874, 21}, {0xA878, 2}, {0xA880, 10},
+        {0xA882, 7}, {0xA8B4, 10}, {0xA8C4, 12}, {0xA8C6, 2}, {0xA8CE, 21}, {0xA8D0, 13},
+        {0xA8DA, 2}, {0xA8E0, 12}, {0xA8F2, 7}, {0xA8F8, 21}, {0xA8FB, 7}, {0xA8FC, 21},
+        {0xA8FD, 7}, {0xA8FF, 12}, {0xA900, 13}, {0xA90A, 7}, {0xA926, 12}, {0xA92E, 21},
+        {0xA930, 7}, {0xA947, 12}, {0xA952, 10}, {0xA954, 2}, {0xA95F, 21}, {0xA960, 7},
+        {0xA97D, 2}, {0xA980, 12}, {0xA983, 10}, {0xA984, 7}, {0xA9B3, 12}, {0xA9B4, 10},
+        {0xA9B6, 12}, {0xA9BA, 10}, {0xA9BC, 12}, {0xA9BE, 10}, {0xA9C1, 21}, {0xA9CE, 2},
+        {0xA9CF, 6}, {0xA9D0, 13}, {0xA9DA, 2}, {0xA9DE, 21}, {0xA9E0, 7}, {0xA9E5, 12},
+        {0xA9E6, 6}, {0xA9E7, 7}, {0xA9F0, 13}, {0xA9FA, 7}, {0xA9FF, 2}, {0xAA00, 7},
+        {0xAA29, 12}, {0xAA2F, 10}, {0xAA31, 12}, {0xAA33, 10}, {0xAA35, 12}, {0xAA37, 2},
+        {0xAA40, 7}, {0xAA43, 12}, {0xAA44, 7}, {0xAA4C, 12}, {0xAA4D, 10}, {0xAA4E, 2},
+        {0xAA50, 13}, {0xAA5A, 2}, {0xAA5C, 21}, {0xAA60, 7}, {0xAA70, 6}, {0xAA71, 7},
+        {0xAA77, 26}, {0xAA7A, 7}, {0xAA7B, 10}, {0xAA7C, 12}, {0xAA7D, 10}, {0xAA7E, 7},
+        {0xAAB0, 12}, {0xAAB1, 7}, {0xAAB2, 12}, {0xAAB5, 7}, {0xAAB7, 12}, {0xAAB9, 7},
+        {0xAABE, 12}, {0xAAC0, 7}, {0xAAC1, 12}, {0xAAC2, 7}, {0xAAC3, 2}, {0xAADB, 7},
+        {0xAADD, 6}, {0xAADE, 21}, {0xAAE0, 7}, {0xAAEB, 10}, {0xAAEC, 12}, {0xAAEE, 10},
+        {0xAAF0, 21}, {0xAAF2, 7}, {0xAAF3, 6}, {0xAAF5, 10}, {0xAAF6, 12}, {0xAAF7, 2},
+        {0xAB01, 7}, {0xAB07, 2}, {0xAB09, 7}, {0xAB0F, 2}, {0xAB11, 7}, {0xAB17, 2},
+        {0xAB20, 7}, {0xAB27, 2}, {0xAB28, 7}, {0xAB2F, 2}, {0xAB30, 5}, {0xAB5B, 24},
+        {0xAB5C, 6}, {0xAB60, 5}, {0xAB69, 6}, {0xAB6A, 24}, {0xAB6C, 2}, {0xAB70, 5},
+        {0xABC0, 7}, {0xABE3, 10}, {0xABE5, 12}, {0xABE6, 10}, {0xABE8, 12}, {0xABE9, 10},
+        {0xABEB, 21}, {0xABEC, 10}, {0xABED, 12}, {0xABEE, 2}, {0xABF0, 13}, {0xABFA, 2},
+        {0xAC00, 7}, {0xD7A4, 2}, {0xD7B0, 7}, {0xD7C7, 2}, {0xD7CB, 7}, {0xD7FC, 2},
+        {0xD800, 4}, {0xE000, 3}, {0xF900, 7}, {0xFA6E, 2}, {0xFA70, 7}, {0xFADA, 2},
+        {0xFB00, 5}, {0xFB07, 2}, {0xFB13, 5}, {0xFB18, 2}, {0xFB1D, 7}, {0xFB1E, 12},
+        {0xFB1F, 7}, {0xFB29, 25}, {0xFB2A, 7}, {0xFB37, 2}, {0xFB38, 7}, {0xFB3D, 2},
+        {0xFB3E, 7}, {0xFB3F, 2}, {0xFB40, 7}, {0xFB42, 2}, {0xFB43, 7}, {0xFB45, 2},
+        {0xFB46, 7}, {0xFBB2, 24}, {0xFBC3, 2}, {0xFBD3, 7}, {0xFD3E, 18}, {0xFD3F, 22},
+        {0xFD40, 26}, {0xFD50, 7}, {0xFD90, 2}, {0xFD92, 7}, {0xFDC8, 2}, {0xFDCF, 26},
+        {0xFDD0, 2}, {0xFDF0, 7}, {0xFDFC, 23}, {0xFDFD, 26}, {0xFE00, 12}, {0xFE10, 21},
+        {0xFE17, 22}, {0xFE18, 18}, {0xFE19, 21}, {0xFE1A, 2}, {0xFE20, 12}, {0xFE30, 21},
+        {0xFE31, 17}, {0xFE33, 16}, {0xFE35, 22}, {0xFE36, 18}, {0xFE37, 22}, {0xFE38, 18},
+        {0xFE39, 22}, {0xFE3A, 18}, {0xFE3B, 22}, {0xFE3C, 18}, {0xFE3D, 22}, {0xFE3E, 18},
+        {0xFE3F, 22}, {0xFE40, 18}, {0xFE41, 22}, {0xFE42, 18}, {0xFE43, 22}, {0xFE44, 18},
+        {0xFE45, 21}, {0xFE47, 22}, {0xFE48, 18}, {0xFE49, 21}, {0xFE4D, 16}, {0xFE50, 21},
+        {0xFE53, 2}, {0xFE54, 21}, {0xFE58, 17}, {0xFE59, 22}, {0xFE5A, 18}, {0xFE5B, 22},
+        {0xFE5C, 18}, {0xFE5D, 22}, {0xFE5E, 18}, {0xFE5F, 21}, {0xFE62, 25}, {0xFE63, 17},
+        {0xFE64, 25}, {0xFE67, 2}, {0xFE68, 21}, {0xFE69, 23}, {0xFE6A, 21}, {0xFE6C, 2},
+        {0xFE70, 7}, {0xFE75, 2}, {0xFE76, 7}, {0xFEFD, 2}, {0xFEFF, 1}, {0xFF00, 2},
+        {0xFF01, 21}, {0xFF04, 23}, {0xFF05, 21}, {0xFF08, 22}, {0xFF09, 18}, {0xFF0A, 21},
+        {0xFF0B, 25}, {0xFF0C, 21}, {0xFF0D, 17}, {0xFF0E, 21}, {0xFF10, 13}, {0xFF1A, 21},
+        {0xFF1C, 25}, {0xFF1F, 21}, {0xFF21, 9}, {0xFF3B, 22}, {0xFF3C, 21}, {0xFF3D, 18},
+        {0xFF3E, 24}, {0xFF3F, 16}, {0xFF40, 24}, {0xFF41, 5}, {0xFF5B, 22}, {0xFF5C, 25},
+        {0xFF5D, 18}, {0xFF5E, 25}, {0xFF5F, 22}, {0xFF60, 18}, {0xFF61, 21}, {0xFF62, 22},
+        {0xFF63, 18}, {0xFF64, 21}, {0xFF66, 7}, {0xFF70, 6}, {0xFF71, 7}, {0xFF9E, 6},
+        {0xFFA0, 7}, {0xFFBF, 2}, {0xFFC2, 7}, {0xFFC8, 2}, {0xFFCA, 7}, {0xFFD0, 2},
+        {0xFFD2, 7}, {0xFFD8, 2}, {0xFFDA, 7}, {0xFFDD, 2}, {0xFFE0, 23}, {0xFFE2, 25},
+        {0xFFE3, 24}, {0xFFE4, 26}, {0xFFE5, 23}, {0xFFE7, 2}, {0xFFE8, 26}, {0xFFE9, 25},
+        {0xFFED, 26}, {0xFFEF, 2}, {0xFFF9, 1}, {0xFFFC, 26}, {0xFFFE, 2}, {0x10000, 7},
+        {0x1000C, 2}, {0x1000D, 7}, {0x10027, 2}, {0x10028, 7}, {0x1003B, 2}, {0x1003C, 7},
+        {0x1003E, 2}, {0x1003F, 7}, {0x1004E, 2}, {0x10050, 7}, {0x1005E, 2}, {0x10080, 7},
+        {0x100FB, 2}, {0x10100, 21}, {0x10103, 2}, {0x10107, 15}, {0x10134, 2}, {0x10137, 26},
+        {0x10140, 14}, {0x10175, 15}, {0x10179, 26}, {0x1018A, 15}, {0x1018C, 26}, {0x1018F, 2},
+        {0x10190, 26}, {0x1019D, 2}, {0x101A0, 26}, {0x101A1, 2}, {0x101D0, 26}, {0x101FD, 12},
+        {0x101FE, 2}, {0x10280, 7}, {0x1029D, 2}, {0x102A0, 7}, {0x102D1, 2}, {0x102E0, 12},
+        {0x102E1, 15}, {0x102FC, 2}, {0x10300, 7}, {0x10320, 15}, {0x10324, 2}, {0x1032D, 7},
+        {0x10341, 14}, {0x10342, 7}, {0x1034A, 14}, {0x1034B, 2}, {0x10350, 7}, {0x10376, 12},
+        {0x1037B, 2}, {0x10380, 7}, {0x1039E, 2}, {0x1039F, 21}, {0x103A0, 7}, {0x103C4, 2},
+        {0x103C8, 7}, {0x103D0, 21}, {0x103D1, 14}, {0x103D6, 2}, {0x10400, 9}, {0x10428, 5},
+        {0x10450, 7}, {0x1049E, 2}, {0x104A0, 13}, {0x104AA, 2}, {0x104B0, 9}, {0x104D4, 2},
+        {0x104D8, 5}, {0x104FC, 2}, {0x10500, 7}, {0x10528, 2}, {0x10530, 7}, {0x10564, 2},
+        {0x1056F, 21}, {0x10570, 9}, {0x1057B, 2}, {0x1057C, 9}, {0x1058B, 2}, {0x1058C, 9},
+        {0x10593, 2}, {0x10594, 9}, {0x10596, 2}, {0x10597, 5}, {0x105A2, 2}, {0x105A3, 5},
+        {0x105B2, 2}, {0x105B3, 5}, {0x105BA, 2}, {0x105BB, 5}, {0x105BD, 2}, {0x10600, 7},
+        {0x10737, 2}, {0x10740, 7}, {0x10756, 2}, {0x10760, 7}, {0x10768, 2}, {0x10780, 6},
+        {0x10786, 2}, {0x10787, 6}, {0x107B1, 2}, {0x107B2, 6}, {0x107BB, 2}, {0x10800, 7},
+        {0x10806, 2}, {0x10808, 7}, {0x10809, 2}, {0x1080A, 7}, {0x10836, 2}, {0x10837, 7},
+        {0x10839, 2}, {0x1083C, 7}, {0x1083D, 2}, {0x1083F, 7}, {0x10856, 2}, {0x10857, 21},
+        {0x10858, 15}, {0x10860, 7}, {0x10877, 26}, {0x10879, 15}, {0x10880, 7}, {0x1089F, 2},
+        {0x108A7, 15}, {0x108B0, 2}, {0x108E0, 7}, {0x108F3, 2}, {0x108F4, 7}, {0x108F6, 2},
+        {0x108FB, 15}, {0x10900, 7}, {0x10916, 15}, {0x1091C, 2}, {0x1091F, 21}, {0x10920, 7},
+        {0x1093A, 2}, {0x1093F, 21}, {0x10940, 2}, {0x10980, 7}, {0x109B8, 2}, {0x109BC, 15},
+        {0x109BE, 7}, {0x109C0, 15}, {0x109D0, 2}, {0x109D2, 15}, {0x10A00, 7}, {0x10A01, 12},
+        {0x10A04, 2}, {0x10A05, 12}, {0x10A07, 2}, {0x10A0C, 12}, {0x10A10, 7}, {0x10A14, 2},
+        {0x10A15, 7}, {0x10A18, 2}, {0x10A19, 7}, {0x10A36, 2}, {0x10A38, 12}, {0x10A3B, 2},
+        {0x10A3F, 12}, {0x10A40, 15}, {0x10A49, 2}, {0x10A50, 21}, {0x10A59, 2}, {0x10A60, 7},
+        {0x10A7D, 15}, {0x10A7F, 21}, {0x10A80, 7}, {0x10A9D, 15}, {0x10AA0, 2}, {0x10AC0, 7},
+        {0x10AC8, 26}, {0x10AC9, 7}, {0x10AE5, 12}, {0x10AE7, 2}, {0x10AEB, 15}, {0x10AF0, 21},
+        {0x10AF7, 2}, {0x10B00, 7}, {0x10B36, 2}, {0x10B39, 21}, {0x10B40, 7}, {0x10B56, 2},
+        {0x10B58, 15}, {0x10B60, 7}, {0x10B73, 2}, {0x10B78, 15}, {0x10B80, 7}, {0x10B92, 2},
+        {0x10B99, 21}, {0x10B9D, 2}, {0x10BA9, 15}, {0x10BB0, 2}, {0x10C00, 7}, {0x10C49, 2},
+        {0x10C80, 9}, {0x10CB3, 2}, {0x10CC0, 5}, {0x10CF3, 2}, {0x10CFA, 15}, {0x10D00, 7},
+        {0x10D24, 12}, {0x10D28, 2}, {0x10D30, 13}, {0x10D3A, 2}, {0x10E60, 15}, {0x10E7F, 2},
+        {0x10E80, 7}, {0x10EAA, 2}, {0x10EAB, 12}, {0x10EAD, 17}, {0x10EAE, 2}, {0x10EB0, 7},
+        {0x10EB2, 2}, {0x10F00, 7}, {0x10F1D, 15}, {0x10F27, 7}, {0x10F28, 2}, {0x10F30, 7},
+        {0x10F46, 12}, {0x10F51, 15}, {0x10F55, 21}, {0x10F5A, 2}, {0x10F70, 7}, {0x10F82, 12},
+        {0x10F86, 21}, {0x10F8A, 2}, {0x10FB0, 7}, {0x10FC5, 15}, {0x10FCC, 2}, {0x10FE0, 7},
+        {0x10FF7, 2}, {0x11000, 10}, {0x11001, 12}, {0x11002, 10}, {0x11003, 7}, {0x11038, 12},
+        {0x11047, 21}, {0x1104E, 2}, {0x11052, 15}, {0x11066, 13}, {0x11070, 12}, {0x11071, 7},
+        {0x11073, 12}, {0x11075, 7}, {0x11076, 2}, {0x1107F, 12}, {0x11082, 10}, {0x11083, 7},
+        {0x110B0, 10}, {0x110B3, 12}, {0x110B7, 10}, {0x110B9, 12}, {0x110BB, 21}, {0x110BD, 1},
+        {0x110BE, 21}, {0x110C2, 12}, {0x110C3, 2}, {0x110CD, 1}, {0x110CE, 2}, {0x110D0, 7},
+        {0x110E9, 2}, {0x110F0, 13}, {0x110FA, 2}, {0x11100, 12}, {0x11103, 7}, {0x11127, 12},
+        {0x1112C, 10}, {0x1112D, 12}, {0x11135, 2}, {0x11136, 13}, {0x11140, 21}, {0x11144, 7},
+        {0x11145, 10}, {0x11147, 7}, {0x11148, 2}, {0x11150, 7}, {0x11173, 12}, {0x11174, 21},
+        {0x11176, 7}, {0x11177, 2}, {0x11180, 12}, {0x11182, 10}, {0x11183, 7}, {0x111B3, 10},
+        {0x111B6, 12}, {0x111BF, 10}, {0x111C1, 7}, {0x111C5, 21}, {0x111C9, 12}, {0x111CD, 21},
+        {0x111CE, 10}, {0x111CF, 12}, {0x111D0, 13}, {0x111DA, 7}, {0x111DB, 21}, {0x111DC, 7},
+        {0x111DD, 21}, {0x111E0, 2}, {0x111E1, 15}, {0x111F5, 2}, {0x11200, 7}, {0x11212, 2},
+        {0x11213, 7}, {0x1122C, 10}, {0x1122F, 12}, {0x11232, 10}, {0x11234, 12}, {0x11235, 10},
+        {0x11236, 12}, {0x11238, 21}, {0x1123E, 12}, {0x1123F, 2}, {0x11280, 7}, {0x11287, 2},
+        {0x11288, 7}, {0x11289, 2}, {0x1128A, 7}, {0x1128E, 2}, {0x1128F, 7}, {0x1129E, 2},
+        {0x1129F, 7}, {0x112A9, 21}, {0x112AA, 2}, {0x112B0, 7}, {0x112DF, 12}, {0x112E0, 10},
+        {0x112E3, 12}, {0x112EB, 2}, {0x112F0, 13}, {0x112FA, 2}, {0x11300, 12}, {0x11302, 10},
+        {0x11304, 2}, {0x11305, 7}, {0x1130D, 2}, {0x1130F, 7}, {0x11311, 2}, {0x11313, 7},
+        {0x11329, 2}, {0x1132A, 7}, {0x11331, 2}, {0x11332, 7}, {0x11334, 2}, {0x11335, 7},
+        {0x1133A, 2}, {0x1133B, 12}, {0x1133D, 7}, {0x1133E, 10}, {0x11340, 12}, {0x11341, 10},
+        {0x11345, 2}, {0x11347, 10}, {0x11349, 2}, {0x1134B, 10}, {0x1134E, 2}, {0x11350, 7},
+        {0x11351, 2}, {0x11357, 10}, {0x11358, 2}, {0x1135D, 7}, {0x11362, 10}, {0x11364, 2},
+        {0x11366, 12}, {0x1136D, 2}, {0x11370, 12}, {0x11375, 2}, {0x11400, 7}, {0x11435, 10},
+        {0x11438, 12}, {0x11440, 10}, {0x11442, 12}, {0x11445, 10}, {0x11446, 12}, {0x11447, 7},
+        {0x1144B, 21}, {0x11450, 13}, {0x1145A, 21}, {0x1145C, 2}, {0x1145D, 21}, {0x1145E, 12},
+        {0x1145F, 7}, {0x11462, 2}, {0x11480, 7}, {0x114B0, 10}, {0x114B3, 12}, {0x114B9, 10},
+        {0x114BA, 12}, {0x114BB, 10}, {0x114BF, 12}, {0x114C1, 10}, {0x114C2, 12}, {0x114C4, 7},
+        {0x114C6, 21}, {0x114C7, 7}, {0x114C8, 2}, {0x114D0, 13}, {0x114DA, 2}, {0x11580, 7},
+        {0x115AF, 10}, {0x115B2, 12}, {0x115B6, 2}, {0x115B8, 10}, {0x115BC, 12}, {0x115BE, 10},
+        {0x115BF, 12}, {0x115C1, 21}, {0x115D8, 7}, {0x115DC, 12}, {0x115DE, 2}, {0x11600, 7},
+        {0x11630, 10}, {0x11633, 12}, {0x1163B, 10}, {0x1163D, 12}, {0x1163E, 10}, {0x1163F, 12},
+        {0x11641, 21}, {0x11644, 7}, {0x11645, 2}, {0x11650, 13}, {0x1165A, 2}, {0x11660, 21},
+        {0x1166D, 2}, {0x11680, 7}, {0x116AB, 12}, {0x116AC, 10}, {0x116AD, 12}, {0x116AE, 10},
+        {0x116B0, 12}, {0x116B6, 10}, {0x116B7, 12}, {0x116B8, 7}, {0x116B9, 21}, {0x116BA, 2},
+        {0x116C0, 13}, {0x116CA, 2}, {0x11700, 7}, {0x1171B, 2}, {0x1171D, 12}, {0x11720, 10},
+        {0x11722, 12}, {0x11726, 10}, {0x11727, 12}, {0x1172C, 2}, {0x11730, 13}, {0x1173A, 15},
+        {0x1173C, 21}, {0x1173F, 26}, {0x11740, 7}, {0x11747, 2}, {0x11800, 7}, {0x1182C, 10},
+        {0x1182F, 12}, {0x11838, 10}, {0x11839, 12}, {0x1183B, 21}, {0x1183C, 2}, {0x118A0, 9},
+        {0x118C0, 5}, {0x118E0, 13}, {0x118EA, 15}, {0x118F3, 2}, {0x118FF, 7}, {0x11907, 2},
+        {0x11909, 7}, {0x1190A, 2}, {0x1190C, 7}, {0x11914, 2}, {0x11915, 7}, {0x11917, 2},
+        {0x11918, 7}, {0x11930, 10}, {0x11936, 2}, {0x11937, 10}, {0x11939, 2}, {0x1193B, 12},
+        {0x1193D, 10}, {0x1193E, 12}, {0x1193F, 7}, {0x11940, 10}, {0x11941, 7}, {0x11942, 10},
+        {0x11943, 12}, {0x11944, 21}, {0x11947, 2}, {0x11950, 13}, {0x1195A, 2}, {0x119A0, 7},
+        {0x119A8, 2}, {0x119AA, 7}, {0x119D1, 10}, {0x119D4, 12}, {0x119D8, 2}, {0x119DA, 12},
+        {0x119DC, 10}, {0x119E0, 12}, {0x119E1, 7}, {0x119E2, 21}, {0x119E3, 7}, {0x119E4, 10},
+        {0x119E5, 2}, {0x11A00, 7}, {0x11A01, 12}, {0x11A0B, 7}, {0x11A33, 12}, {0x11A39, 10},
+        {0x11A3A, 7}, {0x11A3B, 12}, {0x11A3F, 21}, {0x11A47, 12}, {0x11A48, 2}, {0x11A50, 7},
+        {0x11A51, 12}, {0x11A57, 10}, {0x11A59, 12}, {0x11A5C, 7}, {0x11A8A, 12}, {0x11A97, 10},
+        {0x11A98, 12}, {0x11A9A, 21}, {0x11A9D, 7}, {0x11A9E, 21}, {0x11AA3, 2}, {0x11AB0, 7},
+        {0x11AF9, 2}, {0x11C00, 7}, {0x11C09, 2}, {0x11C0A, 7}, {0x11C2F, 10}, {0x11C30, 12},
+        {0x11C37, 2}, {0x11C38, 12}, {0x11C3E, 10}, {0x11C3F, 12}, {0x11C40, 7}, {0x11C41, 21},
+        {0x11C46, 2}, {0x11C50, 13}, {0x11C5A, 15}, {0x11C6D, 2}, {0x11C70, 21}, {0x11C72, 7},
+        {0x11C90, 2}, {0x11C92, 12}, {0x11CA8, 2}, {0x11CA9, 10}, {0x11CAA, 12}, {0x11CB1, 10},
+        {0x11CB2, 12}, {0x11CB4, 10}, {0x11CB5, 12}, {0x11CB7, 2}, {0x11D00, 7}, {0x11D07, 2},
+        {0x11D08, 7}, {0x11D0A, 2}, {0x11D0B, 7}, {0x11D31, 12}, {0x11D37, 2}, {0x11D3A, 12},
+        {0x11D3B, 2}, {0x11D3C, 12}, {0x11D3E, 2}, {0x11D3F, 12}, {0x11D46, 7}, {0x11D47, 12},
+        {0x11D48, 2}, {0x11D50, 13}, {0x11D5A, 2}, {0x11D60, 7}, {0x11D66, 2}, {0x11D67, 7},
+        {0x11D69, 2}, {0x11D6A, 7}, {0x11D8A, 10}, {0x11D8F, 2}, {0x11D90, 12}, {0x11D92, 2},
+        {0x11D93, 10}, {0x11D95, 12}, {0x11D96, 10}, {0x11D97, 12}, {0x11D98, 7}, {0x11D99, 2},
+        {0x11DA0, 13}, {0x11DAA, 2}, {0x11EE0, 7}, {0x11EF3, 12}, {0x11EF5, 10}, {0x11EF7, 21},
+        {0x11EF9, 2}, {0x11FB0, 7}, {0x11FB1, 2}, {0x11FC0, 15}, {0x11FD5, 26}, {0x11FDD, 23},
+        {0x11FE1, 26}, {0x11FF2, 2}, {0x11FFF, 21}, {0x12000, 7}, {0x1239A, 2}, {0x12400, 14},
+        {0x1246F, 2}, {0x12470, 21}, {0x12475, 2}, {0x12480, 7}, {0x12544, 2}, {0x12F90, 7},
+        {0x12FF1, 21}, {0x12FF3, 2}, {0x13000, 7}, {0x1342F, 2}, {0x13430, 1}, {0x13439, 2},
+        {0x14400, 7}, {0x14647, 2}, {0x16800, 7}, {0x16A39, 2}, {0x16A40, 7}, {0x16A5F, 2},
+        {0x16A60, 13}, {0x16A6A, 2}, {0x16A6E, 21}, {0x16A70, 7}, {0x16ABF, 2}, {0x16AC0, 13},
+        {0x16ACA, 2}, {0x16AD0, 7}, {0x16AEE, 2}, {0x16AF0, 12}, {0x16AF5, 21}, {0x16AF6, 2},
+        {0x16B00, 7}, {0x16B30, 12}, {0x16B37, 21}, {0x16B3C, 26}, {0x16B40, 6}, {0x16B44, 21},
+        {0x16B45, 26}, {0x16B46, 2}, {0x16B50, 13}, {0x16B5A, 2}, {0x16B5B, 15}, {0x16B62, 2},
+        {0x16B63, 7}, {0x16B78, 2}, {0x16B7D, 7}, {0x16B90, 2}, {0x16E40, 9}, {0x16E60, 5},
+        {0x16E80, 15}, {0x16E97, 21}, {0x16E9B, 2}, {0x16F00, 7}, {0x16F4B, 2}, {0x16F4F, 12},
+        {0x16F50, 7}, {0x16F51, 10}, {0x16F88, 2}, {0x16F8F, 12}, {0x16F93, 6}, {0x16FA0, 2},
+        {0x16FE0, 6}, {0x16FE2, 21}, {0x16FE3, 6}, {0x16FE4, 12}, {0x16FE5, 2}, {0x16FF0, 10},
+        {0x16FF2, 2}, {0x17000, 7}, {0x187F8, 2}, {0x18800, 7}, {0x18CD6, 2}, {0x18D00, 7},
+        {0x18D09, 2}, {0x1AFF0, 6}, {0x1AFF4, 2}, {0x1AFF5, 6}, {0x1AFFC, 2}, {0x1AFFD, 6},
+        {0x1AFFF, 2}, {0x1B000, 7}, {0x1B123, 2}, {0x1B150, 7}, {0x1B153, 2}, {0x1B164, 7},
+        {0x1B168, 2}, {0x1B170, 7}, {0x1B2FC, 2}, {0x1BC00, 7}, {0x1BC6B, 2}, {0x1BC70, 7},
+        {0x1BC7D, 2}, {0x1BC80, 7}, {0x1BC89, 2}, {0x1BC90, 7}, {0x1BC9A, 2}, {0x1BC9C, 26},
+        {0x1BC9D, 12}, {0x1BC9F, 21}, {0x1BCA0, 1}, {0x1BCA4, 2}, {0x1CF00, 12}, {0x1CF2E, 2},
+        {0x1CF30, 12}, {0x1CF47, 2}, {0x1CF50, 26}, {0x1CFC4, 2}, {0x1D000, 26}, {0x1D0F6, 2},
+        {0x1D100, 26}, {0x1D127, 2}, {0x1D129, 26}, {0x1D165, 10}, {0x1D167, 12}, {0x1D16A, 26},
+        {0x1D16D, 10}, {0x1D173, 1}, {0x1D17B, 12}, {0x1D183, 26}, {0x1D185, 12}, {0x1D18C, 26},
+        {0x1D1AA, 12}, {0x1D1AE, 26}, {0x1D1EB, 2}, {0x1D200, 26}, {0x1D242, 12}, {0x1D245, 26},
+        {0x1D246, 2}, {0x1D2E0, 15}, {0x1D2F4, 2}, {0x1D300, 26}, {0x1D357, 2}, {0x1D360, 15},
+        {0x1D379, 2}, {0x1D400, 9}, {0x1D41A, 5}, {0x1D434, 9}, {0x1D44E, 5}, {0x1D455, 2},
+        {0x1D456, 5}, {0x1D468, 9}, {0x1D482, 5}, {0x1D49C, 9}, {0x1D49D, 2}, {0x1D49E, 9},
+        {0x1D4A0, 2}, {0x1D4A2, 9}, {0x1D4A3, 2}, {0x1D4A5, 9}, {0x1D4A7, 2}, {0x1D4A9, 9},
+        {0x1D4AD, 2}, {0x1D4AE, 9}, {0x1D4B6, 5}, {0x1D4BA, 2}, {0x1D4BB, 5}, {0x1D4BC, 2},
+        {0x1D4BD, 5}, {0x1D4C4, 2}, {0x1D4C5, 5}, {0x1D4D0, 9}, {0x1D4EA, 5}, {0x1D504, 9},
+        {0x1D506, 2}, {0x1D507, 9}, {0x1D50B, 2}, {0x1D50D, 9}, {0x1D515, 2}, {0x1D516, 9},
+        {0x1D51D, 2}, {0x1D51E, 5}, {0x1D538, 9}, {0x1D53A, 2}, {0x1D53B, 9}, {0x1D53F, 2},
+        {0x1D540, 9}, {0x1D545, 2}, {0x1D546, 9}, {0x1D547, 2}, {0x1D54A, 9}, {0x1D551, 2},
+        {0x1D552, 5}, {0x1D56C, 9}, {0x1D586, 5}, {0x1D5A0, 9}, {0x1D5BA, 5}, {0x1D5D4, 9},
+        {0x1D5EE, 5}, {0x1D608, 9}, {0x1D622, 5}, {0x1D63C, 9}, {0x1D656, 5}, {0x1D670, 9},
+        {0x1D68A, 5}, {0x1D6A6, 2}, {0x1D6A8, 9}, {0x1D6C1, 25}, {0x1D6C2, 5}, {0x1D6DB, 25},
+        {0x1D6DC, 5}, {0x1D6E2, 9}, {0x1D6FB, 25}, {0x1D6FC, 5}, {0x1D715, 25}, {0x1D716, 5},
+        {0x1D71C, 9}, {0x1D735, 25}, {0x1D736, 5}, {0x1D74F, 25}, {0x1D750, 5}, {0x1D756, 9},
+        {0x1D76F, 25}, {0x1D770, 5}, {0x1D789, 25}, {0x1D78A, 5}, {0x1D790, 9}, {0x1D7A9, 25},
+        {0x1D7AA, 5}, {0x1D7C3, 25}, {0x1D7C4, 5}, {0x1D7CA, 9}, {0x1D7CB, 5}, {0x1D7CC, 2},
+        {0x1D7CE, 13}, {0x1D800, 26}, {0x1DA00, 12}, {0x1DA37, 26}, {0x1DA3B, 12}, {0x1DA6D, 26},
+        {0x1DA75, 12}, {0x1DA76, 26}, {0x1DA84, 12}, {0x1DA85, 26}, {0x1DA87, 21}, {0x1DA8C, 2},
+        {0x1DA9B, 12}, {0x1DAA0, 2}, {0x1DAA1, 12}, {0x1DAB0, 2}, {0x1DF00, 5}, {0x1DF0A, 7},
+        {0x1DF0B, 5}, {0x1DF1F, 2}, {0x1E000, 12}, {0x1E007, 2}, {0x1E008, 12}, {0x1E019, 2},
+        {0x1E01B, 12}, {0x1E022, 2}, {0x1E023, 12}, {0x1E025, 2}, {0x1E026, 12}, {0x1E02B, 2},
+        {0x1E100, 7}, {0x1E12D, 2}, {0x1E130, 12}, {0x1E137, 6}, {0x1E13E, 2}, {0x1E140, 13},
+        {0x1E14A, 2}, {0x1E14E, 7}, {0x1E14F, 26}, {0x1E150, 2}, {0x1E290, 7}, {0x1E2AE, 12},
+        {0x1E2AF, 2}, {0x1E2C0, 7}, {0x1E2EC, 12}, {0x1E2F0, 13}, {0x1E2FA, 2}, {0x1E2FF, 23},
+        {0x1E300, 2}, {0x1E7E0, 7}, {0x1E7E7, 2}, {0x1E7E8, 7}, {0x1E7EC, 2}, {0x1E7ED, 7},
+        {0x1E7EF, 2}, {0x1E7F0, 7}, {0x1E7FF, 2}, {0x1E800, 7}, {0x1E8C5, 2}, {0x1E8C7, 15},
+        {0x1E8D0, 12}, {0x1E8D7, 2}, {0x1E900, 9}, {0x1E922, 5}, {0x1E944, 12}, {0x1E94B, 6},
+        {0x1E94C, 2}, {0x1E950, 13}, {0x1E95A, 2}, {0x1E95E, 21}, {0x1E960, 2}, {0x1EC71, 15},
+        {0x1ECAC, 26}, {0x1ECAD, 15}, {0x1ECB0, 23}, {0x1ECB1, 15}, {0x1ECB5, 2}, {0x1ED01, 15},
+        {0x1ED2E, 26}, {0x1ED2F, 15}, {0x1ED3E, 2}, {0x1EE00, 7}, {0x1EE04, 2}, {0x1EE05, 7},
+        {0x1EE20, 2}, {0x1EE21, 7}, {0x1EE23, 2}, {0x1EE24, 7}, {0x1EE25, 2}, {0x1EE27, 7},
+        {0x1EE28, 2}, {0x1EE29, 7}, {0x1EE33, 2}, {0x1EE34, 7}, {0x1EE38, 2}, {0x1EE39, 7},
+        {0x1EE3A, 2}, {0x1EE3B, 7}, {0x1EE3C, 2}, {0x1EE42, 7}, {0x1EE43, 2}, {0x1EE47, 7},
+        {0x1EE48, 2}, {0x1EE49, 7}, {0x1EE4A, 2}, {0x1EE4B, 7}, {0x1EE4C, 2}, {0x1EE4D, 7},
+        {0x1EE50, 2}, {0x1EE51, 7}, {0x1EE53, 2}, {0x1EE54, 7}, {0x1EE55, 2}, {0x1EE57, 7},
+        {0x1EE58, 2}, {0x1EE59, 7}, {0x1EE5A, 2}, {0x1EE5B, 7}, {0x1EE5C, 2}, {0x1EE5D, 7},
+        {0x1EE5E, 2}, {0x1EE5F, 7}, {0x1EE60, 2}, {0x1EE61, 7}, {0x1EE63, 2}, {0x1EE64, 7},
+        {0x1EE65, 2}, {0x1EE67, 7}, {0x1EE6B, 2}, {0x1EE6C, 7}, {0x1EE73, 2}, {0x1EE74, 7},
+        {0x1EE78, 2}, {0x1EE79, 7}, {0x1EE7D, 2}, {0x1EE7E, 7}, {0x1EE7F, 2}, {0x1EE80, 7},
+        {0x1EE8A, 2}, {0x1EE8B, 7}, {0x1EE9C, 2}, {0x1EEA1, 7}, {0x1EEA4, 2}, {0x1EEA5, 7},
+        {0x1EEAA, 2}, {0x1EEAB, 7}, {0x1EEBC, 2}, {0x1EEF0, 25}, {0x1EEF2, 2}, {0x1F000, 26},
+        {0x1F02C, 2}, {0x1F030, 26}, {0x1F094, 2}, {0x1F0A0, 26}, {0x1F0AF, 2}, {0x1F0B1, 26},
+        {0x1F0C0, 2}, {0x1F0C1, 26}, {0x1F0D0, 2}, {0x1F0D1, 26}, {0x1F0F6, 2}, {0x1F100, 15},
+        {0x1F10D, 26}, {0x1F1AE, 2}, {0x1F1E6, 26}, {0x1F203, 2}, {0x1F210, 26}, {0x1F23C, 2},
+        {0x1F240, 26}, {0x1F249, 2}, {0x1F250, 26}, {0x1F252, 2}, {0x1F260, 26}, {0x1F266, 2},
+        {0x1F300, 26}, {0x1F3FB, 24}, {0x1F400, 26}, {0x1F6D8, 2}, {0x1F6DD, 26}, {0x1F6ED, 2},
+        {0x1F6F0, 26}, {0x1F6FD, 2}, {0x1F700, 26}, {0x1F774, 2}, {0x1F780, 26}, {0x1F7D9, 2},
+        {0x1F7E0, 26}, {0x1F7EC, 2}, {0x1F7F0, 26}, {0x1F7F1, 2}, {0x1F800, 26}, {0x1F80C, 2},
+        {0x1F810, 26}, {0x1F848, 2}, {0x1F850, 26}, {0x1F85A, 2}, {0x1F860, 26}, {0x1F888, 2},
+        {0x1F890, 26}, {0x1F8AE, 2}, {0x1F8B0, 26}, {0x1F8B2, 2}, {0x1F900, 26}, {0x1FA54, 2},
+        {0x1FA60, 26}, {0x1FA6E, 2}, {0x1FA70, 26}, {0x1FA75, 2}, {0x1FA78, 26}, {0x1FA7D, 2},
+        {0x1FA80, 26}, {0x1FA87, 2}, {0x1FA90, 26}, {0x1FAAD, 2}, {0x1FAB0, 26}, {0x1FABB, 2},
+        {0x1FAC0, 26}, {0x1FAC6, 2}, {0x1FAD0, 26}, {0x1FADA, 2}, {0x1FAE0, 26}, {0x1FAE8, 2},
+        {0x1FAF0, 26}, {0x1FAF7, 2}, {0x1FB00, 26}, {0x1FB93, 2}, {0x1FB94, 26}, {0x1FBCB, 2},
+        {0x1FBF0, 13}, {0x1FBFA, 2}, {0x20000, 7}, {0x2A6E0, 2}, {0x2A700, 7}, {0x2B739, 2},
+        {0x2B740, 7}, {0x2B81E, 2}, {0x2B820, 7}, {0x2CEA2, 2}, {0x2CEB0, 7}, {0x2EBE1, 2},
+        {0x2F800, 7}, {0x2FA1E, 2}, {0x30000, 7}, {0x3134B, 2}, {0xE0001, 1}, {0xE0002, 2},
+        {0xE0020, 1}, {0xE0080, 2}, {0xE0100, 12}, {0xE01F0, 2}, {0xF0000, 3}, {0xFFFFE, 2},
+        {0x100000, 3}, {0x10FFFE, 2},
+    };
+    const size_t GENERAL_CATEGORY_RUN_COUNT = 3968;
+
+    const char *const SCRIPT_NAMES[][2] = {
+        {"Adlm", "Adlam"},
+        {"Ahom", "Ahom"},
+        {"Hluw", "Anatolian_Hieroglyphs"},
+        {"Arab", "Arabic"},
+        {"Armn", "Armenian"},
+        {"Avst", "Avestan"},
+        {"Bali", "Balinese"},
+        {"Bamu", "Bamum"},
+        {"Bass", "Bassa_Vah"},
+        {"Batk", "Batak"},
+        {"Beng", "Bengali"},
+        {"Bhks", "Bhaiksuki"},
+        {"Bopo", "Bopomofo"},
+        {"Brah", "Brahmi"},
+        {"Brai", "Braille"},
+        {"Bugi", "Buginese"},
+        {"Buhd", "Buhid"},
+        {"Cans", "Canadian_Aboriginal"},
+        {"Cari", "Carian"},
+        {"Aghb", "Caucasian_Albanian"},
+        {"Cakm", "Chakma"},
+        {"Cham", "Cham"},
+        {"Cher", "Cherokee"},
+        {"Chrs", "Chorasmian"},
+        {"Zyyy", "Common"},
+        {"Copt", "Coptic"},
+        {"Xsux", "Cuneiform"},
+        {"Cprt", "Cypriot"},
+        {"Cpmn", "Cypro_Minoan"},
+        {"Cyrl", "Cyrillic"},
+        {"Dsrt", "Deseret"},
+        {"Deva", "Devanagari"},
+        {"Diak", "Dives_Akuru"},
+        {"Dogr", "Dogra"},
+        {"Dupl", "Duployan"},
+        {"Egyp", "Egyptian_Hieroglyphs"},
+        {"Elba", "Elbasan"},
+        {"Elym", "Elymaic"},
+        {"Ethi", "Ethiopic"},
+        {"Geor", "Georgian"},
+        {"Glag", "Glagolitic"},
+        {"Goth", "Gothic"},
+        {"Gran", "Grantha"},
+        {"Grek", "Greek"},
+        {"Gujr", "Gujarati"},
+        {"Gong", "Gunjala_Gondi"},
+        {"Guru", "Gurmukhi"},
+        {"Hani", "Han"},
+        {"Hang", "Hangul"},
+        {"Rohg", "Hanifi_Rohingya"},
+        {"Hano", "Hanunoo"},
+        {"Hatr", "Hatran"},
+        {"Hebr", "Hebrew"},
+        {"Hira", "Hiragana"},
+        {"Armi", "Imperial_Aramaic"},
+        {"Zinh", "Inherited"},
+        {"Phli", "Inscriptional_Pahlavi"},
+        {"Prti", "Inscriptional_Parthian"},
+        {"Java", "Javanese"},
+        {"Kthi", "Kaithi"},
+        {"Knda", "Kannada"},
+        {"Kana", "Katakana"},
+        {"Kali", "Kayah_Li"},
+        {"Khar", "Kharoshthi"},
+        {"Kits", "Khitan_Small_Script"},
+        {"Khmr", "Khmer"},
+        {"Khoj", "Khojki"},
+        {"Sind", "Khudawadi"},
+        {"Laoo", "Lao"},
+        {"Latn", "Latin"},
+        {"Lepc", "Lepcha"},
+        {"Limb", "Limbu"},
+        {"Lina", "Linear_A"},
+        {"Linb", "Linear_B"},
+        {"Lisu", "Lisu"},
+        {"Lyci", "Lycian"},
+        {"Lydi", "Lydian"},
+        {"Mahj", "Mahajani"},
+        {"Maka", "Makasar"},
+        {"Mlym", "Malayalam"},
+        {"Mand", "Mandaic"},
+        {"Mani", "Manichaean"},
+        {"Marc", "Marchen"},
+        {"Gonm", "Masaram_Gondi"},
+        {"Medf", "Medefaidrin"},
+        {"Mtei", "Meetei_Mayek"},
+        {"Mend", "Mende_Kikakui"},
+        {"Merc", "Meroitic_Cursive"},
+        {"Mero", "Meroitic_Hieroglyphs"},
+        {"Plrd", "Miao"},
+        {"Modi", "Modi"},
+        {"Mong", "Mongolian"},
+        {"Mroo", "Mro"},
+        {"Mult", "Multani"},
+        {"Mymr", "Myanmar"},
+        {"Nbat", "Nabataean"},
+        {"Nand", "Nandinagari"},
+        {"Talu", "New_Tai_Lue"},
+        {"Newa", "Newa"},
+        {"Nkoo", "Nko"},
+        {"Nshu", "Nushu"},
+        {"Hmnp", "Nyiakeng_Puachue_Hmong"},
+        {"Ogam", "Ogham"},
+        {"Olck", "Ol_Chiki"},
+        {"Hung", "Old_Hungarian"},
+        {"Ital", "Old_Italic"},
+        {"Narb", "Old_North_Arabian"},
+        {"Perm", "Old_Permic"},
+        {"Xpeo", "Old_Persian"},
+        {"Sogo", "Old_Sogdian"},
+        {"Sarb", "Old_South_Arabian"},
+        {"Orkh", "Old_Turkic"},
+        {"Ougr", "Old_Uyghur"},
+        {"Orya", "Oriya"},
+        {"Osge", "Osage"},
+        {"Osma", "Osmanya"},
+        {"Hmng", "Pahawh_Hmong"},
+        {"Palm", "Palmyrene"},
+        {"Pauc", "Pau_Cin_Hau"},
+        {"Phag", "Phags_Pa"},
+        {"Phnx", "Phoenician"},
+        {"Phlp", "Psalter_Pahlavi"},
+        {"Rjng", "Rejang"},
+        {"Runr", "Runic"},
+        {"Samr", "Samaritan"},
+        {"Saur", "Saurashtra"},
+        {"Shrd", "Sharada"},
+        {"Shaw", "Shavian"},
+        {"Sidd", "Siddham"},
+        {"Sgnw", "SignWriting"},
+        {"Sinh", "Sinhala"},
+        {"Sogd", "Sogdian"},
+        {"Sora", "Sora_Sompeng"},
+        {"Soyo", "Soyombo"},
+        {"Sund", "Sundanese"},
+        {"Sylo", "Syloti_Nagri"},
+        {"Syrc", "Syriac"},
+        {"Tglg", "Tagalog"},
+        {"Tagb", "Tagbanwa"},
+        {"Tale", "Tai_Le"},
+        {"Lana", "Tai_Tham"},
+        {"Tavt", "Tai_Viet"},
+        {"Takr", "Takri"},
+        {"Taml", "Tamil"},
+        {"Tnsa", "Tangsa"},
+        {"Tang", "Tangut"},
+        {"Telu", "Telugu"},
+        {"Thaa", "Thaana"},
+        {"Thai", "Thai"},
+        {"Tibt", "Tibetan"},
+        {"Tfng", "Tifinagh"},
+        {"Tirh", "Tirhuta"},
+        {"Toto", "Toto"},
+        {"Ugar", "Ugaritic"},
+        {"Zzzz", "Unknown"},
+        {"Vaii", "Vai"},
+        {"Vith", "Vithkuqi"},
+        {"Wcho", "Wancho"},
+        {"Wara", "Warang_Citi"},
+        {"Yezi", "Yezidi"},
+        {"Yiii", "Yi"},
+        {"Zanb", "Zanabazar_Square"},
+    };
+    const size_t SCRIPT_COUNT = 162;
+
+    const UnicodeRun SCRIPT_RUNS[] = {
+        {0x0, 24}, {0x41, 69}, {0x5B, 24}, {0x61, 69}, {0x7B, 24}, {0xAA, 69},
+        {0xAB, 24}, {0xBA, 69}, {0xBB, 24}, {0xC0, 69}, {0xD7, 24}, {0xD8, 69},
+        {0xF7, 24}, {0xF8, 69}, {0x2B9, 24}, {0x2E0, 69}, {0x2E5, 24}, {0x2EA, 12},
+        {0x2EC, 24}, {0x300, 55}, {0x370, 43}, {0x374, 24}, {0x375, 43}, {0x378, 154},
+        {0x37A, 43}, {0x37E, 24}, {0x37F, 43}, {0x380, 154}, {0x384, 43}, {0x385, 24},
+        {0x386, 43}, {0x387, 24}, {0x388, 43}, {0x38B, 154}, {0x38C, 43}, {0x38D, 154},
+        {0x38E, 43}, {0x3A2, 154}, {0x3A3, 43}, {0x3E2, 25}, {0x3F0, 43}, {0x400, 29},
+        {0x485, 55}, {0x487, 29}, {0x530, 154}, {0x531, 4}, {0x557, 154}, {0x559, 4},
+        {0x58B, 154}, {0x58D, 4}, {0x590, 154}, {0x591, 52}, {0x5C8, 154}, {0x5D0, 52},
+        {0x5EB, 154}, {0x5EF, 52}, {0x5F5, 154}, {0x600, 3}, {0x605, 24}, {0x606, 3},
+        {0x60C, 24}, {0x60D, 3}, {0x61B, 24}, {0x61C, 3}, {0x61F, 24}, {0x620, 3},
+        {0x640, 24}, {0x641, 3}, {0x64B, 55}, {0x656, 3}, {0x670, 55}, {0x671, 3},
+        {0x6DD, 24}, {0x6DE, 3}, {0x700, 136}, {0x70E, 154}, {0x70F, 136}, {0x74B, 154},
+        {0x74D, 136}, {0x750, 3}, {0x780, 147}, {0x7B2, 154}, {0x7C0, 99}, {0x7FB, 154},
+        {0x7FD, 99}, {0x800, 124}, {0x82E, 154}, {0x830, 124}, {0x83F, 154}, {0x840, 80},
+        {0x85C, 154}, {0x85E, 80}, {0x85F, 154}, {0x860, 136}, {0x86B, 154}, {0x870, 3},
+        {0x88F, 154}, {0x890, 3}, {0x892, 154}, {0x898, 3}, {0x8E2, 24}, {0x8E3, 3},
+        {0x900, 31}, {0x951, 55}, {0x955, 31}, {0x964, 24}, {0x966, 31}, {0x980, 10},
+        {0x984, 154}, {0x985, 10}, {0x98D, 154}, {0x98F, 10}, {0x991, 154}, {0x993, 10},
+        {0x9A9, 154}, {0x9AA, 10}, {0x9B1, 154}, {0x9B2, 10}, {0x9B3, 154}, {0x9B6, 10},
+        {0x9BA, 154}, {0x9BC, 10}, {0x9C5, 154}, {0x9C7, 10}, {0x9C9, 154}, {0x9CB, 10},
+        {0x9CF, 154}, {0x9D7, 10}, {0x9D8, 154}, {0x9DC, 10}, {0x9DE, 154}, {0x9DF, 10},
+        {0x9E4, 154}, {0x9E6, 10}, {0x9FF, 154}, {0xA01, 46}, {0xA04, 154}, {0xA05, 46},
+        {0xA0B, 154}, {0xA0F, 46}, {0xA11, 154}, {0xA13, 46}, {0xA29, 154}, {0xA2A, 46},
+        {0xA31, 154}, {0xA32, 46}, {0xA34, 154}, {0xA35, 46}, {0xA37, 154}, {0xA38, 46},
+        {0xA3A, 154}, {0xA3C, 46}, {0xA3D, 154}, {0xA3E, 46}, {0xA43, 154}, {0xA47, 46},
+        {0xA49, 154}, {0xA4B, 46}, {0xA4E, 154}, {0xA51, 46}, {0xA52, 154}, {0xA59, 46},
+        {0xA5D, 154}, {0xA5E, 46}, {0xA5F, 154}, {0xA66, 46}, {0xA77, 154}, {0xA81, 44},
+        {0xA84, 154}, {0xA85, 44}, {0xA8E, 154}, {0xA8F, 44}, {0xA92, 154}, {0xA93, 44},
+        {0xAA9, 154}, {0xAAA, 44}, {0xAB1, 154}, {0xAB2, 44}, {0xAB4, 154}, {0xAB5, 44},
+        {0xABA, 154}, {0xABC, 44}, {0xAC6, 154}, {0xAC7, 44}, {0xACA, 154}, {0xACB, 44},
+        {0xACE, 154}, {0xAD0, 44}, {0xAD1, 154}, {0xAE0, 44}, {0xAE4, 154}, {0xAE6, 44},
+        {0xAF2, 154}, {0xAF9, 44}, {0xB00, 154}, {0xB01, 113}, {0xB04, 154}, {0xB05, 113},
+        {0xB0D, 154}, {0xB0F, 113}, {0xB11, 154}, {0xB13, 113}, {0xB29, 154}, {0xB2A, 113},
+        {0xB31, 154}, {0xB32, 113}, {0xB34, 154}, {0xB35, 113}, {0xB3A, 154}, {0xB3C, 113},
+        {0xB45, 154}, {0xB47, 113}, {0xB49, 154}, {0xB4B, 113}, {0xB4E, 154}, {0xB55, 113},
+        {0xB58, 154}, {0xB5C, 113}, {0xB5E, 154}, {0xB5F, 113}, {0xB64, 154}, {0xB66, 113},
+        {0xB78, 154}, {0xB82, 143}, {0xB84, 154}, {0xB85, 143}, {0xB8B, 154}, {0xB8E, 143},
+        {0xB91, 154}, {0xB92, 143}, {0xB96, 154}, {0xB99, 143}, {0xB9B, 154}, {0xB9C, 143},
+        {0xB9D, 154}, {0xB9E, 143}, {0xBA0, 154}, {0xBA3, 143}, {0xBA5, 154}, {0xBA8, 143},
+        {0xBAB, 154}, {0xBAE, 143}, {0xBBA, 154}, {0xBBE, 143}, {0xBC3, 154}, {0xBC6, 143},
+        {0xBC9, 154}, {0xBCA, 143}, {0xBCE, 154}, {0xBD0, 143}, {0xBD1, 154}, {0xBD7, 143},
+        {0xBD8, 154}, {0xBE6, 143}, {0xBFB, 154}, {0xC00, 146}, {0xC0D, 154}, {0xC0E, 146},
+        {0xC11, 154}, {0xC12, 146}, {0xC29, 154}, {0xC2A, 146}, {0xC3A, 154}, {0xC3C, 146},
+        {0xC45, 154}, {0xC46, 146}, {0xC49, 154}, {0xC4A, 146}, {0xC4E, 154}, {0xC55, 146},
+        {0xC57, 154}, {0xC58, 146}, {0xC5B, 154}, {0xC5D, 146}, {0xC5E, 154}, {0xC60, 146},
+        {0xC64, 154}, {0xC66, 146}, {0xC70, 154}, {0xC77, 146}, {0xC80, 60}, {0xC8D, 154},
+        {0xC8E, 60}, {0xC91, 154}, {0xC92, 60}, {0xCA9, 154}, {0xCAA, 60}, {0xCB4, 154},
+        {0xCB5, 60}, {0xCBA, 154}, {0xCBC, 60}, {0xCC5, 154}, {0xCC6, 60}, {0xCC9, 154},
+        {0xCCA, 60}, {0xCCE, 154}, {0xCD5, 60}, {0xCD7, 154}, {0xCDD, 60}, {0xCDF, 154},
+        {0xCE0, 60}, {0xCE4, 154}, {0xCE6, 60}, {0xCF0, 154}, {0xCF1, 60}, {0xCF3, 154},
+        {0xD00, 79}, {0xD0D, 154}, {0xD0E, 79}, {0xD11, 154}, {0xD12, 79}, {0xD45, 154},
+        {0xD46, 79}, {0xD49, 154}, {0xD4A, 79}, {0xD50, 154}, {0xD54, 79}, {0xD64, 154},
+        {0xD66, 79}, {0xD80, 154}, {0xD81, 130}, {0xD84, 154}, {0xD85, 130}, {0xD97, 154},
+        {0xD9A, 130}, {0xDB2, 154}, {0xDB3, 130}, {0xDBC, 154}, {0xDBD, 130}, {0xDBE, 154},
+        {0xDC0, 130}, {0xDC7, 154}, {0xDCA, 130}, {0xDCB, 154}, {0xDCF, 130}, {0xDD5, 154},
+        {0xDD6, 130}, {0xDD7, 154}, {0xDD8, 130}, {0xDE0, 154}, {0xDE6, 130}, {0xDF0, 154},
+        {0xDF2, 130}, {0xDF5, 154}, {0xE01, 148}, {0xE3B, 154}, {0xE3F, 24}, {0xE40, 148},
+        {0xE5C, 154}, {0xE81, 68}, {0xE83, 154}, {0xE84, 68}, {0xE85, 154}, {0xE86, 68},
+        {0xE8B, 154}, {0xE8C, 68}, {0xEA4, 154}, {0xEA5, 68}, {0xEA6, 154}, {0xEA7, 68},
+        {0xEBE, 154}, {0xEC0, 68}, {0xEC5, 154}, {0xEC6, 68}, {0xEC7, 154}, {0xEC8, 68},
+        {0xECE, 154}, {0xED0, 68}, {0xEDA, 154}, {0xEDC, 68}, {0xEE0, 154}, {0xF00, 149},
+        {0xF48, 154}, {0xF49, 149}, {0xF6D, 154}, {0xF71, 149}, {0xF98, 154}, {0xF99, 149},
+        {0xFBD, 154}, {0xFBE, 149}, {0xFCD, 154}, {0xFCE, 149}, {0xFD5, 24}, {0xFD9, 149},
+        {0xFDB, 154}, {0x1000, 94}, {0x10A0, 39}, {0x10C6, 154}, {0x10C7, 39}, {0x10C8, 154},
+        {0x10CD, 39}, {0x10CE, 154}, {0x10D0, 39}, {0x10FB, 24}, {0x10FC, 39}, {0x1100, 48},
+        {0x1200, 38}, {0x1249, 154}, {0x124A, 38}, {0x124E, 154}, {0x1250, 38}, {0x1257, 154},
+        {0x1258, 38}, {0x1259, 154}, {0x125A, 38}, {0x125E, 154}, {0x1260, 38}, {0x1289, 154},
+        {0x128A, 38}, {0x128E, 154}, {0x1290, 38}, {0x12B1, 154}, {0x12B2, 38}, {0x12B6, 154},
+        {0x12B8, 38}, {0x12BF, 154}, {0x12C0, 38}, {0x12C1, 154}, {0x12C2, 38}, {0x12C6, 154},
+        {0x12C8, 38}, {0x12D7, 154}, {0x12D8, 38}, {0x1311, 154}, {0x1312, 38}, {0x1316, 154},
+        {0x1318, 38}, {0x135B, 154}, {0x135D, 38}, {0x137D, 154}, {0x1380, 38}, {0x139A, 154},
+        {0x13A0, 22}, {0x13F6, 154}, {0x13F8, 22}, {0x13FE, 154}, {0x1400, 17}, {0x1680, 102},
+        {0x169D, 154}, {0x16A0, 123}, {0x16EB, 24}, {0x16EE, 123}, {0x16F9, 154}, {0x1700, 137},
+        {0x1716, 154}, {0x171F, 137}, {0x1720, 50}, {0x1735, 24}, {0x1737, 154}, {0x1740, 16},
+        {0x1754, 154}, {0x1760, 138}, {0x176D, 154}, {0x176E, 138}, {0x1771, 154}, {0x1772, 138},
+        {0x1774, 154}, {0x1780, 65}, {0x17DE, 154}, {0x17E0, 65}, {0x17EA, 154}, {0x17F0, 65},
+        {0x17FA, 154}, {0x1800, 91}, {0x1802, 24}, {0x1804, 91}, {0x1805, 24}, {0x1806, 91},
+        {0x181A, 154}, {0x1820, 91}, {0x1879, 154}, {0x1880, 91}, {0x18AB, 154}, {0x18B0, 17},
+        {0x18F6, 154}, {0x1900, 71}, {0x191F, 154}, {0x1920, 71}, {0x192C, 154}, {0x1930, 71},
+        {0x193C, 154}, {0x1940, 71}, {0x1941, 154}, {0x1944, 71}, {0x1950, 139}, {0x196E, 154},
+        {0x1970, 139}, {0x1975, 154}, {0x1980, 97}, {0x19AC, 154}, {0x19B0, 97}, {0x19CA, 154},
+        {0x19D0, 97}, {0x19DB, 154}, {0x19DE, 97}, {0x19E0, 65}, {0x1A00, 15}, {0x1A1C, 154},
+        {0x1A1E, 15}, {0x1A20, 140}, {0x1A5F, 154}, {0x1A60, 140}, {0x1A7D, 154}, {0x1A7F, 140},
+        {0x1A8A, 154}, {0x1A90, 140}, {0x1A9A, 154}, {0x1AA0, 140}, {0x1AAE, 154}, {0x1AB0, 55},
+        {0x1ACF, 154}, {0x1B00, 6}, {0x1B4D, 154}, {0x1B50, 6}, {0x1B7F, 154}, {0x1B80, 134},
+        {0x1BC0, 9}, {0x1BF4, 154}, {0x1BFC, 9}, {0x1C00, 70}, {0x1C38, 154}, {0x1C3B, 70},
+        {0x1C4A, 154}, {0x1C4D, 70}, {0x1C50, 103}, {0x1C80, 29}, {0x1C89, 154}, {0x1C90, 39},
+        {0x1CBB, 154}, {0x1CBD, 39}, {0x1CC0, 134}, {0x1CC8, 154}, {0x1CD0, 55}, {0x1CD3, 24},
+        {0x1CD4, 55}, {0x1CE1, 24}, {0x1CE2, 55}, {0x1CE9, 24}, {0x1CED, 55}, {0x1CEE, 24},
+        {0x1CF4, 55}, {0x1CF5, 24}, {0x1CF8, 55}, {0x1CFA, 24}, {0x1CFB, 154}, {0x1D00, 69},
+        {0x1D26, 43}, {0x1D2B, 29}, {0x1D2C, 69}, {0x1D5D, 43}, {0x1D62, 69}, {0x1D66, 43},
+        {0x1D6B, 69}, {0x1D78, 29}, {0x1D79, 69}, {0x1DBF, 43}, {0x1DC0, 55}, {0x1E00, 69},
+        {0x1F00, 43}, {0x1F16, 154}, {0x1F18, 43}, {0x1F1E, 154}, {0x1F20, 43}, {0x1F46, 154},
+        {0x1F48, 43}, {0x1F4E, 154}, {0x1F50, 43}, {0x1F58, 154}, {0x1F59, 43}, {0x1F5A, 154},
+        {0x1F5B, 43}, {0x1F5C, 154}, {0x1F5D, 43}, {0x1F5E, 154}, {0x1F5F, 43}, {0x1F7E, 154},
+        {0x1F80, 43}, {0x1FB5, 154}, {0x1FB6, 43}, {0x1FC5, 154}, {0x1FC6, 43}, {0x1FD4, 154},
+        {0x1FD6, 43}, {0x1FDC, 154}, {0x1FDD, 43}, {0x1FF0, 154}, {0x1FF2, 43}, {0x1FF5, 154},
+        {0x1FF6, 43}, {0x1FFF, 154}, {0x2000, 24}, {0x200C, 55}, {0x200E, 24}, {0x2065, 154},
+        {0x2066, 24}, {0x2071, 69}, {0x2072, 154}, {0x2074, 24}, {0x207F, 69}, {0x2080, 24},
+        {0x208F, 154}, {0x2090, 69}, {0x209D, 154}, {0x20A0, 24}, {0x20C1, 154}, {0x20D0, 55},
+        {0x20F1, 154}, {0x2100, 24}, {0x2126, 43}, {0x2127, 24}, {0x212A, 69}, {0x212C, 24},
+        {0x2132, 69}, {0x2133, 24}, {0x214E, 69}, {0x214F, 24}, {0x2160, 69}, {0x2189, 24},
+        {0x218C, 154}, {0x2190, 24}, {0x2427, 154}, {0x2440, 24}, {0x244B, 154}, {0x2460, 24},
+        {0x2800, 14}, {0x2900, 24}, {0x2B74, 154}, {0x2B76, 24}, {0x2B96, 154}, {0x2B97, 24},
+        {0x2C00, 40}, {0x2C60, 69}, {0x2C80, 25}, {0x2CF4, 154}, {0x2CF9, 25}, {0x2D00, 39},
+        {0x2D26, 154}, {0x2D27, 39}, {0x2D28, 154}, {0x2D2D, 39}, {0x2D2E, 154}, {0x2D30, 150},
+        {0x2D68, 154}, {0x2D6F, 150}, {0x2D71, 154}, {0x2D7F, 150}, {0x2D80, 38}, {0x2D97, 154},
+        {0x2DA0, 38}, {0x2DA7, 154}, {0x2DA8, 38}, {0x2DAF, 154}, {0x2DB0, 38}, {0x2DB7, 154},
+        {0x2DB8, 38}, {0x2DBF, 154}, {0x2DC0, 38}, {0x2DC7, 154}, {0x2DC8, 38}, {0x2DCF, 154},
+        {0x2DD0, 38}, {0x2DD7, 154}, {0x2DD8, 38}, {0x2DDF, 154}, {0x2DE0, 29}, {0x2E00, 24},
+        {0x2E5E, 154}, {0x2E80, 47}, {0x2E9A, 154}, {0x2E9B, 47}, {0x2EF4, 154}, {0x2F00, 47},
+        {0x2FD6, 154}, {0x2FF0, 24}, {0x2FFC, 154}, {0x3000, 24}, {0x3005, 47}, {0x3006, 24},
+        {0x3007, 47}, {0x3008, 24}, {0x3021, 47}, {0x302A, 55}, {0x302E, 48}, {0x3030, 24},
+        {0x3038, 47}, {0x303C, 24}, {0x3040, 154}, {0x3041, 53}, {0x3097, 154}, {0x3099, 55},
+        {0x309B, 24}, {0x309D, 53}, {0x30A0, 24}, {0x30A1, 61}, {0x30FB, 24}, {0x30FD, 61},
+        {0x3100, 154}, {0x3105, 12}, {0x3130, 154}, {0x3131, 48}, {0x318F, 154}, {0x3190, 24},
+        {0x31A0, 12}, {0x31C0, 24}, {0x31E4, 154}, {0x31F0, 61}, {0x3200, 48}, {0x321F, 154},
+        {0x3220, 24}, {0x3260, 48}, {0x327F, 24}, {0x32D0, 61}, {0x32FF, 24}, {0x3300, 61},
+        {0x3358, 24}, {0x3400, 47}, {0x4DC0, 24}, {0x4E00, 47}, {0xA000, 160}, {0xA48D, 154},
+        {0xA490, 160}, {0xA4C7, 154}, {0xA4D0, 74}, {0xA500, 155}, {0xA62C, 154}, {0xA640, 29},
+        {0xA6A0, 7}, {0xA6F8, 154}, {0xA700, 24}, {0xA722, 69}, {0xA788, 24}, {0xA78B, 69},
+        {0xA7CB, 154}, {0xA7D0, 69}, {0xA7D2, 154}, {0xA7D3, 69}, {0xA7D4, 154}, {0xA7D5, 69},
+        {0xA7DA, 154}, {0xA7F2, 69}, {0xA800, 135}, {0xA82D, 154}, {0xA830, 24}, {0xA83A, 154},
+        {0xA840, 119}, {0xA878, 154}, {0xA880, 125}, {0xA8C6, 154}, {0xA8CE, 125}, {0xA8DA, 154},
+        {0xA8E0, 31}, {0xA900, 62}, {0xA92E, 24}, {0xA92F, 62}, {0xA930, 122}, {0xA954, 154},
+        {0xA95F, 122}, {0xA960, 48}, {0xA97D, 154}, {0xA980, 58}, {0xA9CE, 154}, {0xA9CF, 24},
+        {0xA9D0, 58}, {0xA9DA, 154}, {0xA9DE, 58}, {0xA9E0, 94}, {0xA9FF, 154}, {0xAA00, 21},
+        {0xAA37, 154}, {0xAA40, 21}, {0xAA4E, 154}, {0xAA50, 21}, {0xAA5A, 154}, {0xAA5C, 21},
+        {0xAA60, 94}, {0xAA80, 141}, {0xAAC3, 154}, {0xAADB, 141}, {0xAAE0, 85}, {0xAAF7, 154},
+        {0xAB01, 38}, {0xAB07, 154}, {0xAB09, 38}, {0xAB0F, 154}, {0xAB11, 38}, {0xAB17, 154},
+        {0xAB20, 38}, {0xAB27, 154}, {0xAB28, 38}, {0xAB2F, 154}, {0xAB30, 69}, {0xAB5B, 24},
+        {0xAB5C, 69}, {0xAB65, 43}, {0xAB66, 69}, {0xAB6A, 24}, {0xAB6C, 154}, {0xAB70, 22},
+        {0xABC0, 85}, {0xABEE, 154}, {0xABF0, 85}, {0xABFA, 154}, {0xAC00, 48}, {0xD7A4, 154},
+        {0xD7B0, 48}, {0xD7C7, 154}, {0xD7CB, 48}, {0xD7FC, 154}, {0xF900, 47}, {0xFA6E, 154},
+        {0xFA70, 47}, {0xFADA, 154}, {0xFB00, 69}, {0xFB07, 154}, {0xFB13, 4}, {0xFB18, 154},
+        {0xFB1D, 52}, {0xFB37, 154}, {0xFB38, 52}, {0xFB3D, 154}, {0xFB3E, 52}, {0xFB3F, 154},
+        {0xFB40, 52}, {0xFB42, 154}, {0xFB43, 52}, {0xFB45, 154}, {0xFB46, 52}, {0xFB50, 3},
+        {0xFBC3, 154}, {0xFBD3, 3}, {0xFD3E, 24}, {0xFD40, 3}, {0xFD90, 154}, {0xFD92, 3},
+        {0xFDC8, 154}, {0xFDCF, 3}, {0xFDD0, 154}, {0xFDF0, 3}, {0xFE00, 55}, {0xFE10, 24},
+        {0xFE1A, 154}, {0xFE20, 55}, {0xFE2E, 29}, {0xFE30, 24}, {0xFE53, 154}, {0xFE54, 24},
+        {0xFE67, 154}, {0xFE68, 24}, {0xFE6C, 154}, {0xFE70, 3}, {0xFE75, 154}, {0xFE76, 3},
+        {0xFEFD, 154}, {0xFEFF, 24}, {0xFF00, 154}, {0xFF01, 24}, {0xFF21, 69}, {0xFF3B, 24},
+        {0xFF41, 69}, {0xFF5B, 24}, {0xFF66, 61}, {0xFF70, 24}, {0xFF71, 61}, {0xFF9E, 24},
+        {0xFFA0, 48}, {0xFFBF, 154}, {0xFFC2, 48}, {0xFFC8, 154}, {0xFFCA, 48}, {0xFFD0, 154},
+        {0xFFD2, 48}, {0xFFD8, 154}, {0xFFDA, 48}, {0xFFDD, 154}, {0xFFE0, 24}, {0xFFE7, 154},
+        {0xFFE8, 24}, {0xFFEF, 154}, {0xFFF9, 24}, {0xFFFE, 154}, {0x10000, 73}, {0x1000C, 154},
+        {0x1000D, 73}, {0x10027, 154}, {0x10028, 73}, {0x1003B, 154}, {0x1003C, 73}, {0x1003E, 154},
+        {0x1003F, 73}, {0x1004E, 154}, {0x10050, 73}, {0x1005E, 154}, {0x10080, 73}, {0x100FB, 154},
+        {0x10100, 24}, {0x10103, 154}, {0x10107, 24}, {0x10134, 154}, {0x10137, 24}, {0x10140, 43},
+        {0x1018F, 154}, {0x10190, 24}, {0x1019D, 154}, {0x101A0, 43}, {0x101A1, 154}, {0x101D0, 24},
+        {0x101FD, 55}, {0x101FE, 154}, {0x10280, 75}, {0x1029D, 154}, {0x102A0, 18}, {0x102D1, 154},
+        {0x102E0, 55}, {0x102E1, 24}, {0x102FC, 154}, {0x10300, 105}, {0x10324, 154}, {0x1032D, 105},
+        {0x10330, 41}, {0x1034B, 154}, {0x10350, 107}, {0x1037B, 154}, {0x10380, 153}, {0x1039E, 154},
+        {0x1039F, 153}, {0x103A0, 108}, {0x103C4, 154}, {0x103C8, 108}, {0x103D6, 154}, {0x10400, 30},
+        {0x10450, 127}, {0x10480, 115}, {0x1049E, 154}, {0x104A0, 115}, {0x104AA, 154}, {0x104B0, 114},
+        {0x104D4, 154}, {0x104D8, 114}, {0x104FC, 154}, {0x10500, 36}, {0x10528, 154}, {0x10530, 19},
+        {0x10564, 154}, {0x1056F, 19}, {0x10570, 156}, {0x1057B, 154}, {0x1057C, 156}, {0x1058B, 154},
+        {0x1058C, 156}, {0x10593, 154}, {0x10594, 156}, {0x10596, 154}, {0x10597, 156}, {0x105A2, 154},
+        {0x105A3, 156}, {0x105B2, 154}, {0x105B3, 156}, {0x105BA, 154}, {0x105BB, 156}, {0x105BD, 154},
+        {0x10600, 72}, {0x10737, 154}, {0x10740, 72}, {0x10756, 154}, {0x10760, 72}, {0x10768, 154},
+        {0x10780, 69}, {0x10786, 154}, {0x10787, 69}, {0x107B1, 154}, {0x107B2, 69}, {0x107BB, 154},
+        {0x10800, 27}, {0x10806, 154}, {0x10808, 27}, {0x10809, 154}, {0x1080A, 27}, {0x10836, 154},
+        {0x10837, 27}, {0x10839, 154}, {0x1083C, 27}, {0x1083D, 154}, {0x1083F, 27}, {0x10840, 54},
+        {0x10856, 154}, {0x10857, 54}, {0x10860, 117}, {0x10880, 95}, {0x1089F, 154}, {0x108A7, 95},
+        {0x108B0, 154}, {0x108E0, 51}, {0x108F3, 154}, {0x108F4, 51}, {0x108F6, 154}, {0x108FB, 51},
+        {0x10900, 120}, {0x1091C, 154}, {0x1091F, 120}, {0x10920, 76}, {0x1093A, 154}, {0x1093F, 76},
+        {0x10940, 154}, {0x10980, 88}, {0x109A0, 87}, {0x109B8, 154}, {0x109BC, 87}, {0x109D0, 154},
+        {0x109D2, 87}, {0x10A00, 63}, {0x10A04, 154}, {0x10A05, 63}, {0x10A07, 154}, {0x10A0C, 63},
+        {0x10A14, 154}, {0x10A15, 63}, {0x10A18, 154}, {0x10A19, 63}, {0x10A36, 154}, {0x10A38, 63},
+        {0x10A3B, 154}, {0x10A3F, 63}, {0x10A49, 154}, {0x10A50, 63}, {0x10A59, 154}, {0x10A60, 110},
+        {0x10A80, 106}, {0x10AA0, 154}, {0x10AC0, 81}, {0x10AE7, 154}, {0x10AEB, 81}, {0x10AF7, 154},
+        {0x10B00, 5}, {0x10B36, 154}, {0x10B39, 5}, {0x10B40, 57}, {0x10B56, 154}, {0x10B58, 57},
+        {0x10B60, 56}, {0x10B73, 154}, {0x10B78, 56}, {0x10B80, 121}, {0x10B92, 154}, {0x10B99, 121},
+        {0x10B9D, 154}, {0x10BA9, 121}, {0x10BB0, 154}, {0x10C00, 111}, {0x10C49, 154}, {0x10C80, 104},
+        {0x10CB3, 154}, {0x10CC0, 104}, {0x10CF3, 154}, {0x10CFA, 104}, {0x10D00, 49}, {0x10D28, 154},
+        {0x10D30, 49}, {0x10D3A, 154}, {0x10E60, 3}, {0x10E7F, 154}, {0x10E80, 159}, {0x10EAA, 154},
+        {0x10EAB, 159}, {0x10EAE, 154}, {0x10EB0, 159}, {0x10EB2, 154}, {0x10F00, 109}, {0x10F28, 154},
+        {0x10F30, 131}, {0x10F5A, 154}, {0x10F70, 112}, {0x10F8A, 154}, {0x10FB0, 23}, {0x10FCC, 154},
+        {0x10FE0, 37}, {0x10FF7, 154}, {0x11000, 13}, {0x1104E, 154}, {0x11052, 13}, {0x11076, 154},
+        {0x1107F, 13}, {0x11080, 59}, {0x110C3, 154}, {0x110CD, 59}, {0x110CE, 154}, {0x110D0, 132},
+        {0x110E9, 154}, {0x110F0, 132}, {0x110FA, 154}, {0x11100, 20}, {0x11135, 154}, {0x11136, 20},
+        {0x11148, 154}, {0x11150, 77}, {0x11177, 154}, {0x11180, 126}, {0x111E0, 154}, {0x111E1, 130},
+        {0x111F5, 154}, {0x11200, 66}, {0x11212, 154}, {0x11213, 66}, {0x1123F, 154}, {0x11280, 93},
+        {0x11287, 154}, {0x11288, 93}, {0x11289, 154}, {0x1128A, 93}, {0x1128E, 154}, {0x1128F, 93},
+        {0x1129E, 154}, {0x1129F, 93}, {0x112AA, 154}, {0x112B0, 67}, {0x112EB, 154}, {0x112F0, 67},
+        {0x112FA, 154}, {0x11300, 42}, {0x11304, 154}, {0x11305, 42}, {0x1130D, 154}, {0x1130F, 42},
+        {0x11311, 154}, {0x11313, 42}, {0x11329, 154}, {0x1132A, 42}, {0x11331, 154}, {0x11332, 42},
+        {0x11334, 154}, {0x11335, 42}, {0x1133A, 154}, {0x1133B, 55}, {0x1133C, 42}, {0x11345, 154},
+        {0x11347, 42}, {0x11349, 154}, {0x1134B, 42}, {0x1134E, 154}, {0x11350, 42}, {0x11351, 154},
+        {0x11357, 42}, {0x11358, 154}, {0x1135D, 42}, {0x11364, 154}, {0x11366, 42}, {0x1136D, 154},
+        {0x11370, 42}, {0x11375, 154}, {0x11400, 98}, {0x1145C, 154}, {0x1145D, 98}, {0x11462, 154},
+        {0x11480, 151}, {0x114C8, 154}, {0x114D0, 151}, {0x114DA, 154}, {0x11580, 128}, {0x115B6, 154},
+        {0x115B8, 128}, {0x115DE, 154}, {0x11600, 90}, {0x11645, 154}, {0x11650, 90}, {0x1165A, 154},
+        {0x11660, 91}, {0x1166D, 154}, {0x11680, 142}, {0x116BA, 154}, {0x116C0, 142}, {0x116CA, 154},
+        {0x11700, 1}, {0x1171B, 154}, {0x1171D, 1}, {0x1172C, 154}, {0x11730, 1}, {0x11747, 154},
+        {0x11800, 33}, {0x1183C, 154}, {0x118A0, 158}, {0x118F3, 154}, {0x118FF, 158}, {0x11900, 32},
+        {0x11907, 154}, {0x11909, 32}, {0x1190A, 154}, {0x1190C, 32}, {0x11914, 154}, {0x11915, 32},
+        {0x11917, 154}, {0x11918, 32}, {0x11936, 154}, {0x11937, 32}, {0x11939, 154}, {0x1193B, 32},
+        {0x11947, 154}, {0x11950, 32}, {0x1195A, 154}, {0x119A0, 96}, {0x119A8, 154}, {0x119AA, 96},
+        {0x119D8, 154}, {0x119DA, 96}, {0x119E5, 154}, {0x11A00, 161}, {0x11A48, 154}, {0x11A50, 133},
+        {0x11AA3, 154}, {0x11AB0, 17}, {0x11AC0, 118}, {0x11AF9, 154}, {0x11C00, 11}, {0x11C09, 154},
+        {0x11C0A, 11}, {0x11C37, 154}, {0x11C38, 11}, {0x11C46, 154}, {0x11C50, 11}, {0x11C6D, 154},
+        {0x11C70, 82}, {0x11C90, 154}, {0x11C92, 82}, {0x11CA8, 154}, {0x11CA9, 82}, {0x11CB7, 154},
+        {0x11D00, 83}, {0x11D07, 154}, {0x11D08, 83}, {0x11D0A, 154}, {0x11D0B, 83}, {0x11D37, 154},
+        {0x11D3A, 83}, {0x11D3B, 154}, {0x11D3C, 83}, {0x11D3E, 154}, {0x11D3F, 83}, {0x11D48, 154},
+        {0x11D50, 83}, {0x11D5A, 154}, {0x11D60, 45}, {0x11D66, 154}, {0x11D67, 45}, {0x11D69, 154},
+        {0x11D6A, 45}, {0x11D8F, 154}, {0x11D90, 45}, {0x11D92, 154}, {0x11D93, 45}, {0x11D99, 154},
+        {0x11DA0, 45}, {0x11DAA, 154}, {0x11EE0, 78}, {0x11EF9, 154}, {0x11FB0, 74}, {0x11FB1, 154},
+        {0x11FC0, 143}, {0x11FF2, 154}, {0x11FFF, 143}, {0x12000, 26}, {0x1239A, 154}, {0x12400, 26},
+        {0x1246F, 154}, {0x12470, 26}, {0x12475, 154}, {0x12480, 26}, {0x12544, 154}, {0x12F90, 28},
+        {0x12FF3, 154}, {0x13000, 35}, {0x1342F, 154}, {0x13430, 35}, {0x13439, 154}, {0x14400, 2},
+        {0x14647, 154}, {0x16800, 7}, {0x16A39, 154}, {0x16A40, 92}, {0x16A5F, 154}, {0x16A60, 92},
+        {0x16A6A, 154}, {0x16A6E, 92}, {0x16A70, 144}, {0x16ABF, 154}, {0x16AC0, 144}, {0x16ACA, 154},
+        {0x16AD0, 8}, {0x16AEE, 154}, {0x16AF0, 8}, {0x16AF6, 154}, {0x16B00, 116}, {0x16B46, 154},
+        {0x16B50, 116}, {0x16B5A, 154}, {0x16B5B, 116}, {0x16B62, 154}, {0x16B63, 116}, {0x16B78, 154},
+        {0x16B7D, 116}, {0x16B90, 154}, {0x16E40, 84}, {0x16E9B, 154}, {0x16F00, 89}, {0x16F4B, 154},
+        {0x16F4F, 89}, {0x16F88, 154}, {0x16F8F, 89}, {0x16FA0, 154}, {0x16FE0, 145}, {0x16FE1, 100},
+        {0x16FE2, 47}, {0x16FE4, 64}, {0x16FE5, 154}, {0x16FF0, 47}, {0x16FF2, 154}, {0x17000, 145},
+        {0x187F8, 154}, {0x18800, 145}, {0x18B00, 64}, {0x18CD6, 154}, {0x18D00, 145}, {0x18D09, 154},
+        {0x1AFF0, 61}, {0x1AFF4, 154}, {0x1AFF5, 61}, {0x1AFFC, 154}, {0x1AFFD, 61}, {0x1AFFF, 154},
+        {0x1B000, 61}, {0x1B001, 53}, {0x1B120, 61}, {0x1B123, 154}, {0x1B150, 53}, {0x1B153, 154},
+        {0x1B164, 61}, {0x1B168, 154}, {0x1B170, 100}, {0x1B2FC, 154}, {0x1BC00, 34}, {0x1BC6B, 154},
+        {0x1BC70, 34}, {0x1BC7D, 154}, {0x1BC80, 34}, {0x1BC89, 154}, {0x1BC90, 34}, {0x1BC9A, 154},
+        {0x1BC9C, 34}, {0x1BCA0, 24}, {0x1BCA4, 154}, {0x1CF00, 55}, {0x1CF2E, 154}, {0x1CF30, 55},
+        {0x1CF47, 154}, {0x1CF50, 24}, {0x1CFC4, 154}, {0x1D000, 24}, {0x1D0F6, 154}, {0x1D100, 24},
+        {0x1D127, 154}, {0x1D129, 24}, {0x1D167, 55}, {0x1D16A, 24}, {0x1D17B, 55}, {0x1D183, 24},
+        {0x1D185, 55}, {0x1D18C, 24}, {0x1D1AA, 55}, {0x1D1AE, 24}, {0x1D1EB, 154}, {0x1D200, 43},
+        {0x1D246, 154}, {0x1D2E0, 24}, {0x1D2F4, 154}, {0x1D300, 24}, {0x1D357, 154}, {0x1D360, 24},
+        {0x1D379, 154}, {0x1D400, 24}, {0x1D455, 154}, {0x1D456, 24}, {0x1D49D, 154}, {0x1D49E, 24},
+        {0x1D4A0, 154}, {0x1D4A2, 24}, {0x1D4A3, 154}, {0x1D4A5, 24}, {0x1D4A7, 154}, {0x1D4A9, 24},
+        {0x1D4AD, 154}, {0x1D4AE, 24}, {0x1D4BA, 154}, {0x1D4BB, 24}, {0x1D4BC, 154}, {0x1D4BD, 24},
+        {0x1D4C4, 154}, {0x1D4C5, 24}, {0x1D506, 154}, {0x1D507, 24}, {0x1D50B, 154}, {0x1D50D, 24},
+        {0x1D515, 154}, {0x1D516, 24}, {0x1D51D, 154}, {0x1D51E, 24}, {0x1D53A, 154}, {0x1D53B, 24},
+        {0x1D53F, 154}, {0x1D540, 24}, {0x1D545, 154}, {0x1D546, 24}, {0x1D547, 154}, {0x1D54A, 24},
+        {0x1D551, 154}, {0x1D552, 24}, {0x1D6A6, 154}, {0x1D6A8, 24}, {0x1D7CC, 154}, {0x1D7CE, 24},
+        {0x1D800, 129}, {0x1DA8C, 154}, {0x1DA9B, 129}, {0x1DAA0, 154}, {0x1DAA1, 129}, {0x1DAB0, 154},
+        {0x1DF00, 69}, {0x1DF1F, 154}, {0x1E000, 40}, {0x1E007, 154}, {0x1E008, 40}, {0x1E019, 154},
+        {0x1E01B, 40}, {0x1E022, 154}, {0x1E023, 40}, {0x1E025, 154}, {0x1E026, 40}, {0x1E02B, 154},
+        {0x1E100, 101}, {0x1E12D, 154}, {0x1E130, 101}, {0x1E13E, 154}, {0x1E140, 101}, {0x1E14A, 154},
+        {0x1E14E, 101}, {0x1E150, 154}, {0x1E290, 152}, {0x1E2AF, 154}, {0x1E2C0, 157}, {0x1E2FA, 154},
+        {0x1E2FF, 157}, {0x1E300, 154}, {0x1E7E0, 38}, {0x1E7E7, 154}, {0x1E7E8, 38}, {0x1E7EC, 154},
+        {0x1E7ED, 38}, {0x1E7EF, 154}, {0x1E7F0, 38}, {0x1E7FF, 154}, {0x1E800, 86}, {0x1E8C5, 154},
+        {0x1E8C7, 86}, {0x1E8D7, 154}, {0x1E900, 0}, {0x1E94C, 154}, {0x1E950, 0}, {0x1E95A, 154},
+        {0x1E95E, 0}, {0x1E960, 154}, {0x1EC71, 24}, {0x1ECB5, 154}, {0x1ED01, 24}, {0x1ED3E, 154},
+        {0x1EE00, 3}, {0x1EE04, 154}, {0x1EE05, 3}, {0x1EE20, 154}, {0x1EE21, 3}, {0x1EE23, 154},
+        {0x1EE24, 3}, {0x1EE25, 154}, {0x1EE27, 3}, {0x1EE28, 154}, {0x1EE29, 3}, {0x1EE33, 154},
+        {0x1EE34, 3}, {0x1EE38, 154}, {0x1EE39, 3}, {0x1EE3A, 154}, {0x1EE3B, 3}, {0x1EE3C, 154},
+        {0x1EE42, 3}, {0x1EE43, 154}, {0x1EE47, 3}, {0x1EE48, 154}, {0x1EE49, 3}, {0x1EE4A, 154},
+        {0x1EE4B, 3}, {0x1EE4C, 154}, {0x1EE4D, 3}, {0x1EE50, 154}, {0x1EE51, 3}, {0x1EE53, 154},
+        {0x1EE54, 3}, {0x1EE55, 154}, {0x1EE57, 3}, {0x1EE58, 154}, {0x1EE59, 3}, {0x1EE5A, 154},
+        {0x1EE5B, 3}, {0x1EE5C, 154}, {0x1EE5D, 3}, {0x1EE5E, 154}, {0x1EE5F, 3}, {0x1EE60, 154},
+        {0x1EE61, 3}, {0x1EE63, 154}, {0x1EE64, 3}, {0x1EE65, 154}, {0x1EE67, 3}, {0x1EE6B, 154},
+        {0x1EE6C, 3}, {0x1EE73, 154}, {0x1EE74, 3}, {0x1EE78, 154}, {0x1EE79, 3}, {0x1EE7D, 154},
+        {0x1EE7E, 3}, {0x1EE7F, 154}, {0x1EE80, 3}, {0x1EE8A, 154}, {0x1EE8B, 3}, {0x1EE9C, 154},
+        {0x1EEA1, 3}, {0x1EEA4, 154}, {0x1EEA5, 3}, {0x1EEAA, 154}, {0x1EEAB, 3}, {0x1EEBC, 154},
+        {0x1EEF0, 3}, {0x1EEF2, 154}, {0x1F000, 24}, {0x1F02C, 154}, {0x1F030, 24}, {0x1F094, 154},
+        {0x1F0A0, 24}, {0x1F0AF, 154}, {0x1F0B1, 24}, {0x1F0C0, 154}, {0x1F0C1, 24}, {0x1F0D0, 154},
+        {0x1F0D1, 24}, {0x1F0F6, 154}, {0x1F100, 24}, {0x1F1AE, 154}, {0x1F1E6, 24}, {0x1F200, 53},
+        {0x1F201, 24}, {0x1F203, 154}, {0x1F210, 24}, {0x1F23C, 154}, {0x1F240, 24}, {0x1F249, 154},
+        {0x1F250, 24}, {0x1F252, 154}, {0x1F260, 24}, {0x1F266, 154}, {0x1F300, 24}, {0x1F6D8, 154},
+        {0x1F6DD, 24}, {0x1F6ED, 154}, {0x1F6F0, 24}, {0x1F6FD, 154}, {0x1F700, 24}, {0x1F774, 154},
+        {0x1F780, 24}, {0x1F7D9, 154}, {0x1F7E0, 24}, {0x1F7EC, 154}, {0x1F7F0, 24}, {0x1F7F1, 154},
+        {0x1F800, 24}, {0x1F80C, 154}, {0x1F810, 24}, {0x1F848, 154}, {0x1F850, 24}, {0x1F85A, 154},
+        {0x1F860, 24}, {0x1F888, 154}, {0x1F890, 24}, {0x1F8AE, 154}, {0x1F8B0, 24}, {0x1F8B2, 154},
+        {0x1F900, 24}, {0x1FA54, 154}, {0x1FA60, 24}, {0x1FA6E, 154}, {0x1FA70, 24}, {0x1FA75, 154},
+        {0x1FA78, 24}, {0x1FA7D, 154}, {0x1FA80, 24}, {0x1FA87, 154}, {0x1FA90, 24}, {0x1FAAD, 154},
+        {0x1FAB0, 24}, {0x1FABB, 154}, {0x1FAC0, 24}, {0x1FAC6, 154}, {0x1FAD0, 24}, {0x1FADA, 154},
+        {0x1FAE0, 24}, {0x1FAE8, 154}, {0x1FAF0, 24}, {0x1FAF7, 154}, {0x1FB00, 24}, {0x1FB93, 154},
+        {0x1FB94, 24}, {0x1FBCB, 154}, {0x1FBF0, 24}, {0x1FBFA, 154}, {0x20000, 47}, {0x2A6E0, 154},
+        {0x2A700, 47}, {0x2B739, 154}, {0x2B740, 47}, {0x2B81E, 154}, {0x2B820, 47}, {0x2CEA2, 154},
+        {0x2CEB0, 47}, {0x2EBE1, 154}, {0x2F800, 47}, {0x2FA1E, 154}, {0x30000, 47}, {0x3134B, 154},
+        {0xE0001, 24}, {0xE0002, 154}, {0xE0020, 24}, {0xE0080, 154}, {0xE0100, 55}, {0xE01F0, 154},
+    };
+    const size_t SCRIPT_RUN_COUNT = 1638;
+
+    const UnicodeCaseOrbit CASE_ORBITS[] = {
+        {0x41, 0x61}, {0x42, 0x62}, {0x43, 0x63}, {0x44, 0x64}, {0x45, 0x65}, {0x46, 0x66},
+        {0x47, 0x67}, {0x48, 0x68}, {0x49, 0x69}, {0x4A, 0x6A}, {0x4B, 0x6B}, {0x4C, 0x6C},
+        {0x4D, 0x6D}, {0x4E, 0x6E}, {0x4F, 0x6F}, {0x50, 0x70}, {0x51, 0x71}, {0x52, 0x72},
+        {0x53, 0x73}, {0x54, 0x74}, {0x55, 0x75}, {0x56, 0x76}, {0x57, 0x77}, {0x58, 0x78},
+        {0x59, 0x79}, {0x5A, 0x7A}, {0x61, 0x41}, {0x62, 0x42}, {0x63, 0x43}, {0x64, 0x44},
+        {0x65, 0x45}, {0x66, 0x46}, {0x67, 0x47}, {0x68, 0x48}, {0x69, 0x49}, {0x6A, 0x4A},
+        {0x6B, 0x212A}, {0x6C, 0x4C}, {0x6D, 0x4D}, {0x6E, 0x4E}, {0x6F, 0x4F}, {0x70, 0x50},
+        {0x71, 0x51}, {0x72, 0x52}, {0x73, 0x17F}, {0x74, 0x54}, {0x75, 0x55}, {0x76, 0x56},
+        {0x77, 0x57}, {0x78, 0x58}, {0x79, 0x59}, {0x7A, 0x5A}, {0xB5, 0x39C}, {0xC0, 0xE0},
+        {0xC1, 0xE1}, {0xC2, 0xE2}, {0xC3, 0xE3}, {0xC4, 0xE4}, {0xC5, 0xE5}, {0xC6, 0xE6},
+        {0xC7, 0xE7}, {0xC8, 0xE8}, {0xC9, 0xE9}, {0xCA, 0xEA}, {0xCB, 0xEB}, {0xCC, 0xEC},
+        {0xCD, 0xED}, {0xCE, 0xEE}, {0xCF, 0xEF}, {0xD0, 0xF0}, {0xD1, 0xF1}, {0xD2, 0xF2},
+        {0xD3, 0xF3}, {0xD4, 0xF4}, {0xD5, 0xF5}, {0xD6, 0xF6}, {0xD8, 0xF8}, {0xD9, 0xF9},
+        {0xDA, 0xFA}, {0xDB, 0xFB}, {0xDC, 0xFC}, {0xDD, 0xFD}, {0xDE, 0xFE}, {0xDF, 0x1E9E},
+        {0xE0, 0xC0}, {0xE1, 0xC1}, {0xE2, 0xC2}, {0xE3, 0xC3}, {0xE4, 0xC4}, {0xE5, 0x212B},
+        {0xE6, 0xC6}, {0xE7, 0xC7}, {0xE8, 0xC8}, {0xE9, 0xC9}, {0xEA, 0xCA}, {0xEB, 0xCB},
+        {0xEC, 0xCC}, {0xED, 0xCD}, {0xEE, 0xCE}, {0xEF, 0xCF}, {0xF0, 0xD0}, {0xF1, 0xD1},
+        {0xF2, 0xD2}, {0xF3, 0xD3}, {0xF4, 0xD4}, {0xF5, 0xD5}, {0xF6, 0xD6}, {0xF8, 0xD8},
+        {0xF9, 0xD9}, {0xFA, 0xDA}, {0xFB, 0xDB}, {0xFC, 0xDC}, {0xFD, 0xDD}, {0xFE, 0xDE},
+        {0xFF, 0x178}, {0x100, 0x101}, {0x101, 0x100}, {0x102, 0x103}, {0x103, 0x102}, {0x104, 0x105},
+        {0x105, 0x104}, {0x106, 0x107}, {0x107, 0x106}, {0x108, 0x109}, {0x109, 0x108}, {0x10A, 0x10B},
+        {0x10B, 0x10A}, {0x10C, 0x10D}, {0x10D, 0x10C}, {0x10E, 0x10F}, {0x10F, 0x10E}, {0x110, 0x111},
+        {0x111, 0x110}, {0x112, 0x113}, {0x113, 0x112}, {0x114, 0x115}, {0x115, 0x114}, {0x116, 0x117},
+        {0x117, 0x116}, {0x118, 0x119}, {0x119, 0x118}, {0x11A, 0x11B}, {0x11B, 0x11A}, {0x11C, 0x11D},
+        {0x11D, 0x11C}, {0x11E, 0x11F}, {0x11F, 0x11E}, {0x120, 0x121}, {0x121, 0x120}, {0x122, 0x123},
+        {0x123, 0x122}, {0x124, 0x125}, {0x125, 0x124}, {0x126, 0x127}, {0x127, 0x126}, {0x128, 0x129},
+        {0x129, 0x128}, {0x12A, 0x12B}, {0x12B, 0x12A}, {0x12C, 0x12D}, {0x12D, 0x12C}, {0x12E, 0x12F},
+        {0x12F, 0x12E}, {0x132, 0x133}, {0x133, 0x132}, {0x134, 0x135}, {0x135, 0x134}, {0x136, 0x137},
+        {0x137, 0x136}, {0x139, 0x13A}, {0x13A, 0x139}, {0x13B, 0x13C}, {0x13C, 0x13B}, {0x13D, 0x13E},
+        {0x13E, 0x13D}, {0x13F, 0x140}, {0x140, 0x13F}, {0x141, 0x142}, {0x142, 0x141}, {0x143, 0x144},
+        {0x144, 0x143}, {0x145, 0x146}, {0x146, 0x145}, {0x147, 0x148}, {0x148, 0x147}, {0x14A, 0x14B},
+        {0x14B, 0x14A}, {0x14C, 0x14D}, {0x14D, 0x14C}, {0x14E, 0x14F}, {0x14F, 0x14E}, {0x150, 0x151},
+        {0x151, 0x150}, {0x152, 0x153}, {0x153, 0x152}, {0x154, 0x155}, {0x155, 0x154}, {0x156, 0x157},
+        {0x157, 0x156}, {0x158, 0x159}, {0x159, 0x158}, {0x15A, 0x15B}, {0x15B, 0x15A}, {0x15C, 0x15D},
+        {0x15D, 0x15C}, {0x15E, 0x15F}, {0x15F, 0x15E}, {0x160, 0x161}, {0x161, 0x160}, {0x162, 0x163},
+        {0x163, 0x162}, {0x164, 0x165}, {0x165, 0x164}, {0x166, 0x167}, {0x167, 0x166}, {0x168, 0x169},
+        {0x169, 0x168}, {0x16A, 0x16B}, {0x16B, 0x16A}, {0x16C, 0x16D}, {0x16D, 0x16C}, {0x16E, 0x16F},
+        {0x16F, 0x16E}, {0x170, 0x171}, {0x171, 0x170}, {0x172, 0x173}, {0x173, 0x172}, {0x174, 0x175},
+        {0x175, 0x174}, {0x176, 0x177}, {0x177, 0x176}, {0x178, 0xFF}, {0x179, 0x17A}, {0x17A, 0x179},
+        {0x17B, 0x17C}, {0x17C, 0x17B}, {0x17D, 0x17E}, {0x17E, 0x17D}, {0x17F, 0x53}, {0x180, 0x243},
+        {0x181, 0x253}, {0x182, 0x183}, {0x183, 0x182}, {0x184, 0x185}, {0x185, 0x184}, {0x186, 0x254},
+        {0x187, 0x188}, {0x188, 0x187}, {0x189, 0x256}, {0x18A, 0x257}, {0x18B, 0x18C}, {0x18C, 0x18B},
+        {0x18E, 0x1DD}, {0x18F, 0x259}, {0x190, 0x25B}, {0x191, 0x192}, {0x192, 0x191}, {0x193, 0x260},
+        {0x194, 0x263}, {0x195, 0x1F6}, {0x196, 0x269}, {0x197, 0x268}, {0x198, 0x199}, {0x199, 0x198},
+        {0x19A, 0x23D}, {0x19C, 0x26F}, {0x19D, 0x272}, {0x19E, 0x220}, {0x19F, 0x275}, {0x1A0, 0x1A1},
+        {0x1A1, 0x1A0}, {0x1A2, 0x1A3}, {0x1A3, 0x1A2}, {0x1A4, 0x1A5}, {0x1A5, 0x1A4}, {0x1A6, 0x280},
+        {0x1A7, 0x1A8}, {0x1A8, 0x1A7}, {0x1A9, 0x283}, {0x1AC, 0x1AD}, {0x1AD, 0x1AC}, {0x1AE, 0x288},
+        {0x1AF, 0x1B0}, {0x1B0, 0x1AF}, {0x1B1, 0x28A}, {0x1B2, 0x28B}, {0x1B3, 0x1B4}, {0x1B4, 0x1B3},
+        {0x1B5, 0x1B6}, {0x1B6, 0x1B5}, {0x1B7, 0x292}, {0x1B8, 0x1B9}, {0x1B9, 0x1B8}, {0x1BC, 0x1BD},
+        {0x1BD, 0x1BC}, {0x1BF, 0x1F7}, {0x1C4, 0x1C5}, {0x1C5, 0x1C6}, {0x1C6, 0x1C4}, {0x1C7, 0x1C8},
+        {0x1C8, 0x1C9}, {0x1C9, 0x1C7}, {0x1CA, 0x1CB}, {0x1CB, 0x1CC}, {0x1CC, 0x1CA}, {0x1CD, 0x1CE},
+        {0x1CE, 0x1CD}, {0x1CF, 0x1D0}, {0x1D0, 0x1CF}, {0x1D1, 0x1D2}, {0x1D2, 0x1D1}, {0x1D3, 0x1D4},
+        {0x1D4, 0x1D3}, {0x1D5, 0x1D6}, {0x1D6, 0x1D5}, {0x1D7, 0x1D8}, {0x1D8, 0x1D7}, {0x1D9, 0x1DA},
+        {0x1DA, 0x1D9}, {0x1DB, 0x1DC}, {0x1DC, 0x1DB}, {0x1DD, 0x18E}, {0x1DE, 0x1DF}, {0x1DF, 0x1DE},
+        {0x1E0, 0x1E1}, {0x1E1, 0x1E0}, {0x1E2, 0x1E3}, {0x1E3, 0x1E2}, {0x1E4, 0x1E5}, {0x1E5, 0x1E4},
+        {0x1E6, 0x1E7}, {0x1E7, 0x1E6}, {0x1E8, 0x1E9}, {0x1E9, 0x1E8}, {0x1EA, 0x1EB}, {0x1EB, 0x1EA},
+        {0x1EC, 0x1ED}, {0x1ED, 0x1EC}, {0x1EE, 0x1EF}, {0x1EF, 0x1EE}, {0x1F1, 0x1F2}, {0x1F2, 0x1F3},
+        {0x1F3, 0x1F1}, {0x1F4, 0x1F5}, {0x1F5, 0x1F4}, {0x1F6, 0x195}, {0x1F7, 0x1BF}, {0x1F8, 0x1F9},
+        {0x1F9, 0x1F8}, {0x1FA, 0x1FB}, {0x1FB, 0x1FA}, {0x1FC, 0x1FD}, {0x1FD, 0x1FC}, {0x1FE, 0x1FF},
+        {0x1FF, 0x1FE}, {0x200, 0x201}, {0x201, 0x200}, {0x202, 0x203}, {0x203, 0x202}, {0x204, 0x205},
+        {0x205, 0x204}, {0x206, 0x207}, {0x207, 0x206}, {0x208, 0x209}, {0x209, 0x208}, {0x20A, 0x20B},
+        {0x20B, 0x20A}, {0x20C, 0x20D}, {0x20D, 0x20C}, {0x20E, 0x20F}, {0x20F, 0x20E}, {0x210, 0x211},
+        {0x211, 0x210}, {0x212, 0x213}, {0x213, 0x212}, {0x214, 0x215}, {0x215, 0x214}, {0x216, 0x217},
+        {0x217, 0x216}, {0x218, 0x219}, {0x219, 0x218}, {0x21A, 0x21B}, {0x21B, 0x21A}, {0x21C, 0x21D},
+        {0x21D, 0x21C}, {0x21E, 0x21F}, {0x21F, 0x21E}, {0x220, 0x19E}, {0x222, 0x223}, {0x223, 0x222},
+        {0x224, 0x225}, {0x225, 0x224}, {0x226, 0x227}, {0x227, 0x226}, {0x228, 0x229}, {0x229, 0x228},
+        {0x22A, 0x22B}, {0x22B, 0x22A}, {0x22C, 0x22D}, {0x22D, 0x22C}, {0x22E, 0x22F}, {0x22F, 0x22E},
+        {0x230, 0x231}, {0x231, 0x230}, {0x232, 0x233}, {0x233, 0x232}, {0x23A, 0x2C65}, {0x23B, 0x23C},
+        {0x23C, 0x23B}, {0x23D, 0x19A}, {0x23E, 0x2C66}, {0x23F, 0x2C7E}, {0x240, 0x2C7F}, {0x241, 0x242},
+        {0x242, 0x241}, {0x243, 0x180}, {0x244, 0x289}, {0x245, 0x28C}, {0x246, 0x247}, {0x247, 0x246},
+        {0x248, 0x249}, {0x249, 0x248}, {0x24A, 0x24B}, {0x24B, 0x24A}, {0x24C, 0x24D}, {0x24D, 0x24C},
+        {0x24E, 0x24F}, {0x24F, 0x24E}, {0x250, 0x2C6F}, {0x251, 0x2C6D}, {0x252, 0x2C70}, {0x253, 0x181},
+        {0x254, 0x186}, {0x256, 0x189}, {0x257, 0x18A}, {0x259, 0x18F}, {0x25B, 0x190}, {0x25C, 0xA7AB},
+        {0x260, 0x193}, {0x261, 0xA7AC}, {0x263, 0x194}, {0x265, 0xA78D}, {0x266, 0xA7AA}, {0x268, 0x197},
+        {0x269, 0x196}, {0x26A, 0xA7AE}, {0x26B, 0x2C62}, {0x26C, 0xA7AD}, {0x26F, 0x19C}, {0x271, 0x2C6E},
+        {0x272, 0x19D}, {0x275, 0x19F}, {0x27D, 0x2C64}, {0x280, 0x1A6}, {0x282, 0xA7C5}, {0x283, 0x1A9},
+        {0x287, 0xA7B1}, {0x288, 0x1AE}, {0x289, 0x244}, {0x28A, 0x1B1}, {0x28B, 0x1B2}, {0x28C, 0x245},
+        {0x292, 0x1B7}, {0x29D, 0xA7B2}, {0x29E, 0xA7B0}, {0x345, 0x399}, {0x370, 0x371}, {0x371, 0x370},
+        {0x372, 0x373}, {0x373, 0x372}, {0x376, 0x377}, {0x377, 0x376}, {0x37B, 0x3FD}, {0x37C, 0x3FE},
+        {0x37D, 0x3FF}, {0x37F, 0x3F3}, {0x386, 0x3AC}, {0x388, 0x3AD}, {0x389, 0x3AE}, {0x38A, 0x3AF},
+        {0x38C, 0x3CC}, {0x38E, 0x3CD}, {0x38F, 0x3CE}, {0x391, 0x3B1}, {0x392, 0x3B2}, {0x393, 0x3B3},
+        {0x394, 0x3B4}, {0x395, 0x3B5}, {0x396, 0x3B6}, {0x397, 0x3B7}, {0x398, 0x3B8}, {0x399, 0x3B9},
+        {0x39A, 0x3BA}, {0x39B, 0x3BB}, {0x39C, 0x3BC}, {0x39D, 0x3BD}, {0x39E, 0x3BE}, {0x39F, 0x3BF},
+        {0x3A0, 0x3C0}, {0x3A1, 0x3C1}, {0x3A3, 0x3C2}, {0x3A4, 0x3C4}, {0x3A5, 0x3C5}, {0x3A6, 0x3C6},
+        {0x3A7, 0x3C7}, {0x3A8, 0x3C8}, {0x3A9, 0x3C9}, {0x3AA, 0x3CA}, {0x3AB, 0x3CB}, {0x3AC, 0x386},
+        {0x3AD, 0x388}, {0x3AE, 0x389}, {0x3AF, 0x38A}, {0x3B1, 0x391}, {0x3B2, 0x3D0}, {0x3B3, 0x393},
+        {0x3B4, 0x394}, {0x3B5, 0x3F5}, {0x3B6, 0x396}, {0x3B7, 0x397}, {0x3B8, 0x3D1}, {0x3B9, 0x1FBE},
+        {0x3BA, 0x3F0}, {0x3BB, 0x39B}, {0x3BC, 0xB5}, {0x3BD, 0x39D}, {0x3BE, 0x39E}, {0x3BF, 0x39F},
+        {0x3C0, 0x3D6}, {0x3C1, 0x3F1}, {0x3C2, 0x3C3}, {0x3C3, 0x3A3}, {0x3C4, 0x3A4}, {0x3C5, 0x3A5},
+        {0x3C6, 0x3D5}, {0x3C7, 0x3A7}, {0x3C8, 0x3A8}, {0x3C9, 0x2126}, {0x3CA, 0x3AA}, {0x3CB, 0x3AB},
+        {0x3CC, 0x38C}, {0x3CD, 0x38E}, {0x3CE, 0x38F}, {0x3CF, 0x3D7}, {0x3D0, 0x392}, {0x3D1, 0x3F4},
+        {0x3D5, 0x3A6}, {0x3D6, 0x3A0}, {0x3D7, 0x3CF}, {0x3D8, 0x3D9}, {0x3D9, 0x3D8}, {0x3DA, 0x3DB},
+        {0x3DB, 0x3DA}, {0x3DC, 0x3DD}, {0x3DD, 0x3DC}, {0x3DE, 0x3DF}, {0x3DF, 0x3DE}, {0x3E0, 0x3E1},
+        {0x3E1, 0x3E0}, {0x3E2, 0x3E3}, {0x3E3, 0x3E2}, {0x3E4, 0x3E5}, {0x3E5, 0x3E4}, {0x3E6, 0x3E7},
+        {0x3E7, 0x3E6}, {0x3E8, 0x3E9}, {0x3E9, 0x3E8}, {0x3EA, 0x3EB}, {0x3EB, 0x3EA}, {0x3EC, 0x3ED},
+        {0x3ED, 0x3EC}, {0x3EE, 0x3EF}, {0x3EF, 0x3EE}, {0x3F0, 0x39A}, {0x3F1, 0x3A1}, {0x3F2, 0x3F9},
+        {0x3F3, 0x37F}, {0x3F4, 0x398}, {0x3F5, 0x395}, {0x3F7, 0x3F8}, {0x3F8, 0x3F7}, {0x3F9, 0x3F2},
+        {0x3FA, 0x3FB}, {0x3FB, 0x3FA}, {0x3FD, 0x37B}, {0x3FE, 0x37C}, {0x3FF, 0x37D}, {0x400, 0x450},
+        {0x401, 0x451}, {0x402, 0x452}, {0x403, 0x453}, {0x404, 0x454}, {0x405, 0x455}, {0x406, 0x456},
+        {0x407, 0x457}, {0x408, 0x458}, {0x409, 0x459}, {0x40A, 0x45A}, {0x40B, 0x45B}, {0x40C, 0x45C},
+        {0x40D, 0x45D}, {0x40E, 0x45E}, {0x40F, 0x45F}, {0x410, 0x430}, {0x411, 0x431}, {0x412, 0x432},
+        {0x413, 0x433}, {0x414, 0x434}, {0x415, 0x435}, {0x416, 0x436}, {0x417, 0x437}, {0x418, 0x438},
+        {0x419, 0x439}, {0x41A, 0x43A}, {0x41B, 0x43B}, {0x41C, 0x43C}, {0x41D, 0x43D}, {0x41E, 0x43E},
+        {0x41F, 0x43F}, {0x420, 0x440}, {0x421, 0x441}, {0x422, 0x442}, {0x423, 0x443}, {0x424, 0x444},
+        {0x425, 0x445}, {0x426, 0x446}, {0x427, 0x447}, {0x428, 0x448}, {0x429, 0x449}, {0x42A, 0x44A},
+        {0x42B, 0x44B}, {0x42C, 0x44C}, {0x42D, 0x44D}, {0x42E, 0x44E}, {0x42F, 0x44F}, {0x430, 0x410},
+        {0x431, 0x411}, {0x432, 0x1C80}, {0x433, 0x413}, {0x434, 0x1C81}, {0x435, 0x415}, {0x436, 0x416},
+        {0x437, 0x417}, {0x438, 0x418}, {0x439, 0x419}, {0x43A, 0x41A}, {0x43B, 0x41B}, {0x43C, 0x41C},
+        {0x43D, 0x41D}, {0x43E, 0x1C82}, {0x43F, 0x41F}, {0x440, 0x420}, {0x441, 0x1C83}, {0x442, 0x1C84},
+        {0x443, 0x423}, {0x444, 0x424}, {0x445, 0x425}, {0x446, 0x426}, {0x447, 0x427}, {0x448, 0x428},
+        {0x449, 0x429}, {0x44A, 0x1C86}, {0x44B, 0x42B}, {0x44C, 0x42C}, {0x44D, 0x42D}, {0x44E, 0x42E},
+        {0x44F, 0x42F}, {0x450, 0x400}, {0x451, 0x401}, {0x452, 0x402}, {0x453, 0x403}, {0x454, 0x404},
+        {0x455, 0x405}, {0x456, 0x406}, {0x457, 0x407}, {0x458, 0x408}, {0x459, 0x409}, {0x45A, 0x40A},
+        {0x45B, 0x40B}, {0x45C, 0x40C}, {0x45D, 0x40D}, {0x45E, 0x40E}, {0x45F, 0x40F}, {0x460, 0x461},
+        {0x461, 0x460}, {0x462, 0x463}, {0x463, 0x1C87}, {0x464, 0x465}, {0x465, 0x464}, {0x466, 0x467},
+        {0x467, 0x466}, {0x468, 0x469}, {0x469, 0x468}, {0x46A, 0x46B}, {0x46B, 0x46A}, {0x46C, 0x46D},
+        {0x46D, 0x46C}, {0x46E, 0x46F}, {0x46F, 0x46E}, {0x470, 0x471}, {0x471, 0x470}, {0x472, 0x473},
+        {0x473, 0x472}, {0x474, 0x475}, {0x475, 0x474}, {0x476, 0x477}, {0x477, 0x476}, {0x478, 0x479},
+        {0x479, 0x478}, {0x47A, 0x47B}, {0x47B, 0x47A}, {0x47C, 0x47D}, {0x47D, 0x47C}, {0x47E, 0x47F},
+        {0x47F, 0x47E}, {0x480, 0x481}, {0x481, 0x480}, {0x48A, 0x48B}, {0x48B, 0x48A}, {0x48C, 0x48D},
+        {0x48D, 0x48C}, {0x48E, 0x48F}, {0x48F, 0x48E}, {0x490, 0x491}, {0x491, 0x490}, {0x492, 0x493},
+        {0x493, 0x492}, {0x494, 0x495}, {0x495, 0x494}, {0x496, 0x497}, {0x497, 0x496}, {0x498, 0x499},
+        {0x499, 0x498}, {0x49A, 0x49B}, {0x49B, 0x49A}, {0x49C, 0x49D}, {0x49D, 0x49C}, {0x49E, 0x49F},
+        {0x49F, 0x49E}, {0x4A0, 0x4A1}, {0x4A1, 0x4A0}, {0x4A2, 0x4A3}, {0x4A3, 0x4A2}, {0x4A4, 0x4A5},
+        {0x4A5, 0x4A4}, {0x4A6, 0x4A7}, {0x4A7, 0x4A6}, {0x4A8, 0x4A9}, {0x4A9, 0x4A8}, {0x4AA, 0x4AB},
+        {0x4AB, 0x4AA}, {0x4AC, 0x4AD}, {0x4AD, 0x4AC}, {0x4AE, 0x4AF}, {0x4AF, 0x4AE}, {0x4B0, 0x4B1},
+        {0x4B1, 0x4B0}, {0x4B2, 0x4B3}, {0x4B3, 0x4B2}, {0x4B4, 0x4B5}, {0x4B5, 0x4B4}, {0x4B6, 0x4B7},
+        {0x4B7, 0x4B6}, {0x4B8, 0x4B9}, {0x4B9, 0x4B8}, {0x4BA, 0x4BB}, {0x4BB, 0x4BA}, {0x4BC, 0x4BD},
+        {0x4BD, 0x4BC}, {0x4BE, 0x4BF}, {0x4BF, 0x4BE}, {0x4C0, 0x4CF}, {0x4C1, 0x4C2}, {0x4C2, 0x4C1},
+        {0x4C3, 0x4C4}, {0x4C4, 0x4C3}, {0x4C5, 0x4C6}, {0x4C6, 0x4C5}, {0x4C7, 0x4C8}, {0x4C8, 0x4C7},
+        {0x4C9, 0x4CA}, {0x4CA, 0x4C9}, {0x4CB, 0x4CC}, {0x4CC, 0x4CB}, {0x4CD, 0x4CE}, {0x4CE, 0x4CD},
+        {0x4CF, 0x4C0}, {0x4D0, 0x4D1}, {0x4D1, 0x4D0}, {0x4D2, 0x4D3}, {0x4D3, 0x4D2}, {0x4D4, 0x4D5},
+        {0x4D5, 0x4D4}, {0x4D6, 0x4D7}, {0x4D7, 0x4D6}, {0x4D8, 0x4D9}, {0x4D9, 0x4D8}, {0x4DA, 0x4DB},
+        {0x4DB, 0x4DA}, {0x4DC, 0x4DD}, {0x4DD, 0x4DC}, {0x4DE, 0x4DF}, {0x4DF, 0x4DE}, {0x4E0, 0x4E1},
+        {0x4E1, 0x4E0}, {0x4E2, 0x4E3}, {0x4E3, 0x4E2}, {0x4E4, 0x4E5}, {0x4E5, 0x4E4}, {0x4E6, 0x4E7},
+        {0x4E7, 0x4E6}, {0x4E8, 0x4E9}, {0x4E9, 0x4E8}, {0x4EA, 0x4EB}, {0x4EB, 0x4EA}, {0x4EC, 0x4ED},
+        {0x4ED, 0x4EC}, {0x4EE, 0x4EF}, {0x4EF, 0x4EE}, {0x4F0, 0x4F1}, {0x4F1, 0x4F0}, {0x4F2, 0x4F3},
+        {0x4F3, 0x4F2}, {0x4F4, 0x4F5}, {0x4F5, 0x4F4}, {0x4F6, 0x4F7}, {0x4F7, 0x4F6}, {0x4F8, 0x4F9},
+        {0x4F9, 0x4F8}, {0x4FA, 0x4FB}, {0x4FB, 0x4FA}, {0x4FC, 0x4FD}, {0x4FD, 0x4FC}, {0x4FE, 0x4FF},
+        {0x4FF, 0x4FE}, {0x500, 0x501}, {0x501, 0x500}, {0x502, 0x503}, {0x503, 0x502}, {0x504, 0x505},
+        {0x505, 0x504}, {0x506, 0x507}, {0x507, 0x506}, {0x508, 0x509}, {0x509, 0x508}, {0x50A, 0x50B},
+        {0x50B, 0x50A}, {0x50C, 0x50D}, {0x50D, 0x50C}, {0x50E, 0x50F}, {0x50F, 0x50E}, {0x510, 0x511},
+        {0x511, 0x510}, {0x512, 0x513}, {0x513, 0x512}, {0x514, 0x515}, {0x515, 0x514}, {0x516, 0x517},
+        {0x517, 0x516}, {0x518, 0x519}, {0x519, 0x518}, {0x51A, 0x51B}, {0x51B, 0x51A}, {0x51C, 0x51D},
+        {0x51D, 0x51C}, {0x51E, 0x51F}, {0x51F, 0x51E}, {0x520, 0x521}, {0x521, 0x520}, {0x522, 0x523},
+        {0x523, 0x522}, {0x524, 0x525}, {0x525, 0x524}, {0x526, 0x527}, {0x527, 0x526}, {0x528, 0x529},
+        {0x529, 0x528}, {0x52A, 0x52B}, {0x52B, 0x52A}, {0x52C, 0x52D}, {0x52D, 0x52C}, {0x52E, 0x52F},
+        {0x52F, 0x52E}, {0x531, 0x561}, {0x532, 0x562}, {0x533, 0x563}, {0x534, 0x564}, {0x535, 0x565},
+        {0x536, 0x566}, {0x537, 0x567}, {0x538, 0x568}, {0x539, 0x569}, {0x53A, 0x56A}, {0x53B, 0x56B},
+        {0x53C, 0x56C}, {0x53D, 0x56D}, {0x53E, 0x56E}, {0x53F, 0x56F}, {0x540, 0x570}, {0x541, 0x571},
+        {0x542, 0x572}, {0x543, 0x573}, {0x544, 0x574}, {0x545, 0x575}, {0x546, 0x576}, {0x547, 0x577},
+        {0x548, 0x578}, {0x549, 0x579}, {0x54A, 0x57A}, {0x54B, 0x57B}, {0x54C, 0x57C}, {0x54D, 0x57D},
+        {0x54E, 0x57E}, {0x54F, 0x57F}, {0x550, 0x580}, {0x551, 0x581}, {0x552, 0x582}, {0x553, 0x583},
+        {0x554, 0x584}, {0x555, 0x585}, {0x556, 0x586}, {0x561, 0x531}, {0x562, 0x532}, {0x563, 0x533},
+        {0x564, 0x534}, {0x565, 0x535}, {0x566, 0x536}, {0x567, 0x537}, {0x568, 0x538}, {0x569, 0x539},
+        {0x56A, 0x53A}, {0x56B, 0x53B}, {0x56C, 0x53C}, {0x56D, 0x53D}, {0x56E, 0x53E}, {0x56F, 0x53F},
+        {0x570, 0x540}, {0x571, 0x541}, {0x572, 0x542}, {0x573, 0x543}, {0x574, 0x544}, {0x575, 0x545},
+        {0x576, 0x546}, {0x577, 0x547}, {0x578, 0x548}, {0x579, 0x549}, {0x57A, 0x54A}, {0x57B, 0x54B},
+        {0x57C, 0x54C}, {0x57D, 0x54D}, {0x57E, 0x54E}, {0x57F, 0x54F}, {0x580, 0x550}, {0x581, 0x551},
+        {0x582, 0x552}, {0x583, 0x553}, {0x584, 0x554}, {0x585, 0x555}, {0x586, 0x556}, {0x10A0, 0x2D00},
+        {0x10A1, 0x2D01}, {0x10A2, 0x2D02}, {0x10A3, 0x2D03}, {0x10A4, 0x2D04}, {0x10A5, 0x2D05}, {0x10A6, 0x2D06},
+        {0x10A7, 0x2D07}, {0x10A8, 0x2D08}, {0x10A9, 0x2D09}, {0x10AA, 0x2D0A}, {0x10AB, 0x2D0B}, {0x10AC, 0x2D0C},
+        {0x10AD, 0x2D0D}, {0x10AE, 0x2D0E}, {0x10AF, 0x2D0F}, {0x10B0, 0x2D10}, {0x10B1, 0x2D11}, {0x10B2, 0x2D12},
+        {0x10B3, 0x2D13}, {0x10B4, 0x2D14}, {0x10B5, 0x2D15}, {0x10B6, 0x2D16}, {0x10B7, 0x2D17}, {0x10B8, 0x2D18},
+        {0x10B9, 0x2D19}, {0x10BA, 0x2D1A}, {0x10BB, 0x2D1B}, {0x10BC, 0x2D1C}, {0x10BD, 0x2D1D}, {0x10BE, 0x2D1E},
+        {0x10BF, 0x2D1F}, {0x10C0, 0x2D20}, {0x10C1, 0x2D21}, {0x10C2, 0x2D22}, {0x10C3, 0x2D23}, {0x10C4, 0x2D24},
+        {0x10C5, 0x2D25}, {0x10C7, 0x2D27}, {0x10CD, 0x2D2D}, {0x10D0, 0x1C90}, {0x10D1, 0x1C91}, {0x10D2, 0x1C92},
+        {0x10D3, 0x1C93}, {0x10D4, 0x1C94}, {0x10D5, 0x1C95}, {0x10D6, 0x1C96}, {0x10D7, 0x1C97}, {0x10D8, 0x1C98},
+        {0x10D9, 0x1C99}, {0x10DA, 0x1C9A}, {0x10DB, 0x1C9B}, {0x10DC, 0x1C9C}, {0x10DD, 0x1C9D}, {0x10DE, 0x1C9E},
+        {0x10DF, 0x1C9F}, {0x10E0, 0x1CA0}, {0x10E1, 0x1CA1}, {0x10E2, 0x1CA2}, {0x10E3, 0x1CA3}, {0x10E4, 0x1CA4},
+        {0x10E5, 0x1CA5}, {0x10E6, 0x1CA6}, {0x10E7, 0x1CA7}, {0x10E8, 0x1CA8}, {0x10E9, 0x1CA9}, {0x10EA, 0x1CAA},
+        {0x10EB, 0x1CAB}, {0x10EC, 0x1CAC}, {0x10ED, 0x1CAD}, {0x10EE, 0x1CAE}, {0x10EF, 0x1CAF}, {0x10F0, 0x1CB0},
+        {0x10F1, 0x1CB1}, {0x10F2, 0x1CB2}, {0x10F3, 0x1CB3}, {0x10F4, 0x1CB4}, {0x10F5, 0x1CB5}, {0x10F6, 0x1CB6},
+        {0x10F7, 0x1CB7}, {0x10F8, 0x1CB8}, {0x10F9, 0x1CB9}, {0x10FA, 0x1CBA}, {0x10FD, 0x1CBD}, {0x10FE, 0x1CBE},
+        {0x10FF, 0x1CBF}, {0x13A0, 0xAB70}, {0x13A1, 0xAB71}, {0x13A2, 0xAB72}, {0x13A3, 0xAB73}, {0x13A4, 0xAB74},
+        {0x13A5, 0xAB75}, {0x13A6, 0xAB76}, {0x13A7, 0xAB77}, {0x13A8, 0xAB78}, {0x13A9, 0xAB79}, {0x13AA, 0xAB7A},
+        {0x13AB, 0xAB7B}, {0x13AC, 0xAB7C}, {0x13AD, 0xAB7D}, {0x13AE, 0xAB7E}, {0x13AF, 0xAB7F}, {0x13B0, 0xAB80},
+        {0x13B1, 0xAB81}, {0x13B2, 0xAB82}, {0x13B3, 0xAB83}, {0x13B4, 0xAB84}, {0x13B5, 0xAB85}, {0x13B6, 0xAB86},
+        {0x13B7, 0xAB87}, {0x13B8, 0xAB88}, {0x13B9, 0xAB89}, {0x13BA, 0xAB8A}, {0x13BB, 0xAB8B}, {0x13BC, 0xAB8C},
+        {0x13BD, 0xAB8D}, {0x13BE, 0xAB8E}, {0x13BF, 0xAB8F}, {0x13C0, 0xAB90}, {0x13C1, 0xAB91}, {0x13C2, 0xAB92},
+        {0x13C3, 0xAB93}, {0x13C4, 0xAB94}, {0x13C5, 0xAB95}, {0x13C6, 0xAB96}, {0x13C7, 0xAB97}, {0x13C8, 0xAB98},
+        {0x13C9, 0xAB99}, {0x13CA, 0xAB9A}, {0x13CB, 0xAB9B}, {0x13CC, 0xAB9C}, {0x13CD, 0xAB9D}, {0x13CE, 0xAB9E},
+        {0x13CF, 0xAB9F}, {0x13D0, 0xABA0}, {0x13D1, 0xABA1}, {0x13D2, 0xABA2}, {0x13D3, 0xABA3}, {0x13D4, 0xABA4},
+        {0x13D5, 0xABA5}, {0x13D6, 0xABA6}, {0x13D7, 0xABA7}, {0x13D8, 0xABA8}, {0x13D9, 0xABA9}, {0x13DA, 0xABAA},
+        {0x13DB, 0xABAB}, {0x13DC, 0xABAC}, {0x13DD, 0xABAD}, {0x13DE, 0xABAE}, {0x13DF, 0xABAF}, {0x13E0, 0xABB0},
+        {0x13E1, 0xABB1}, {0x13E2, 0xABB2}, {0x13E3, 0xABB3}, {0x13E4, 0xABB4}, {0x13E5, 0xABB5}, {0x13E6, 0xABB6},
+        {0x13E7, 0xABB7}, {0x13E8, 0xABB8}, {0x13E9, 0xABB9}, {0x13EA, 0xABBA}, {0x13EB, 0xABBB}, {0x13EC, 0xABBC},
+        {0x13ED, 0xABBD}, {0x13EE, 0xABBE}, {0x13EF, 0xABBF}, {0x13F0, 0x13F8}, {0x13F1, 0x13F9}, {0x13F2, 0x13FA},
+        {0x13F3, 0x13FB}, {0x13F4, 0x13FC}, {0x13F5, 0x13FD}, {0x13F8, 0x13F0}, {0x13F9, 0x13F1}, {0x13FA, 0x13F2},
+        {0x13FB, 0x13F3}, {0x13FC, 0x13F4}, {0x13FD, 0x13F5}, {0x1C80, 0x412}, {0x1C81, 0x414}, {0x1C82, 0x41E},
+        {0x1C83, 0x421}, {0x1C84, 0x1C85}, {0x1C85, 0x422}, {0x1C86, 0x42A}, {0x1C87, 0x462}, {0x1C88, 0xA64A},
+        {0x1C90, 0x10D0}, {0x1C91, 0x10D1}, {0x1C92, 0x10D2}, {0x1C93, 0x10D3}, {0x1C94, 0x10D4}, {0x1C95, 0x10D5},
+        {0x1C96, 0x10D6}, {0x1C97, 0x10D7}, {0x1C98, 0x10D8}, {0x1C99, 0x10D9}, {0x1C9A, 0x10DA}, {0x1C9B, 0x10DB},
+        {0x1C9C, 0x10DC}, {0x1C9D, 0x10DD}, {0x1C9E, 0x10DE}, {0x1C9F, 0x10DF}, {0x1CA0, 0x10E0}, {0x1CA1, 0x10E1},
+        {0x1CA2, 0x10E2}, {0x1CA3, 0x10E3}, {0x1CA4, 0x10E4}, {0x1CA5, 0x10E5}, {0x1CA6, 0x10E6}, {0x1CA7, 0x10E7},
+        {0x1CA8, 0x10E8}, {0x1CA9, 0x10E9}, {0x1CAA, 0x10EA}, {0x1CAB, 0x10EB}, {0x1CAC, 0x10EC}, {0x1CAD, 0x10ED},
+        {0x1CAE, 0x10EE}, {0x1CAF, 0x10EF}, {0x1CB0, 0x10F0}, {0x1CB1, 0x10F1}, {0x1CB2, 0x10F2}, {0x1CB3, 0x10F3},
+        {0x1CB4, 0x10F4}, {0x1CB5, 0x10F5}, {0x1CB6, 0x10F6}, {0x1CB7, 0x10F7}, {0x1CB8, 0x10F8}, {0x1CB9, 0x10F9},
+        {0x1CBA, 0x10FA}, {0x1CBD, 0x10FD}, {0x1CBE, 0x10FE}, {0x1CBF, 0x10FF}, {0x1D79, 0xA77D}, {0x1D7D, 0x2C63},
+        {0x1D8E, 0xA7C6}, {0x1E00, 0x1E01}, {0x1E01, 0x1E00}, {0x1E02, 0x1E03}, {0x1E03, 0x1E02}, {0x1E04, 0x1E05},
+        {0x1E05, 0x1E04}, {0x1E06, 0x1E07}, {0x1E07, 0x1E06}, {0x1E08, 0x1E09}, {0x1E09, 0x1E08}, {0x1E0A, 0x1E0B},
+        {0x1E0B, 0x1E0A}, {0x1E0C, 0x1E0D}, {0x1E0D, 0x1E0C}, {0x1E0E, 0x1E0F}, {0x1E0F, 0x1E0E}, {0x1E10, 0x1E11},
+        {0x1E11, 0x1E10}, {0x1E12, 0x1E13}, {0x1E13, 0x1E12}, {0x1E14, 0x1E15}, {0x1E15, 0x1E14}, {0x1E16, 0x1E17},
+        {0x1E17, 0x1E16}, {0x1E18, 0x1E19}, {0x1E19, 0x1E18}, {0x1E1A, 0x1E1B}, {0x1E1B, 0x1E1A}, {0x1E1C, 0x1E1D},
+        {0x1E1D, 0x1E1C}, {0x1E1E, 0x1E1F}, {0x1E1F, 0x1E1E}, {0x1E20, 0x1E21}, {0x1E21, 0x1E20}, {0x1E22, 0x1E23},
+        {0x1E23, 0x1E22}, {0x1E24, 0x1E25}, {0x1E25, 0x1E24}, {0x1E26, 0x1E27}, {0x1E27, 0x1E26}, {0x1E28, 0x1E29},
+        {0x1E29, 0x1E28}, {0x1E2A, 0x1E2B}, {0x1E2B, 0x1E2A}, {0x1E2C, 0x1E2D}, {0x1E2D, 0x1E2C}, {0x1E2E, 0x1E2F},
+        {0x1E2F, 0x1E2E}, {0x1E30, 0x1E31}, {0x1E31, 0x1E30}, {0x1E32, 0x1E33}, {0x1E33, 0x1E32}, {0x1E34, 0x1E35},
+        {0x1E35, 0x1E34}, {0x1E36, 0x1E37}, {0x1E37, 0x1E36}, {0x1E38, 0x1E39}, {0x1E39, 0x1E38}, {0x1E3A, 0x1E3B},
+        {0x1E3B, 0x1E3A}, {0x1E3C, 0x1E3D}, {0x1E3D, 0x1E3C}, {0x1E3E, 0x1E3F}, {0x1E3F, 0x1E3E}, {0x1E40, 0x1E41},
+        {0x1E41, 0x1E40}, {0x1E42, 0x1E43}, {0x1E43, 0x1E42}, {0x1E44, 0x1E45}, {0x1E45, 0x1E44}, {0x1E46, 0x1E47},
+        {0x1E47, 0x1E46}, {0x1E48, 0x1E49}, {0x1E49, 0x1E48}, {0x1E4A, 0x1E4B}, {0x1E4B, 0x1E4A}, {0x1E4C, 0x1E4D},
+        {0x1E4D, 0x1E4C}, {0x1E4E, 0x1E4F}, {0x1E4F, 0x1E4E}, {0x1E50, 0x1E51}, {0x1E51, 0x1E50}, {0x1E52, 0x1E53},
+        {0x1E53, 0x1E52}, {0x1E54, 0x1E55}, {0x1E55, 0x1E54}, {0x1E56, 0x1E57}, {0x1E57, 0x1E56}, {0x1E58, 0x1E59},
+        {0x1E59, 0x1E58}, {0x1E5A, 0x1E5B}, {0x1E5B, 0x1E5A}, {0x1E5C, 0x1E5D}, {0x1E5D, 0x1E5C}, {0x1E5E, 0x1E5F},
+        {0x1E5F, 0x1E5E}, {0x1E60, 0x1E61}, {0x1E61, 0x1E9B}, {0x1E62, 0x1E63}, {0x1E63, 0x1E62}, {0x1E64, 0x1E65},
+        {0x1E65, 0x1E64}, {0x1E66, 0x1E67}, {0x1E67, 0x1E66}, {0x1E68, 0x1E69}, {0x1E69, 0x1E68}, {0x1E6A, 0x1E6B},
+        {0x1E6B, 0x1E6A}, {0x1E6C, 0x1E6D}, {0x1E6D, 0x1E6C}, {0x1E6E, 0x1E6F}, {0x1E6F, 0x1E6E}, {0x1E70, 0x1E71},
+        {0x1E71, 0x1E70}, {0x1E72, 0x1E73}, {0x1E73, 0x1E72}, {0x1E74, 0x1E75}, {0x1E75, 0x1E74}, {0x1E76, 0x1E77},
+        {0x1E77, 0x1E76}, {0x1E78, 0x1E79}, {0x1E79, 0x1E78}, {0x1E7A, 0x1E7B}, {0x1E7B, 0x1E7A}, {0x1E7C, 0x1E7D},
+        {0x1E7D, 0x1E7C}, {0x1E7E, 0x1E7F}, {0x1E7F, 0x1E7E}, {0x1E80, 0x1E81}, {0x1E81, 0x1E80}, {0x1E82, 0x1E83},
+        {0x1E83, 0x1E82}, {0x1E84, 0x1E85}, {0x1E85, 0x1E84}, {0x1E86, 0x1E87}, {0x1E87, 0x1E86}, {0x1E88, 0x1E89},
+        {0x1E89, 0x1E88}, {0x1E8A, 0x1E8B}, {0x1E8B, 0x1E8A}, {0x1E8C, 0x1E8D}, {0x1E8D, 0x1E8C}, {0x1E8E, 0x1E8F},
+        {0x1E8F, 0x1E8E}, {0x1E90, 0x1E91}, {0x1E91, 0x1E90}, {0x1E92, 0x1E93}, {0x1E93, 0x1E92}, {0x1E94, 0x1E95},
+        {0x1E95, 0x1E94}, {0x1E9B, 0x1E60}, {0x1E9E, 0xDF}, {0x1EA0, 0x1EA1}, {0x1EA1, 0x1EA0}, {0x1EA2, 0x1EA3},
+        {0x1EA3, 0x1EA2}, {0x1EA4, 0x1EA5}, {0x1EA5, 0x1EA4}, {0x1EA6, 0x1EA7}, {0x1EA7, 0x1EA6}, {0x1EA8, 0x1EA9},
+        {0x1EA9, 0x1EA8}, {0x1EAA, 0x1EAB}, {0x1EAB, 0x1EAA}, {0x1EAC, 0x1EAD}, {0x1EAD, 0x1EAC}, {0x1EAE, 0x1EAF},
+        {0x1EAF, 0x1EAE}, {0x1EB0, 0x1EB1}, {0x1EB1, 0x1EB0}, {0x1EB2, 0x1EB3}, {0x1EB3, 0x1EB2}, {0x1EB4, 0x1EB5},
+        {0x1EB5, 0x1EB4}, {0x1EB6, 0x1EB7}, {0x1EB7, 0x1EB6}, {0x1EB8, 0x1EB9}, {0x1EB9, 0x1EB8}, {0x1EBA, 0x1EBB},
+        {0x1EBB, 0x1EBA}, {0x1EBC, 0x1EBD}, {0x1EBD, 0x1EBC}, {0x1EBE, 0x1EBF}, {0x1EBF, 0x1EBE}, {0x1EC0, 0x1EC1},
+        {0x1EC1, 0x1EC0}, {0x1EC2, 0x1EC3}, {0x1EC3, 0x1EC2}, {0x1EC4, 0x1EC5}, {0x1EC5, 0x1EC4}, {0x1EC6, 0x1EC7},
+        {0x1EC7, 0x1EC6}, {0x1EC8, 0x1EC9}, {0x1EC9, 0x1EC8}, {0x1ECA, 0x1ECB}, {0x1ECB, 0x1ECA}, {0x1ECC, 0x1ECD},
+        {0x1ECD, 0x1ECC}, {0x1ECE, 0x1ECF}, {0x1ECF, 0x1ECE}, {0x1ED0, 0x1ED1}, {0x1ED1, 0x1ED0}, {0x1ED2, 0x1ED3},
+        {0x1ED3, 0x1ED2}, {0x1ED4, 0x1ED5}, {0x1ED5, 0x1ED4}, {0x1ED6, 0x1ED7}, {0x1ED7, 0x1ED6}, {0x1ED8, 0x1ED9},
+        {0x1ED9, 0x1ED8}, {0x1EDA, 0x1EDB}, {0x1EDB, 0x1EDA}, {0x1EDC, 0x1EDD}, {0x1EDD, 0x1EDC}, {0x1EDE, 0x1EDF},
+        {0x1EDF, 0x1EDE}, {0x1EE0, 0x1EE1}, {0x1EE1, 0x1EE0}, {0x1EE2, 0x1EE3}, {0x1EE3, 0x1EE2}, {0x1EE4, 0x1EE5},
+        {0x1EE5, 0x1EE4}, {0x1EE6, 0x1EE7}, {0x1EE7, 0x1EE6}, {0x1EE8, 0x1EE9}, {0x1EE9, 0x1EE8}, {0x1EEA, 0x1EEB},
+        {0x1EEB, 0x1EEA}, {0x1EEC, 0x1EED}, {0x1EED, 0x1EEC}, {0x1EEE, 0x1EEF}, {0x1EEF, 0x1EEE}, {0x1EF0, 0x1EF1},
+        {0x1EF1, 0x1EF0}, {0x1EF2, 0x1EF3}, {0x1EF3, 0x1EF2}, {0x1EF4, 0x1EF5}, {0x1EF5, 0x1EF4}, {0x1EF6, 0x1EF7},
+        {0x1EF7, 0x1EF6}, {0x1EF8, 0x1EF9}, {0x1EF9, 0x1EF8}, {0x1EFA, 0x1EFB}, {0x1EFB, 0x1EFA}, {0x1EFC, 0x1EFD},
+        {0x1EFD, 0x1EFC}, {0x1EFE, 0x1EFF}, {0x1EFF, 0x1EFE}, {0x1F00, 0x1F08}, {0x1F01, 0x1F09}, {0x1F02, 0x1F0A},
+        {0x1F03, 0x1F0B}, {0x1F04, 0x1F0C}, {0x1F05, 0x1F0D}, {0x1F06, 0x1F0E}, {0x1F07, 0x1F0F}, {0x1F08, 0x1F00},
+        {0x1F09, 0x1F01}, {0x1F0A, 0x1F02}, {0x1F0B, 0x1F03}, {0x1F0C, 0x1F04}, {0x1F0D, 0x1F05}, {0x1F0E, 0x1F06},
+        {0x1F0F, 0x1F07}, {0x1F10, 0x1F18}, {0x1F11, 0x1F19}, {0x1F12, 0x1F1A}, {0x1F13, 0x1F1B}, {0x1F14, 0x1F1C},
+        {0x1F15, 0x1F1D}, {0x1F18, 0x1F10}, {0x1F19, 0x1F11}, {0x1F1A, 0x1F12}, {0x1F1B, 0x1F13}, {0x1F1C, 0x1F14},
+        {0x1F1D, 0x1F15}, {0x1F20, 0x1F28}, {0x1F21, 0x1F29}, {0x1F22, 0x1F2A}, {0x1F23, 0x1F2B}, {0x1F24, 0x1F2C},
+        {0x1F25, 0x1F2D}, {0x1F26, 0x1F2E}, {0x1F27, 0x1F2F}, {0x1F28, 0x1F20}, {0x1F29, 0x1F21}, {0x1F2A, 0x1F22},
+        {0x1F2B, 0x1F23}, {0x1F2C, 0x1F24}, {0x1F2D, 0x1F25}, {0x1F2E, 0x1F26}, {0x1F2F, 0x1F27}, {0x1F30, 0x1F38},
+        {0x1F31, 0x1F39}, {0x1F32, 0x1F3A}, {0x1F33, 0x1F3B}, {0x1F34, 0x1F3C}, {0x1F35, 0x1F3D}, {0x1F36, 0x1F3E},
+        {0x1F37, 0x1F3F}, {0x1F38, 0x1F30}, {0x1F39, 0x1F31}, {0x1F3A, 0x1F32}, {0x1F3B, 0x1F33}, {0x1F3C, 0x1F34},
+        {0x1F3D, 0x1F35}, {0x1F3E, 0x1F36}, {0x1F3F, 0x1F37}, {0x1F40, 0x1F48}, {0x1F41, 0x1F49}, {0x1F42, 0x1F4A},
+        {0x1F43, 0x1F4B}, {0x1F44, 0x1F4C}, {0x1F45, 0x1F4D}, {0x1F48, 0x1F40}, {0x1F49, 0x1F41}, {0x1F4A, 0x1F42},
+        {0x1F4B, 0x1F43}, {0x1F4C, 0x1F44}, {0x1F4D, 0x1F45}, {0x1F51, 0x1F59}, {0x1F53, 0x1F5B}, {0x1F55, 0x1F5D},
+        {0x1F57, 0x1F5F}, {0x1F59, 0x1F51}, {0x1F5B, 0x1F53}, {0x1F5D, 0x1F55}, {0x1F5F, 0x1F57}, {0x1F60, 0x1F68},
+        {0x1F61, 0x1F69}, {0x1F62, 0x1F6A}, {0x1F63, 0x1F6B}, {0x1F64, 0x1F6C}, {0x1F65, 0x1F6D}, {0x1F66, 0x1F6E},
+        {0x1F67, 0x1F6F}, {0x1F68, 0x1F60}, {0x1F69, 0x1F61}, {0x1F6A, 0x1F62}, {0x1F6B, 0x1F63}, {0x1F6C, 0x1F64},
+        {0x1F6D, 0x1F65}, {0x1F6E, 0x1F66}, {0x1F6F, 0x1F67}, {0x1F70, 0x1FBA}, {0x1F71, 0x1FBB}, {0x1F72, 0x1FC8},
+        {0x1F73, 0x1FC9}, {0x1F74, 0x1FCA}, {0x1F75, 0x1FCB}, {0x1F76, 0x1FDA}, {0x1F77, 0x1FDB}, {0x1F78, 0x1FF8},
+        {0x1F79, 0x1FF9}, {0x1F7A, 0x1FEA}, {0x1F7B, 0x1FEB}, {0x1F7C, 0x1FFA}, {0x1F7D, 0x1FFB}, {0x1F80, 0x1F88},
+        {0x1F81, 0x1F89}, {0x1F82, 0x1F8A}, {0x1F83, 0x1F8B}, {0x1F84, 0x1F8C}, {0x1F85, 0x1F8D}, {0x1F86, 0x1F8E},
+        {0x1F87, 0x1F8F}, {0x1F88, 0x1F80}, {0x1F89, 0x1F81}, {0x1F8A, 0x1F82}, {0x1F8B, 0x1F83}, {0x1F8C, 0x1F84},
+        {0x1F8D, 0x1F85}, {0x1F8E, 0x1F86}, {0x1F8F, 0x1F87}, {0x1F90, 0x1F98}, {0x1F91, 0x1F99}, {0x1F92, 0x1F9A},
+        {0x1F93, 0x1F9B}, {0x1F94, 0x1F9C}, {0x1F95, 0x1F9D}, {0x1F96, 0x1F9E}, {0x1F97, 0x1F9F}, {0x1F98, 0x1F90},
+        {0x1F99, 0x1F91}, {0x1F9A, 0x1F92}, {0x1F9B, 0x1F93}, {0x1F9C, 0x1F94}, {0x1F9D, 0x1F95}, {0x1F9E, 0x1F96},
+        {0x1F9F, 0x1F97}, {0x1FA0, 0x1FA8}, {0x1FA1, 0x1FA9}, {0x1FA2, 0x1FAA}, {0x1FA3, 0x1FAB}, {0x1FA4, 0x1FAC},
+        {0x1FA5, 0x1FAD}, {0x1FA6, 0x1FAE}, {0x1FA7, 0x1FAF}, {0x1FA8, 0x1FA0}, {0x1FA9, 0x1FA1}, {0x1FAA, 0x1FA2},
+        {0x1FAB, 0x1FA3}, {0x1FAC, 0x1FA4}, {0x1FAD, 0x1FA5}, {0x1FAE, 0x1FA6}, {0x1FAF, 0x1FA7}, {0x1FB0, 0x1FB8},
+        {0x1FB1, 0x1FB9}, {0x1FB3, 0x1FBC}, {0x1FB8, 0x1FB0}, {0x1FB9, 0x1FB1}, {0x1FBA, 0x1F70}, {0x1FBB, 0x1F71},
+        {0x1FBC, 0x1FB3}, {0x1FBE, 0x345}, {0x1FC3, 0x1FCC}, {0x1FC8, 0x1F72}, {0x1FC9, 0x1F73}, {0x1FCA, 0x1F74},
+        {0x1FCB, 0x1F75}, {0x1FCC, 0x1FC3}, {0x1FD0, 0x1FD8}, {0x1FD1, 0x1FD9}, {0x1FD8, 0x1FD0}, {0x1FD9, 0x1FD1},
+        {0x1FDA, 0x1F76}, {0x1FDB, 0x1F77}, {0x1FE0, 0x1FE8}, {0x1FE1, 0x1FE9}, {0x1FE5, 0x1FEC}, {0x1FE8, 0x1FE0},
+        {0x1FE9, 0x1FE1}, {0x1FEA, 0x1F7A}, {0x1FEB, 0x1F7B}, {0x1FEC, 0x1FE5}, {0x1FF3, 0x1FFC}, {0x1FF8, 0x1F78},
+        {0x1FF9, 0x1F79}, {0x1FFA, 0x1F7C}, {0x1FFB, 0x1F7D}, {0x1FFC, 0x1FF3}, {0x2126, 0x3A9}, {0x212A, 0x4B},
+        {0x212B, 0xC5}, {0x2132, 0x214E}, {0x214E, 0x2132}, {0x2160, 0x2170}, {0x2161, 0x2171}, {0x2162, 0x2172},
+        {0x2163, 0x2173}, {0x2164, 0x2174}, {0x2165, 0x2175}, {0x2166, 0x2176}, {0x2167, 0x2177}, {0x2168, 0x2178},
+        {0x2169, 0x2179}, {0x216A, 0x217A}, {0x216B, 0x217B}, {0x216C, 0x217C}, {0x216D, 0x217D}, {0x216E, 0x217E},
+        {0x216F, 0x217F}, {0x2170, 0x2160}, {0x2171, 0x2161}, {0x2172, 0x2162}, {0x2173, 0x2163}, {0x2174, 0x2164},
+        {0x2175, 0x2165}, {0x2176, 0x2166}, {0x2177, 0x2167}, {0x2178, 0x2168}, {0x2179, 0x2169}, {0x217A, 0x216A},
+        {0x217B, 0x216B}, {0x217C, 0x216C}, {0x217D, 0x216D}, {0x217E, 0x216E}, {0x217F, 0x216F}, {0x2183, 0x2184},
+        {0x2184, 0x2183}, {0x24B6, 0x24D0}, {0x24B7, 0x24D1}, {0x24B8, 0x24D2}, {0x24B9, 0x24D3}, {0x24BA, 0x24D4},
+        {0x24BB, 0x24D5}, {0x24BC, 0x24D6}, {0x24BD, 0x24D7}, {0x24BE, 0x24D8}, {0x24BF, 0x24D9}, {0x24C0, 0x24DA},
+        {0x24C1, 0x24DB}, {0x24C2, 0x24DC}, {0x24C3, 0x24DD}, {0x24C4, 0x24DE}, {0x24C5, 0x24DF}, {0x24C6, 0x24E0},
+        {0x24C7, 0x24E1}, {0x24C8, 0x24E2}, {0x24C9, 0x24E3}, {0x24CA, 0x24E4}, {0x24CB, 0x24E5}, {0x24CC, 0x24E6},
+        {0x24CD, 0x24E7}, {0x24CE, 0x24E8}, {0x24CF, 0x24E9}, {0x24D0, 0x24B6}, {0x24D1, 0x24B7}, {0x24D2, 0x24B8},
+        {0x24D3, 0x24B9}, {0x24D4, 0x24BA}, {0x24D5, 0x24BB}, {0x24D6, 0x24BC}, {0x24D7, 0x24BD}, {0x24D8, 0x24BE},
+        {0x24D9, 0x24BF}, {0x24DA, 0x24C0}, {0x24DB, 0x24C1}, {0x24DC, 0x24C2}, {0x24DD, 0x24C3}, {0x24DE, 0x24C4},
+        {0x24DF, 0x24C5}, {0x24E0, 0x24C6}, {0x24E1, 0x24C7}, {0x24E2, 0x24C8}, {0x24E3, 0x24C9}, {0x24E4, 0x24CA},
+        {0x24E5, 0x24CB}, {0x24E6, 0x24CC}, {0x24E7, 0x24CD}, {0x24E8, 0x24CE}, {0x24E9, 0x24CF}, {0x2C00, 0x2C30},
+        {0x2C01, 0x2C31}, {0x2C02, 0x2C32}, {0x2C03, 0x2C33}, {0x2C04, 0x2C34}, {0x2C05, 0x2C35}, {0x2C06, 0x2C36},
+        {0x2C07, 0x2C37}, {0x2C08, 0x2C38}, {0x2C09, 0x2C39}, {0x2C0A, 0x2C3A}, {0x2C0B, 0x2C3B}, {0x2C0C, 0x2C3C},
+        {0x2C0D, 0x2C3D}, {0x2C0E, 0x2C3E}, {0x2C0F, 0x2C3F}, {0x2C10, 0x2C40}, {0x2C11, 0x2C41}, {0x2C12, 0x2C42},
+        {0x2C13, 0x2C43}, {0x2C14, 0x2C44}, {0x2C15, 0x2C45}, {0x2C16, 0x2C46}, {0x2C17, 0x2C47}, {0x2C18, 0x2C48},
+        {0x2C19, 0x2C49}, {0x2C1A, 0x2C4A}, {0x2C1B, 0x2C4B}, {0x2C1C, 0x2C4C}, {0x2C1D, 0x2C4D}, {0x2C1E, 0x2C4E},
+        {0x2C1F, 0x2C4F}, {0x2C20, 0x2C50}, {0x2C21, 0x2C51}, {0x2C22, 0x2C52}, {0x2C23, 0x2C53}, {0x2C24, 0x2C54},
+        {0x2C25, 0x2C55}, {0x2C26, 0x2C56}, {0x2C27, 0x2C57}, {0x2C28, 0x2C58}, {0x2C29, 0x2C59}, {0x2C2A, 0x2C5A},
+        {0x2C2B, 0x2C5B}, {0x2C2C, 0x2C5C}, {0x2C2D, 0x2C5D}, {0x2C2E, 0x2C5E}, {0x2C2F, 0x2C5F}, {0x2C30, 0x2C00},
+        {0x2C31, 0x2C01}, {0x2C32, 0x2C02}, {0x2C33, 0x2C03}, {0x2C34, 0x2C04}, {0x2C35, 0x2C05}, {0x2C36, 0x2C06},
+        {0x2C37, 0x2C07}, {0x2C38, 0x2C08}, {0x2C39, 0x2C09}, {0x2C3A, 0x2C0A}, {0x2C3B, 0x2C0B}, {0x2C3C, 0x2C0C},
+        {0x2C3D, 0x2C0D}, {0x2C3E, 0x2C0E}, {0x2C3F, 0x2C0F}, {0x2C40, 0x2C10}, {0x2C41, 0x2C11}, {0x2C42, 0x2C12},
+        {0x2C43, 0x2C13}, {0x2C44, 0x2C14}, {0x2C45, 0x2C15}, {0x2C46, 0x2C16}, {0x2C47, 0x2C17}, {0x2C48, 0x2C18},
+        {0x2C49, 0x2C19}, {0x2C4A, 0x2C1A}, {0x2C4B, 0x2C1B}, {0x2C4C, 0x2C1C}, {0x2C4D, 0x2C1D}, {0x2C4E, 0x2C1E},
+        {0x2C4F, 0x2C1F}, {0x2C50, 0x2C20}, {0x2C51, 0x2C21}, {0x2C52, 0x2C22}, {0x2C53, 0x2C23}, {0x2C54, 0x2C24},
+        {0x2C55, 0x2C25}, {0x2C56, 0x2C26}, {0x2C57, 0x2C27}, {0x2C58, 0x2C28}, {0x2C59, 0x2C29}, {0x2C5A, 0x2C2A},
+        {0x2C5B, 0x2C2B}, {0x2C5C, 0x2C2C}, {0x2C5D, 0x2C2D}, {0x2C5E, 0x2C2E}, {0x2C5F, 0x2C2F}, {0x2C60, 0x2C61},
+        {0x2C61, 0x2C60}, {0x2C62, 0x26B}, {0x2C63, 0x1D7D}, {0x2C64, 0x27D}, {0x2C65, 0x23A}, {0x2C66, 0x23E},
+        {0x2C67, 0x2C68}, {0x2C68, 0x2C67}, {0x2C69, 0x2C6A}, {0x2C6A, 0x2C69}, {0x2C6B, 0x2C6C}, {0x2C6C, 0x2C6B},
+        {0x2C6D, 0x251}, {0x2C6E, 0x271}, {0x2C6F, 0x250}, {0x2C70, 0x252}, {0x2C72, 0x2C73}, {0x2C73, 0x2C72},
+        {0x2C75, 0x2C76}, {0x2C76, 0x2C75}, {0x2C7E, 0x23F}, {0x2C7F, 0x240}, {0x2C80, 0x2C81}, {0x2C81, 0x2C80},
+        {0x2C82, 0x2C83}, {0x2C83, 0x2C82}, {0x2C84, 0x2C85}, {0x2C85, 0x2C84}, {0x2C86, 0x2C87}, {0x2C87, 0x2C86},
+        {0x2C88, 0x2C89}, {0x2C89, 0x2C88}, {0x2C8A, 0x2C8B}, {0x2C8B, 0x2C8A}, {0x2C8C, 0x2C8D}, {0x2C8D, 0x2C8C},
+        {0x2C8E, 0x2C8F}, {0x2C8F, 0x2C8E}, {0x2C90, 0x2C91}, {0x2C91, 0x2C90}, {0x2C92, 0x2C93}, {0x2C93, 0x2C92},
+        {0x2C94, 0x2C95}, {0x2C95, 0x2C94}, {0x2C96, 0x2C97}, {0x2C97, 0x2C96}, {0x2C98, 0x2C99}, {0x2C99, 0x2C98},
+        {0x2C9A, 0x2C9B}, {0x2C9B, 0x2C9A}, {0x2C9C, 0x2C9D}, {0x2C9D, 0x2C9C}, {0x2C9E, 0x2C9F}, {0x2C9F, 0x2C9E},
+        {0x2CA0, 0x2CA1}, {0x2CA1, 0x2CA0}, {0x2CA2, 0x2CA3}, {0x2CA3, 0x2CA2}, {0x2CA4, 0x2CA5}, {0x2CA5, 0x2CA4},
+        {0x2CA6, 0x2CA7}, {0x2CA7, 0x2CA6}, {0x2CA8, 0x2CA9}, {0x2CA9, 0x2CA8}, {0x2CAA, 0x2CAB}, {0x2CAB, 0x2CAA},
+        {0x2CAC, 0x2CAD}, {0x2CAD, 0x2CAC}, {0x2CAE, 0x2CAF}, {0x2CAF, 0x2CAE}, {0x2CB0, 0x2CB1}, {0x2CB1, 0x2CB0},
+        {0x2CB2, 0x2CB3}, {0x2CB3, 0x2CB2}, {0x2CB4, 0x2CB5}, {0x2CB5, 0x2CB4}, {0x2CB6, 0x2CB7}, {0x2CB7, 0x2CB6},
+        {0x2CB8, 0x2CB9}, {0x2CB9, 0x2CB8}, {0x2CBA, 0x2CBB}, {0x2CBB, 0x2CBA}, {0x2CBC, 0x2CBD}, {0x2CBD, 0x2CBC},
+        {0x2CBE, 0x2CBF}, {0x2CBF, 0x2CBE}, {0x2CC0, 0x2CC1}, {0x2CC1, 0x2CC0}, {0x2CC2, 0x2CC3}, {0x2CC3, 0x2CC2},
+        {0x2CC4, 0x2CC5}, {0x2CC5, 0x2CC4}, {0x2CC6, 0x2CC7}, {0x2CC7, 0x2CC6}, {0x2CC8, 0x2CC9}, {0x2CC9, 0x2CC8},
+        {0x2CCA, 0x2CCB}, {0x2CCB, 0x2CCA}, {0x2CCC, 0x2CCD}, {0x2CCD, 0x2CCC}, {0x2CCE, 0x2CCF}, {0x2CCF, 0x2CCE},
+        {0x2CD0, 0x2CD1}, {0x2CD1, 0x2CD0}, {0x2CD2, 0x2CD3}, {0x2CD3, 0x2CD2}, {0x2CD4, 0x2CD5}, {0x2CD5, 0x2CD4},
+        {0x2CD6, 0x2CD7}, {0x2CD7, 0x2CD6}, {0x2CD8, 0x2CD9}, {0x2CD9, 0x2CD8}, {0x2CDA, 0x2CDB}, {0x2CDB, 0x2CDA},
+        {0x2CDC, 0x2CDD}, {0x2CDD, 0x2CDC}, {0x2CDE, 0x2CDF}, {0x2CDF, 0x2CDE}, {0x2CE0, 0x2CE1}, {0x2CE1, 0x2CE0},
+        {0x2CE2, 0x2CE3}, {0x2CE3, 0x2CE2}, {0x2CEB, 0x2CEC}, {0x2CEC, 0x2CEB}, {0x2CED, 0x2CEE}, {0x2CEE, 0x2CED},
+        {0x2CF2, 0x2CF3}, {0x2CF3, 0x2CF2}, {0x2D00, 0x10A0}, {0x2D01, 0x10A1}, {0x2D02, 0x10A2}, {0x2D03, 0x10A3},
+        {0x2D04, 0x10A4}, {0x2D05, 0x10A5}, {0x2D06, 0x10A6}, {0x2D07, 0x10A7}, {0x2D08, 0x10A8}, {0x2D09, 0x10A9},
+        {0x2D0A, 0x10AA}, {0x2D0B, 0x10AB}, {0x2D0C, 0x10AC}, {0x2D0D, 0x10AD}, {0x2D0E, 0x10AE}, {0x2D0F, 0x10AF},
+        {0x2D10, 0x10B0}, {0x2D11, 0x10B1}, {0x2D12, 0x10B2}, {0x2D13, 0x10B3}, {0x2D14, 0x10B4}, {0x2D15, 0x10B5},
+        {0x2D16, 0x10B6}, {0x2D17, 0x10B7}, {0x2D18, 0x10B8}, {0x2D19, 0x10B9}, {0x2D1A, 0x10BA}, {0x2D1B, 0x10BB},
+        {0x2D1C, 0x10BC}, {0x2D1D, 0x10BD}, {0x2D1E, 0x10BE}, {0x2D1F, 0x10BF}, {0x2D20, 0x10C0}, {0x2D21, 0x10C1},
+        {0x2D22, 0x10C2}, {0x2D23, 0x10C3}, {0x2D24, 0x10C4}, {0x2D25, 0x10C5}, {0x2D27, 0x10C7}, {0x2D2D, 0x10CD},
+        {0xA640, 0xA641}, {0xA641, 0xA640}, {0xA642, 0xA643}, {0xA643, 0xA642}, {0xA644, 0xA645}, {0xA645, 0xA644},
+        {0xA646, 0xA647}, {0xA647, 0xA646}, {0xA648, 0xA649}, {0xA649, 0xA648}, {0xA64A, 0xA64B}, {0xA64B, 0x1C88},
+        {0xA64C, 0xA64D}, {0xA64D, 0xA64C}, {0xA64E, 0xA64F}, {0xA64F, 0xA64E}, {0xA650, 0xA651}, {0xA651, 0xA650},
+        {0xA652, 0xA653}, {0xA653, 0xA652}, {0xA654, 0xA655}, {0xA655, 0xA654}, {0xA656, 0xA657}, {0xA657, 0xA656},
+        {0xA658, 0xA659}, {0xA659, 0xA658}, {0xA65A, 0xA65B}, {0xA65B, 0xA65A}, {0xA65C, 0xA65D}, {0xA65D, 0xA65C},
+        {0xA65E, 0xA65F}, {0xA65F, 0xA65E}, {0xA660, 0xA661}, {0xA661, 0xA660}, {0xA662, 0xA663}, {0xA663, 0xA662},
+        {0xA664, 0xA665}, {0xA665, 0xA664}, {0xA666, 0xA667}, {0xA667, 0xA666}, {0xA668, 0xA669}, {0xA669, 0xA668},
+        {0xA66A, 0xA66B}, {0xA66B, 0xA66A}, {0xA66C, 0xA66D}, {0xA66D, 0xA66C}, {0xA680, 0xA681}, {0xA681, 0xA680},
+        {0xA682, 0xA683}, {0xA683, 0xA682}, {0xA684, 0xA685}, {0xA685, 0xA684}, {0xA686, 0xA687}, {0xA687, 0xA686},
+        {0xA688, 0xA689}, {0xA689, 0xA688}, {0xA68A, 0xA68B}, {0xA68B, 0xA68A}, {0xA68C, 0xA68D}, {0xA68D, 0xA68C},
+        {0xA68E, 0xA68F}, {0xA68F, 0xA68E}, {0xA690, 0xA691}, {0xA691, 0xA690}, {0xA692, 0xA693}, {0xA693, 0xA692},
+        {0xA694, 0xA695}, {0xA695, 0xA694}, {0xA696, 0xA697}, {0xA697, 0xA696}, {0xA698, 0xA699}, {0xA699, 0xA698},
+        {0xA69A, 0xA69B}, {0xA69B, 0xA69A}, {0xA722, 0xA723}, {0xA723, 0xA722}, {0xA724, 0xA725}, {0xA725, 0xA724},
+        {0xA726, 0xA727}, {0xA727, 0xA726}, {0xA728, 0xA729}, {0xA729, 0xA728}, {0xA72A, 0xA72B}, {0xA72B, 0xA72A},
+        {0xA72C, 0xA72D}, {0xA72D, 0xA72C}, {0xA72E, 0xA72F}, {0xA72F, 0xA72E}, {0xA732, 0xA733}, {0xA733, 0xA732},
+        {0xA734, 0xA735}, {0xA735, 0xA734}, {0xA736, 0xA737}, {0xA737, 0xA736}, {0xA738, 0xA739}, {0xA739, 0xA738},
+        {0xA73A, 0xA73B}, {0xA73B, 0xA73A}, {0xA73C, 0xA73D}, {0xA73D, 0xA73C}, {0xA73E, 0xA73F}, {0xA73F, 0xA73E},
+        {0xA740, 0xA741}, {0xA741, 0xA740}, {0xA742, 0xA743}, {0xA743, 0xA742}, {0xA744, 0xA745}, {0xA745, 0xA744},
+        {0xA746, 0xA747}, {0xA747, 0xA746}, {0xA748, 0xA749}, {0xA749, 0xA748}, {0xA74A, 0xA74B}, {0xA74B, 0xA74A},
+        {0xA74C, 0xA74D}, {0xA74D, 0xA74C}, {0xA74E, 0xA74F}, {0xA74F, 0xA74E}, {0xA750, 0xA751}, {0xA751, 0xA750},
+        {0xA752, 0xA753}, {0xA753, 0xA752}, {0xA754, 0xA755}, {0xA755, 0xA754}, {0xA756, 0xA757}, {0xA757, 0xA756},
+        {0xA758, 0xA759}, {0xA759, 0xA758}, {0xA75A, 0xA75B}, {0xA75B, 0xA75A}, {0xA75C, 0xA75D}, {0xA75D, 0xA75C},
+        {0xA75E, 0xA75F}, {0xA75F, 0xA75E}, {0xA760, 0xA761}, {0xA761, 0xA760}, {0xA762, 0xA763}, {0xA763, 0xA762},
+        {0xA764, 0xA765}, {0xA765, 0xA764}, {0xA766, 0xA767}, {0xA767, 0xA766}, {0xA768, 0xA769}, {0xA769, 0xA768},
+        {0xA76A, 0xA76B}, {0xA76B, 0xA76A}, {0xA76C, 0xA76D}, {0xA76D, 0xA76C}, {0xA76E, 0xA76F}, {0xA76F, 0xA76E},
+        {0xA779, 0xA77A}, {0xA77A, 0xA779}, {0xA77B, 0xA77C}, {0xA77C, 0xA77B}, {0xA77D, 0x1D79}, {0xA77E, 0xA77F},
+        {0xA77F, 0xA77E}, {0xA780, 0xA781}, {0xA781, 0xA780}, {0xA782, 0xA783}, {0xA783, 0xA782}, {0xA784, 0xA785},
+        {0xA785, 0xA784}, {0xA786, 0xA787}, {0xA787, 0xA786}, {0xA78B, 0xA78C}, {0xA78C, 0xA78B}, {0xA78D, 0x265},
+        {0xA790, 0xA791}, {0xA791, 0xA790}, {0xA792, 0xA793}, {0xA793, 0xA792}, {0xA794, 0xA7C4}, {0xA796, 0xA797},
+        {0xA797, 0xA796}, {0xA798, 0xA799}, {0xA799, 0xA798}, {0xA79A, 0xA79B}, {0xA79B, 0xA79A}, {0xA79C, 0xA79D},
+        {0xA79D, 0xA79C}, {0xA79E, 0xA79F}, {0xA79F, 0xA79E}, {0xA7A0, 0xA7A1}, {0xA7A1, 0xA7A0}, {0xA7A2, 0xA7A3},
+        {0xA7A3, 0xA7A2}, {0xA7A4, 0xA7A5}, {0xA7A5, 0xA7A4}, {0xA7A6, 0xA7A7}, {0xA7A7, 0xA7A6}, {0xA7A8, 0xA7A9},
+        {0xA7A9, 0xA7A8}, {0xA7AA, 0x266}, {0xA7AB, 0x25C}, {0xA7AC, 0x261}, {0xA7AD, 0x26C}, {0xA7AE, 0x26A},
+        {0xA7B0, 0x29E}, {0xA7B1, 0x287}, {0xA7B2, 0x29D}, {0xA7B3, 0xAB53}, {0xA7B4, 0xA7B5}, {0xA7B5, 0xA7B4},
+        {0xA7B6, 0xA7B7}, {0xA7B7, 0xA7B6}, {0xA7B8, 0xA7B9}, {0xA7B9, 0xA7B8}, {0xA7BA, 0xA7BB}, {0xA7BB, 0xA7BA},
+        {0xA7BC, 0xA7BD}, {0xA7BD, 0xA7BC}, {0xA7BE, 0xA7BF}, {0xA7BF, 0xA7BE}, {0xA7C0, 0xA7C1}, {0xA7C1, 0xA7C0},
+        {0xA7C2, 0xA7C3}, {0xA7C3, 0xA7C2}, {0xA7C4, 0xA794}, {0xA7C5, 0x282}, {0xA7C6, 0x1D8E}, {0xA7C7, 0xA7C8},
+        {0xA7C8, 0xA7C7}, {0xA7C9, 0xA7CA}, {0xA7CA, 0xA7C9}, {0xA7D0, 0xA7D1}, {0xA7D1, 0xA7D0}, {0xA7D6, 0xA7D7},
+        {0xA7D7, 0xA7D6}, {0xA7D8, 0xA7D9}, {0xA7D9, 0xA7D8}, {0xA7F5, 0xA7F6}, {0xA7F6, 0xA7F5}, {0xAB53, 0xA7B3},
+        {0xAB70, 0x13A0}, {0xAB71, 0x13A1}, {0xAB72, 0x13A2}, {0xAB73, 0x13A3}, {0xAB74, 0x13A4}, {0xAB75, 0x13A5},
+        {0xAB76, 0x13A6}, {0xAB77, 0x13A7}, {0xAB78, 0x13A8}, {0xAB79, 0x13A9}, {0xAB7A, 0x13AA}, {0xAB7B, 0x13AB},
+        {0xAB7C, 0x13AC}, {0xAB7D, 0x13AD}, {0xAB7E, 0x13AE}, {0xAB7F, 0x13AF}, {0xAB80, 0x13B0}, {0xAB81, 0x13B1},
+        {0xAB82, 0x13B2}, {0xAB83, 0x13B3}, {0xAB84, 0x13B4}, {0xAB85, 0x13B5}, {0xAB86, 0x13B6}, {0xAB87, 0x13B7},
+        {0xAB88, 0x13B8}, {0xAB89, 0x13B9}, {0xAB8A, 0x13BA}, {0xAB8B, 0x13BB}, {0xAB8C, 0x13BC}, {0xAB8D, 0x13BD},
+        {0xAB8E, 0x13BE}, {0xAB8F, 0x13BF}, {0xAB90, 0x13C0}, {0xAB91, 0x13C1}, {0xAB92, 0x13C2}, {0xAB93, 0x13C3},
+        {0xAB94, 0x13C4}, {0xAB95, 0x13C5}, {0xAB96, 0x13C6}, {0xAB97, 0x13C7}, {0xAB98, 0x13C8}, {0xAB99, 0x13C9},
+        {0xAB9A, 0x13CA}, {0xAB9B, 0x13CB}, {0xAB9C, 0x13CC}, {0xAB9D, 0x13CD}, {0xAB9E, 0x13CE}, {0xAB9F, 0x13CF},
+        {0xABA0, 0x13D0}, {0xABA1, 0x13D1}, {0xABA2, 0x13D2}, {0xABA3, 0x13D3}, {0xABA4, 0x13D4}, {0xABA5, 0x13D5},
+        {0xABA6, 0x13D6}, {0xABA7, 0x13D7}, {0xABA8, 0x13D8}, {0xABA9, 0x13D9}, {0xABAA, 0x13DA}, {0xABAB, 0x13DB},
+        {0xABAC, 0x13DC}, {0xABAD, 0x13DD}, {0xABAE, 0x13DE}, {0xABAF, 0x13DF}, {0xABB0, 0x13E0}, {0xABB1, 0x13E1},
+        {0xABB2, 0x13E2}, {0xABB3, 0x13E3}, {0xABB4, 0x13E4}, {0xABB5, 0x13E5}, {0xABB6, 0x13E6}, {0xABB7, 0x13E7},
+        {0xABB8, 0x13E8}, {0xABB9, 0x13E9}, {0xABBA, 0x13EA}, {0xABBB, 0x13EB}, {0xABBC, 0x13EC}, {0xABBD, 0x13ED},
+        {0xABBE, 0x13EE}, {0xABBF, 0x13EF}, {0xFF21, 0xFF41}, {0xFF22, 0xFF42}, {0xFF23, 0xFF43}, {0xFF24, 0xFF44},
+        {0xFF25, 0xFF45}, {0xFF26, 0xFF46}, {0xFF27, 0xFF47}, {0xFF28, 0xFF48}, {0xFF29, 0xFF49}, {0xFF2A, 0xFF4A},
+        {0xFF2B, 0xFF4B}, {0xFF2C, 0xFF4C}, {0xFF2D, 0xFF4D}, {0xFF2E, 0xFF4E}, {0xFF2F, 0xFF4F}, {0xFF30, 0xFF50},
+        {0xFF31, 0xFF51}, {0xFF32, 0xFF52}, {0xFF33, 0xFF53}, {0xFF34, 0xFF54}, {0xFF35, 0xFF55}, {0xFF36, 0xFF56},
+        {0xFF37, 0xFF57}, {0xFF38, 0xFF58}, {0xFF39, 0xFF59}, {0xFF3A, 0xFF5A}, {0xFF41, 0xFF21}, {0xFF42, 0xFF22},
+        {0xFF43, 0xFF23}, {0xFF44, 0xFF24}, {0xFF45, 0xFF25}, {0xFF46, 0xFF26}, {0xFF47, 0xFF27}, {0xFF48, 0xFF28},
+        {0xFF49, 0xFF29}, {0xFF4A, 0xFF2A}, {0xFF4B, 0xFF2B}, {0xFF4C, 0xFF2C}, {0xFF4D, 0xFF2D}, {0xFF4E, 0xFF2E},
+        {0xFF4F, 0xFF2F}, {0xFF50, 0xFF30}, {0xFF51, 0xFF31}, {0xFF52, 0xFF32}, {0xFF53, 0xFF33}, {0xFF54, 0xFF34},
+        {0xFF55, 0xFF35}, {0xFF56, 0xFF36}, {0xFF57, 0xFF37}, {0xFF58, 0xFF38}, {0xFF59, 0xFF39}, {0xFF5A, 0xFF3A},
+        {0x10400, 0x10428}, {0x10401, 0x10429}, {0x10402, 0x1042A}, {0x10403, 0x1042B}, {0x10404, 0x1042C}, {0x10405, 0x1042D},
+        {0x10406, 0x1042E}, {0x10407, 0x1042F}, {0x10408, 0x10430}, {0x10409, 0x10431}, {0x1040A, 0x10432}, {0x1040B, 0x10433},
+        {0x1040C, 0x10434}, {0x1040D, 0x10435}, {0x1040E, 0x10436}, {0x1040F, 0x10437}, {0x10410, 0x10438}, {0x10411, 0x10439},
+        {0x10412, 0x1043A}, {0x10413, 0x1043B}, {0x10414, 0x1043C}, {0x10415, 0x1043D}, {0x10416, 0x1043E}, {0x10417, 0x1043F},
+        {0x10418, 0x10440}, {0x10419, 0x10441}, {0x1041A, 0x10442}, {0x1041B, 0x10443}, {0x1041C, 0x10444}, {0x1041D, 0x10445},
+        {0x1041E, 0x10446}, {0x1041F, 0x10447}, {0x10420, 0x10448}, {0x10421, 0x10449}, {0x10422, 0x1044A}, {0x10423, 0x1044B},
+        {0x10424, 0x1044C}, {0x10425, 0x1044D}, {0x10426, 0x1044E}, {0x10427, 0x1044F}, {0x10428, 0x10400}, {0x10429, 0x10401},
+        {0x1042A, 0x10402}, {0x1042B, 0x10403}, {0x1042C, 0x10404}, {0x1042D, 0x10405}, {0x1042E, 0x10406}, {0x1042F, 0x10407},
+        {0x10430, 0x10408}, {0x10431, 0x10409}, {0x10432, 0x1040A}, {0x10433, 0x1040B}, {0x10434, 0x1040C}, {0x10435, 0x1040D},
+        {0x10436, 0x1040E}, {0x10437, 0x1040F}, {0x10438, 0x10410}, {0x10439, 0x10411}, {0x1043A, 0x10412}, {0x1043B, 0x10413},
+        {0x1043C, 0x10414}, {0x1043D, 0x10415}, {0x1043E, 0x10416}, {0x1043F, 0x10417}, {0x10440, 0x10418}, {0x10441, 0x10419},
+        {0x10442, 0x1041A}, {0x10443, 0x1041B}, {0x10444, 0x1041C}, {0x10445, 0x1041D}, {0x10446, 0x1041E}, {0x10447, 0x1041F},
+        {0x10448, 0x10420}, {0x10449, 0x10421}, {0x1044A, 0x10422}, {0x1044B, 0x10423}, {0x1044C, 0x10424}, {0x1044D, 0x10425},
+        {0x1044E, 0x10426}, {0x1044F, 0x10427}, {0x104B0, 0x104D8}, {0x104B1, 0x104D9}, {0x104B2, 0x104DA}, {0x104B3, 0x104DB},
+        {0x104B4, 0x104DC}, {0x104B5, 0x104DD}, {0x104B6, 0x104DE}, {0x104B7, 0x104DF}, {0x104B8, 0x104E0}, {0x104B9, 0x104E1},
+        {0x104BA, 0x104E2}, {0x104BB, 0x104E3}, {0x104BC, 0x104E4}, {0x104BD, 0x104E5}, {0x104BE, 0x104E6}, {0x104BF, 0x104E7},
+        {0x104C0, 0x104E8}, {0x104C1, 0x104E9}, {0x104C2, 0x104EA}, {0x104C3, 0x104EB}, {0x104C4, 0x104EC}, {0x104C5, 0x104ED},
+        {0x104C6, 0x104EE}, {0x104C7, 0x104EF}, {0x104C8, 0x104F0}, {0x104C9, 0x104F1}, {0x104CA, 0x104F2}, {0x104CB, 0x104F3},
+        {0x104CC, 0x104F4}, {0x104CD, 0x104F5}, {0x104CE, 0x104F6}, {0x104CF, 0x104F7}, {0x104D0, 0x104F8}, {0x104D1, 0x104F9},
+        {0x104D2, 0x104FA}, {0x104D3, 0x104FB}, {0x104D8, 0x104B0}, {0x104D9, 0x104B1}, {0x104DA, 0x104B2}, {0x104DB, 0x104B3},
+        {0x104DC, 0x104B4}, {0x104DD, 0x104B5}, {0x104DE, 0x104B6}, {0x104DF, 0x104B7}, {0x104E0, 0x104B8}, {0x104E1, 0x104B9},
+        {0x104E2, 0x104BA}, {0x104E3, 0x104BB}, {0x104E4, 0x104BC}, {0x104E5, 0x104BD}, {0x104E6, 0x104BE}, {0x104E7, 0x104BF},
+        {0x104E8, 0x104C0}, {0x104E9, 0x104C1}, {0x104EA, 0x104C2}, {0x104EB, 0x104C3}, {0x104EC, 0x104C4}, {0x104ED, 0x104C5},
+        {0x104EE, 0x104C6}, {0x104EF, 0x104C7}, {0x104F0, 0x104C8}, {0x104F1, 0x104C9}, {0x104F2, 0x104CA}, {0x104F3, 0x104CB},
+        {0x104F4, 0x104CC}, {0x104F5, 0x104CD}, {0x104F6, 0x104CE}, {0x104F7, 0x104CF}, {0x104F8, 0x104D0}, {0x104F9, 0x104D1},
+        {0x104FA, 0x104D2}, {0x104FB, 0x104D3}, {0x10570, 0x10597}, {0x10571, 0x10598}, {0x10572, 0x10599}, {0x10573, 0x1059A},
+        {0x10574, 0x1059B}, {0x10575, 0x1059C}, {0x10576, 0x1059D}, {0x10577, 0x1059E}, {0x10578, 0x1059F}, {0x10579, 0x105A0},
+        {0x1057A, 0x105A1}, {0x1057C, 0x105A3}, {0x1057D, 0x105A4}, {0x1057E, 0x105A5}, {0x1057F, 0x105A6}, {0x10580, 0x105A7},
+        {0x10581, 0x105A8}, {0x10582, 0x105A9}, {0x10583, 0x105AA}, {0x10584, 0x105AB}, {0x10585, 0x105AC}, {0x10586, 0x105AD},
+        {0x10587, 0x105AE}, {0x10588, 0x105AF}, {0x10589, 0x105B0}, {0x1058A, 0x105B1}, {0x1058C, 0x105B3}, {0x1058D, 0x105B4},
+        {0x1058E, 0x105B5}, {0x1058F, 0x105B6}, {0x10590, 0x105B7}, {0x10591, 0x105B8}, {0x10592, 0x105B9}, {0x10594, 0x105BB},
+        {0x10595, 0x105BC}, {0x10597, 0x10570}, {0x10598, 0x10571}, {0x10599, 0x10572}, {0x1059A, 0x10573}, {0x1059B, 0x10574},
+        {0x1059C, 0x10575}, {0x1059D, 0x10576}, {0x1059E, 0x10577}, {0x1059F, 0x10578}, {0x105A0, 0x10579}, {0x105A1, 0x1057A},
+        {0x105A3, 0x1057C}, {0x105A4, 0x1057D}, {0x105A5, 0x1057E}, {0x105A6, 0x1057F}, {0x105A7, 0x10580}, {0x105A8, 0x10581},
+        {0x105A9, 0x10582}, {0x105AA, 0x10583}, {0x105AB, 0x10584}, {0x105AC, 0x10585}, {0x105AD, 0x10586}, {0x105AE, 0x10587},
+        {0x105AF, 0x10588}, {0x105B0, 0x10589}, {0x105B1, 0x1058A}, {0x105B3, 0x1058C}, {0x105B4, 0x1058D}, {0x105B5, 0x1058E},
+        {0x105B6, 0x1058F}, {0x105B7, 0x10590}, {0x105B8, 0x10591}, {0x105B9, 0x10592}, {0x105BB, 0x10594}, {0x105BC, 0x10595},
+        {0x10C80, 0x10CC0}, {0x10C81, 0x10CC1}, {0x10C82, 0x10CC2}, {0x10C83, 0x10CC3}, {0x10C84, 0x10CC4}, {0x10C85, 0x10CC5},
+        {0x10C86, 0x10CC6}, {0x10C87, 0x10CC7}, {0x10C88, 0x10CC8}, {0x10C89, 0x10CC9}, {0x10C8A, 0x10CCA}, {0x10C8B, 0x10CCB},
+        {0x10C8C, 0x10CCC}, {0x10C8D, 0x10CCD}, {0x10C8E, 0x10CCE}, {0x10C8F, 0x10CCF}, {0x10C90, 0x10CD0}, {0x10C91, 0x10CD1},
+        {0x10C92, 0x10CD2}, {0x10C93, 0x10CD3}, {0x10C94, 0x10CD4}, {0x10C95, 0x10CD5}, {0x10C96, 0x10CD6}, {0x10C97, 0x10CD7},
+        {0x10C98, 0x10CD8}, {0x10C99, 0x10CD9}, {0x10C9A, 0x10CDA}, {0x10C9B, 0x10CDB}, {0x10C9C, 0x10CDC}, {0x10C9D, 0x10CDD},
+        {0x10C9E, 0x10CDE}, {0x10C9F, 0x10CDF}, {0x10CA0, 0x10CE0}, {0x10CA1, 0x10CE1}, {0x10CA2, 0x10CE2}, {0x10CA3, 0x10CE3},
+        {0x10CA4, 0x10CE4}, {0x10CA5, 0x10CE5}, {0x10CA6, 0x10CE6}, {0x10CA7, 0x10CE7}, {0x10CA8, 0x10CE8}, {0x10CA9, 0x10CE9},
+        {0x10CAA, 0x10CEA}, {0x10CAB, 0x10CEB}, {0x10CAC, 0x10CEC}, {0x10CAD, 0x10CED}, {0x10CAE, 0x10CEE}, {0x10CAF, 0x10CEF},
+        {0x10CB0, 0x10CF0}, {0x10CB1, 0x10CF1}, {0x10CB2, 0x10CF2}, {0x10CC0, 0x10C80}, {0x10CC1, 0x10C81}, {0x10CC2, 0x10C82},
+        {0x10CC3, 0x10C83}, {0x10CC4, 0x10C84}, {0x10CC5, 0x10C85}, {0x10CC6, 0x10C86}, {0x10CC7, 0x10C87}, {0x10CC8, 0x10C88},
+        {0x10CC9, 0x10C89}, {0x10CCA, 0x10C8A}, {0x10CCB, 0x10C8B}, {0x10CCC, 0x10C8C}, {0x10CCD, 0x10C8D}, {0x10CCE, 0x10C8E},
+        {0x10CCF, 0x10C8F}, {0x10CD0, 0x10C90}, {0x10CD1, 0x10C91}, {0x10CD2, 0x10C92}, {0x10CD3, 0x10C93}, {0x10CD4, 0x10C94},
+        {0x10CD5, 0x10C95}, {0x10CD6, 0x10C96}, {0x10CD7, 0x10C97}, {0x10CD8, 0x10C98}, {0x10CD9, 0x10C99}, {0x10CDA, 0x10C9A},
+        {0x10CDB, 0x10C9B}, {0x10CDC, 0x10C9C}, {0x10CDD, 0x10C9D}, {0x10CDE, 0x10C9E}, {0x10CDF, 0x10C9F}, {0x10CE0, 0x10CA0},
+        {0x10CE1, 0x10CA1}, {0x10CE2, 0x10CA2}, {0x10CE3, 0x10CA3}, {0x10CE4, 0x10CA4}, {0x10CE5, 0x10CA5}, {0x10CE6, 0x10CA6},
+        {0x10CE7, 0x10CA7}, {0x10CE8, 0x10CA8}, {0x10CE9, 0x10CA9}, {0x10CEA, 0x10CAA}, {0x10CEB, 0x10CAB}, {0x10CEC, 0x10CAC},
+        {0x10CED, 0x10CAD}, {0x10CEE, 0x10CAE}, {0x10CEF, 0x10CAF}, {0x10CF0, 0x10CB0}, {0x10CF1, 0x10CB1}, {0x10CF2, 0x10CB2},
+        {0x118A0, 0x118C0}, {0x118A1, 0x118C1}, {0x118A2, 0x118C2}, {0x118A3, 0x118C3}, {0x118A4, 0x118C4}, {0x118A5, 0x118C5},
+        {0x118A6, 0x118C6}, {0x118A7, 0x118C7}, {0x118A8, 0x118C8}, {0x118A9, 0x118C9}, {0x118AA, 0x118CA}, {0x118AB, 0x118CB},
+        {0x118AC, 0x118CC}, {0x118AD, 0x118CD}, {0x118AE, 0x118CE}, {0x118AF, 0x118CF}, {0x118B0, 0x118D0}, {0x118B1, 0x118D1},
+        {0x118B2, 0x118D2}, {0x118B3, 0x118D3}, {0x118B4, 0x118D4}, {0x118B5, 0x118D5}, {0x118B6, 0x118D6}, {0x118B7, 0x118D7},
+        {0x118B8, 0x118D8}, {0x118B9, 0x118D9}, {0x118BA, 0x118DA}, {0x118BB, 0x118DB}, {0x118BC, 0x118DC}, {0x118BD, 0x118DD},
+        {0x118BE, 0x118DE}, {0x118BF, 0x118DF}, {0x118C0, 0x118A0}, {0x118C1, 0x118A1}, {0x118C2, 0x118A2}, {0x118C3, 0x118A3},
+        {0x118C4, 0x118A4}, {0x118C5, 0x118A5}, {0x118C6, 0x118A6}, {0x118C7, 0x118A7}, {0x118C8, 0x118A8}, {0x118C9, 0x118A9},
+        {0x118CA, 0x118AA}, {0x118CB, 0x118AB}, {0x118CC, 0x118AC}, {0x118CD, 0x118AD}, {0x118CE, 0x118AE}, {0x118CF, 0x118AF},
+        {0x118D0, 0x118B0}, {0x118D1, 0x118B1}, {0x118D2, 0x118B2}, {0x118D3, 0x118B3}, {0x118D4, 0x118B4}, {0x118D5, 0x118B5},
+        {0x118D6, 0x118B6}, {0x118D7, 0x118B7}, {0x118D8, 0x118B8}, {0x118D9, 0x118B9}, {0x118DA, 0x118BA}, {0x118DB, 0x118BB},
+        {0x118DC, 0x118BC}, {0x118DD, 0x118BD}, {0x118DE, 0x118BE}, {0x118DF, 0x118BF}, {0x16E40, 0x16E60}, {0x16E41, 0x16E61},
+        {0x16E42, 0x16E62}, {0x16E43, 0x16E63}, {0x16E44, 0x16E64}, {0x16E45, 0x16E65}, {0x16E46, 0x16E66}, {0x16E47, 0x16E67},
+        {0x16E48, 0x16E68}, {0x16E49, 0x16E69}, {0x16E4A, 0x16E6A}, {0x16E4B, 0x16E6B}, {0x16E4C, 0x16E6C}, {0x16E4D, 0x16E6D},
+        {0x16E4E, 0x16E6E}, {0x16E4F, 0x16E6F}, {0x16E50, 0x16E70}, {0x16E51, 0x16E71}, {0x16E52, 0x16E72}, {0x16E53, 0x16E73},
+        {0x16E54, 0x16E74}, {0x16E55, 0x16E75}, {0x16E56, 0x16E76}, {0x16E57, 0x16E77}, {0x16E58, 0x16E78}, {0x16E59, 0x16E79},
+        {0x16E5A, 0x16E7A}, {0x16E5B, 0x16E7B}, {0x16E5C, 0x16E7C}, {0x16E5D, 0x16E7D}, {0x16E5E, 0x16E7E}, {0x16E5F, 0x16E7F},
+        {0x16E60, 0x16E40}, {0x16E61, 0x16E41}, {0x16E62, 0x16E42}, {0x16E63, 0x16E43}, {0x16E64, 0x16E44}, {0x16E65, 0x16E45},
+        {0x16E66, 0x16E46}, {0x16E67, 0x16E47}, {0x16E68, 0x16E48}, {0x16E69, 0x16E49}, {0x16E6A, 0x16E4A}, {0x16E6B, 0x16E4B},
+        {0x16E6C, 0x16E4C}, {0x16E6D, 0x16E4D}, {0x16E6E, 0x16E4E}, {0x16E6F, 0x16E4F}, {0x16E70, 0x16E50}, {0x16E71, 0x16E51},
+        {0x16E72, 0x16E52}, {0x16E73, 0x16E53}, {0x16E74, 0x16E54}, {0x16E75, 0x16E55}, {0x16E76, 0x16E56}, {0x16E77, 0x16E57},
+        {0x16E78, 0x16E58}, {0x16E79, 0x16E59}, {0x16E7A, 0x16E5A}, {0x16E7B, 0x16E5B}, {0x16E7C, 0x16E5C}, {0x16E7D, 0x16E5D},
+        {0x16E7E, 0x16E5E}, {0x16E7F, 0x16E5F}, {0x1E900, 0x1E922}, {0x1E901, 0x1E923}, {0x1E902, 0x1E924}, {0x1E903, 0x1E925},
+        {0x1E904, 0x1E926}, {0x1E905, 0x1E927}, {0x1E906, 0x1E928}, {0x1E907, 0x1E929}, {0x1E908, 0x1E92A}, {0x1E909, 0x1E92B},
+        {0x1E90A, 0x1E92C}, {0x1E90B, 0x1E92D}, {0x1E90C, 0x1E92E}, {0x1E90D, 0x1E92F}, {0x1E90E, 0x1E930}, {0x1E90F, 0x1E931},
+        {0x1E910, 0x1E932}, {0x1E911, 0x1E933}, {0x1E912, 0x1E934}, {0x1E913, 0x1E935}, {0x1E914, 0x1E936}, {0x1E915, 0x1E937},
+        {0x1E916, 0x1E938}, {0x1E917, 0x1E939}, {0x1E918, 0x1E93A}, {0x1E919, 0x1E93B}, {0x1E91A, 0x1E93C}, {0x1E91B, 0x1E93D},
+        {0x1E91C, 0x1E93E}, {0x1E91D, 0x1E93F}, {0x1E91E, 0x1E940}, {0x1E91F, 0x1E941}, {0x1E920, 0x1E942}, {0x1E921, 0x1E943},
+        {0x1E922, 0x1E900}, {0x1E923, 0x1E901}, {0x1E924, 0x1E902}, {0x1E925, 0x1E903}, {0x1E926, 0x1E904}, {0x1E927, 0x1E905},
+        {0x1E928, 0x1E906}, {0x1E929, 0x1E907}, {0x1E92A, 0x1E908}, {0x1E92B, 0x1E909}, {0x1E92C, 0x1E90A}, {0x1E92D, 0x1E90B},
+        {0x1E92E, 0x1E90C}, {0x1E92F, 0x1E90D}, {0x1E930, 0x1E90E}, {0x1E931, 0x1E90F}, {0x1E932, 0x1E910}, {0x1E933, 0x1E911},
+        {0x1E934, 0x1E912}, {0x1E935, 0x1E913}, {0x1E936, 0x1E914}, {0x1E937, 0x1E915}, {0x1E938, 0x1E916}, {0x1E939, 0x1E917},
+        {0x1E93A, 0x1E918}, {0x1E93B, 0x1E919}, {0x1E93C, 0x1E91A}, {0x1E93D, 0x1E91B}, {0x1E93E, 0x1E91C}, {0x1E93F, 0x1E91D},
+        {0x1E940, 0x1E91E}, {0x1E941, 0x1E91F}, {0x1E942, 0x1E920}, {0x1E943, 0x1E921},
+    };
+    const size_t CASE_ORBIT_COUNT = 2878;
+} // namespace regex
\ No newline at end of file
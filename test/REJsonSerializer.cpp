@@ -11,12 +11,22 @@ using namespace regex::notations;
 
 Json REJsonSerializer::VisitAlternation(const AlternationExpression::Ptr &exp)
 {
-    return {{"kind", "Alternation"}, {"left", VisitRegularExpression(exp->left)}, {"right", VisitRegularExpression(exp->right)}};
+    return {{"kind", "Alternation"}, {"items", VisitItems(exp->items)}};
 }
 
 Json REJsonSerializer::VisitConcatenation(const ConcatenationExpression::Ptr &exp)
 {
-    return {{"kind", "Concatenation"}, {"left", VisitRegularExpression(exp->left)}, {"right", VisitRegularExpression(exp->right)}};
+    return {{"kind", "Concatenation"}, {"items", VisitItems(exp->items)}};
+}
+
+Json REJsonSerializer::VisitItems(const vector<RegularExpression::Ptr> &items)
+{
+    vector<Json> itemsJson;
+    for (const auto &item : items)
+    {
+        itemsJson.push_back(VisitRegularExpression(item));
+    }
+    return itemsJson;
 }
 
 Json REJsonSerializer::VisitKleeneStar(const KleeneStarExpression::Ptr &exp)
@@ -24,12 +34,32 @@ Json REJsonSerializer::VisitKleeneStar(const KleeneStarExpression::Ptr &exp)
     return {{"kind", "KleeneStar"}, {"inner_exp", VisitRegularExpression(exp->innerExp)}};
 }
 
+Json REJsonSerializer::VisitRepeat(const RepeatExpression::Ptr &exp)
+{
+    return {{"kind", "Repeat"}, {"at_least", exp->atLeast}, {"at_most", exp->atMost}, {"inner_exp", VisitRegularExpression(exp->innerExp)}};
+}
+
 Json REJsonSerializer::VisitSymbol(const SymbolExpression::Ptr &exp)
 {
     // exp->range.rangeType -> string
     return {{"kind", "Symbol"}, {"lower", utf8::utf32to8(u32string({exp->range.lower}))}, {"upper", utf8::utf32to8(u32string({exp->range.upper}))}};
 }
 
+Json REJsonSerializer::VisitCharClass(const CharClassExpression::Ptr &exp)
+{
+    vector<Json> rangesJson;
+    for (const auto &range : exp->charClass.Ranges())
+    {
+        rangesJson.push_back({{"lower", utf8::utf32to8(u32string({range.lower}))}, {"upper", utf8::utf32to8(u32string({range.upper}))}});
+    }
+    return {{"kind", "CharClass"}, {"ranges", rangesJson}};
+}
+
+Json REJsonSerializer::VisitCapture(const CaptureExpression::Ptr &exp)
+{
+    return {{"kind", "Capture"}, {"group", exp->group}, {"inner_exp", VisitRegularExpression(exp->innerExp)}};
+}
+
 Json NFAToJson(const NFA &nfa)
 {
     return JsonMap({{"start_vertex", nfa.startVertex}, {"end_vertex", nfa.endVertex}, {"graph", GraphToJson(nfa.G)}});
@@ -15,7 +15,13 @@ public:
     virtual Json VisitAlternation(const AlternationExpression::Ptr &exp);
     virtual Json VisitConcatenation(const ConcatenationExpression::Ptr &exp);
     virtual Json VisitKleeneStar(const KleeneStarExpression::Ptr &exp);
+    virtual Json VisitRepeat(const RepeatExpression::Ptr &exp);
     virtual Json VisitSymbol(const SymbolExpression::Ptr &exp);
+    virtual Json VisitCharClass(const CharClassExpression::Ptr &exp);
+    virtual Json VisitCapture(const CaptureExpression::Ptr &exp);
+
+private:
+    Json VisitItems(const vector<RegularExpression::Ptr> &items);
 };
 
 Json NFAToJson(const NFA &nfa);
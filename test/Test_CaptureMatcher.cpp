@@ -0,0 +1,92 @@
+#include "CaptureMatcher.hpp"
+#include "REJsonSerializer.hpp"
+#include "TaggedDFA.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Capture Matcher", "[CaptureMatcher]")
+{
+    vector<Submatch> groups;
+    auto digit = Range(U'0', U'9');
+    auto letter = Range(U'a', U'z');
+
+    SECTION("Test Groups of the Span")
+    {
+        CaptureMatcher matcher(Capture(OneOrMore(letter), 1) + Symbol(U'=') + Capture(OneOrMore(digit), 2));
+        u32string str = U"-- size=1024; x";
+        REQUIRE(matcher.GroupCount() == 3);
+        REQUIRE(matcher.Search(str, groups) == true);
+        REQUIRE(groups[0].begin == 3);
+        REQUIRE(groups[0].end == 12);
+        REQUIRE(groups[1].begin == 3);
+        REQUIRE(groups[1].end == 7);
+        REQUIRE(groups[2].begin == 8);
+        REQUIRE(groups[2].end == 12);
+        REQUIRE(matcher.Match(str, groups) == false);
+        REQUIRE(groups[0].begin == -1);
+        REQUIRE(matcher.Match(U"a=1b", groups) == true);
+        REQUIRE(groups[0].end == 3);
+        REQUIRE(matcher.FullMatch(U"a=1b", groups) == false);
+        REQUIRE(matcher.Search(U"no fields", groups) == false);
+    }
+    SECTION("Test Agreement With the Tagged DFA")
+    {
+        vector<RegularExpression::Ptr> exps = {
+            Capture(OneOrMore(Capture(letter, 2)), 1) + Capture(digit->Many(), 3) + Symbol(U';'),
+            Capture(Symbol(U'a') | Literal(U"ab"), 1) + Capture(Symbol(U'c') | Literal(U"bcd"), 2) + Symbol(U';'),
+            OneOrMore(Capture(letter + Capture(digit->Many(), 2), 1)) + Symbol(U';'),
+            Repeat(Capture(letter | digit, 1), 2, 4) + Capture(OneOrMore(digit), 2) + Symbol(U';'),
+        };
+        vector<u32string> strs = {U"ab12;", U"abcd;", U"a1b2c;", U"a1b;", U"abc1234;", U"12;", U";", U"x ab12;"};
+        for (const auto &exp : exps)
+        {
+            CaptureMatcher matcher(exp);
+            TaggedDFA tdfa(exp);
+            vector<Submatch> expected;
+            for (const auto &str : strs)
+            {
+                bool matched = tdfa.FullMatch(str, expected);
+                REQUIRE(matcher.FullMatch(str, groups) == matched);
+                for (size_t g = 0; g < groups.size(); g++)
+                {
+                    REQUIRE(groups[g].begin == expected[g].begin);
+                    REQUIRE(groups[g].end == expected[g].end);
+                }
+                /* the span of the search comes from FindIter */
+                matched = tdfa.Search(str, expected);
+                REQUIRE(matcher.Search(str, groups) == matched);
+                for (size_t g = 0; g < groups.size(); g++)
+                {
+                    REQUIRE(groups[g].begin == expected[g].begin);
+                    REQUIRE(groups[g].end == expected[g].end);
+                }
+            }
+        }
+    }
+    SECTION("Test Long Input With Rare Matches")
+    {
+        u32string str(100000, U' ');
+        str.replace(90000, 8, U"key=4096");
+        CaptureMatcher matcher(Capture(OneOrMore(letter), 1) + Symbol(U'=') + Capture(OneOrMore(digit), 2));
+        REQUIRE(matcher.Search(str, groups) == true);
+        REQUIRE(groups[1].begin == 90000);
+        REQUIRE(groups[2].end == 90008);
+    }
+    SECTION("Test Reusing the Fill Buffers")
+    {
+        CaptureMatcher matcher(Capture(OneOrMore(letter), 1) + Optional(Capture(OneOrMore(digit), 2)));
+        u32string str = U"ab12 c x9";
+        CaptureMatcher::FillBuffers buffers;
+        vector<Submatch> expected;
+        for (auto [begin, end] : vector<std::pair<size_t, size_t>>{{5, 6}, {0, 4}, {7, 9}, {0, 2}, {3, 4}})
+        {
+            REQUIRE(matcher.Fill(str, begin, end, groups, buffers) == matcher.Fill(str, begin, end, expected));
+            for (size_t g = 0; g < groups.size(); g++)
+            {
+                REQUIRE(groups[g].begin == expected[g].begin);
+                REQUIRE(groups[g].end == expected[g].end);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "CountingMatcher.hpp"
+#include "ExpressionArena.hpp"
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Character Classes", "[CharClass]")
+{
+    SECTION("Test Set Algebra")
+    {
+        CharClass lower(U'a', U'z');
+        CharClass digits(U'0', U'9');
+        CharClass word = lower.Union(digits).Union(CharClass(U'_', U'_'));
+
+        REQUIRE(word.Ranges().size() == 3);
+        REQUIRE(word.Contains(U'_') == true);
+        REQUIRE(word.Contains(U'A') == false);
+        REQUIRE(CharClass({{U'a', U'm'}, {U'n', U'z'}}) == lower);
+        REQUIRE(CharClass({{U'a', U'p'}, {U'f', U'z'}}) == lower);
+        REQUIRE(word.Intersect(CharClass(U'5', U'c')) == CharClass({{U'5', U'9'}, {U'_', U'_'}, {U'a', U'c'}}));
+        REQUIRE(lower.Difference(CharClass(U'b', U'y')) == CharClass({{U'a', U'a'}, {U'z', U'z'}}));
+        REQUIRE(lower.Negate().Contains(U'a') == false);
+        REQUIRE(lower.Negate().Contains(CharClass::MAX_CODE_POINT) == true);
+        REQUIRE(lower.Negate().Negate() == lower);
+        REQUIRE(CharClass::Any().Negate().IsEmpty() == true);
+        REQUIRE(CharClass().Negate() == CharClass::Any());
+        REQUIRE_THROWS_AS(CharClass(U'z', U'a'), std::invalid_argument);
+    }
+    SECTION("Test Matching a Class")
+    {
+        auto word = CharClass({{U'a', U'z'}, {U'0', U'9'}, {U'_', U'_'}});
+        auto e = OneOrMore(Class(word)) + Symbol(U'!');
+        auto matrix = e->Compile();
+
+        REQUIRE(matrix.FullMatch(U"snake_case_42!") == true);
+        REQUIRE(matrix.FullMatch(U"Snake!") == false);
+        REQUIRE(matrix.FullMatch(U"!") == false);
+        REQUIRE(Class(CharClass())->Compile().FullMatch(U"a") == false);
+    }
+    SECTION("Test a Class Is a Single Transition")
+    {
+        auto word = CharClass({{U'a', U'z'}, {U'0', U'9'}, {U'_', U'_'}});
+        NFA classNFA(Class(word));
+        NFA alternationNFA(Range(U'a', U'z') | Range(U'0', U'9') | Symbol(U'_'));
+
+        REQUIRE(classNFA.G.NodeCount() == 2);
+        REQUIRE(alternationNFA.G.NodeCount() == 8);
+        /* all the ranges of the class share one pattern besides epsilon */
+        REQUIRE(classNFA.patterns.Size() == 2);
+        REQUIRE(classNFA.patterns.GetPatternsByID(0).size() == 3);
+    }
+    SECTION("Test Overlapping Ranges")
+    {
+        auto e = (Range(U'a', U'z') + Symbol(U'1')) | (Symbol(U'q') + Symbol(U'2'));
+        auto matrix = e->Compile();
+
+        REQUIRE(matrix.FullMatch(U"b1") == true);
+        REQUIRE(matrix.FullMatch(U"q1") == true);
+        REQUIRE(matrix.FullMatch(U"q2") == true);
+        REQUIRE(matrix.FullMatch(U"b2") == false);
+
+        auto any = Class(CharClass::Any().Difference(CharClass(U'\n', U'\n')));
+        auto line = any->Many() + Literal(U"end");
+        REQUIRE(line->Compile().FullMatch(U"the end") == true);
+        REQUIRE(line->Compile().FullMatch(U"the\nend") == false);
+    }
+    SECTION("Test Case Folding")
+    {
+        REQUIRE(CharClass(U'a', U'c').FoldCase() == CharClass({{U'A', U'C'}, {U'a', U'c'}}));
+        REQUIRE(CharClass(U'0', U'9').FoldCase() == CharClass(U'0', U'9'));
+        /* the orbits can have more than two members */
+        CharClass k = CharClass(U'K', U'K').FoldCase();
+        REQUIRE(k.Contains(U'k') == true);
+        REQUIRE(k.Contains(U'\u212A') == true);
+        CharClass sigma = CharClass(U'\u03C3', U'\u03C3').FoldCase();
+        REQUIRE(sigma == CharClass({{U'\u03A3', U'\u03A3'}, {U'\u03C2', U'\u03C3'}}));
+        REQUIRE(CharClass::Any().FoldCase() == CharClass::Any());
+    }
+    SECTION("Test Classes in Other Components")
+    {
+        auto e1 = Class(CharClass({{U'a', U'c'}, {U'x', U'z'}}));
+        auto e2 = Class(CharClass({{U'x', U'z'}, {U'a', U'c'}}));
+        REQUIRE(RegularExpressionEqual()(e1, e2) == true);
+        REQUIRE(RegularExpressionHash()(e1) == RegularExpressionHash()(e2));
+        REQUIRE(RegularExpressionEqual()(e1, Class(CharClass(U'a', U'c'))) == false);
+
+        ExpressionArena arena;
+        REQUIRE(arena.Intern(e1) == arena.Class(CharClass({{U'x', U'z'}, {U'a', U'c'}})));
+        REQUIRE(RegularExpressionEqual()(arena.ToExpression(arena.Intern(e1)), e1) == true);
+
+        CountingMatcher matcher(RepeatExactly(e1, 100));
+        REQUIRE(matcher.CounterCount() == 1);
+        REQUIRE(matcher.FullMatch(u32string(50, U'a') + u32string(50, U'z')) == true);
+        REQUIRE(matcher.FullMatch(u32string(99, U'a') + U"m") == false);
+    }
+}
\ No newline at end of file
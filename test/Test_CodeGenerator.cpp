@@ -0,0 +1,66 @@
+#include "CodeGenerator.hpp"
+#include "HttpRequestLineMatcher.hpp"
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "images/HttpRequestLine.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Code Generation", "[CodeGenerator]")
+{
+    /* the build saves the image of this expression with SaveHttpRequestLine and generates the matcher from it */
+    DFAMatrix matrix = HttpRequestLine()->Compile();
+    using generated::HttpRequestLineMatcher;
+
+    SECTION("Test the Generated Matcher")
+    {
+        vector<u32string> lines = {U"GET /index.html HTTP/1.1", U"DELETE /users/42 HTTP/2.0", U"HEAD / HTTP/1.0",
+                                   U"GET  HTTP/1.1",           U"PATCH /x HTTP/1.1",         U"POST /form HTTP/1",
+                                   U"PUT /ünicode HTTP/1.1",   U"GET /a HTTP/1.1 trailing",  U""};
+        for (const auto &line : lines)
+        {
+            const char32_t *begin = line.data();
+            const char32_t *end = begin + line.size();
+            REQUIRE(HttpRequestLineMatcher::FullMatch(begin, end) == matrix.FullMatch(line));
+            REQUIRE(HttpRequestLineMatcher::Match(begin, end, true) == matrix.Match(line.begin(), line.end(), true));
+            REQUIRE(HttpRequestLineMatcher::Match(begin, end, false) == matrix.Match(line.begin(), line.end(), false));
+            REQUIRE(HttpRequestLineMatcher::Search(begin, end) - begin == matrix.Search(line.begin(), line.end()) - line.begin());
+        }
+        REQUIRE(HttpRequestLineMatcher::FullMatch(lines[0].data(), lines[0].data() + lines[0].size()) == true);
+        REQUIRE(DFAMatrix::Load(HTTP_REQUEST_LINE_IMAGE).FullMatch(lines[1]) == true);
+    }
+    SECTION("Test Searching Long Inputs")
+    {
+        /* a request line at the end of a long line which starts many partial matches */
+        u32string line;
+        while (line.size() < (1 << 20))
+        {
+            line += U"GET /";
+        }
+        const char32_t *begin = line.data();
+        REQUIRE(HttpRequestLineMatcher::Search(begin, begin + line.size()) == begin + line.size());
+        line += U" HTTP/1.1";
+        REQUIRE(HttpRequestLineMatcher::Search(begin, begin + line.size()) - begin ==
+                matrix.Search(line.begin(), line.end()) - line.begin());
+    }
+    SECTION("Test the Generated Source")
+    {
+        string source = CppCodeGenerator(matrix, "RequestLine", "http").Generate();
+
+        REQUIRE(source.find("namespace http") != string::npos);
+        REQUIRE(source.find("struct RequestLine") != string::npos);
+        /* the search states are generated too, with the reversed matrix finding the start of a match */
+        REQUIRE(source.find("case " + std::to_string(matrix.StateCount() - 1) + ":") != string::npos);
+        REQUIRE(source.find("struct RequestLineReverse") != string::npos);
+        REQUIRE(source.find("RequestLineReverse::MatchFrom(") != string::npos);
+        REQUIRE(source == CppCodeGenerator(matrix, "RequestLine", "http").Generate());
+        REQUIRE(CppCodeGenerator(Symbol(U'^')->Compile(), "Caret").Generate().find("0x5E") != string::npos);
+        REQUIRE(source.find("Context(") == string::npos);
+        auto word = (WordBoundary() + Literal(U"id") + WordBoundary())->Compile();
+        REQUIRE(CppCodeGenerator(word, "Word").Generate().find("static int Context(char32_t c)") != string::npos);
+        REQUIRE_THROWS_AS(CppCodeGenerator(matrix, "Request Line"), std::invalid_argument);
+        REQUIRE_THROWS_AS(CppCodeGenerator(matrix, "RequestLine", "1http"), std::invalid_argument);
+        REQUIRE_THROWS_AS(CppCodeGenerator(DFAMatrix(), "Empty"), std::invalid_argument);
+    }
+}
\ No newline at end of file
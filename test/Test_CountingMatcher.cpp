@@ -0,0 +1,130 @@
+#include "CountingMatcher.hpp"
+#include "NFA.hpp"
+#include <catch2/catch.hpp>
+#include <random>
+
+using namespace regex;
+using namespace regex::notations;
+
+TEST_CASE("Test Counting Matcher", "[CountingMatcher]")
+{
+    SECTION("Test Large Exact Repetition")
+    {
+        auto e = Symbol(U'<') + RepeatExactly(Range(U'a', U'z'), 1000) + Symbol(U'>');
+        CountingMatcher matcher(e);
+
+        REQUIRE(CountingMatcher::HasCountedRepetition(e) == true);
+        REQUIRE(matcher.CounterCount() == 1);
+        REQUIRE(matcher.StateCount() < 20);
+        REQUIRE(matcher.FullMatch(U"<" + u32string(1000, U'x') + U">") == true);
+        REQUIRE(matcher.FullMatch(U"<" + u32string(999, U'x') + U">") == false);
+        REQUIRE(matcher.FullMatch(U"<" + u32string(1001, U'x') + U">") == false);
+        REQUIRE(matcher.FullMatch(U"<" + u32string(500, U'x') + U"1" + u32string(499, U'x') + U">") == false);
+    }
+    SECTION("Test Length Validation")
+    {
+        auto e = Repeat(Range(0, 0x10FFFF), 0, 4096) + Literal(U"END");
+        CountingMatcher matcher(e);
+
+        REQUIRE(matcher.FullMatch(U"END") == true);
+        REQUIRE(matcher.FullMatch(u32string(4096, U'.') + U"END") == true);
+        REQUIRE(matcher.FullMatch(u32string(4097, U'.') + U"END") == false);
+        u32string s = u32string(100, U'.') + U"END" + u32string(100, U'.');
+        REQUIRE(matcher.Match(s.begin(), s.end(), true) == 103);
+    }
+    SECTION("Test Unbounded Repetition")
+    {
+        auto e = RepeatAtLeast(Range(U'0', U'9'), 100) + Symbol(U'!');
+        CountingMatcher matcher(e);
+
+        REQUIRE(matcher.CounterCount() == 1);
+        REQUIRE(matcher.FullMatch(u32string(99, U'1') + U"!") == false);
+        REQUIRE(matcher.FullMatch(u32string(100, U'1') + U"!") == true);
+        REQUIRE(matcher.FullMatch(u32string(1000, U'1') + U"!") == true);
+    }
+    SECTION("Test Overlapping Counts")
+    {
+        /* every thread started by the star keeps its own count in the same window */
+        auto e = (Repeat(Symbol(U'a'), 2, 3) + Symbol(U'b'))->Many();
+        CountingMatcher matcher(e, 0);
+        auto matrix = e->Compile();
+
+        REQUIRE(matcher.CounterCount() == 1);
+        for (auto s : {U"", U"aab", U"aaab", U"aaaab", U"aabaaab", U"ab", U"aabaab", U"aaba"})
+        {
+            REQUIRE(matcher.FullMatch(s) == matrix.FullMatch(s));
+        }
+    }
+    SECTION("Test Counters Inside Unrolled Repetitions")
+    {
+        auto e = Repeat(Repeat(Range(U'0', U'9'), 2, 40) + Symbol(U'-'), 1, 3);
+        CountingMatcher matcher(e, 8);
+
+        REQUIRE(matcher.CounterCount() == 3);
+        REQUIRE(matcher.FullMatch(U"12-") == true);
+        REQUIRE(matcher.FullMatch(U"12-345-6789-") == true);
+        REQUIRE(matcher.FullMatch(U"12-345-6789-00-") == false);
+        REQUIRE(matcher.FullMatch(U"1-") == false);
+    }
+    SECTION("Test Same Results as the DFA")
+    {
+        auto e = LineBegin() + ((Repeat(Range(U'c', U'e'), 1, 3) + Symbol(U'x')) | (Literal(U"ab") + Optional(Symbol(U'f'))));
+        CountingMatcher matcher(e, 0);
+        auto matrix = e->Compile();
+        u32string text = U"zzcdxab";
+
+        for (auto s : {U"cx", U"cdex", U"cdecx", U"ab", U"abf", U"abff", U"abfx", U"x"})
+        {
+            u32string str = s;
+            REQUIRE(matcher.FullMatch(str) == matrix.FullMatch(str));
+            REQUIRE(matcher.Match(str.begin(), str.end(), false) == matrix.Match(str.begin(), str.end(), false));
+        }
+        REQUIRE(matcher.Search(text.begin(), text.end()) == matrix.Search(text.begin(), text.end()));
+    }
+    SECTION("Test Assertions in Context")
+    {
+        auto word = Range(U'a', U'z');
+        vector<RegularExpression::Ptr> exps = {
+            LineBegin() + Repeat(word, 1, 40) + LineEnd(),
+            WordBoundary() + Repeat(word, 2, 40) + WordBoundary(),
+            NotWordBoundary() + Symbol(U'b') + Symbol(U'c')->Many(),
+        };
+        for (const auto &e : exps)
+        {
+            CountingMatcher matcher(e, 8);
+            auto matrix = e->Compile();
+            for (auto s : {U"ab cd", U"x\nabc\n", U"abcc", U"a b", U""})
+            {
+                u32string str = s;
+                REQUIRE(matcher.Match(str.begin(), str.end(), true) == matrix.Match(str.begin(), str.end(), true));
+                REQUIRE(matcher.Search(str.begin(), str.end()) == matrix.Search(str.begin(), str.end()));
+            }
+        }
+    }
+    SECTION("Test Searching Long Inputs")
+    {
+        /* every start reads to the end of the string, which is read once */
+        auto e = Range(U'a', U'z')->Many() + Repeat(Range(U'0', U'9'), 50, 50);
+        CountingMatcher matcher(e, 8);
+        u32string str(1 << 16, U'x');
+        REQUIRE(matcher.Search(str.begin(), str.end()) == str.end());
+        str += u32string(50, U'7');
+        REQUIRE(matcher.Search(str.begin(), str.end()) == str.begin());
+        str[1000] = U'-';
+        REQUIRE(matcher.Search(str.begin(), str.end()) == str.begin() + 1001);
+
+        auto f = (Repeat(Range(U'a', U'b'), 2, 12) + Symbol(U'c')) | (Symbol(U'b') + Repeat(Range(U'a', U'c'), 9, 9));
+        CountingMatcher counting(f, 8);
+        auto matrix = f->Compile();
+        std::mt19937 random(7);
+        for (int i = 0; i < 500; i++)
+        {
+            u32string text;
+            for (size_t length = random() % 40; text.size() < length;)
+            {
+                text += static_cast<char32_t>(U'a' + random() % 4);
+            }
+            REQUIRE(counting.Search(text.begin(), text.end()) == matrix.Search(text.begin(), text.end()));
+        }
+    }
+}
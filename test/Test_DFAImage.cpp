@@ -0,0 +1,55 @@
+#include <cstring>
+
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "UnicodeProperties.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test DFA Image", "[DFAImage]")
+{
+    auto e = OneOrMore(Property("L")) + Symbol(U'@') + Range(U'0', U'9')->Many();
+    DFAMatrix matrix = e->Compile();
+    SECTION("Test Using an Image in Place")
+    {
+        vector<uint8_t> image(matrix.ImageData(), matrix.ImageData() + matrix.ImageSize());
+        DFAMatrix view = DFAMatrix::FromImage(image.data(), image.size());
+
+        REQUIRE(view.StateCount() == matrix.StateCount());
+        REQUIRE(view.ColumnCount() == matrix.ColumnCount());
+        REQUIRE(view.FullMatch(U"名前@123") == true);
+        REQUIRE(view.FullMatch(U"name@12a") == false);
+        REQUIRE(DFAMatrix(matrix).ImageData() == matrix.ImageData());
+    }
+    SECTION("Test Saving and Loading")
+    {
+        matrix.Save("Image1.rdfa", "identifier@digits");
+        DFAMatrix loaded = DFAMatrix::Load("Image1.rdfa");
+
+        REQUIRE(loaded.Metadata() == "identifier@digits");
+        REQUIRE(matrix.Metadata() == "");
+        REQUIRE(loaded.FullMatch(U"Ωmega@42") == true);
+        REQUIRE(loaded.FullMatch(U"@42") == false);
+        u32string s = U"12 user@2024";
+        REQUIRE(loaded.Search(s.begin(), s.end()) == s.begin() + 3);
+    }
+    SECTION("Test Rejecting Broken Images")
+    {
+        vector<uint8_t> image(matrix.ImageData(), matrix.ImageData() + matrix.ImageSize());
+        REQUIRE_THROWS_AS(DFAMatrix::FromImage(image.data(), sizeof(DFAImageHeader) - 1), std::runtime_error);
+        REQUIRE_THROWS_AS(DFAMatrix::FromImage(image.data(), image.size() - 1), std::runtime_error);
+
+        DFAImageHeader header;
+        std::memcpy(&header, image.data(), sizeof(header));
+        header.version = DFA_IMAGE_VERSION + 1;
+        std::memcpy(image.data(), &header, sizeof(header));
+        REQUIRE_THROWS_AS(DFAMatrix::FromImage(image), std::runtime_error);
+
+        header.version = DFA_IMAGE_VERSION;
+        header.transitionsOffset = header.imageSize;
+        std::memcpy(image.data(), &header, sizeof(header));
+        REQUIRE_THROWS_AS(DFAMatrix::FromImage(image), std::runtime_error);
+        REQUIRE_THROWS_AS(DFAMatrix::Load("NoSuchImage.rdfa"), std::runtime_error);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "ExpressionArena.hpp"
+#include "REJsonSerializer.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex;
+
+TEST_CASE("Test Expression Arena", "[ExpressionArena]")
+{
+    SECTION("Test Hash Consing")
+    {
+        ExpressionArena arena;
+        NodeIndex a1 = arena.Symbol(U'a');
+        NodeIndex a2 = arena.Symbol(U'a');
+        NodeIndex b = arena.Symbol(U'b');
+
+        REQUIRE(a1 == a2);
+        REQUIRE(a1 != b);
+        REQUIRE(arena.Concatenation(a1, b) == arena.Concatenation(a2, b));
+        REQUIRE(arena.Concatenation(a1, b) != arena.Concatenation(b, a1));
+        REQUIRE(arena.LineBegin() != arena.LineEnd());
+
+        size_t before = arena.NodeCount();
+        arena.Literal(U"abab");
+        REQUIRE(arena.NodeCount() == before + 1);
+    }
+    SECTION("Test Repeated Subtrees Are Stored Once")
+    {
+        ExpressionArena arena;
+        NodeIndex x = arena.Literal(U"ABC");
+        size_t before = arena.NodeCount();
+        NodeIndex e = arena.RepeatExactly(x, 1000);
+
+        REQUIRE(arena.NodeCount() - before == 1);
+        REQUIRE(arena.Node(e).kind == RegularExpressionKind::Repeat);
+        auto matrix = arena.Compile(arena.RepeatExactly(x, 3));
+        REQUIRE(matrix.FullMatch(U"ABCABCABC") == true);
+        REQUIRE(matrix.FullMatch(U"ABCABC") == false);
+        REQUIRE(arena.Child(e, 0) == x);
+
+        u32string text;
+        for (int i = 0; i < 40; i++)
+        {
+            text += U"ABC";
+        }
+        REQUIRE(arena.Compile(arena.RepeatExactly(x, 40)).FullMatch(text) == true);
+    }
+    SECTION("Test Compile")
+    {
+        ExpressionArena arena;
+        NodeIndex digits = arena.KleeneStar(arena.Range(U'0', U'9'));
+        NodeIndex e1 = arena.Concatenation(digits, arena.Repeat(arena.Literal(U"ABC"), 2, 5));
+        NodeIndex e2 = arena.Concatenation(digits, arena.RepeatAtLeast(arena.Literal(U"ABC"), 3));
+        auto matrix1 = arena.Compile(e1);
+        auto matrix2 = arena.Compile(e2);
+
+        REQUIRE(matrix1.FullMatch(U"321ABCABC") == true);
+        REQUIRE(matrix1.FullMatch(U"321ABC") == false);
+        REQUIRE(matrix1.FullMatch(U"321ABCABCABCABCABC") == true);
+        REQUIRE(matrix1.FullMatch(U"321ABCABCABCABCABCABC") == false);
+        REQUIRE(matrix2.FullMatch(U"321ABCABC") == false);
+        REQUIRE(matrix2.FullMatch(U"321ABCABCABCABC") == true);
+
+        auto folded = arena.Compile(e1, CompileFlags::CaseInsensitive);
+        REQUIRE(folded.FullMatch(U"321abcAbC") == true);
+        REQUIRE(matrix1.FullMatch(U"321abcAbC") == false);
+        REQUIRE(folded.FullMatch(U"321abc") == false);
+    }
+    SECTION("Test Conversion From and To Expression Trees")
+    {
+        using namespace regex::notations;
+        auto e = (Symbol(U'a') + Symbol(U'b')) | (Range(U'0', U'9')->Many() | (LineBegin() + Symbol(U'a')->Many()));
+        ExpressionArena arena;
+        NodeIndex node = arena.Intern(e);
+
+        REQUIRE(RegularExpressionEqual()(arena.ToExpression(node), e) == true);
+        REQUIRE(arena.Intern(arena.ToExpression(node)) == node);
+
+        NFA expected(e);
+        NFA actual(arena, node);
+        REQUIRE(NFAToJson(actual) == NFAToJson(expected));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "FindIter.hpp"
+#include "REJsonSerializer.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <random>
+
+using namespace regex::notations;
+
+static vector<std::pair<size_t, size_t>> FindAll(const DFAMatrix &matrix, const u32string &str)
+{
+    vector<std::pair<size_t, size_t>> spans;
+    FindIter iter(matrix, str);
+    MatchSpan span;
+    while (iter.Next(span))
+    {
+        spans.emplace_back(span.begin, span.end);
+    }
+    return spans;
+}
+
+/* the matches found by trying the anchored states at every position */
+static vector<std::pair<size_t, size_t>> FindAllByPosition(const DFAMatrix &matrix, const u32string &str)
+{
+    vector<std::pair<size_t, size_t>> spans;
+    size_t lastEnd = SIZE_MAX;
+    for (size_t position = 0; position <= str.size();)
+    {
+        auto start = str.begin() + position;
+        int length = matrix.MatchFrom(matrix.StartState(str.begin(), start), start, str.end(), true);
+        if (length == -1 || (length == 0 && position == lastEnd))
+        {
+            position++;
+            continue;
+        }
+        spans.emplace_back(position, position + length);
+        lastEnd = position + length;
+        position = length == 0 ? position + 1 : lastEnd;
+    }
+    return spans;
+}
+
+TEST_CASE("Test FindIter", "[FindIter]")
+{
+    using Spans = vector<std::pair<size_t, size_t>>;
+
+    SECTION("Test Non-Overlapping Matches")
+    {
+        DFAMatrix matrix = OneOrMore(Range(U'0', U'9'))->Compile();
+        REQUIRE(FindAll(matrix, U"a1 22 333b") == Spans{{1, 2}, {3, 5}, {6, 9}});
+        REQUIRE(FindAll(matrix, U"no digits").empty() == true);
+        REQUIRE(FindAll(matrix, U"").empty() == true);
+        DFAMatrix aba = Literal(U"aba")->Compile();
+        REQUIRE(FindAll(aba, U"ababababa") == Spans{{0, 3}, {4, 7}});
+    }
+    SECTION("Test Empty Matches")
+    {
+        DFAMatrix matrix = Symbol(U'a')->Many()->Compile();
+        REQUIRE(FindAll(matrix, U"baaa") == Spans{{0, 0}, {1, 4}});
+        REQUIRE(FindAll(matrix, U"bab") == Spans{{0, 0}, {1, 2}, {3, 3}});
+        REQUIRE(FindAll(matrix, U"") == Spans{{0, 0}});
+    }
+    SECTION("Test Agreement With Search")
+    {
+        DFAMatrix matrix = (Literal(U"ab") | Literal(U"cd"))->Compile();
+        u32string str = U"xxcdyabzzab";
+        auto spans = FindAll(matrix, str);
+        REQUIRE(spans.size() == 3);
+        size_t position = 0;
+        for (const auto &[begin, end] : spans)
+        {
+            auto it = matrix.Search(str.begin() + position, str.end());
+            REQUIRE(static_cast<size_t>(it - str.begin()) == begin);
+            REQUIRE(matrix.Match(it, str.end(), true) == static_cast<int>(end - begin));
+            position = end;
+        }
+    }
+    SECTION("Test IsMatch and Count")
+    {
+        DFAMatrix matrix = OneOrMore(Range(U'0', U'9'))->Compile();
+        REQUIRE(matrix.IsMatch(U"a1 22 333b") == true);
+        REQUIRE(matrix.Count(U"a1 22 333b") == 3);
+        REQUIRE(matrix.IsMatch(U"no digits") == false);
+        REQUIRE(matrix.Count(U"") == 0);
+        DFAMatrix many = Symbol(U'a')->Many()->Compile();
+        REQUIRE(many.IsMatch(U"") == true);
+        REQUIRE(many.Count(U"bab") == 3);
+        DFAMatrix empty;
+        REQUIRE(empty.IsMatch(U"a") == false);
+        REQUIRE(empty.Count(U"a") == 0);
+    }
+    SECTION("Test Search States")
+    {
+        auto ab = Range(U'a', U'b');
+        vector<RegularExpression::Ptr> exps = {OneOrMore(Range(U'0', U'9')),
+                                               Symbol(U'a')->Many(),
+                                               (Literal(U"ab") | Symbol(U'a')) + Optional(Literal(U"bc")),
+                                               Literal(U"abcd") | Symbol(U'c'),
+                                               WordBoundary() + Literal(U"ab"),
+                                               LineBegin() + OneOrMore(Symbol(U'a')) + LineEnd(),
+                                               (Symbol(U'x')->Many() + Symbol(U'y')) | Symbol(U'z'),
+                                               ab->Many() + Symbol(U'a') + RepeatExactly(ab, 3)};
+        std::mt19937 random(11);
+        const u32string alphabet = U"abcdxyz0 \n";
+        for (const auto &exp : exps)
+        {
+            DFAMatrix matrix = exp->Compile();
+            REQUIRE(matrix.SearchStartState(CharacterContext::TextEdge) != -1);
+            REQUIRE(matrix.AnchoredStateCount() < matrix.StateCount());
+            REQUIRE(matrix.Reversed() != nullptr);
+            for (int t = 0; t < 200; t++)
+            {
+                u32string str;
+                for (size_t n = random() % 16, i = 0; i < n; i++)
+                {
+                    str += alphabet[random() % alphabet.size()];
+                }
+                auto expected = FindAllByPosition(matrix, str);
+                REQUIRE(FindAll(matrix, str) == expected);
+                REQUIRE(matrix.Count(str) == expected.size());
+                REQUIRE(matrix.IsMatch(str) == !expected.empty());
+                size_t first = expected.empty() ? str.size() : std::min(expected[0].first, str.size());
+                REQUIRE(matrix.Search(str.begin(), str.end()) == str.begin() + first);
+            }
+        }
+        /* the search states of this pattern are given up, and every position is tried instead */
+        DFAMatrix many = (Symbol(U'a') + RepeatExactly(ab, 12) + Symbol(U'c'))->Compile();
+        REQUIRE(many.SearchStartState(CharacterContext::TextEdge) == -1);
+        REQUIRE(many.AnchoredStateCount() == many.StateCount());
+        u32string str = U"xa" + u32string(12, U'b') + U"cxa" + u32string(12, U'a') + U"c";
+        REQUIRE(many.IsMatch(str) == true);
+        REQUIRE(many.Count(str) == 2);
+        /* a matrix only run from its start has neither */
+        DFAMatrix anchored = BuildAnchoredDFAMatrix(exps.back());
+        REQUIRE(anchored.SearchStartState(CharacterContext::TextEdge) == -1);
+        REQUIRE(anchored.Reversed() == nullptr);
+        REQUIRE(anchored.StateCount() == exps.back()->Compile().AnchoredStateCount());
+    }
+    SECTION("Test Universal States")
+    {
+        /* once "ab" is read every continuation is accepted, so the longest match ends with the string */
+        DFAMatrix matrix = (Literal(U"ab") + Class(CharClass::Any())->Many())->Compile();
+        u32string str = U"xxab\U0010FFFF\n!";
+        REQUIRE(matrix.Match(str.begin() + 2, str.end(), true) == 5);
+        REQUIRE(matrix.Match(str.begin() + 2, str.end(), false) == 2);
+        REQUIRE(matrix.Count(str) == 1);
+        REQUIRE(matrix.FullMatch(U"ab anything") == true);
+        /* a state accepting only some continuations is not universal */
+        DFAMatrix partial = (Literal(U"ab") + Range(U'a', U'z')->Many())->Compile();
+        REQUIRE(partial.Match(str.begin() + 2, str.end(), true) == 2);
+    }
+}
\ No newline at end of file
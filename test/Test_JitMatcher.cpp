@@ -0,0 +1,66 @@
+#include "JitMatcher.hpp"
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "UnicodeProperties.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test JIT Matcher", "[JitMatcher]")
+{
+    SECTION("Test the Same Results as the Interpreter")
+    {
+        auto word = OneOrMore(Property("L") | Symbol(U'_'));
+        auto number = OneOrMore(Range(U'0', U'9')) + Optional(Symbol(U'.') + OneOrMore(Range(U'0', U'9')));
+        vector<RegularExpression::Ptr> expressions = {
+            word + Symbol(U'=') + number,
+            (Literal(U"ab") | Literal(U"abc"))->Many() + Symbol(U'd'),
+            Class(CharClass::Any().Difference(CharClass(U'"', U'"')))->Many() + Symbol(U'"'),
+            Symbol(U'x')->Many()};
+        vector<u32string> strings = {U"",      U"x=1",   U"größe=3.25", U"x_=.5",  U"abcabd", U"ababcd",
+                                     U"abce",  U"no\"",  U"\"",         U"a=1.2.3", U"d",      U"\U0010FFFF\"",
+                                     U"x=12 ", U"\xFFFFFFFF"};
+        for (const auto &e : expressions)
+        {
+            DFAMatrix matrix = e->Compile();
+            JitMatcher jit(matrix);
+            REQUIRE(jit.IsCompiled() == JitMatcher::IsSupported());
+            for (const auto &str : strings)
+            {
+                REQUIRE(jit.Match(str.begin(), str.end(), true) == matrix.Match(str.begin(), str.end(), true));
+                REQUIRE(jit.Match(str.begin(), str.end(), false) == matrix.Match(str.begin(), str.end(), false));
+                REQUIRE(jit.FullMatch(str) == matrix.FullMatch(str));
+                REQUIRE(jit.Search(str.begin(), str.end()) == matrix.Search(str.begin(), str.end()));
+            }
+        }
+    }
+    SECTION("Test Searching Long Inputs")
+    {
+        /* the search states read the input once, where trying every start would take quadratic time */
+        DFAMatrix matrix = (Range(U'a', U'z')->Many() + Symbol(U'Q'))->Compile();
+        JitMatcher jit(matrix);
+        REQUIRE(jit.IsCompiled() == JitMatcher::IsSupported());
+        u32string str(1 << 20, U'a');
+        REQUIRE(jit.Search(str.begin(), str.end()) == str.end());
+        str[str.size() - 3] = U'-';
+        str.back() = U'Q';
+        REQUIRE(jit.Search(str.begin(), str.end()) == str.end() - 2);
+        REQUIRE(jit.Search(str.begin(), str.end()) == matrix.Search(str.begin(), str.end()));
+    }
+    SECTION("Test Falling Back to the Interpreter")
+    {
+        DFAMatrix matrix = (Literal(U"id") + Range(U'0', U'9')->Many())->Compile();
+        JitMatcher small(matrix, 100);
+        REQUIRE(small.IsCompiled() == false);
+        REQUIRE(small.FullMatch(U"id42") == true);
+        REQUIRE(JitMatcher::ShouldCompile(matrix, JitMatcher::MIN_INPUT_SIZE) == JitMatcher::IsSupported());
+
+        JitMatcher anchored((LineBegin() + Literal(U"id"))->Compile());
+        REQUIRE(anchored.IsCompiled() == false);
+        REQUIRE(anchored.FullMatch(U"id") == true);
+
+        JitMatcher empty{DFAMatrix()};
+        REQUIRE(empty.IsCompiled() == false);
+        REQUIRE(empty.FullMatch(U"id") == false);
+    }
+}
\ No newline at end of file
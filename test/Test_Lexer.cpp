@@ -0,0 +1,68 @@
+#include "Lexer.hpp"
+#include "REJsonSerializer.hpp"
+#include "UnicodeProperties.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Lexer", "[Lexer]")
+{
+    enum Rule
+    {
+        If,
+        Identifier,
+        Number,
+        Space,
+        Operator
+    };
+    auto letter = Property("L") | Symbol(U'_');
+    auto digit = Range(U'0', U'9');
+    Lexer lexer({Literal(U"if"), letter + (letter | digit)->Many(), OneOrMore(digit), OneOrMore(Symbol(U' ')),
+                 Literal(U"=") | Literal(U"==") | Literal(U"<") | Literal(U"<=")});
+    vector<int> ids;
+    vector<TokenSpan> spans;
+
+    SECTION("Test Longest Match and Priority")
+    {
+        u32string input = U"if iffy == 42 <= größe";
+        REQUIRE(lexer.Tokenize(input, ids, spans) == input.size());
+        REQUIRE(ids == vector<int>{If, Space, Identifier, Space, Operator, Space, Number, Space, Operator, Space, Identifier});
+        REQUIRE(spans[2].begin == 3);
+        REQUIRE(spans[2].end == 7);
+        REQUIRE(input.substr(spans[4].begin, spans[4].end - spans[4].begin) == U"==");
+        REQUIRE(input.substr(spans[10].begin) == U"größe");
+    }
+    SECTION("Test Stopping at an Unknown Character")
+    {
+        REQUIRE(lexer.Tokenize(U"x = 1 ; y", ids, spans) == 6);
+        REQUIRE(ids == vector<int>{Identifier, Space, Operator, Space, Number, Space});
+        REQUIRE(lexer.Tokenize(U"", ids, spans) == 0);
+        REQUIRE(ids.empty() == true);
+        /* past the last code point, the class map has no column */
+        u32string input = U"ab ";
+        input += char32_t{0x110000};
+        REQUIRE(lexer.Tokenize(input, ids, spans) == 3);
+        REQUIRE(ids == vector<int>{Identifier, Space});
+    }
+    SECTION("Test Reusing the Vectors")
+    {
+        ids.reserve(64);
+        spans.reserve(64);
+        const int *data = ids.data();
+        lexer.Tokenize(U"a b c", ids, spans);
+        lexer.Tokenize(U"d e", ids, spans);
+        REQUIRE(ids.data() == data);
+        REQUIRE(ids.size() == 3);
+    }
+    SECTION("Test Invalid Rules")
+    {
+        REQUIRE_THROWS_AS(Lexer({LineBegin() + Literal(U"if")}), std::invalid_argument);
+        /* the DFA of this rule needs 2^17 states, and the construction stops past MAX_STATE_COUNT */
+        auto ab = Range(U'a', U'b');
+        REQUIRE_THROWS_AS(Lexer({ab->Many() + Symbol(U'a') + RepeatExactly(ab, 16)}), std::runtime_error);
+        /* a rule matching the empty string never makes an empty token */
+        Lexer optional({Symbol(U'a')->Many()});
+        REQUIRE(optional.Tokenize(U"aab", ids, spans) == 2);
+        REQUIRE(ids.size() == 1);
+    }
+}
\ No newline at end of file
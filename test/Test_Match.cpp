@@ -3,6 +3,7 @@
 
 #include "NFA.hpp"
 #include "REJsonSerializer.hpp"
+#include "Simplifier.hpp"
 #include <catch2/catch.hpp>
 
 using std::cout;
@@ -30,6 +31,7 @@ TEST_CASE("Test Matching", "[DFAMatrix]")
         REQUIRE(matrix2.FullMatch(U"aaaaa") == true);
         REQUIRE(matrix2.FullMatch(U"aaaaabb") == true);
         REQUIRE(matrix2.FullMatch(U"aaabbaa") == false);
+        REQUIRE(matrix2.FullMatch(U"bb") == true);
     }
     SECTION("Test Matching 3")
     {
@@ -99,4 +101,65 @@ TEST_CASE("Test Matching", "[DFAMatrix]")
         REQUIRE(matrix.Match(apple.begin(), apple.end(), true) == 5);
         REQUIRE(matrix.Match(appleAndBanana.begin(), appleAndBanana.end(), true) == 5);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Test Bounded Repetition", "[DFAMatrix]")
+{
+    SECTION("Test Optional and OneOrMore")
+    {
+        auto e = Literal(U"colo") + Optional(Symbol(U'u')) + Symbol(U'r') + OneOrMore(Symbol(U'!'));
+        auto matrix = e->Compile();
+
+        REQUIRE(matrix.FullMatch(U"color!") == true);
+        REQUIRE(matrix.FullMatch(U"colour!!!") == true);
+        REQUIRE(matrix.FullMatch(U"colour") == false);
+        REQUIRE(matrix.FullMatch(U"colouur!") == false);
+    }
+    SECTION("Test Empty Repetition")
+    {
+        auto e = Symbol(U'a') + Repeat(Symbol(U'b'), 0, 0) + Symbol(U'c');
+        auto matrix = e->Compile();
+
+        REQUIRE(matrix.FullMatch(U"ac") == true);
+        REQUIRE(matrix.FullMatch(U"abc") == false);
+    }
+    SECTION("Test Nested Repetition")
+    {
+        auto e = Repeat(Repeat(Symbol(U'a'), 2, 3) + Symbol(U'-'), 1, 2);
+        auto matrix = e->Compile();
+
+        REQUIRE(matrix.FullMatch(U"aa-") == true);
+        REQUIRE(matrix.FullMatch(U"aaa-aa-") == true);
+        REQUIRE(matrix.FullMatch(U"a-") == false);
+        REQUIRE(matrix.FullMatch(U"aa-aa-aa-") == false);
+    }
+    SECTION("Test Large Bounded Repetition")
+    {
+        auto e = Repeat(Range(U'0', U'9'), 1, 200);
+        NFA nfa(e);
+        REQUIRE(nfa.G.NodeCount() < 200 * 3);
+
+        auto matrix = e->Compile();
+        REQUIRE(matrix.FullMatch(U"") == false);
+        REQUIRE(matrix.FullMatch(U"7") == true);
+        REQUIRE(matrix.FullMatch(u32string(200, U'5')) == true);
+        REQUIRE(matrix.FullMatch(u32string(201, U'5')) == false);
+    }
+    SECTION("Test Case-Insensitive Matching")
+    {
+        auto e = Literal(U"select") + OneOrMore(Symbol(U' ')) + OneOrMore(Range(U'a', U'z') | Symbol(U'_'));
+        auto matrix = e->Compile();
+        auto folded = e->Compile(CompileFlags::CaseInsensitive);
+
+        REQUIRE(folded.FullMatch(U"SELECT user_ID") == true);
+        REQUIRE(folded.FullMatch(U"select name") == true);
+        REQUIRE(matrix.FullMatch(U"SELECT user_ID") == false);
+        REQUIRE(folded.FullMatch(U"SELECT 1") == false);
+        /* the classes are folded, the automaton is not expanded */
+        REQUIRE(folded.StateCount() == matrix.StateCount());
+        REQUIRE(Symbol(U'k')->Compile(CompileFlags::CaseInsensitive).FullMatch(U"\u212A") == true);
+        /* simple case folding maps one character to one character */
+        REQUIRE(Literal(U"ss")->Compile(CompileFlags::CaseInsensitive).FullMatch(U"\u00DF") == false);
+        auto digits = LineBegin() + Range(U'0', U'9');
+        REQUIRE(FoldCase(digits) == digits);
+    }
+}
@@ -0,0 +1,81 @@
+#include "OnePassDFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "TaggedDFA.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test One-Pass DFA", "[OnePassDFA]")
+{
+    vector<Submatch> groups;
+    auto digit = Range(U'0', U'9');
+    auto letter = Range(U'a', U'z');
+
+    SECTION("Test Detection")
+    {
+        REQUIRE(OnePassDFA::IsOnePass(Capture(OneOrMore(letter), 1) + Symbol(U'=') + Capture(OneOrMore(digit), 2)) == true);
+        REQUIRE(OnePassDFA::IsOnePass(OneOrMore(Capture(letter + Capture(digit->Many(), 2), 1))) == true);
+        REQUIRE(OnePassDFA::IsOnePass(Capture(Symbol(U'a')->Many(), 1) + Capture(Symbol(U'a')->Many(), 2)) == false);
+        REQUIRE(OnePassDFA::IsOnePass(Symbol(U'a')->Many() + Symbol(U'a')) == false);
+        REQUIRE(OnePassDFA::IsOnePass(Capture(Symbol(U'a') | Literal(U"ab"), 1)) == false);
+        /* two ways to match the empty string */
+        REQUIRE(OnePassDFA::IsOnePass(Optional(Symbol(U'a')) + Capture(Optional(Symbol(U'b')), 1)->Many()) == false);
+        REQUIRE(OnePassDFA::IsOnePass(LineBegin() + Symbol(U'a')) == false);
+        REQUIRE_THROWS_AS(OnePassDFA(Symbol(U'a')->Many() + Symbol(U'a')), std::invalid_argument);
+    }
+    SECTION("Test Field Extraction")
+    {
+        auto field = Capture(OneOrMore(letter), 1) + Symbol(U'=') + Capture(OneOrMore(digit), 2);
+        OnePassDFA dfa(field + (Symbol(U';') + field)->Many());
+        REQUIRE(dfa.GroupCount() == 3);
+        u32string str = U"a=1;size=1024";
+        REQUIRE(dfa.FullMatch(str, groups) == true);
+        REQUIRE(groups[0].end == 13);
+        REQUIRE(groups[1].begin == 4);
+        REQUIRE(groups[1].end == 8);
+        REQUIRE(groups[2].begin == 9);
+        REQUIRE(groups[2].end == 13);
+        REQUIRE(dfa.FullMatch(U"a=1;", groups) == false);
+        REQUIRE(dfa.Match(U"a=1;", groups) == true);
+        REQUIRE(groups[0].end == 3);
+        REQUIRE(groups[2].begin == 2);
+        REQUIRE(dfa.Search(U"-- x=9 --", groups) == true);
+        REQUIRE(groups[0].begin == 3);
+        REQUIRE(groups[0].end == 6);
+        REQUIRE(dfa.Search(U"x=", groups) == false);
+    }
+    SECTION("Test Agreement With the Tagged DFA")
+    {
+        vector<RegularExpression::Ptr> exps = {
+            OneOrMore(Capture(letter + Capture(digit->Many(), 2), 1)) + Symbol(U';'),
+            Capture(Symbol(U'x') + Optional(Capture(digit, 2)), 1) + Capture(letter->Many(), 3),
+            Capture(Literal(U"GET") | Literal(U"PUT"), 1) + Symbol(U' ') + Capture(OneOrMore(letter | Symbol(U'/')), 2),
+        };
+        vector<u32string> strs = {U"a1b22c;", U"a;", U";", U"x", U"x1abc", U"xa", U"GET /a/b", U"PUT ", U"POST /"};
+        for (const auto &exp : exps)
+        {
+            REQUIRE(OnePassDFA::IsOnePass(exp) == true);
+            OnePassDFA dfa(exp);
+            TaggedDFA tdfa(exp);
+            vector<Submatch> expected;
+            for (const auto &str : strs)
+            {
+                REQUIRE(dfa.Search(str, groups) == tdfa.Search(str, expected));
+                for (size_t g = 0; g < groups.size(); g++)
+                {
+                    REQUIRE(groups[g].begin == expected[g].begin);
+                    REQUIRE(groups[g].end == expected[g].end);
+                }
+            }
+        }
+    }
+    SECTION("Test Long Input With Rare Matches")
+    {
+        u32string str(100000, U' ');
+        str.replace(90000, 5, U"key=7");
+        OnePassDFA dfa(Capture(OneOrMore(letter), 1) + Symbol(U'=') + Capture(OneOrMore(digit), 2));
+        REQUIRE(dfa.Search(str, groups) == true);
+        REQUIRE(groups[1].begin == 90000);
+        REQUIRE(groups[2].end == 90005);
+    }
+}
\ No newline at end of file
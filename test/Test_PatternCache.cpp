@@ -0,0 +1,84 @@
+#include "PatternCache.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex;
+using namespace regex::notations;
+
+TEST_CASE("Test Pattern Cache", "[PatternCache]")
+{
+    SECTION("Test Structural Hash and Equality")
+    {
+        auto e1 = (Symbol(U'a') + Symbol(U'b')) | Range(U'0', U'9')->Many();
+        auto e2 = (Symbol(U'a') + Symbol(U'b')) | Range(U'0', U'9')->Many();
+        auto e3 = (Symbol(U'a') + Symbol(U'b')) | Range(U'0', U'8')->Many();
+        auto e4 = (Symbol(U'b') + Symbol(U'a')) | Range(U'0', U'9')->Many();
+        RegularExpressionHash hash;
+        RegularExpressionEqual equal;
+
+        REQUIRE(hash(e1) == hash(e2));
+        REQUIRE(equal(e1, e2) == true);
+        REQUIRE(equal(e1, e3) == false);
+        REQUIRE(equal(e1, e4) == false);
+        REQUIRE(equal(LineBegin(), LineEnd()) == false);
+        REQUIRE(equal(Symbol(U'a') + Symbol(U'b'), Symbol(U'a') | Symbol(U'b')) == false);
+    }
+    SECTION("Test Hits and Misses")
+    {
+        PatternCache cache(4);
+        auto m1 = cache.Compile(Literal(U"apple"));
+        auto m2 = cache.Compile(Literal(U"apple"));
+        auto m3 = cache.Compile(Literal(U"banana"));
+
+        REQUIRE(m1 == m2);
+        REQUIRE(m1 != m3);
+        REQUIRE(cache.Hits() == 1);
+        REQUIRE(cache.Misses() == 2);
+        REQUIRE(cache.Size() == 2);
+        REQUIRE(m2->FullMatch(U"apple") == true);
+        REQUIRE(m3->FullMatch(U"apple") == false);
+    }
+    SECTION("Test Compile Flags in the Key")
+    {
+        PatternCache cache(4);
+        auto sensitive = cache.Compile(Literal(U"apple"));
+        auto insensitive = cache.Compile(Literal(U"apple"), CompileFlags::CaseInsensitive);
+
+        REQUIRE(sensitive != insensitive);
+        REQUIRE(cache.Misses() == 2);
+        REQUIRE(cache.Compile(Literal(U"apple"), CompileFlags::CaseInsensitive) == insensitive);
+        REQUIRE(cache.Hits() == 1);
+        REQUIRE(sensitive->FullMatch(U"APPLE") == false);
+        REQUIRE(insensitive->FullMatch(U"APPLE") == true);
+    }
+    SECTION("Test Least Recently Used Eviction")
+    {
+        PatternCache cache(2);
+        cache.Compile(Symbol(U'a'));
+        cache.Compile(Symbol(U'b'));
+        cache.Compile(Symbol(U'a'));
+        cache.Compile(Symbol(U'c'));
+
+        REQUIRE(cache.Size() == 2);
+        cache.Compile(Symbol(U'a'));
+        REQUIRE(cache.Hits() == 2);
+        cache.Compile(Symbol(U'b'));
+        REQUIRE(cache.Misses() == 4);
+
+        cache.SetCapacity(1);
+        REQUIRE(cache.Size() == 1);
+        cache.Clear();
+        REQUIRE(cache.Size() == 0);
+        REQUIRE(cache.Hits() == 0);
+    }
+    SECTION("Test Compile Through the Global Cache")
+    {
+        auto e = Range(U'0', U'9')->Many() + Literal(U"px");
+        size_t hits = PatternCache::Global().Hits();
+        auto matrix1 = e->Compile();
+        auto matrix2 = (Range(U'0', U'9')->Many() + Literal(U"px"))->Compile();
+
+        REQUIRE(PatternCache::Global().Hits() == hits + 1);
+        REQUIRE(matrix1.FullMatch(U"128px") == true);
+        REQUIRE(matrix2.FullMatch(U"128pt") == false);
+    }
+}
\ No newline at end of file
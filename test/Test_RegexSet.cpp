@@ -0,0 +1,145 @@
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "RegexSet.hpp"
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <random>
+#include <tuple>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Regex Set", "[RegexSet]")
+{
+    SECTION("Test the Same Results as Searching Each Pattern")
+    {
+        vector<RegularExpression::Ptr> exps = {Literal(U"error"),
+                                               Literal(U"err") + Range(U'0', U'9'),
+                                               OneOrMore(Symbol(U'x')) + Symbol(U'y'),
+                                               Literal(U"warn") | Literal(U"fail"),
+                                               Range(U'a', U'c') + Literal(U"rr"),
+                                               RepeatExactly(Range(U'0', U'9'), 3)};
+        RegexSet set(exps);
+        REQUIRE(set.Size() == exps.size());
+        vector<DFAMatrix> matrices;
+        for (const auto &e : exps)
+        {
+            matrices.push_back(e->Compile());
+        }
+        std::mt19937 random(42);
+        const u32string alphabet = U"erowanfilxy0123 ";
+        for (int t = 0; t < 300; t++)
+        {
+            u32string line;
+            for (size_t n = random() % 24, i = 0; i < n; i++)
+            {
+                line += alphabet[random() % alphabet.size()];
+            }
+            line += t % 3 == 0 ? U" error" : t % 3 == 1 ? U" xxxy" : U" 99";
+            vector<size_t> expected;
+            for (size_t id = 0; id < matrices.size(); id++)
+            {
+                if (matrices[id].Search(line.begin(), line.end()) != line.end())
+                {
+                    expected.push_back(id);
+                }
+            }
+            REQUIRE(set.Matches(line) == expected);
+            REQUIRE(set.IsMatch(line) == !expected.empty());
+        }
+    }
+    SECTION("Test Assertions")
+    {
+        RegexSet set({LineBegin() + Literal(U"GET"), Literal(U"html") + LineEnd(), Literal(U"GET"), LineBegin() + LineEnd()});
+
+        REQUIRE(set.Matches(U"GET /index.html") == vector<size_t>{0, 1, 2});
+        REQUIRE(set.Matches(U" GET /index.html ") == vector<size_t>{2});
+        REQUIRE(set.Matches(U"html GET") == vector<size_t>{2});
+        REQUIRE(set.Matches(U"") == vector<size_t>{3});
+        REQUIRE(set.IsMatch(U"POST") == false);
+    }
+    SECTION("Test Assertions at Line Breaks")
+    {
+        vector<RegularExpression::Ptr> exps = {LineBegin() + Literal(U"ab"), Literal(U"ab") + LineEnd(),
+                                               Symbol(U'b') + LineEnd() + Symbol(U'\n') + LineBegin() + Symbol(U'a'),
+                                               LineBegin() + LineEnd(), LineBegin() + OneOrMore(Symbol(U'b'))};
+        RegexSet set(exps);
+        REQUIRE(set.Matches(U"x\nab") == vector<size_t>{0, 1});
+        REQUIRE(set.Matches(U"ab\nx") == vector<size_t>{0, 1});
+        REQUIRE(set.Matches(U"xab\n\nx") == vector<size_t>{1, 3});
+        vector<std::tuple<size_t, size_t, size_t>> found;
+        auto collect = [&found](const SetMatch &match) { found.emplace_back(match.id, match.begin, match.end); };
+        set.ForEachMatch(U"x\nab", collect, true);
+        REQUIRE(found == vector<std::tuple<size_t, size_t, size_t>>{{0, 2, 4}, {1, 2, 4}});
+        vector<DFAMatrix> matrices;
+        for (const auto &e : exps)
+        {
+            matrices.push_back(e->Compile());
+        }
+        std::mt19937 random(5);
+        const u32string alphabet = U"abx\n";
+        for (int t = 0; t < 300; t++)
+        {
+            u32string line;
+            for (size_t n = random() % 12, i = 0; i < n; i++)
+            {
+                line += alphabet[random() % alphabet.size()];
+            }
+            vector<size_t> expected;
+            for (size_t id = 0; id < matrices.size(); id++)
+            {
+                if (matrices[id].IsMatch(line))
+                {
+                    expected.push_back(id);
+                }
+            }
+            REQUIRE(set.Matches(line) == expected);
+            vector<size_t> reported;
+            set.ForEachMatch(line, [&reported](const SetMatch &match) { reported.push_back(match.id); });
+            std::sort(reported.begin(), reported.end());
+            reported.erase(std::unique(reported.begin(), reported.end()), reported.end());
+            REQUIRE(reported == expected);
+        }
+    }
+    SECTION("Test Flushing the Cache")
+    {
+        /* the searching DFA of this pattern has 2^13 states */
+        RegexSet set({Symbol(U'a') + RepeatExactly(Range(U'a', U'b'), 12) + Symbol(U'c'), Literal(U"bbbbbbbbbbbbbbbbbbbb")});
+        std::mt19937 random(7);
+        u32string line;
+        for (int i = 0; i < 10000; i++)
+        {
+            line += random() % 2 ? U'a' : U'b';
+        }
+        REQUIRE(set.Matches(line).size() <= 1);
+        REQUIRE(set.CachedStateCount() <= RegexSet::MAX_CACHED_STATES);
+        u32string match = U"a" + u32string(12, U'b') + U"c";
+        REQUIRE(set.Matches(line + match) == vector<size_t>{0});
+        REQUIRE(set.Matches(line + match + u32string(20, U'b')) == vector<size_t>{0, 1});
+        REQUIRE(set.Matches(U"bbbbbbbbbbbbbbbbbbbb") == vector<size_t>{1});
+    }
+    SECTION("Test Overlapping Matches")
+    {
+        RegexSet set({Literal(U"he"), Literal(U"she"), Literal(U"his"), Literal(U"hers")});
+        vector<std::tuple<size_t, size_t, size_t>> found;
+        auto collect = [&found](const SetMatch &match) { found.emplace_back(match.id, match.begin, match.end); };
+        set.ForEachMatch(U"ushers", collect, true);
+        REQUIRE(found == vector<std::tuple<size_t, size_t, size_t>>{{0, 2, 4}, {1, 1, 4}, {3, 2, 6}});
+        found.clear();
+        set.ForEachMatch(U"ushers", collect);
+        REQUIRE(std::get<1>(found.front()) == SIZE_MAX);
+        REQUIRE(found.size() == 3);
+    }
+    SECTION("Test Overlapping Matches of Expressions")
+    {
+        RegexSet set({OneOrMore(Symbol(U'a')), Symbol(U'x')->Many() + Symbol(U'b'), LineBegin() + Symbol(U'b'),
+                      Symbol(U'c') + LineEnd()});
+        vector<std::tuple<size_t, size_t, size_t>> found;
+        auto collect = [&found](const SetMatch &match) { found.emplace_back(match.id, match.begin, match.end); };
+        set.ForEachMatch(U"baaxxbc", collect, true);
+        REQUIRE(found == vector<std::tuple<size_t, size_t, size_t>>{
+                             {1, 0, 1}, {2, 0, 1}, {0, 1, 2}, {0, 1, 3}, {1, 3, 6}, {3, 6, 7}});
+        found.clear();
+        set.ForEachMatch(U"", collect, true);
+        REQUIRE(found.empty() == true);
+    }
+}
\ No newline at end of file
@@ -46,4 +46,65 @@ TEST_CASE("test regaulr expression syntax tree", "[RegularExpression]")
 
         REQUIRE(actual == expected);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("test n-ary regular expression nodes", "[RegularExpression]")
+{
+    SECTION("operators flatten nested nodes")
+    {
+        auto a = Symbol(U'a');
+        auto b = Symbol(U'b');
+        auto c = Symbol(U'c');
+        auto d = Symbol(U'd');
+        auto e1 = (a + b) + (c + d);
+        auto e2 = a | b | c;
+        auto e3 = (a | b) + c;
+
+        REQUIRE(static_pointer_cast<ConcatenationExpression>(e1)->items.size() == 4);
+        REQUIRE(static_pointer_cast<AlternationExpression>(e2)->items.size() == 3);
+        REQUIRE(static_pointer_cast<ConcatenationExpression>(e3)->items.size() == 2);
+        REQUIRE(static_pointer_cast<ConcatenationExpression>(Literal(U"apple"))->items.size() == 5);
+        REQUIRE(RegularExpressionEqual()(a + (b + c), (a + b) + c) == true);
+    }
+    SECTION("operators do not modify named operands")
+    {
+        auto ab = Symbol(U'a') + Symbol(U'b');
+        auto abc = ab + Symbol(U'c');
+
+        REQUIRE(static_pointer_cast<ConcatenationExpression>(ab)->items.size() == 2);
+        REQUIRE(static_pointer_cast<ConcatenationExpression>(abc)->items.size() == 3);
+        REQUIRE(ab->Compile().FullMatch(U"ab") == true);
+        REQUIRE(abc->Compile().FullMatch(U"abc") == true);
+    }
+    SECTION("long chains stay shallow")
+    {
+        auto e = Symbol(U'x');
+        for (int i = 0; i < 500; i++)
+        {
+            e = std::move(e) + (Symbol(U'a') | Symbol(U'b'));
+        }
+        auto items = static_pointer_cast<ConcatenationExpression>(e)->items;
+        REQUIRE(items.size() == 501);
+
+        u32string text = U"x" + u32string(500, U'b');
+        REQUIRE(e->Compile().FullMatch(text) == true);
+        REQUIRE(e->Compile().FullMatch(text + U"b") == false);
+    }
+    SECTION("deeply nested trees are traversed without recursion")
+    {
+        auto e = Symbol(U'a');
+        for (int i = 0; i < 5000; i++)
+        {
+            e = (Symbol(U'b') + e)->Many();
+        }
+        auto f = Symbol(U'a');
+        for (int i = 0; i < 5000; i++)
+        {
+            f = (Symbol(U'b') + f)->Many();
+        }
+        REQUIRE(RegularExpressionHash()(e) == RegularExpressionHash()(f));
+        REQUIRE(RegularExpressionEqual()(e, f) == true);
+
+        NFA nfa(e);
+        REQUIRE(nfa.G.NodeCount() == 2 + 5000 * 4);
+    }
+}
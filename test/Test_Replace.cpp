@@ -0,0 +1,71 @@
+#include "REJsonSerializer.hpp"
+#include "Replace.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Replace and Split", "[Replace]")
+{
+    auto digits = OneOrMore(Range(U'0', U'9'));
+    auto word = OneOrMore(Range(U'a', U'z'));
+    u32string out;
+
+    SECTION("Test Replace Templates")
+    {
+        REQUIRE(ReplaceTemplate(U"plain").MaxGroup() == 0);
+        REQUIRE(ReplaceTemplate(U"$2-${10}$1").MaxGroup() == 10);
+        REQUIRE_THROWS_AS(ReplaceTemplate(U"cost: $"), std::invalid_argument);
+        REQUIRE_THROWS_AS(ReplaceTemplate(U"${1"), std::invalid_argument);
+        REQUIRE_THROWS_AS(ReplaceTemplate(U"$x"), std::invalid_argument);
+        ReplaceTemplate tmpl(U"[$0|$$|${0}0]");
+        tmpl.Expand(U"ab", MatchSpan{0, 2}, out);
+        REQUIRE(out == U"[ab|$|ab0]");
+    }
+    SECTION("Test Replace With A DFA Matrix")
+    {
+        DFAMatrix matrix = digits->Compile();
+        ReplaceTemplate tmpl(U"<$0>");
+        REQUIRE(ReplaceAll(matrix, U"a1 22 333b", tmpl, out) == 3);
+        REQUIRE(out == U"a<1> <22> <333>b");
+        out.clear();
+        REQUIRE(Replace(matrix, U"a1 22 333b", tmpl, out) == true);
+        REQUIRE(out == U"a<1> 22 333b");
+        out.clear();
+        REQUIRE(ReplaceAll(matrix, U"none", tmpl, out) == 0);
+        REQUIRE(out == U"none");
+        /* the output is appended to */
+        REQUIRE(Replace(matrix, U"7", ReplaceTemplate(U""), out) == true);
+        REQUIRE(out == U"none");
+        REQUIRE_THROWS_AS(ReplaceAll(matrix, U"1", ReplaceTemplate(U"$1"), out), std::invalid_argument);
+        /* empty matches are replaced between the characters */
+        out.clear();
+        REQUIRE(ReplaceAll(Symbol(U'a')->Many()->Compile(), U"bab", ReplaceTemplate(U"-"), out) == 3);
+        REQUIRE(out == U"-b-b-");
+    }
+    SECTION("Test Replace With Groups")
+    {
+        CaptureMatcher matcher(Capture(word, 1) + Symbol(U'=') + Capture(digits, 2) + Optional(Capture(Symbol(U'!'), 3)));
+        ReplaceTemplate tmpl(U"$2:$1$3");
+        REQUIRE(ReplaceAll(matcher, U"x=1, size=1024!;", tmpl, out) == 2);
+        REQUIRE(out == U"1:x, 1024:size!;");
+        out.clear();
+        REQUIRE(Replace(matcher, U"a=1 b=2", tmpl, out) == true);
+        REQUIRE(out == U"1:a b=2");
+        REQUIRE_THROWS_AS(Replace(matcher, U"a=1", ReplaceTemplate(U"$4"), out), std::invalid_argument);
+    }
+    SECTION("Test Split")
+    {
+        DFAMatrix matrix = OneOrMore(Symbol(U',') | Symbol(U' '))->Compile();
+        u32string str = U"a, b,,c ";
+        vector<u32string_view> pieces;
+        REQUIRE(Split(matrix, str, pieces) == 4);
+        REQUIRE(pieces == vector<u32string_view>{U"a", U"b", U"c", U""});
+        REQUIRE(pieces[1].data() == str.data() + 3);
+        str = U"";
+        REQUIRE(Split(matrix, str, pieces) == 1);
+        REQUIRE(pieces[0].empty() == true);
+        str = U"abc";
+        REQUIRE(Split(matrix, str, pieces) == 1);
+        REQUIRE(pieces[0] == U"abc");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "REJsonSerializer.hpp"
+#include "ReverseSearcher.hpp"
+#include <catch2/catch.hpp>
+#include <random>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Reverse Searcher", "[ReverseSearcher]")
+{
+    auto digit = Range(U'0', U'9');
+    auto letter = Range(U'a', U'z');
+    MatchSpan span;
+
+    SECTION("Test Reversed Expressions")
+    {
+        DFAMatrix matrix = Reverse(Literal(U"ab") + OneOrMore(Symbol(U'c')) + Capture(Literal(U"de") | digit, 1))->Compile();
+        REQUIRE(matrix.FullMatch(U"edccba") == true);
+        REQUIRE(matrix.FullMatch(U"7cba") == true);
+        REQUIRE(matrix.FullMatch(U"abccde") == false);
+        auto reversed = Reverse(LineBegin() + Symbol(U'a'));
+        REQUIRE(RegularExpressionEqual()(reversed, Symbol(U'a') + LineEnd()) == true);
+    }
+    SECTION("Test End-Anchored Search")
+    {
+        ReverseSearcher searcher(OneOrMore(digit) + LineEnd());
+        REQUIRE(searcher.IsEndAnchored() == true);
+        REQUIRE(searcher.Search(U"abc 123 456", span) == true);
+        REQUIRE(span.begin == 8);
+        REQUIRE(span.end == 11);
+        REQUIRE(searcher.Search(U"123 x", span) == false);
+        REQUIRE(searcher.Search(U"", span) == false);
+        ReverseSearcher whole(LineBegin() + OneOrMore(digit) + LineEnd());
+        REQUIRE(whole.Search(U"0123", span) == true);
+        REQUIRE(span.begin == 0);
+        REQUIRE(whole.Search(U"a123", span) == false);
+        ReverseSearcher alternatives(Literal(U"ab") + LineEnd() | OneOrMore(digit) + LineEnd());
+        REQUIRE(alternatives.IsEndAnchored() == true);
+        REQUIRE(alternatives.Search(U"xab", span) == true);
+        REQUIRE(span.begin == 1);
+        /* "$" also holds before a newline */
+        REQUIRE(searcher.Search(U"a 12\nb 345", span) == true);
+        REQUIRE(span.begin == 2);
+        REQUIRE(span.end == 4);
+    }
+    SECTION("Test Reverse Suffix Search")
+    {
+        ReverseSearcher searcher(OneOrMore(letter) + Literal(U"@example.com"));
+        REQUIRE(searcher.IsEndAnchored() == false);
+        REQUIRE(searcher.Suffix() == U"@example.com");
+        REQUIRE(searcher.Search(U"to: 42@example.com, bob@example.com", span) == true);
+        REQUIRE(span.begin == 20);
+        REQUIRE(span.end == 35);
+        REQUIRE(searcher.Search(U"to: @example.com", span) == false);
+        /* a later occurrence of the suffix can end a match starting further left */
+        auto exp = (Symbol(U'<') + letter->Many() + Symbol(U'!') | Symbol(U'k')) + Literal(U"!!");
+        ReverseSearcher overlapping(exp);
+        REQUIRE(overlapping.Suffix() == U"!!");
+        u32string str = U"x<ak!!!";
+        REQUIRE(overlapping.Search(str, span) == true);
+        REQUIRE(span.begin == 1);
+        REQUIRE(span.end == 7);
+        DFAMatrix matrix = exp->Compile();
+        FindIter iter(matrix, str);
+        MatchSpan expected;
+        REQUIRE(iter.Next(expected) == true);
+        REQUIRE(expected.begin == span.begin);
+        REQUIRE(expected.end == span.end);
+    }
+    SECTION("Test Match Starts")
+    {
+        ReverseSearcher searcher(OneOrMore(digit) + Optional(Symbol(U'.') + OneOrMore(digit)));
+        REQUIRE(searcher.Suffix().empty() == true);
+        u32string str = U"pi 3.14!";
+        REQUIRE(searcher.MatchStart(str, 7) == 3);
+        REQUIRE(searcher.MatchStart(str, 4) == 3);
+        REQUIRE(searcher.MatchStart(str, 2) == SIZE_MAX);
+        ReverseSearcher word(WordBoundary() + OneOrMore(letter));
+        REQUIRE(word.MatchStart(U"ab cd", 4) == 3);
+        REQUIRE(word.MatchStart(U"ab cd", 1) == 0);
+        REQUIRE(searcher.Search(str, span) == true);
+        REQUIRE(span.begin == 3);
+        REQUIRE(span.end == 7);
+    }
+    SECTION("Test Searching Like FindIter")
+    {
+        vector<RegularExpression::Ptr> exps = {Class(CharClass::Any())->Many() + Symbol(U'y') + LineEnd(),
+                                               LineBegin() + Symbol(U'a')->Many() + LineEnd(),
+                                               WordBoundary() + OneOrMore(letter) + Literal(U"xy"),
+                                               (Symbol(U'a') | Literal(U"bxa")) + Literal(U"xa")};
+        std::mt19937 random(7);
+        const u32string alphabet = U"abxy \n";
+        for (const auto &exp : exps)
+        {
+            ReverseSearcher searcher(exp);
+            DFAMatrix matrix = exp->Compile();
+            REQUIRE((searcher.IsEndAnchored() || !searcher.Suffix().empty()) == true);
+            for (int t = 0; t < 200; t++)
+            {
+                u32string str;
+                for (size_t n = random() % 16, i = 0; i < n; i++)
+                {
+                    str += alphabet[random() % alphabet.size()];
+                }
+                FindIter iter(matrix, str);
+                MatchSpan expected;
+                bool found = iter.Next(expected);
+                REQUIRE(searcher.Search(str, span) == found);
+                if (found)
+                {
+                    REQUIRE(span.begin == expected.begin);
+                    REQUIRE(span.end == expected.end);
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <iomanip>
 #include <iostream>
 
+#include "FindIter.hpp"
 #include "NFA.hpp"
 #include "REJsonSerializer.hpp"
 #include <catch2/catch.hpp>
@@ -22,4 +23,56 @@ TEST_CASE("Test Searching", "[DFAMatrix]")
         REQUIRE(matrixSunset.Search(s.begin(), s.end()) == s.begin());
         REQUIRE(matrixAutumnWater.Search(s.begin(), s.end()) == s.begin() + 8);
     }
+}
+
+TEST_CASE("Test Assertions", "[DFAMatrix]")
+{
+    auto letter = Range(U'a', U'z');
+
+    SECTION("Test Line Anchors")
+    {
+        auto matrix = (LineBegin() + Literal(U"ab"))->Compile();
+        u32string s = U"xab\nab";
+        REQUIRE(matrix.HasAssertions() == true);
+        REQUIRE(matrix.Search(s.begin(), s.end()) == s.begin() + 4);
+        /* Match takes the start of the range as the start of the text */
+        REQUIRE(matrix.Match(s.begin() + 1, s.end(), true) == 2);
+        REQUIRE(matrix.Count(U"ab\nab\nxab") == 2);
+
+        auto lineEnd = (Literal(U"ab") + LineEnd())->Compile();
+        u32string t = U"abx\nab\n";
+        REQUIRE(lineEnd.Search(t.begin(), t.end()) == t.begin() + 4);
+        REQUIRE(lineEnd.FullMatch(U"ab") == true);
+        REQUIRE(lineEnd.FullMatch(U"ab\n") == false);
+        /* "$" does not look behind, so the states are not told apart by the context behind */
+        REQUIRE(lineEnd.StateCount() == Literal(U"ab")->Compile().StateCount());
+        REQUIRE((Symbol(U'\n') + LineBegin() + Symbol(U'b'))->Compile().FullMatch(U"\nb") == true);
+
+        auto emptyLine = (LineBegin() + LineEnd())->Compile();
+        u32string u = U"a\n\nb";
+        REQUIRE(emptyLine.Search(u.begin(), u.end()) == u.begin() + 2);
+        REQUIRE(emptyLine.IsMatch(U"ab") == false);
+        REQUIRE(emptyLine.IsMatch(U"") == true);
+        REQUIRE((Literal(U"ab") + LineEnd())->Compile().HasAssertions() == true);
+        REQUIRE(Literal(U"ab")->Compile().HasAssertions() == false);
+    }
+    SECTION("Test Word Boundaries")
+    {
+        auto word = (WordBoundary() + Literal(U"cat") + WordBoundary())->Compile();
+        u32string s = U"cat concat cat_ cat.";
+        REQUIRE(word.Count(s) == 2);
+        FindIter iter(word, s);
+        MatchSpan span;
+        REQUIRE(iter.Next(span) == true);
+        REQUIRE(span.begin == 0);
+        REQUIRE(iter.Next(span) == true);
+        REQUIRE(span.begin == 16);
+        REQUIRE(span.end == 19);
+        REQUIRE(iter.Next(span) == false);
+        REQUIRE((NotWordBoundary() + Literal(U"cat"))->Compile().Count(s) == 1);
+        /* the empty matches of "\b" are the edges of the words */
+        REQUIRE(WordBoundary()->Compile().Count(U"ab cd") == 4);
+        REQUIRE((OneOrMore(letter) + WordBoundary())->Compile().FullMatch(U"abc") == true);
+        REQUIRE(UnicodeRange(RangeType::WordBoundary, 0, 0).ToString() == U"\\b");
+    }
 }
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "Simplifier.hpp"
+#include <catch2/catch.hpp>
+
+using std::make_shared;
+using namespace regex::notations;
+
+TEST_CASE("Test Simplifier", "[Simplifier]")
+{
+    RegularExpressionEqual equal;
+    SECTION("Test Flattening and Duplicates")
+    {
+        auto nested = make_shared<AlternationExpression>(
+            Literal(U"ab"), make_shared<AlternationExpression>(Literal(U"cd"), Literal(U"ab")));
+        REQUIRE(equal(Simplify(nested), Literal(U"ab") | Literal(U"cd")) == true);
+
+        auto concatenation = make_shared<ConcatenationExpression>(Literal(U"ab"), Literal(U"cd"));
+        REQUIRE(equal(Simplify(concatenation), Literal(U"abcd")) == true);
+    }
+    SECTION("Test Merging Characters")
+    {
+        auto digits = Symbol(U'0') | Range(U'1', U'5') | Range(U'3', U'9');
+        REQUIRE(equal(Simplify(digits), Range(U'0', U'9')) == true);
+
+        auto word = Range(U'a', U'z') | Literal(U"--") | Symbol(U'_');
+        REQUIRE(equal(Simplify(word), Class(CharClass({{U'a', U'z'}, {U'_', U'_'}})) | Literal(U"--")) == true);
+    }
+    SECTION("Test Factoring Prefixes")
+    {
+        auto keywords = Literal(U"abc") | Literal(U"abd") | Literal(U"ab") | Literal(U"x");
+        auto expected = (Literal(U"ab") + Optional(Range(U'c', U'd'))) | Symbol(U'x');
+        REQUIRE(equal(Simplify(keywords), expected) == true);
+
+        auto matrix = keywords->Compile();
+        REQUIRE(matrix.FullMatch(U"ab") == true);
+        REQUIRE(matrix.FullMatch(U"abd") == true);
+        REQUIRE(matrix.FullMatch(U"abe") == false);
+        REQUIRE(matrix.FullMatch(U"x") == true);
+    }
+    SECTION("Test Collapsing Stars")
+    {
+        auto a = Symbol(U'a');
+        REQUIRE(equal(Simplify(a->Many()->Many()), a->Many()) == true);
+        REQUIRE(equal(Simplify(a->Many() + a->Many()), a->Many()) == true);
+        REQUIRE(equal(Simplify(Optional(a)->Many()), a->Many()) == true);
+        REQUIRE(equal(Simplify(Repeat(a->Many(), 2, 5)), a->Many()) == true);
+        REQUIRE(equal(Simplify(Repeat(a->Many(), 0, 0)), Repeat(a->Many(), 0, 0)) == true);
+    }
+    SECTION("Test Unchanged Trees Are Shared")
+    {
+        auto e = (Literal(U"ab") | Literal(U"cd"))->Many() + Symbol(U'e');
+        REQUIRE(Simplify(e) == e);
+    }
+    SECTION("Test Fewer NFA States")
+    {
+        vector<u32string> words = {U"interface", U"internal", U"interval", U"intern", U"into", U"int"};
+        RegularExpression::Ptr e = Literal(words.front());
+        for (size_t i = 1; i < words.size(); i++)
+        {
+            e = e | Literal(words[i]);
+        }
+        NFA original(e);
+        NFA simplified(Simplify(e));
+        REQUIRE(simplified.G.NodeCount() < original.G.NodeCount());
+
+        auto matrix = e->Compile();
+        for (const auto &word : words)
+        {
+            REQUIRE(matrix.FullMatch(word) == true);
+        }
+        REQUIRE(matrix.FullMatch(U"inter") == false);
+        REQUIRE(matrix.FullMatch(U"intervals") == false);
+    }
+}
\ No newline at end of file
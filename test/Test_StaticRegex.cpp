@@ -0,0 +1,63 @@
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "StaticRegex.hpp"
+#include <catch2/catch.hpp>
+
+namespace static_patterns
+{
+    using namespace regex::static_notations;
+
+    constexpr auto staticMethod = Literal(U"GET") | Literal(U"HEAD") | Literal(U"POST") | Literal(U"PUT") | Literal(U"DELETE");
+    constexpr auto staticRequestLine = staticMethod + Symbol(U' ') + OneOrMore(Range(U'!', U'~')) + Symbol(U' ') +
+                                       Literal(U"HTTP/") + Range(U'0', U'9') + Symbol(U'.') + Range(U'0', U'9');
+    constexpr auto staticHexByte = Literal(U"0x") + Repeat<1, 2>(Range(U'0', U'9') | Range(U'a', U'f'));
+    constexpr auto staticEmpty = Literal(U"");
+
+    using RequestLine = regex::StaticRegex<staticRequestLine>;
+    using HexByte = regex::StaticRegex<staticHexByte>;
+    using Empty = regex::StaticRegex<staticEmpty>;
+
+    /* the matchers are built and run during the compilation */
+    static_assert(RequestLine::FullMatch(U"GET /index.html HTTP/1.1"), "a request line");
+    static_assert(!RequestLine::FullMatch(U"GET /index.html HTTP/1"), "not a request line");
+    static_assert(HexByte::Match(U"0xff0", true) == 4, "the longest match");
+} // namespace static_patterns
+
+using static_patterns::Empty;
+using static_patterns::HexByte;
+using static_patterns::RequestLine;
+
+using namespace regex::notations;
+
+TEST_CASE("Test Static Regex", "[StaticRegex]")
+{
+    SECTION("Test the Same Results as the Runtime Compiler")
+    {
+        auto method = Literal(U"GET") | Literal(U"HEAD") | Literal(U"POST") | Literal(U"PUT") | Literal(U"DELETE");
+        auto e = method + Symbol(U' ') + OneOrMore(Range(U'!', U'~')) + Symbol(U' ') + Literal(U"HTTP/") +
+                 Range(U'0', U'9') + Symbol(U'.') + Range(U'0', U'9');
+        DFAMatrix matrix = e->Compile();
+        vector<u32string> lines = {U"GET /index.html HTTP/1.1", U"DELETE /users/42 HTTP/2.0", U"HEAD / HTTP/1.0",
+                                   U"GET  HTTP/1.1",           U"PATCH /x HTTP/1.1",         U"PUT /ünicode HTTP/1.1",
+                                   U"GET /a HTTP/1.1 trailing", U"x GET /a HTTP/1.1",        U""};
+        for (const auto &line : lines)
+        {
+            REQUIRE(RequestLine::FullMatch(line) == matrix.FullMatch(line));
+            REQUIRE(RequestLine::Match(line, true) == matrix.Match(line.begin(), line.end(), true));
+            REQUIRE(RequestLine::Match(line, false) == matrix.Match(line.begin(), line.end(), false));
+            REQUIRE(RequestLine::Search(line) == static_cast<size_t>(matrix.Search(line.begin(), line.end()) - line.begin()));
+        }
+    }
+    SECTION("Test Repetitions and Empty Patterns")
+    {
+        REQUIRE(HexByte::FullMatch(U"0x7") == true);
+        REQUIRE(HexByte::FullMatch(U"0x7f") == true);
+        REQUIRE(HexByte::FullMatch(U"0x7f0") == false);
+        REQUIRE(HexByte::FullMatch(U"0x") == false);
+        REQUIRE(HexByte::Search(U"= 0x7") == 2);
+        REQUIRE(Empty::FullMatch(U"") == true);
+        REQUIRE(Empty::Match(U"abc", true) == 0);
+        REQUIRE(Empty::STATE_COUNT == 1);
+        REQUIRE(RequestLine::STATE_COUNT < 64);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "REJsonSerializer.hpp"
+#include "StreamReplacer.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+/* feed the string in chunks of the given size and collect the result */
+static u32string Stream(StreamReplacer &replacer, const u32string &str, size_t chunkSize)
+{
+    u32string out;
+    for (size_t i = 0; i < str.size(); i += chunkSize)
+    {
+        replacer.Write(str.substr(i, chunkSize), out);
+    }
+    replacer.Finish(out);
+    return out;
+}
+
+TEST_CASE("Test Stream Replacer", "[StreamReplacer]")
+{
+    auto digit = Range(U'0', U'9');
+
+    SECTION("Test Agreement With ReplaceAll")
+    {
+        vector<std::pair<RegularExpression::Ptr, u32string>> cases = {
+            {Repeat(digit, 3, 3) + Symbol(U'-') + Repeat(digit, 4, 4), U"call 555-1234 or 555-12345, not 55-1234"},
+            {Literal(U"aba"), U"ababababa abba aba"},
+            {Symbol(U'a')->Many(), U"baab b"},
+            {OneOrMore(Symbol(U'x')) + Optional(Literal(U"yz")), U"xxxy xyz xxyzyz yz"},
+            {LineBegin() + OneOrMore(digit), U"12 34\n56 7\n\n8"},
+            {OneOrMore(digit) + LineEnd(), U"12 34\n56 7\n\n8"},
+            {WordBoundary() + Literal(U"is") + WordBoundary(), U"this is his island, is"},
+            {NotWordBoundary(), U"ab, c"},
+        };
+        ReplaceTemplate tmpl(U"<$0>");
+        for (const auto &[exp, str] : cases)
+        {
+            DFAMatrix matrix = exp->Compile();
+            u32string expected;
+            size_t count = ReplaceAll(matrix, str, tmpl, expected);
+            for (size_t chunkSize : {size_t{1}, size_t{2}, size_t{3}, size_t{7}, str.size()})
+            {
+                StreamReplacer replacer(matrix, tmpl);
+                REQUIRE(Stream(replacer, str, chunkSize) == expected);
+                REQUIRE(replacer.ReplacedCount() == count);
+            }
+        }
+    }
+    SECTION("Test Bounded Buffering")
+    {
+        DFAMatrix matrix = (Literal(U"SSN:") + Repeat(digit, 9, 9))->Compile();
+        StreamReplacer replacer(matrix, ReplaceTemplate(U"SSN:#########"));
+        u32string out;
+        replacer.Write(U"id 7, SSN:1234", out);
+        /* only the tentative match is held back */
+        REQUIRE(out == U"id 7, ");
+        REQUIRE(replacer.BufferedSize() == 8);
+        replacer.Write(U"56789 and SSN:12", out);
+        REQUIRE(out == U"id 7, SSN:######### and ");
+        replacer.Write(U"x", out);
+        REQUIRE(replacer.BufferedSize() == 0);
+        replacer.Finish(out);
+        REQUIRE(out == U"id 7, SSN:######### and SSN:12x");
+        /* the replacer takes a new stream after Finish */
+        out.clear();
+        replacer.Write(U"SSN:000000000", out);
+        replacer.Finish(out);
+        REQUIRE(out == U"SSN:#########");
+        REQUIRE(replacer.ReplacedCount() == 2);
+    }
+    SECTION("Test Invalid Matchers")
+    {
+        DFAMatrix matrix = digit->Compile();
+        REQUIRE_THROWS_AS(StreamReplacer(matrix, ReplaceTemplate(U"$1")), std::invalid_argument);
+        DFAMatrix empty;
+        StreamReplacer passThrough(empty, ReplaceTemplate(U"x"));
+        REQUIRE(Stream(passThrough, U"abc", 2) == U"abc");
+    }
+}
\ No newline at end of file
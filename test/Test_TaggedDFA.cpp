@@ -0,0 +1,126 @@
+#include "REJsonSerializer.hpp"
+#include "TaggedDFA.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+static u32string Group(const u32string &str, const Submatch &group)
+{
+    return str.substr(group.begin, group.end - group.begin);
+}
+
+TEST_CASE("Test Tagged DFA", "[TaggedDFA]")
+{
+    vector<Submatch> groups;
+
+    SECTION("Test Field Extraction")
+    {
+        auto digit = Range(U'0', U'9');
+        auto letter = Range(U'a', U'z');
+        TaggedDFA tdfa(Capture(OneOrMore(letter), 1) + Symbol(U'=') + Capture(OneOrMore(digit), 2));
+        REQUIRE(tdfa.GroupCount() == 3);
+        u32string str = U"size=1024";
+        REQUIRE(tdfa.FullMatch(str, groups) == true);
+        REQUIRE(groups.size() == 3);
+        REQUIRE(groups[0].begin == 0);
+        REQUIRE(groups[0].end == 9);
+        REQUIRE(Group(str, groups[1]) == U"size");
+        REQUIRE(Group(str, groups[2]) == U"1024");
+        REQUIRE(tdfa.FullMatch(U"size=", groups) == false);
+        REQUIRE(groups[1].begin == -1);
+    }
+    SECTION("Test Leftmost Greedy Groups")
+    {
+        auto a = Symbol(U'a');
+        /* (a*)(a*): the first group takes everything */
+        TaggedDFA greedy(Capture(a->Many(), 1) + Capture(a->Many(), 2));
+        REQUIRE(greedy.FullMatch(U"aaa", groups) == true);
+        REQUIRE(groups[1].begin == 0);
+        REQUIRE(groups[1].end == 3);
+        REQUIRE(groups[2].begin == 3);
+        REQUIRE(groups[2].end == 3);
+        /* (a|ab)(c|bcd)(d*): the first alternative wins when both reach the end */
+        TaggedDFA alternatives(Capture(Symbol(U'a') | Literal(U"ab"), 1) + Capture(Symbol(U'c') | Literal(U"bcd"), 2) +
+                               Capture(Symbol(U'd')->Many(), 3));
+        u32string str = U"abcd";
+        REQUIRE(alternatives.FullMatch(str, groups) == true);
+        REQUIRE(Group(str, groups[1]) == U"a");
+        REQUIRE(Group(str, groups[2]) == U"bcd");
+        REQUIRE(Group(str, groups[3]) == U"");
+    }
+    SECTION("Test Repeated and Optional Groups")
+    {
+        /* a group in a repetition reports its last iteration */
+        TaggedDFA repeated(OneOrMore(Capture(Range(U'a', U'z') + Range(U'0', U'9'), 1)));
+        u32string str = U"a1b2c3";
+        REQUIRE(repeated.FullMatch(str, groups) == true);
+        REQUIRE(Group(str, groups[1]) == U"c3");
+        /* a group which is skipped stays unmatched, and an unused number is never matched */
+        TaggedDFA optional(Symbol(U'x') + Optional(Capture(Symbol(U'y'), 3)) + Symbol(U'z'));
+        REQUIRE(optional.GroupCount() == 4);
+        REQUIRE(optional.FullMatch(U"xz", groups) == true);
+        REQUIRE(groups[3].begin == -1);
+        REQUIRE(groups[1].begin == -1);
+        REQUIRE(optional.FullMatch(U"xyz", groups) == true);
+        REQUIRE(groups[3].begin == 1);
+        REQUIRE(groups[3].end == 2);
+        /* bounded repetitions copy the groups */
+        TaggedDFA bounded(Repeat(Capture(Symbol(U'a') | Symbol(U'b'), 1), 2, 3) + Capture(Symbol(U'b')->Many(), 2));
+        str = U"abbb";
+        REQUIRE(bounded.FullMatch(str, groups) == true);
+        REQUIRE(groups[1].begin == 2);
+        REQUIRE(Group(str, groups[2]) == U"b");
+    }
+    SECTION("Test Longest Match and Search")
+    {
+        auto word = OneOrMore(Range(U'a', U'z'));
+        TaggedDFA tdfa(Capture(word, 1) + Optional(Symbol(U'@') + Capture(word, 2)));
+        u32string str = U"12 mail@host, x";
+        REQUIRE(tdfa.Match(str, groups) == false);
+        REQUIRE(tdfa.Search(str, groups) == true);
+        REQUIRE(groups[0].begin == 3);
+        REQUIRE(groups[0].end == 12);
+        REQUIRE(Group(str, groups[1]) == U"mail");
+        REQUIRE(Group(str, groups[2]) == U"host");
+        REQUIRE(tdfa.Match(U"mail@", groups) == true);
+        REQUIRE(groups[0].end == 4);
+        REQUIRE(groups[2].begin == -1);
+        REQUIRE(tdfa.Search(U"123", groups) == false);
+        /* the span comes from the DFA matrix, and only the match is read by the tagged DFA */
+        u32string text(100000, U' ');
+        text.replace(90000, 9, U"mail@host");
+        REQUIRE(tdfa.Search(text, groups) == true);
+        REQUIRE(groups[1].begin == 90000);
+        REQUIRE(groups[2].end == 90009);
+        TaggedDFA empty(Capture(Symbol(U'a')->Many(), 1));
+        REQUIRE(empty.Search(U"xyz", groups) == true);
+        REQUIRE(groups[0].begin == 0);
+        REQUIRE(groups[1].end == 0);
+    }
+    SECTION("Test Membership")
+    {
+        TaggedDFA tdfa(Capture(Literal(U"ab") | Symbol(U'a'), 1)->Many() + Capture(OneOrMore(Symbol(U'b')), 2));
+        for (u32string str : {U"b", U"ab", U"abb", U"aab", U"abab", U"bbb", U"abababb"})
+        {
+            REQUIRE(tdfa.FullMatch(str, groups) == true);
+        }
+        for (u32string str : {U"", U"a", U"aba", U"bab"})
+        {
+            REQUIRE(tdfa.FullMatch(str, groups) == false);
+        }
+        u32string str = U"ababb";
+        REQUIRE(tdfa.FullMatch(str, groups) == true);
+        REQUIRE(Group(str, groups[1]) == U"ab");
+        REQUIRE(Group(str, groups[2]) == U"b");
+    }
+    SECTION("Test Invalid Expressions")
+    {
+        REQUIRE_THROWS_AS(Capture(Symbol(U'a'), 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(TaggedDFA(LineBegin() + Capture(Symbol(U'a'), 1)), std::invalid_argument);
+        TaggedDFA plain(Literal(U"abc"));
+        REQUIRE(plain.GroupCount() == 1);
+        REQUIRE(plain.Search(U"xxabcx", groups) == true);
+        REQUIRE(groups[0].begin == 2);
+        REQUIRE(groups[0].end == 5);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "NFA.hpp"
+#include "REJsonSerializer.hpp"
+#include "UnicodeProperties.hpp"
+#include <catch2/catch.hpp>
+
+using namespace regex::notations;
+
+TEST_CASE("Test Unicode Properties", "[UnicodeProperties]")
+{
+    SECTION("Test Property Classes")
+    {
+        REQUIRE(UnicodePropertyClass("Lu").Contains(U'Q') == true);
+        REQUIRE(UnicodePropertyClass("Lu").Contains(U'q') == false);
+        REQUIRE(UnicodePropertyClass("L").Contains(U'é') == true);
+        REQUIRE(UnicodePropertyClass("Letter").Contains(U'中') == true);
+        REQUIRE(UnicodePropertyClass("Nd").Contains(U'٣') == true);
+        REQUIRE(UnicodePropertyClass("gc=Decimal_Number").Contains(U'x') == false);
+        REQUIRE(UnicodePropertyClass("Han").Contains(U'霞') == true);
+        REQUIRE(UnicodePropertyClass("Script=Hani").Contains(U'か') == false);
+        REQUIRE(UnicodePropertyClass("sc=Hiragana").Contains(U'か') == true);
+        REQUIRE(UnicodePropertyClass("greek").Contains(U'λ') == true);
+        REQUIRE(UnicodePropertyClass("cased letter") == UnicodePropertyClass("Lu").Union(UnicodePropertyClass("Ll")).Union(UnicodePropertyClass("Lt")));
+        REQUIRE(UnicodePropertyClass("Assigned").Contains(0x10FFFF) == false);
+        REQUIRE(UnicodePropertyClass("Any") == CharClass::Any());
+        REQUIRE_THROWS_AS(UnicodePropertyClass("Klingon"), std::invalid_argument);
+        REQUIRE_THROWS_AS(UnicodePropertyClass("Block=Basic_Latin"), std::invalid_argument);
+    }
+    SECTION("Test Matching Properties")
+    {
+        auto han = OneOrMore(Property("Han"));
+        auto matrix = han->Compile();
+        u32string s = U"落霞与孤鹜齐飞，秋水共长天一色。";
+
+        REQUIRE(matrix.Match(s.begin(), s.end(), true) == 7);
+        REQUIRE(matrix.Match(s.begin() + 7, s.end(), true) == -1);
+        REQUIRE(matrix.Search(s.begin() + 7, s.end()) == s.begin() + 8);
+
+        auto identifier = Property("L") + (Property("L") | Property("Nd") | Symbol(U'_'))->Many();
+        auto identifierMatrix = identifier->Compile();
+        REQUIRE(identifierMatrix.FullMatch(U"变量_1") == true);
+        REQUIRE(identifierMatrix.FullMatch(U"Δx٣") == true);
+        REQUIRE(identifierMatrix.FullMatch(U"1abc") == false);
+    }
+    SECTION("Test a Property Is a Single Transition")
+    {
+        NFA nfa(Property("L"));
+
+        REQUIRE(nfa.G.NodeCount() == 2);
+        REQUIRE(nfa.patterns.Size() == 2);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef HTTP_REQUEST_LINE_HPP
+#define HTTP_REQUEST_LINE_HPP
+#include "RegularExpression.hpp"
+
+/**
+ * HttpRequestLine
+ *
+ * The expression of an HTTP request line. Its image is saved during the build and turned into the
+ * generated matcher of the code generation test.
+ *
+ * @return {RegularExpression::Ptr} : the expression
+ */
+inline regex::RegularExpression::Ptr HttpRequestLine()
+{
+    using namespace regex::notations;
+    auto method = Literal(U"GET") | Literal(U"HEAD") | Literal(U"POST") | Literal(U"PUT") | Literal(U"DELETE");
+    return method + Symbol(U' ') + OneOrMore(Range(U'!', U'~')) + Symbol(U' ') + Literal(U"HTTP/") +
+           Range(U'0', U'9') + Symbol(U'.') + Range(U'0', U'9');
+}
+#endif // HTTP_REQUEST_LINE_HPP
\ No newline at end of file
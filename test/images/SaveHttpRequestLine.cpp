@@ -0,0 +1,34 @@
+#include "DFA.hpp"
+#include "images/HttpRequestLine.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * SaveHttpRequestLine <image>
+ *
+ * Compile the expression of an HTTP request line and save its DFA matrix image, in the byte order and
+ * the image version of the build.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <image>" << std::endl;
+        return 2;
+    }
+    else
+    {
+        // pass
+    }
+    try
+    {
+        HttpRequestLine()->Compile().Save(argv[1]);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << argv[0] << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "CodeGenerator.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * RegexCodegen <image> <name> <output> [namespace]
+ *
+ * Read a DFA matrix saved by DFAMatrix::Save and write a header with an equivalent generated matcher.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc != 4 && argc != 5)
+    {
+        std::cerr << "usage: " << argv[0] << " <image> <name> <output> [namespace]" << std::endl;
+        return 2;
+    }
+    else
+    {
+        // pass
+    }
+    try
+    {
+        auto matrix = regex::DFAMatrix::Load(argv[1]);
+        regex::CppCodeGenerator generator(matrix, argv[2], argc == 5 ? argv[4] : "generated");
+        std::ofstream out(argv[3], std::ios::binary);
+        out << generator.Generate();
+        if (!out)
+        {
+            throw std::runtime_error(std::string("cannot write ") + argv[3]);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << argv[0] << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
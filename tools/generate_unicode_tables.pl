@@ -0,0 +1,95 @@
+#!/usr/bin/env perl
+# Generates src/UnicodeTables.cpp from the Unicode Character Database shipped with Perl.
+#
+# Usage: perl tools/generate_unicode_tables.pl > src/UnicodeTables.cpp
+#
+# Every property is stored as runs: a run starts at "first" and extends to the start of the
+# next run, and all the code points of a run have the same property value.
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap prop_value_aliases);
+
+sub emit_property
+{
+    my ($prefix, $property, $aliasProperty) = @_;
+    my ($starts, $values) = prop_invmap($property);
+    my %ids;
+    my @names;
+    for my $value (sort @$values)
+    {
+        next if exists $ids{$value};
+        $ids{$value} = scalar @names;
+        my @aliases = prop_value_aliases($aliasProperty, $value);
+        my ($short, $long) = @aliases ? @aliases[0, 1] : ($value, $value);
+        push @names, [$short, $long];
+    }
+    die "too many values of $property" if @names > 256;
+
+    print "    const char *const ${prefix}_NAMES[][2] = {\n";
+    print "        {\"$_->[0]\", \"$_->[1]\"},\n" for @names;
+    print "    };\n";
+    print "    const size_t ${prefix}_COUNT = " . scalar(@names) . ";\n\n";
+
+    my @runs;
+    for my $i (0 .. $#$starts)
+    {
+        next if $starts->[$i] > 0x10FFFF;
+        push @runs, sprintf("{0x%X, %d}", $starts->[$i], $ids{$values->[$i]});
+    }
+    print "    const UnicodeRun ${prefix}_RUNS[] = {\n";
+    for (my $i = 0; $i < @runs; $i += 6)
+    {
+        my $last = $i + 5 < $#runs ? $i + 5 : $#runs;
+        print "        " . join(", ", @runs[$i .. $last]) . ",\n";
+    }
+    print "    };\n";
+    print "    const size_t ${prefix}_RUN_COUNT = " . scalar(@runs) . ";\n";
+}
+
+# The code points equal under simple case folding form an orbit, stored as a cycle: every member
+# points to the next larger member, and the largest one to the smallest.
+sub emit_case_orbits
+{
+    my ($starts, $maps) = prop_invmap("Simple_Case_Folding");
+    my %orbits;
+    for my $i (0 .. $#$starts)
+    {
+        next if $maps->[$i] == 0;
+        my $last = $i < $#$starts ? $starts->[$i + 1] - 1 : 0x10FFFF;
+        for my $c ($starts->[$i] .. $last)
+        {
+            my $folded = $maps->[$i] + $c - $starts->[$i];
+            $orbits{$folded}{$folded} = 1;
+            $orbits{$folded}{$c} = 1;
+        }
+    }
+    my %next;
+    for my $orbit (values %orbits)
+    {
+        my @members = sort { $a <=> $b } keys %$orbit;
+        for my $k (0 .. $#members)
+        {
+            $next{$members[$k]} = $members[($k + 1) % @members];
+        }
+    }
+    my @pairs = map { sprintf("{0x%X, 0x%X}", $_, $next{$_}) } sort { $a <=> $b } keys %next;
+    print "    const UnicodeCaseOrbit CASE_ORBITS[] = {\n";
+    for (my $i = 0; $i < @pairs; $i += 6)
+    {
+        my $last = $i + 5 < $#pairs ? $i + 5 : $#pairs;
+        print "        " . join(", ", @pairs[$i .. $last]) . ",\n";
+    }
+    print "    };\n";
+    print "    const size_t CASE_ORBIT_COUNT = " . scalar(@pairs) . ";\n";
+}
+
+print "// Generated by tools/generate_unicode_tables.pl. Do not edit.\n";
+print "#include \"UnicodeTables.hpp\"\n\n";
+print "namespace regex\n{\n";
+print "    const char *const UNICODE_VERSION = \"" . Unicode::UCD::UnicodeVersion() . "\";\n\n";
+emit_property("GENERAL_CATEGORY", "General_Category", "gc");
+print "\n";
+emit_property("SCRIPT", "Script", "sc");
+print "\n";
+emit_case_orbits();
+print "} // namespace regex";